@@ -44,6 +44,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <memory>
+#include <array>
 
 #include "boost/numeric/odeint.hpp"
 #include "boost/range/algorithm.hpp"
@@ -53,6 +54,10 @@
 #include "transport-runtime/transport.h"
 #include "transport-runtime/models/canonical_model.h"
 #include "transport-runtime/models/odeint_defaults.h"
+#include "transport-runtime/models/stepper_factory.h"
+#include "transport-runtime/models/implicit_system.h"
+#include "transport-runtime/models/rosenbrock_w.h"
+#include "transport-runtime/utilities/taylor_jet.h"
 
 
 // #define CPPTRANSPORT_INSTRUMENT
@@ -248,6 +253,12 @@ namespace transport
 
         void validate_ics(const parameters<number>& p, const flattened_tensor<number>& input, flattened_tensor<number>& output) override;
 
+        $IF{autodiff_check}
+          //! compare derivatives of the potential computed by automatic differentiation with the symbolic
+          //! expressions at the supplied coordinates; returns the largest relative discrepancy
+          number check_autodiff(const parameters<number>& __params, const flattened_tensor<number>& __coords) const;
+        $ENDIF
+
 
         // PARAMETER HANDLING -- implements a 'model' interface
 
@@ -281,6 +292,19 @@ namespace transport
         // calculate the sorted mass spectrum, normalized to H^2 if desired
         void sorted_mass_spectrum(const twopf_db_task<number>* __task, const flattened_tensor<number>& __fields, double __N, bool __norm, flattened_tensor<number>& __M, flattened_tensor<number>& __E) override;
 
+
+        // BATCHED EVALUATION
+
+      protected:
+
+        // evaluate u2, u3 and the sorted mass spectrum over a range of time samples; workspace is local to each call,
+        // so kernels for disjoint ranges of samples can run concurrently
+        void u2_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, const std::vector<double>& __klist, std::vector< std::vector< std::vector<number> > >& __u2, unsigned int __begin, unsigned int __end) override;
+        void u3_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, const std::vector<double>& __k1list, const std::vector<double>& __k2list, const std::vector<double>& __k3list, std::vector< std::vector< std::vector<number> > >& __u3, unsigned int __begin, unsigned int __end) override;
+        void sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, bool __norm, std::vector< std::vector<number> >& __E, unsigned int __begin, unsigned int __end) override;
+
+        bool batch_concurrent() const override { return(true); }
+
         // BACKEND INTERFACE (PARTIAL IMPLEMENTATION -- WE PROVIDE A COMMON BACKGROUND INTEGRATOR)
 
       public:
@@ -603,52 +627,248 @@ namespace transport
 
 
     $IF{!fast}
-      template <typename number, typename StateType>
-      void $MODEL_compute_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
-        {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+      $IF{autodiff}
+        // potential expressed generically in the scalar type, so that it can be evaluated on Taylor jets
+        template <typename number, typename Scalar>
+        Scalar $MODEL_generic_V(const number* __raw_params, const Scalar* __x, number __Mp)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $TEMP_POOL{"const auto $1 = $2;"}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __dV[FIELDS_FLATTEN($a)] = $DV[a]|;
-        }
+            return $POTENTIAL;
+          }
 
 
-      template <typename number, typename StateType>
-      void $MODEL_compute_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
-        {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+        // evaluate the potential together with all its derivatives up to the given order in a single forward-mode sweep
+        template <unsigned int Order, typename number, typename StateType>
+        ad::taylor_jet<number, $NUMBER_FIELDS, Order> $MODEL_jet_V(const number* __raw_params, const StateType& __x, number __Mp)
+          {
+            using __jet_type = ad::taylor_jet<number, $NUMBER_FIELDS, Order>;
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            std::array<__jet_type, $NUMBER_FIELDS> __seeds;
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __seeds[__a] = __jet_type::variable(__x[__a], __a);
+              }
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            return $MODEL_generic_V(__raw_params, __seeds.data(), __Mp);
+          }
 
-          // force unroll to make explicit that we wish to populate array elements
-          __ddV[FIELDS_FLATTEN($a,$b)] = $DDV[ab]|;
-        }
 
+        template <typename number, typename StateType>
+        void $MODEL_compute_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
+          {
+            DEFINE_INDEX_TOOLS
+            const auto __V = $MODEL_jet_V<1>(__raw_params, __x, __Mp);
 
-      template <typename number, typename StateType>
-      void $MODEL_compute_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
-        {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __dV[FIELDS_FLATTEN(__a)] = __V.derivative(__a);
+              }
+          }
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+        template <typename number, typename StateType>
+        void $MODEL_compute_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
+          {
+            DEFINE_INDEX_TOOLS
+            const auto __V = $MODEL_jet_V<2>(__raw_params, __x, __Mp);
 
-          // force unroll to make explicit that we wish to populate array elements
-          __dddV[FIELDS_FLATTEN($a,$b,$c)] = $DDDV[abc]|;
-        }
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                for(unsigned int __b = 0; __b < $NUMBER_FIELDS; ++__b)
+                  {
+                    __ddV[FIELDS_FLATTEN(__a,__b)] = __V.derivative(__a,__b);
+                  }
+              }
+          }
+
+
+        template <typename number, typename StateType>
+        void $MODEL_compute_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
+          {
+            DEFINE_INDEX_TOOLS
+            const auto __V = $MODEL_jet_V<3>(__raw_params, __x, __Mp);
+
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                for(unsigned int __b = 0; __b < $NUMBER_FIELDS; ++__b)
+                  {
+                    for(unsigned int __c = 0; __c < $NUMBER_FIELDS; ++__c)
+                      {
+                        __dddV[FIELDS_FLATTEN(__a,__b,__c)] = __V.derivative(__a,__b,__c);
+                      }
+                  }
+              }
+          }
+
+        $IF{autodiff_check}
+          template <typename number, typename StateType>
+          void $MODEL_symbolic_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
+            {
+              DEFINE_INDEX_TOOLS
+              $RESOURCE_RELEASE
+
+              $RESOURCE_PARAMETERS{__raw_params}
+              $RESOURCE_COORDINATES{__x}
+
+              $TEMP_POOL{"const auto $1 = $2;"}
+
+              // force unroll to make explicit that we wish to populate array elements
+              __dV[FIELDS_FLATTEN($a)] = $DV[a]|;
+            }
+
+
+          template <typename number, typename StateType>
+          void $MODEL_symbolic_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
+            {
+              DEFINE_INDEX_TOOLS
+              $RESOURCE_RELEASE
+
+              $RESOURCE_PARAMETERS{__raw_params}
+              $RESOURCE_COORDINATES{__x}
+
+              $TEMP_POOL{"const auto $1 = $2;"}
+
+              // force unroll to make explicit that we wish to populate array elements
+              __ddV[FIELDS_FLATTEN($a,$b)] = $DDV[ab]|;
+            }
+
+
+          template <typename number, typename StateType>
+          void $MODEL_symbolic_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
+            {
+              DEFINE_INDEX_TOOLS
+              $RESOURCE_RELEASE
+
+              $RESOURCE_PARAMETERS{__raw_params}
+              $RESOURCE_COORDINATES{__x}
+
+              $TEMP_POOL{"const auto $1 = $2;"}
+
+              // force unroll to make explicit that we wish to populate array elements
+              __dddV[FIELDS_FLATTEN($a,$b,$c)] = $DDDV[abc]|;
+            }
+        $ENDIF
+      $ELSE
+        template <typename number, typename StateType>
+        void $MODEL_compute_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __dV[FIELDS_FLATTEN($a)] = $DV[a]|;
+          }
+
+
+        template <typename number, typename StateType>
+        void $MODEL_compute_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __ddV[FIELDS_FLATTEN($a,$b)] = $DDV[ab]|;
+          }
+
+
+        template <typename number, typename StateType>
+        void $MODEL_compute_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __dddV[FIELDS_FLATTEN($a,$b,$c)] = $DDDV[abc]|;
+          }
+      $ENDIF
+
+
+      $IF{autodiff}
+        // when more than one derivative is needed at the same point, evaluate a single jet of the highest
+        // order required rather than one jet per derivative
+        template <typename number, typename StateType>
+        void $MODEL_compute_derivatives(const number* __raw_params, const StateType& __x, number __Mp,
+                                        number* __dV, number* __ddV)
+          {
+            DEFINE_INDEX_TOOLS
+            const auto __V = $MODEL_jet_V<2>(__raw_params, __x, __Mp);
+
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __dV[FIELDS_FLATTEN(__a)] = __V.derivative(__a);
+
+                for(unsigned int __b = 0; __b < $NUMBER_FIELDS; ++__b)
+                  {
+                    __ddV[FIELDS_FLATTEN(__a,__b)] = __V.derivative(__a,__b);
+                  }
+              }
+          }
+
+
+        template <typename number, typename StateType>
+        void $MODEL_compute_derivatives(const number* __raw_params, const StateType& __x, number __Mp,
+                                        number* __dV, number* __ddV, number* __dddV)
+          {
+            DEFINE_INDEX_TOOLS
+            const auto __V = $MODEL_jet_V<3>(__raw_params, __x, __Mp);
+
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __dV[FIELDS_FLATTEN(__a)] = __V.derivative(__a);
+
+                for(unsigned int __b = 0; __b < $NUMBER_FIELDS; ++__b)
+                  {
+                    __ddV[FIELDS_FLATTEN(__a,__b)] = __V.derivative(__a,__b);
+
+                    for(unsigned int __c = 0; __c < $NUMBER_FIELDS; ++__c)
+                      {
+                        __dddV[FIELDS_FLATTEN(__a,__b,__c)] = __V.derivative(__a,__b,__c);
+                      }
+                  }
+              }
+          }
+      $ELSE
+        // symbolic derivatives are independent expressions, so there is nothing to share between them
+        template <typename number, typename StateType>
+        void $MODEL_compute_derivatives(const number* __raw_params, const StateType& __x, number __Mp,
+                                        number* __dV, number* __ddV)
+          {
+            $MODEL_compute_dV(__raw_params, __x, __Mp, __dV);
+            $MODEL_compute_ddV(__raw_params, __x, __Mp, __ddV);
+          }
+
+
+        template <typename number, typename StateType>
+        void $MODEL_compute_derivatives(const number* __raw_params, const StateType& __x, number __Mp,
+                                        number* __dV, number* __ddV, number* __dddV)
+          {
+            $MODEL_compute_dV(__raw_params, __x, __Mp, __dV);
+            $MODEL_compute_ddV(__raw_params, __x, __Mp, __ddV);
+            $MODEL_compute_dddV(__raw_params, __x, __Mp, __dddV);
+          }
+      $ENDIF
     $ENDIF
 
 
@@ -693,9 +913,48 @@ namespace transport
 
             throw std::out_of_range(msg.str());
           }
+
+        $IF{autodiff_check}
+          // cross-check automatic differentiation against the symbolic derivatives at the initial conditions
+          const auto __discrepancy = this->check_autodiff(__params, __output);
+
+          if(!(__discrepancy <= CPPTRANSPORT_DEFAULT_AUTODIFF_CHECK_TOLERANCE))
+            {
+              std::ostringstream msg;
+
+              msg << CPPTRANSPORT_AUTODIFF_CHECK_FAILED_A << __discrepancy
+                  << CPPTRANSPORT_AUTODIFF_CHECK_FAILED_B << CPPTRANSPORT_DEFAULT_AUTODIFF_CHECK_TOLERANCE << "]";
+
+              throw std::runtime_error(msg.str());
+            }
+        $ENDIF
       }
 
 
+    $IF{autodiff_check}
+      template <typename number>
+      number $MODEL<number>::check_autodiff(const parameters<number>& __params, const flattened_tensor<number>& __coords) const
+        {
+          const auto __Mp = __params.get_Mp();
+          const auto& __pvector = __params.get_vector();
+
+          std::array<number, $NUMBER_FIELDS> __ad_dV, __sym_dV;
+          std::array<number, $NUMBER_FIELDS*$NUMBER_FIELDS> __ad_ddV, __sym_ddV;
+          std::array<number, $NUMBER_FIELDS*$NUMBER_FIELDS*$NUMBER_FIELDS> __ad_dddV, __sym_dddV;
+
+          $MODEL_compute_derivatives(__pvector.data(), __coords, __Mp, __ad_dV.data(), __ad_ddV.data(), __ad_dddV.data());
+
+          $MODEL_symbolic_dV(__pvector.data(), __coords, __Mp, __sym_dV.data());
+          $MODEL_symbolic_ddV(__pvector.data(), __coords, __Mp, __sym_ddV.data());
+          $MODEL_symbolic_dddV(__pvector.data(), __coords, __Mp, __sym_dddV.data());
+
+          return std::max({ ad::relative_discrepancy(__ad_dV, __sym_dV),
+                            ad::relative_discrepancy(__ad_ddV, __sym_ddV),
+                            ad::relative_discrepancy(__ad_dddV, __sym_dddV) });
+        }
+    $ENDIF
+
+
     // Handle parameters
 
 
@@ -706,6 +965,27 @@ namespace transport
 
         if(input.size() == $NUMBER_PARAMS)
           {
+            $IF{specialized}
+              // this variant was translated with fixed parameter values, which have been folded into the
+              // generated code; it gives wrong answers for any other values, so reject them
+              const std::vector<unsigned int> __fixed_index = $SPECIALIZED_PARAM_INDICES;
+              const std::vector<double> __fixed_value = $SPECIALIZED_PARAM_VALUES;
+
+              for(unsigned int __i = 0; __i < __fixed_index.size(); ++__i)
+                {
+                  double __supplied = static_cast<double>(input[__fixed_index[__i]]);
+
+                  if(std::abs(__supplied - __fixed_value[__i]) > CPPTRANSPORT_DEFAULT_SPECIALIZATION_TOLERANCE * std::abs(__fixed_value[__i]))
+                    {
+                      std::ostringstream msg;
+                      msg << CPPTRANSPORT_SPECIALIZED_PARAMS_A << this->get_param_names()[__fixed_index[__i]] << " = " << __fixed_value[__i]
+                          << CPPTRANSPORT_SPECIALIZED_PARAMS_B << __supplied;
+
+                      throw std::invalid_argument(msg.str());
+                    }
+                }
+            $ENDIF
+
             output.assign(input.begin(), input.end());
           }
         else
@@ -931,9 +1211,7 @@ namespace transport
         const auto __a = std::exp(__Ninit - __task->get_N_horizon_crossing() + __task->get_astar_normalization());
 
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __fields, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __fields, __Mp, __ddV);
-          $MODEL_compute_dddV(__raw_params, __fields, __Mp, __dddV);
+          $MODEL_compute_derivatives(__raw_params, __fields, __Mp, __dV, __ddV, __dddV);
         $ENDIF
 
         $TEMP_POOL{"const auto $1 = $2;"}
@@ -1257,8 +1535,7 @@ namespace transport
         $RESOURCE_PARAMETERS{__raw_params}
         $RESOURCE_COORDINATES{__fields}
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __fields, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __fields, __Mp, __ddV);
+          $MODEL_compute_derivatives(__raw_params, __fields, __Mp, __dV, __ddV);
           $RESOURCE_DV{__dV}
           $RESOURCE_DDV{__ddV}
         $ENDIF
@@ -1285,9 +1562,7 @@ namespace transport
         $RESOURCE_PARAMETERS{__raw_params}
         $RESOURCE_COORDINATES{__fields}
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __fields, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __fields, __Mp, __ddV);
-          $MODEL_compute_dddV(__raw_params, __fields, __Mp, __dddV);
+          $MODEL_compute_derivatives(__raw_params, __fields, __Mp, __dV, __ddV, __dddV);
           $RESOURCE_DV{__dV}
           $RESOURCE_DDV{__ddV}
           $RESOURCE_DDDV{__dddV}
@@ -1315,9 +1590,7 @@ namespace transport
         $RESOURCE_PARAMETERS{__raw_params}
         $RESOURCE_COORDINATES{__fields}
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __fields, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __fields, __Mp, __ddV);
-          $MODEL_compute_dddV(__raw_params, __fields, __Mp, __dddV);
+          $MODEL_compute_derivatives(__raw_params, __fields, __Mp, __dV, __ddV, __dddV);
           $RESOURCE_DV{__dV}
           $RESOURCE_DDV{__ddV}
           $RESOURCE_DDDV{__dddV}
@@ -1391,8 +1664,7 @@ namespace transport
         $RESOURCE_PARAMETERS{__raw_params}
         $RESOURCE_COORDINATES{__fields}
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __fields, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __fields, __Mp, __ddV);
+          $MODEL_compute_derivatives(__raw_params, __fields, __Mp, __dV, __ddV);
           $RESOURCE_DV{__dV}
           $RESOURCE_DDV{__ddV}
         $ENDIF
@@ -1458,6 +1730,178 @@ namespace transport
       }
 
 
+    template <typename number>
+    void $MODEL<number>::u2_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                         const std::vector<double>& __Nsample, const std::vector<double>& __klist,
+                                         std::vector< std::vector< std::vector<number> > >& __u2, unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+        const auto __Noffset = __task->get_astar_normalization() - __task->get_N_horizon_crossing();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        $IF{!fast}
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            const auto __a = std::exp(__Nsample[__j] + __Noffset);
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_derivatives(__batch_params.data(), __fields, __Mp, __batch_dV.data(), __batch_ddV.data());
+              $RESOURCE_DV{__batch_dV}
+              $RESOURCE_DDV{__batch_ddV}
+            $ENDIF
+
+            for(unsigned int __n = 0; __n < __klist.size(); ++__n)
+              {
+                const auto __k = __klist[__n];
+                auto& __u2_n = __u2[__n];
+
+                $TEMP_POOL{"const auto $1 = $2;"}
+
+                __u2_n[FLATTEN($A,$B)][__j] = $U2_TENSOR[AB]{__k, __a};
+              }
+          }
+      }
+
+
+    template <typename number>
+    void $MODEL<number>::u3_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                         const std::vector<double>& __Nsample, const std::vector<double>& __k1list,
+                                         const std::vector<double>& __k2list, const std::vector<double>& __k3list,
+                                         std::vector< std::vector< std::vector<number> > >& __u3, unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+        const auto __Noffset = __task->get_astar_normalization() - __task->get_N_horizon_crossing();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        $IF{!fast}
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_dddV($NUMBER_FIELDS * $NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            const auto __a = std::exp(__Nsample[__j] + __Noffset);
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_derivatives(__batch_params.data(), __fields, __Mp, __batch_dV.data(), __batch_ddV.data(), __batch_dddV.data());
+              $RESOURCE_DV{__batch_dV}
+              $RESOURCE_DDV{__batch_ddV}
+              $RESOURCE_DDDV{__batch_dddV}
+            $ENDIF
+
+            for(unsigned int __n = 0; __n < __k1list.size(); ++__n)
+              {
+                const auto __k1 = __k1list[__n];
+                const auto __k2 = __k2list[__n];
+                const auto __k3 = __k3list[__n];
+                auto& __u3_n = __u3[__n];
+
+                $TEMP_POOL{"const auto $1 = $2;"}
+
+                __u3_n[FLATTEN($A,$B,$C)][__j] = $U3_TENSOR[ABC]{__k1, __k2, __k3, __a};
+              }
+          }
+      }
+
+
+    template <typename number>
+    void $MODEL<number>::sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                                           const std::vector<double>& __Nsample, bool __norm, std::vector< std::vector<number> >& __E,
+                                                           unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        flattened_tensor<number> __M($NUMBER_FIELDS * $NUMBER_FIELDS);
+        std::array<number, $NUMBER_FIELDS> __spectrum;
+        Eigen::Matrix<number, $NUMBER_FIELDS, $NUMBER_FIELDS> __batch_mass_matrix;
+        $IF{!fast}
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_derivatives(__batch_params.data(), __fields, __Mp, __batch_dV.data(), __batch_ddV.data());
+              $RESOURCE_DV{__batch_dV}
+              $RESOURCE_DDV{__batch_ddV}
+            $ENDIF
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            __M[FIELDS_FLATTEN($a,$b)] = $M_TENSOR[ab];
+            const auto __Hsq = $HUBBLE_SQ;
+
+            __batch_mass_matrix($a,$b) = __M[FIELDS_FLATTEN($a,$b)];
+
+            // extract eigenvalues from the self-adjoint view, as for mass_spectrum(), and sort them into order
+            auto __evalues = __batch_mass_matrix.template selfadjointView<Eigen::Upper>().eigenvalues();
+
+            for(unsigned int __i = 0; __i < $NUMBER_FIELDS; ++__i)
+              {
+                __spectrum[__i] = __evalues(__i);
+              }
+            std::sort(__spectrum.begin(), __spectrum.end());
+
+            for(unsigned int __i = 0; __i < $NUMBER_FIELDS; ++__i)
+              {
+                __E[__i][__j] = __norm ? __spectrum[__i] / __Hsq : __spectrum[__i];
+              }
+          }
+      }
+
+
     template <typename number>
     void $MODEL<number>::backend_process_backg(const background_task<number>* tk, backg_history<number>& solution, bool silent)
       {
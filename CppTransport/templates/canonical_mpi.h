@@ -134,21 +134,6 @@ namespace transport
         $MODEL_mpi(local_environment& e, argument_cache& a)
           : $MODEL<number>(e, a)
           {
-#ifdef CPPTRANSPORT_INSTRUMENT
-            twopf_setup_timer.stop();
-            twopf_u_tensor_timer.stop();
-            twopf_transport_eq_timer.stop();
-
-            threepf_setup_timer.stop();
-            threepf_u_tensor_timer.stop();
-            threepf_transport_eq_timer.stop();
-
-            twopf_items = 0;
-            threepf_items = 0;
-
-            twopf_invokations = 0;
-            threepf_invokations = 0;
-#endif
           }
 
         // destructor is default unless instrumented
@@ -156,39 +141,8 @@ namespace transport
         //! instrumented destructor
         ~$MODEL_mpi()
           {
-            if(this->twopf_items > 0)
-              {
-                std::cout << '\n' << "TWOPF INSTRUMENTATION REPORT" << '\n';
-                std::cout << "* TOTALS" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user) << " user, " << format_time(twopf_setup_timer.elapsed().system) << " system, " << format_time(twopf_setup_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "* PER ITEM" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_setup_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_setup_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "* PER INVOKATION" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_setup_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_setup_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-              }
-
-            if(this->threepf_items > 0)
-              {
-                std::cout << '\n' << "THREEPF INSTRUMENTATION REPORT" << '\n';
-                std::cout << "* TOTALS" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user) << " user, " << format_time(threepf_setup_timer.elapsed().system) << " system, " << format_time(threepf_setup_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "* PER ITEM" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_setup_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_setup_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "* PER INVOKATION" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_setup_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_setup_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-              }
+            if(this->twopf_profile.get_configurations() > 0) this->twopf_profile.write(std::cout, "TWOPF");
+            if(this->threepf_profile.get_configurations() > 0) this->threepf_profile.write(std::cout, "THREEPF");
           }
 #else
         //! uninstrumented destructor
@@ -215,6 +169,11 @@ namespace transport
         //! return perturbations tolerances
         std::pair< double, double > get_pert_tol() const override { return std::make_pair($PERT_ABS_ERR, $PERT_REL_ERR); }
 
+        $IF{dual_unroll}
+          //! return kernel variants selected by calibration
+          std::string get_kernel_variant() const override { return describe_kernel_variants(this->twopf_variant, this->threepf_variant); }
+        $ENDIF
+
 
         // BACKEND INTERFACE
 
@@ -249,6 +208,10 @@ namespace transport
         //! query whether backend support collection of per-configuration statistics
         virtual bool supports_per_configuration_statistics() const override { return(true); }
 
+        //! integrate a 2pf configuration with a stepper selected at runtime, for benchmarking
+        bool backend_autotune(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk, const stepper_candidate& stepper,
+                              std::vector< std::vector<number> >& samples) override;
+
 
         // INTERNAL API
 
@@ -256,11 +219,13 @@ namespace transport
 
         //! integrate a single 2pf k-configuration
         void twopf_kmode(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk,
-                         twopf_batcher<number>& batcher, unsigned int refinement_level);
+                         twopf_batcher<number>& batcher, unsigned int refinement_level,
+                         const typename integration_items<number>::checkpoint_item* resume = nullptr);
 
         //! integrate a single 3pf k-configuration
         void threepf_kmode(const threepf_kconfig_record&, const threepf_task<number>* tk,
-                           threepf_batcher<number>& batcher, unsigned int refinement_level);
+                           threepf_batcher<number>& batcher, unsigned int refinement_level,
+                           const typename integration_items<number>::checkpoint_item* resume = nullptr);
 
         //! populate initial values for a 2pf configuration
         void populate_twopf_ic(twopf_state& x, unsigned int start, double kmode, double Ninit,
@@ -274,25 +239,33 @@ namespace transport
         void populate_threepf_ic(threepf_state& x, unsigned int start, const threepf_kconfig& kconfig,
                                  double Ninit, const twopf_db_task<number>* tk, const std::vector<number>& ic, double k_normalize=1.0);
 
+        $IF{dual_unroll}
+          //! time the unrolled and rolled 2pf kernels on a representative configuration, and select the faster
+          void calibrate_twopf_kernels(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk, twopf_batcher<number>& batcher);
+
+          //! time the unrolled and rolled 3pf kernels on a representative configuration, and select the faster
+          void calibrate_threepf_kernels(const threepf_kconfig_record& kconfig, const threepf_task<number>* tk, threepf_batcher<number>& batcher);
+        $ENDIF
+
 
         // INTERNAL DATA
 
       private:
 
-#ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer twopf_setup_timer;
-        boost::timer::cpu_timer twopf_u_tensor_timer;
-        boost::timer::cpu_timer twopf_transport_eq_timer;
+        $IF{dual_unroll}
+          //! kernel variant selected for 2pf integrations; empty until calibrated
+          boost::optional<kernel_variant> twopf_variant;
 
-        unsigned int twopf_items;
-        unsigned int twopf_invokations;
+          //! kernel variant selected for 3pf integrations; empty until calibrated
+          boost::optional<kernel_variant> threepf_variant;
+        $ENDIF
 
-        boost::timer::cpu_timer threepf_setup_timer;
-        boost::timer::cpu_timer threepf_u_tensor_timer;
-        boost::timer::cpu_timer threepf_transport_eq_timer;
+#ifdef CPPTRANSPORT_INSTRUMENT
+        //! hot-path profile aggregated over all twopf configurations processed by this model instance
+        hot_path::profile_accumulator twopf_profile;
 
-        unsigned int threepf_items;
-        unsigned int threepf_invokations;
+        //! hot-path profile aggregated over all threepf configurations processed by this model instance
+        hot_path::profile_accumulator threepf_profile;
 #endif
 
       };
@@ -317,10 +290,7 @@ namespace transport
         $MODEL_mpi_twopf_functor(const twopf_db_task<number>* tk, const twopf_kconfig& k
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            boost::timer::cpu_timer& st,
-            boost::timer::cpu_timer& ut,
-            boost::timer::cpu_timer& tt,
-            unsigned int& in
+            hot_path::integration_profile& pf
 #endif
         )
           : __params(tk->get_params()),
@@ -336,13 +306,14 @@ namespace transport
               __ddV(nullptr),
             $ENDIF
 
+            $IF{dual_unroll}
+              __variant(kernel_variant::unrolled),
+            $ENDIF
+
             __raw_params(nullptr)
 #ifdef CPPTRANSPORT_INSTRUMENT
             ,
-                __setup_timer(st),
-                __u_tensor_timer(ut),
-                __transport_eq_timer(tt),
-                __invokations(in)
+                __profile(pf)
 #endif
           {
           }
@@ -375,7 +346,39 @@ namespace transport
             delete[] this->__raw_params;
           }
 
-        void operator()(const twopf_state& __x, twopf_state& __dxdt, number __t);
+        $IF{dual_unroll}
+          //! evaluate the RHS using the kernel variant selected by calibration
+          template <typename State>
+          void operator()(const State& __x, State& __dxdt, number __t)
+            {
+              if(this->__variant == kernel_variant::rolled) this->rhs_rolled(__x, __dxdt, __t);
+              else                                          this->rhs_unrolled(__x, __dxdt, __t);
+            }
+
+          //! evaluate the RHS using the unrolled kernel
+          template <typename State>
+          void rhs_unrolled(const State& __x, State& __dxdt, number __t);
+
+          //! evaluate the RHS using the rolled kernel
+          template <typename State>
+          void rhs_rolled(const State& __x, State& __dxdt, number __t);
+
+          //! select kernel variant used by operator()
+          void set_kernel_variant(kernel_variant v) { this->__variant = v; }
+        $ELSE
+          template <typename State>
+          void operator()(const State& __x, State& __dxdt, number __t);
+        $ENDIF
+
+        $IF{implicit_pert}
+          //! factorize an approximation to I - gamma_h J at (x, t), for use with W-method steppers
+          template <typename State>
+          void prepare_W(const State& __x, number __t, number __gamma_h);
+
+          //! solve (I - gamma_h J) y = r using the factorization computed by prepare_W()
+          template <typename State>
+          void solve_W(const State& __r, State& __y);
+        $ENDIF
 
         // adjust horizon exit time, given an initial time N_init which we wish to move to zero
         void rebase_horizon_exit_time(double N_init) { this->__N_horizon_exit -= N_init; }
@@ -407,13 +410,23 @@ namespace transport
           number* __ddV;
         $ENDIF
 
+        $IF{dual_unroll}
+          //! kernel variant used by operator()
+          kernel_variant __variant;
+        $ENDIF
+
+        $IF{implicit_pert}
+          //! W-method factorizations for the background, tensor and 2pf blocks
+          W_factor<number> __W_backg{2*$NUMBER_FIELDS};
+          W_factor<number> __W_tensor{2};
+          W_factor<number> __W_twopf{2*$NUMBER_FIELDS};
+        $ENDIF
+
         number* __raw_params;
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer& __setup_timer;
-        boost::timer::cpu_timer& __u_tensor_timer;
-        boost::timer::cpu_timer& __transport_eq_timer;
-        unsigned int& __invokations;
+        //! per-configuration profile; sampled evaluations record their phase timings here
+        hot_path::integration_profile& __profile;
 #endif
 
       };
@@ -443,7 +456,8 @@ namespace transport
           {
           }
 
-        void operator()(const twopf_state& x, number t);
+        template <typename State>
+        void operator()(const State& x, number t);
 
       };
 
@@ -467,10 +481,7 @@ namespace transport
         $MODEL_mpi_threepf_functor(const twopf_db_task<number>* tk, const threepf_kconfig& k
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-          boost::timer::cpu_timer& st,
-          boost::timer::cpu_timer& ut,
-          boost::timer::cpu_timer& tt,
-          unsigned int& in
+          hot_path::integration_profile& pf
 #endif
         )
           : __params(tk->get_params()),
@@ -494,13 +505,14 @@ namespace transport
               __dddV(nullptr),
             $ENDIF
 
+            $IF{dual_unroll}
+              __variant(kernel_variant::unrolled),
+            $ENDIF
+
             __raw_params(nullptr)
 #ifdef CPPTRANSPORT_INSTRUMENT
             ,
-            __setup_timer(st),
-            __u_tensor_timer(ut),
-            __transport_eq_timer(tt),
-            __invokations(in)
+            __profile(pf)
 #endif
           {
           }
@@ -547,7 +559,39 @@ namespace transport
             delete[] this->__raw_params;
           }
 
-        void operator()(const threepf_state& __x, threepf_state& __dxdt, number __dt);
+        $IF{dual_unroll}
+          //! evaluate the RHS using the kernel variant selected by calibration
+          template <typename State>
+          void operator()(const State& __x, State& __dxdt, number __t)
+            {
+              if(this->__variant == kernel_variant::rolled) this->rhs_rolled(__x, __dxdt, __t);
+              else                                          this->rhs_unrolled(__x, __dxdt, __t);
+            }
+
+          //! evaluate the RHS using the unrolled kernel
+          template <typename State>
+          void rhs_unrolled(const State& __x, State& __dxdt, number __t);
+
+          //! evaluate the RHS using the rolled kernel
+          template <typename State>
+          void rhs_rolled(const State& __x, State& __dxdt, number __t);
+
+          //! select kernel variant used by operator()
+          void set_kernel_variant(kernel_variant v) { this->__variant = v; }
+        $ELSE
+          template <typename State>
+          void operator()(const State& __x, State& __dxdt, number __dt);
+        $ENDIF
+
+        $IF{implicit_pert}
+          //! factorize an approximation to I - gamma_h J at (x, t), for use with W-method steppers
+          template <typename State>
+          void prepare_W(const State& __x, number __t, number __gamma_h);
+
+          //! solve (I - gamma_h J) y = r using the factorization computed by prepare_W()
+          template <typename State>
+          void solve_W(const State& __r, State& __y);
+        $ENDIF
 
         // adjust horizon exit time, given an initial time N_init which we wish to move to zero
         void rebase_horizon_exit_time(double N_init) { this->__N_horizon_exit -= N_init; }
@@ -585,13 +629,27 @@ namespace transport
           number* __dddV;
         $ENDIF
 
+        $IF{dual_unroll}
+          //! kernel variant used by operator()
+          kernel_variant __variant;
+        $ENDIF
+
+        $IF{implicit_pert}
+          //! W-method factorizations for the background block, and for each momentum in the tensor, 2pf and 3pf blocks
+          W_factor<number> __W_backg{2*$NUMBER_FIELDS};
+          W_factor<number> __W_tensor_k1{2};
+          W_factor<number> __W_tensor_k2{2};
+          W_factor<number> __W_tensor_k3{2};
+          W_factor<number> __W_k1{2*$NUMBER_FIELDS};
+          W_factor<number> __W_k2{2*$NUMBER_FIELDS};
+          W_factor<number> __W_k3{2*$NUMBER_FIELDS};
+        $ENDIF
+
         number* __raw_params;
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer& __setup_timer;
-        boost::timer::cpu_timer& __u_tensor_timer;
-        boost::timer::cpu_timer& __transport_eq_timer;
-        unsigned int& __invokations;
+        //! per-configuration profile; sampled evaluations record their phase timings here
+        hot_path::integration_profile& __profile;
 #endif
 
       };
@@ -626,7 +684,8 @@ namespace transport
           {
           }
 
-        void operator()(const threepf_state& x, number t);
+        template <typename State>
+        void operator()(const State& x, number t);
 
       };
 
@@ -693,16 +752,30 @@ namespace transport
         assert(queues.size() == 1);
         const work_queue<twopf_kconfig_record>::device_work_list list = queues[0];
 
+        $IF{dual_unroll}
+          // choose between the unrolled and rolled kernels the first time this model receives 2pf work
+          if(!this->twopf_variant && list.size() > 0) this->calibrate_twopf_kernels(list[0], tk, batcher);
+        $ENDIF
+
         for(unsigned int i = 0; i < list.size(); ++i)
           {
             bool success = false;
             unsigned int refinement_level = 0;
 
+            // if this configuration was in flight when an earlier integration was interrupted, resume it from its checkpoint
+            const typename integration_items<number>::checkpoint_item* resume = batcher.find_resume_checkpoint(list[i]->serial);
+            if(resume != nullptr)
+              {
+                refinement_level = resume->refinement;
+                BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+                    << "** " << CPPTRANSPORT_RESUME_CONFIG << " " << list[i]->serial << " " << CPPTRANSPORT_RESUME_FROM_SAMPLE << " " << resume->samples.size();
+              }
+
             while(!success)
             try
               {
                 // write the time history for this k-configuration
-                this->twopf_kmode(list[i], tk, batcher, refinement_level);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
+                this->twopf_kmode(list[i], tk, batcher, refinement_level, resume);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
                 success = true;
                }
             catch(std::overflow_error& xe)
@@ -711,6 +784,7 @@ namespace transport
                 if(refinement_level == 0) batcher.report_refinement();
                 batcher.unbatch(list[i]->serial);
                 refinement_level++;
+                resume = nullptr;     // a refined mesh is integrated from the beginning
 
                 BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::warning)
                     << "** " << CPPTRANSPORT_RETRY_CONFIG << " " << list[i]->serial << " (" << i+1
@@ -735,7 +809,8 @@ namespace transport
     template <typename number, typename StateType>
     void $MODEL_mpi<number, StateType>::twopf_kmode(const twopf_kconfig_record& kconfig,
                                                     const twopf_db_task<number>* tk,
-                                                    twopf_batcher<number>& batcher, unsigned int refinement_level)
+                                                    twopf_batcher<number>& batcher, unsigned int refinement_level,
+                                                    const typename integration_items<number>::checkpoint_item* resume)
       {
         DEFINE_INDEX_TOOLS
 
@@ -748,15 +823,29 @@ namespace transport
         // this also starts the timers running, so we do it as early as possible
         $MODEL_mpi_twopf_observer< $MODEL_mpi<number, StateType> > obs(batcher, kconfig, tk->get_initial_time(*kconfig), time_db);
 
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // set up a profile for this configuration; it is confined to this thread until merged below
+        hot_path::integration_profile profile;
+        obs.attach_profile(profile);
+#endif
+
+        // set up an agent to checkpoint this integration, so it can be resumed if interrupted
+        checkpoint_agent<number> checkpointer(batcher, kconfig->serial, refinement_level, $PERT_STEP_SIZE/pow(4.0,refinement_level));
+        obs.attach_checkpoint(checkpointer);
+
         // set up a functor to evolve this system
         $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            this->twopf_setup_timer, this->twopf_u_tensor_timer, this->twopf_transport_eq_timer, this->twopf_invokations
+            profile
 #endif
           );
         rhs.set_up_workspace();
 
+        $IF{dual_unroll}
+          if(this->twopf_variant) rhs.set_kernel_variant(*this->twopf_variant);
+        $ENDIF
+
         // set up a state vector
         twopf_state x;
         x.resize($MODEL_pool::twopf_state_size);
@@ -787,6 +876,25 @@ namespace transport
         auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
         auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
 
+        // if resuming from a checkpoint, replay the observer over all but the most recent stored sample,
+        // then restart the integration from that sample (which the integrator will observe as its initial point).
+        // The stepper restarts from its initial step size; the step size controller recovers within a few steps
+        if(resume != nullptr && !resume->samples.empty())
+          {
+            if(resume->samples.back().position != resume->samples.size() || resume->samples.back().state.size() != x.size())
+              throw runtime_exception(exception_type::INTEGRATION_FAILURE, CPPTRANSPORT_CHECKPOINT_MISMATCH);
+
+            for(unsigned int i = 0; i+1 < resume->samples.size(); ++i)
+              {
+                obs(resume->samples[i].state, static_cast<number>(resume->samples[i].time));
+              }
+
+            const std::vector<number>& last = resume->samples.back().state;
+            for(unsigned int i = 0; i < x.size(); ++i) x[i] = last[i];
+
+            std::advance(begin_iterator, resume->samples.size()-1);
+          }
+
         using boost::numeric::odeint::integrate_times;
         
         auto stepper = $MAKE_PERT_STEPPER{twopf_state, number, number, CPPTRANSPORT_ALGEBRA_NAME(twopf_state), CPPTRANSPORT_OPERATIONS_NAME(twopf_state)};
@@ -797,11 +905,70 @@ namespace transport
         rhs.close_down_workspace();
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        ++this->twopf_items;
+        this->twopf_profile.merge(profile);
 #endif
       }
 
 
+    template <typename number, typename StateType>
+    bool $MODEL_mpi<number, StateType>::backend_autotune(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk,
+                                                         const stepper_candidate& stepper, std::vector< std::vector<number> >& samples)
+      {
+        DEFINE_INDEX_TOOLS
+
+        // get time configuration database
+        const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // benchmark integrations are not included in the model's profile
+        hot_path::integration_profile profile;
+#endif
+
+        // set up a functor to evolve this system
+        $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+          ,
+            profile
+#endif
+          );
+        rhs.set_up_workspace();
+
+        $IF{dual_unroll}
+          if(this->twopf_variant) rhs.set_kernel_variant(*this->twopf_variant);
+        $ENDIF
+
+        // set up a state vector
+        twopf_state x;
+        x.resize($MODEL_pool::twopf_state_size);
+
+        // fix initial conditions - background
+        const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+        x[$MODEL_pool::backg_start + FLATTEN($A)] = ics[$A];
+
+        // fix initial conditions - tensors and 2pf, exactly as for a production integration
+        this->populate_tensor_ic(x, $MODEL_pool::tensor_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+        this->populate_twopf_ic(x, $MODEL_pool::twopf_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+
+        rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+        auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
+        auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
+
+        // record the state at each time sample; no batcher is involved, so nothing is written to a container
+        samples.clear();
+        auto obs = [&](const twopf_state& s, number t) -> void
+          {
+            samples.emplace_back(s.size());
+            for(unsigned int i = 0; i < s.size(); ++i) samples.back()[i] = s[i];
+          };
+
+        stepper_factory::integrate_times<twopf_state, number, CPPTRANSPORT_ALGEBRA_NAME(twopf_state), CPPTRANSPORT_OPERATIONS_NAME(twopf_state)>
+          (stepper, rhs, x, begin_iterator, end_iterator, static_cast<number>($PERT_STEP_SIZE), obs);
+
+        rhs.close_down_workspace();
+        return(true);
+      }
+
+
     // make initial conditions for each component of the 2pf
     // x           - state vector *containing* space for the 2pf (doesn't have to be entirely the 2pf)
     // start       - starting position of twopf components within the state vector
@@ -873,17 +1040,31 @@ namespace transport
         assert(queues.size() == 1);
         const work_queue<threepf_kconfig_record>::device_work_list list = queues[0];
 
+        $IF{dual_unroll}
+          // choose between the unrolled and rolled kernels the first time this model receives 3pf work
+          if(!this->threepf_variant && list.size() > 0) this->calibrate_threepf_kernels(list[0], tk, batcher);
+        $ENDIF
+
         // step through the queue, solving for the three-point functions in each case
         for(unsigned int i = 0; i < list.size(); ++i)
           {
             bool success = false;
             unsigned int refinement_level = 0;
 
+            // if this configuration was in flight when an earlier integration was interrupted, resume it from its checkpoint
+            const typename integration_items<number>::checkpoint_item* resume = batcher.find_resume_checkpoint(list[i]->serial);
+            if(resume != nullptr)
+              {
+                refinement_level = resume->refinement;
+                BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+                    << "** " << CPPTRANSPORT_RESUME_CONFIG << " " << list[i]->serial << " " << CPPTRANSPORT_RESUME_FROM_SAMPLE << " " << resume->samples.size();
+              }
+
             while(!success)
             try
               {
                 // write the time history for this k-configuration
-                this->threepf_kmode(list[i], tk, batcher, refinement_level);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
+                this->threepf_kmode(list[i], tk, batcher, refinement_level, resume);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
                 success = true;
               }
             catch(std::overflow_error& xe)
@@ -892,6 +1073,7 @@ namespace transport
                 if(refinement_level == 0) batcher.report_refinement();
                 batcher.unbatch(list[i]->serial);
                 refinement_level++;
+                resume = nullptr;     // a refined mesh is integrated from the beginning
 
                 BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::warning)
                     << "** " << CPPTRANSPORT_RETRY_CONFIG << " " << list[i]->serial << " (" << i+1
@@ -917,7 +1099,8 @@ namespace transport
     template <typename number, typename StateType>
     void $MODEL_mpi<number, StateType>::threepf_kmode(const threepf_kconfig_record& kconfig,
                                                       const threepf_task<number>* tk,
-                                                      threepf_batcher<number>& batcher, unsigned int refinement_level)
+                                                      threepf_batcher<number>& batcher, unsigned int refinement_level,
+                                                      const typename integration_items<number>::checkpoint_item* resume)
       {
         DEFINE_INDEX_TOOLS
 
@@ -930,15 +1113,29 @@ namespace transport
         // this also starts the timers running, so we do it as early as possible
         $MODEL_mpi_threepf_observer< $MODEL_mpi<number, StateType> > obs(batcher, kconfig, tk->get_initial_time(*kconfig), time_db);
 
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // set up a profile for this configuration; it is confined to this thread until merged below
+        hot_path::integration_profile profile;
+        obs.attach_profile(profile);
+#endif
+
+        // set up an agent to checkpoint this integration, so it can be resumed if interrupted
+        checkpoint_agent<number> checkpointer(batcher, kconfig->serial, refinement_level, $PERT_STEP_SIZE/pow(4.0,refinement_level));
+        obs.attach_checkpoint(checkpointer);
+
         // set up a functor to evolve this system
         $MODEL_mpi_threepf_functor< $MODEL_mpi<number, StateType> >  rhs(tk, *kconfig
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            this->threepf_setup_timer, this->threepf_u_tensor_timer, this->threepf_transport_eq_timer, this->threepf_invokations
+            profile
 #endif
           );
         rhs.set_up_workspace();
 
+        $IF{dual_unroll}
+          if(this->threepf_variant) rhs.set_kernel_variant(*this->threepf_variant);
+        $ENDIF
+
         // set up a state vector
         threepf_state x;
         x.resize($MODEL_pool::threepf_state_size);
@@ -985,6 +1182,25 @@ namespace transport
         rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
         auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
         auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
+
+        // if resuming from a checkpoint, replay the observer over all but the most recent stored sample,
+        // then restart the integration from that sample (which the integrator will observe as its initial point).
+        // The stepper restarts from its initial step size; the step size controller recovers within a few steps
+        if(resume != nullptr && !resume->samples.empty())
+          {
+            if(resume->samples.back().position != resume->samples.size() || resume->samples.back().state.size() != x.size())
+              throw runtime_exception(exception_type::INTEGRATION_FAILURE, CPPTRANSPORT_CHECKPOINT_MISMATCH);
+
+            for(unsigned int i = 0; i+1 < resume->samples.size(); ++i)
+              {
+                obs(resume->samples[i].state, static_cast<number>(resume->samples[i].time));
+              }
+
+            const std::vector<number>& last = resume->samples.back().state;
+            for(unsigned int i = 0; i < x.size(); ++i) x[i] = last[i];
+
+            std::advance(begin_iterator, resume->samples.size()-1);
+          }
     
         using boost::numeric::odeint::integrate_times;
 
@@ -996,7 +1212,7 @@ namespace transport
         rhs.close_down_workspace();
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        ++this->threepf_items;
+        this->threepf_profile.merge(profile);
 #endif
       }
 
@@ -1016,11 +1232,132 @@ namespace transport
       }
 
 
+    $IF{dual_unroll}
+      template <typename number, typename StateType>
+      void $MODEL_mpi<number, StateType>::calibrate_twopf_kernels(const twopf_kconfig_record& kconfig,
+                                                                  const twopf_db_task<number>* tk,
+                                                                  twopf_batcher<number>& batcher)
+        {
+          DEFINE_INDEX_TOOLS
+
+          // get time configuration database
+          const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+          // calibration evaluations are not included in the model's profile
+          hot_path::integration_profile profile;
+#endif
+
+          // set up a functor to evolve this system
+          $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+            ,
+              profile
+#endif
+            );
+          rhs.set_up_workspace();
+
+          // both kernels are timed at the initial conditions for this configuration
+          twopf_state x;
+          x.resize($MODEL_pool::twopf_state_size);
+
+          twopf_state dxdt;
+          dxdt.resize($MODEL_pool::twopf_state_size);
+
+          const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+          x[$MODEL_pool::backg_start + FLATTEN($A)] = ics[$A];
+
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+
+          rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+          const number t = *(time_db.value_begin(tk->get_ics().get_N_initial()));
+
+          kernel_calibration calibration = calibrate_kernel_variants([&]() -> void { rhs.rhs_unrolled(x, dxdt, t); },
+                                                                     [&]() -> void { rhs.rhs_rolled(x, dxdt, t); });
+          this->twopf_variant = calibration.get_variant();
+
+          BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+            << "** " << CPPTRANSPORT_KERNEL_TWOPF << " " << calibration;
+
+          rhs.close_down_workspace();
+        }
+
+
+      template <typename number, typename StateType>
+      void $MODEL_mpi<number, StateType>::calibrate_threepf_kernels(const threepf_kconfig_record& kconfig,
+                                                                    const threepf_task<number>* tk,
+                                                                    threepf_batcher<number>& batcher)
+        {
+          DEFINE_INDEX_TOOLS
+
+          // get time configuration database
+          const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+          // calibration evaluations are not included in the model's profile
+          hot_path::integration_profile profile;
+#endif
+
+          // set up a functor to evolve this system
+          $MODEL_mpi_threepf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+            ,
+              profile
+#endif
+            );
+          rhs.set_up_workspace();
+
+          // both kernels are timed at the initial conditions for this configuration
+          threepf_state x;
+          x.resize($MODEL_pool::threepf_state_size);
+
+          threepf_state dxdt;
+          dxdt.resize($MODEL_pool::threepf_state_size);
+
+          const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+          x[$MODEL_pool::backg_start + FLATTEN($A)] = ics[$A];
+
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+
+          this->populate_threepf_ic(x, $MODEL_pool::threepf_start, *kconfig, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+
+          rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+          const number t = *(time_db.value_begin(tk->get_ics().get_N_initial()));
+
+          kernel_calibration calibration = calibrate_kernel_variants([&]() -> void { rhs.rhs_unrolled(x, dxdt, t); },
+                                                                     [&]() -> void { rhs.rhs_rolled(x, dxdt, t); });
+          this->threepf_variant = calibration.get_variant();
+
+          BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+            << "** " << CPPTRANSPORT_KERNEL_THREEPF << " " << calibration;
+
+          rhs.close_down_workspace();
+        }
+    $ENDIF
+
+
     // IMPLEMENTATION - FUNCTOR FOR 2PF INTEGRATION
 
 
+    $VARIANTS
     template <typename Model>
-    void $MODEL_mpi_twopf_functor<Model>::operator()(const twopf_state& __x, twopf_state& __dxdt, number __t)
+    template <typename State>
+    $IF{dual_unroll}
+    void $MODEL_mpi_twopf_functor<Model>::rhs_$KERNEL_VARIANT(const State& __x, State& __dxdt, number __t)
+    $ELSE
+    void $MODEL_mpi_twopf_functor<Model>::operator()(const State& __x, State& __dxdt, number __t)
+    $ENDIF
       {
         DEFINE_INDEX_TOOLS
         $RESOURCE_RELEASE
@@ -1032,8 +1369,7 @@ namespace transport
 
         // calculation of dV, ddV, dddV has to occur above the temporary pool
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __x, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __x, __Mp, __ddV);
+          $MODEL_compute_derivatives(__raw_params, __x, __Mp, __dV, __ddV);
 
           // capture resources for transport tensors
           $RESOURCE_DV{__dV}
@@ -1041,7 +1377,9 @@ namespace transport
         $ENDIF
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.resume();
+        // only a fraction of evaluations read the clock, so that instrumentation does not perturb the hot path
+        const bool __sampled = __profile.sample_rhs();
+        const hot_path::tick_type __tick_setup = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         $TEMP_POOL{"const auto $1 = $2;"}
@@ -1068,8 +1406,7 @@ namespace transport
 #define __dtwopf(a,b)        __dxdt[$MODEL_pool::twopf_start + FLATTEN(a,b)]
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.stop();
-        __u_tensor_timer.resume();
+        const hot_path::tick_type __tick_u_tensor = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the background
@@ -1092,8 +1429,7 @@ namespace transport
         $U2_DECLARE[AB] = $U2_TENSOR[AB]{__k, __a};
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __u_tensor_timer.stop();
-        __transport_eq_timer.resume();
+        const hot_path::tick_type __tick_transport = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the 2pf
@@ -1114,17 +1450,96 @@ namespace transport
 #endif
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __transport_eq_timer.stop();
-        ++__invokations;
+        if(__sampled) __profile.record_rhs(__tick_setup, __tick_u_tensor, __tick_transport, hot_path::read_clock());
 #endif
       }
+    $ENDVARIANTS
+
+
+    $IF{implicit_pert}
+
+      // IMPLEMENTATION - W-MATRIX FOR 2PF INTEGRATION
+
+      // W-method steppers accept any approximation to the Jacobian; see transport-runtime/models/implicit_system.h.
+      // We approximate the background block by u2 at k=0, which reproduces the linearization of the background
+      // equations up to terms proportional to the momenta, and the 2pf block by the approximate factorization of
+      // u2 (+) u2. The field dependence of u2 is dropped, which makes the approximate Jacobian block diagonal
+
+
+      template <typename Model>
+      template <typename State>
+      void $MODEL_mpi_twopf_functor<Model>::prepare_W(const State& __x, number __t, number __gamma_h)
+        {
+          DEFINE_INDEX_TOOLS
+          $RESOURCE_RELEASE
+
+          const auto __a = std::exp(__t - this->__N_horizon_exit + this->__astar_normalization);
+          const number __k_bg = 0.0;
+
+          $RESOURCE_PARAMETERS{__raw_params}
+          $RESOURCE_COORDINATES{__x}
+
+          // calculation of dV, ddV has to occur above the temporary pool
+          $IF{!fast}
+            $MODEL_compute_derivatives(__raw_params, __x, __Mp, __dV, __ddV);
+
+            // capture resources for transport tensors
+            $RESOURCE_DV{__dV}
+            $RESOURCE_DDV{__ddV}
+          $ENDIF
+
+          $TEMP_POOL{"const auto $1 = $2;"}
+
+          const auto __Hsq = $HUBBLE_SQ;
+          const auto __eps = $EPSILON;
+
+          // background block
+          {
+            $U2_DECLARE[AB] = $U2_TENSOR[AB]{__k_bg, __a};
+
+            this->__W_backg($A, $B) = $U2_CONTAINER[AB];
+          }
+
+          // tensor block; the tensor 2pf evolves according to d(T_ij)/dN = w_ik T_kj + w_jk T_ik
+          // with w = ((0, 1), (-k^2/a^2H^2, eps-3))
+          this->__W_tensor(0, 0) = 0.0;
+          this->__W_tensor(0, 1) = 1.0;
+          this->__W_tensor(1, 0) = -__k*__k/(__a*__a*__Hsq);
+          this->__W_tensor(1, 1) = __eps-3.0;
+
+          // 2pf block
+          {
+            $U2_DECLARE[AB] = $U2_TENSOR[AB]{__k, __a};
+
+            this->__W_twopf($A, $B) = $U2_CONTAINER[AB];
+          }
+
+          this->__W_backg.factorize(__gamma_h);
+          this->__W_tensor.factorize(__gamma_h);
+          this->__W_twopf.factorize(__gamma_h);
+        }
+
+
+      template <typename Model>
+      template <typename State>
+      void $MODEL_mpi_twopf_functor<Model>::solve_W(const State& __r, State& __y)
+        {
+          __y = __r;
+
+          W_solve_vector(this->__W_backg, __y, $MODEL_pool::backg_start);
+          W_solve_matrix(this->__W_tensor, this->__W_tensor, __y, $MODEL_pool::tensor_start);
+          W_solve_matrix(this->__W_twopf, this->__W_twopf, __y, $MODEL_pool::twopf_start);
+        }
+
+    $ENDIF
 
 
     // IMPLEMENTATION - FUNCTOR FOR 2PF OBSERVATION
 
 
     template <typename Model>
-    void $MODEL_mpi_twopf_observer<Model>::operator()(const twopf_state& x, number t)
+    template <typename State>
+    void $MODEL_mpi_twopf_observer<Model>::operator()(const State& x, number t)
       {
         DEFINE_INDEX_TOOLS
         
@@ -1149,6 +1564,7 @@ namespace transport
 
         this->start_batching(static_cast<double>(t), this->get_log(), generic_batcher::log_severity_level::normal);
         this->push(x);
+        this->checkpoint(x, static_cast<double>(t));
         this->stop_batching();
       }
 
@@ -1156,8 +1572,14 @@ namespace transport
     // IMPLEMENTATION - FUNCTOR FOR 3PF INTEGRATION
 
 
+    $VARIANTS
     template <typename Model>
-    void $MODEL_mpi_threepf_functor<Model>::operator()(const threepf_state& __x, threepf_state& __dxdt, number __t)
+    template <typename State>
+    $IF{dual_unroll}
+    void $MODEL_mpi_threepf_functor<Model>::rhs_$KERNEL_VARIANT(const State& __x, State& __dxdt, number __t)
+    $ELSE
+    void $MODEL_mpi_threepf_functor<Model>::operator()(const State& __x, State& __dxdt, number __t)
+    $ENDIF
       {
         DEFINE_INDEX_TOOLS
         $RESOURCE_RELEASE
@@ -1169,9 +1591,7 @@ namespace transport
 
         // calculation of dV, ddV, dddV has to occur above the temporary pool
         $IF{!fast}
-          $MODEL_compute_dV(__raw_params, __x, __Mp, __dV);
-          $MODEL_compute_ddV(__raw_params, __x, __Mp, __ddV);
-          $MODEL_compute_dddV(__raw_params, __x, __Mp, __dddV);
+          $MODEL_compute_derivatives(__raw_params, __x, __Mp, __dV, __ddV, __dddV);
 
           // capture resources for transport tensors
           $RESOURCE_DV{__dV}
@@ -1180,7 +1600,9 @@ namespace transport
         $ENDIF
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.resume();
+        // only a fraction of evaluations read the clock, so that instrumentation does not perturb the hot path
+        const bool __sampled = __profile.sample_rhs();
+        const hot_path::tick_type __tick_setup = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         $TEMP_POOL{"const auto $1 = $2;"}
@@ -1248,8 +1670,7 @@ namespace transport
 #define __dthreepf(a,b,c)       __dxdt[$MODEL_pool::threepf_start     + FLATTEN(a,b,c)]
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.stop();
-        __u_tensor_timer.resume();
+        const hot_path::tick_type __tick_u_tensor = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the background
@@ -1292,8 +1713,7 @@ namespace transport
         $U3_k3k1k2_DECLARE[ABC] = $U3_TENSOR[ABC]{__k3, __k1, __k2, __a};
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __u_tensor_timer.stop();
-        __transport_eq_timer.resume();
+        const hot_path::tick_type __tick_transport = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the real and imaginary components of the 2pf
@@ -1333,17 +1753,120 @@ namespace transport
         __dthreepf($A, $B, $C) $+= - $U3_k3k1k2_CONTAINER[CMN] * __twopf_im_k1($A, $M) * __twopf_im_k2($B, $N);
         
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __transport_eq_timer.stop();
-        ++__invokations;
+        if(__sampled) __profile.record_rhs(__tick_setup, __tick_u_tensor, __tick_transport, hot_path::read_clock());
 #endif
       }
+    $ENDVARIANTS
+
+
+    $IF{implicit_pert}
+
+      // IMPLEMENTATION - W-MATRIX FOR 3PF INTEGRATION
+
+      // As for the 2pf, the approximate Jacobian is block diagonal. The u3 source terms in the 3pf equations
+      // sit below the diagonal and are dropped; the 3pf block uses the approximate factorization of
+      // u2(k1) (+) u2(k2) (+) u2(k3), which shares its factors with the 2pf blocks
+
+
+      template <typename Model>
+      template <typename State>
+      void $MODEL_mpi_threepf_functor<Model>::prepare_W(const State& __x, number __t, number __gamma_h)
+        {
+          DEFINE_INDEX_TOOLS
+          $RESOURCE_RELEASE
+
+          const auto __a = std::exp(__t - this->__N_horizon_exit + this->__astar_normalization);
+          const number __k_bg = 0.0;
+
+          $RESOURCE_PARAMETERS{__raw_params}
+          $RESOURCE_COORDINATES{__x}
+
+          // calculation of dV, ddV has to occur above the temporary pool
+          $IF{!fast}
+            $MODEL_compute_derivatives(__raw_params, __x, __Mp, __dV, __ddV);
+
+            // capture resources for transport tensors
+            $RESOURCE_DV{__dV}
+            $RESOURCE_DDV{__ddV}
+          $ENDIF
+
+          $TEMP_POOL{"const auto $1 = $2;"}
+
+          const auto __Hsq = $HUBBLE_SQ;
+          const auto __eps = $EPSILON;
+
+          // background block
+          {
+            $U2_k1_DECLARE[AB] = $U2_TENSOR[AB]{__k_bg, __a};
+
+            this->__W_backg($A, $B) = $U2_k1_CONTAINER[AB];
+          }
+
+          // tensor blocks; each tensor 2pf evolves according to the same 2x2 linear system as in the 2pf functor
+          auto __tensor_block = [&](W_factor<number>& __W, double __kmode) -> void
+            {
+              __W(0, 0) = 0.0;
+              __W(0, 1) = 1.0;
+              __W(1, 0) = -__kmode*__kmode/(__a*__a*__Hsq);
+              __W(1, 1) = __eps-3.0;
+            };
+
+          __tensor_block(this->__W_tensor_k1, __k1);
+          __tensor_block(this->__W_tensor_k2, __k2);
+          __tensor_block(this->__W_tensor_k3, __k3);
+
+          // 2pf and 3pf blocks
+          {
+            $U2_k1_DECLARE[AB] = $U2_TENSOR[AB]{__k1, __a};
+            $U2_k2_DECLARE[AB] = $U2_TENSOR[AB]{__k2, __a};
+            $U2_k3_DECLARE[AB] = $U2_TENSOR[AB]{__k3, __a};
+
+            this->__W_k1($A, $B) = $U2_k1_CONTAINER[AB];
+            this->__W_k2($A, $B) = $U2_k2_CONTAINER[AB];
+            this->__W_k3($A, $B) = $U2_k3_CONTAINER[AB];
+          }
+
+          this->__W_backg.factorize(__gamma_h);
+          this->__W_tensor_k1.factorize(__gamma_h);
+          this->__W_tensor_k2.factorize(__gamma_h);
+          this->__W_tensor_k3.factorize(__gamma_h);
+          this->__W_k1.factorize(__gamma_h);
+          this->__W_k2.factorize(__gamma_h);
+          this->__W_k3.factorize(__gamma_h);
+        }
+
+
+      template <typename Model>
+      template <typename State>
+      void $MODEL_mpi_threepf_functor<Model>::solve_W(const State& __r, State& __y)
+        {
+          __y = __r;
+
+          W_solve_vector(this->__W_backg, __y, $MODEL_pool::backg_start);
+
+          W_solve_matrix(this->__W_tensor_k1, this->__W_tensor_k1, __y, $MODEL_pool::tensor_k1_start);
+          W_solve_matrix(this->__W_tensor_k2, this->__W_tensor_k2, __y, $MODEL_pool::tensor_k2_start);
+          W_solve_matrix(this->__W_tensor_k3, this->__W_tensor_k3, __y, $MODEL_pool::tensor_k3_start);
+
+          W_solve_matrix(this->__W_k1, this->__W_k1, __y, $MODEL_pool::twopf_re_k1_start);
+          W_solve_matrix(this->__W_k1, this->__W_k1, __y, $MODEL_pool::twopf_im_k1_start);
+          W_solve_matrix(this->__W_k2, this->__W_k2, __y, $MODEL_pool::twopf_re_k2_start);
+          W_solve_matrix(this->__W_k2, this->__W_k2, __y, $MODEL_pool::twopf_im_k2_start);
+          W_solve_matrix(this->__W_k3, this->__W_k3, __y, $MODEL_pool::twopf_re_k3_start);
+          W_solve_matrix(this->__W_k3, this->__W_k3, __y, $MODEL_pool::twopf_im_k3_start);
+
+          W_solve_tensor(this->__W_k1, this->__W_k2, this->__W_k3, __y, $MODEL_pool::threepf_start);
+        }
+
+    $ENDIF
 
 
     // IMPLEMENTATION - FUNCTOR FOR 3PF OBSERVATION
 
 
     template <typename Model>
-    void $MODEL_mpi_threepf_observer<Model>::operator()(const threepf_state& x, number t)
+    template <typename State>
+    void $MODEL_mpi_threepf_observer<Model>::operator()(const State& x, number t)
       {
         DEFINE_INDEX_TOOLS
 
@@ -1403,11 +1926,101 @@ namespace transport
 
         this->start_batching(static_cast<double>(t), this->get_log(), generic_batcher::log_severity_level::normal);
         this->push(x);
+        this->checkpoint(x, static_cast<double>(t));
         this->stop_batching();
       }
 
 
+    $IF{split}
+      // SPLIT TRANSLATION UNITS
+
+
+      // with --split, the expensive parts of this implementation are instantiated for the default number and
+      // state types in separate translation units which can be compiled in parallel. Any other translation unit
+      // including this header sees only the explicit instantiation declarations and does not instantiate them
+      // again; models using other number types are instantiated implicitly, as usual
+      namespace $MODEL_split
+        {
+          using number = default_number_type;
+          using model_type = $MODEL_mpi<number, std::vector<number> >;
+          using state_type = model_type::twopf_state;
+        }
+
+
+      extern template void $MODEL<$MODEL_split::number>::u2(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::u3(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::A(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::B(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::C(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::u2_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+      extern template void $MODEL<$MODEL_split::number>::u3_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+
+      extern template class $MODEL_mpi_twopf_functor<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_threepf_functor<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_twopf_observer<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_threepf_observer<$MODEL_split::model_type>;
+
+      $IF{dual_unroll}
+        extern template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::rhs_unrolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        extern template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::rhs_rolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        extern template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::rhs_unrolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        extern template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::rhs_rolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ELSE
+        extern template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        extern template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ENDIF
+
+      extern template void $MODEL_mpi_twopf_observer<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::number);
+      extern template void $MODEL_mpi_threepf_observer<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::number);
+
+#ifdef $SPLIT_UNIT{tensors}
+      template void $MODEL<$MODEL_split::number>::u2(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::u3(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::A(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::B(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::C(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::u2_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+      template void $MODEL<$MODEL_split::number>::u3_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+#endif
+
+#ifdef $SPLIT_UNIT{twopf}
+      template class $MODEL_mpi_twopf_functor<$MODEL_split::model_type>;
+      $IF{dual_unroll}
+        template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::rhs_unrolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::rhs_rolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ELSE
+        template void $MODEL_mpi_twopf_functor<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ENDIF
+#endif
+
+#ifdef $SPLIT_UNIT{threepf}
+      template class $MODEL_mpi_threepf_functor<$MODEL_split::model_type>;
+      $IF{dual_unroll}
+        template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::rhs_unrolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+        template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::rhs_rolled<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ELSE
+        template void $MODEL_mpi_threepf_functor<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::state_type&, $MODEL_split::number);
+      $ENDIF
+#endif
+
+#ifdef $SPLIT_UNIT{observers}
+      template class $MODEL_mpi_twopf_observer<$MODEL_split::model_type>;
+      template class $MODEL_mpi_threepf_observer<$MODEL_split::model_type>;
+      template void $MODEL_mpi_twopf_observer<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::number);
+      template void $MODEL_mpi_threepf_observer<$MODEL_split::model_type>::operator()<$MODEL_split::state_type>(const $MODEL_split::state_type&, $MODEL_split::number);
+#endif
+    $ENDIF
+
+
     }   // namespace transport
 
 
+$IF{plugin}
+// entry points used by the runtime to load this model from a plugin; defined only in the plugin's translation unit
+#ifdef CPPTRANSPORT_MODEL_PLUGIN
+CPPTRANSPORT_DEFINE_MODEL_PLUGIN(transport::$MODEL_mpi<>, "$UNIQUE_ID")
+#endif
+$ENDIF
+
+
 #endif  // $GUARD
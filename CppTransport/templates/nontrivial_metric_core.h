@@ -44,15 +44,20 @@
 #include <sstream>
 #include <stdexcept>
 #include <memory>
+#include <array>
 
 #include "boost/numeric/odeint.hpp"
 #include "boost/range/algorithm.hpp"
 
 #include "Eigen/Core"
+#include "Eigen/LU"
 
 #include "transport-runtime/transport.h"
 #include "transport-runtime/models/nontrivial_metric_model.h"
 #include "transport-runtime/models/odeint_defaults.h"
+#include "transport-runtime/models/stepper_factory.h"
+#include "transport-runtime/models/numeric_geometry.h"
+#include "transport-runtime/utilities/taylor_jet.h"
 
 
 // #define CPPTRANSPORT_INSTRUMENT
@@ -295,6 +300,19 @@ namespace transport
         // calculate the sorted mass spectrum, normalized to H^2 if desired
         void sorted_mass_spectrum(const twopf_db_task<number>* __task, const flattened_tensor<number>& __fields, double __N, bool __norm, flattened_tensor<number>& __M, flattened_tensor<number>& __E) override;
 
+
+        // BATCHED EVALUATION
+
+      protected:
+
+        // evaluate u2, u3 and the sorted mass spectrum over a range of time samples; workspace is local to each call,
+        // so kernels for disjoint ranges of samples can run concurrently
+        void u2_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, const std::vector<double>& __klist, std::vector< std::vector< std::vector<number> > >& __u2, unsigned int __begin, unsigned int __end) override;
+        void u3_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, const std::vector<double>& __k1list, const std::vector<double>& __k2list, const std::vector<double>& __k3list, std::vector< std::vector< std::vector<number> > >& __u3, unsigned int __begin, unsigned int __end) override;
+        void sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history, const std::vector<double>& __Nsample, bool __norm, std::vector< std::vector<number> >& __E, unsigned int __begin, unsigned int __end) override;
+
+        bool batch_concurrent() const override { return(true); }
+
         // BACKEND INTERFACE (PARTIAL IMPLEMENTATION -- WE PROVIDE A COMMON BACKGROUND INTEGRATOR)
 
       public:
@@ -648,6 +666,22 @@ namespace transport
       }
 
 
+    $IF{numeric_curvature}
+      // invert the field-space metric numerically; used in place of a symbolic inverse when the model was
+      // translated with --numeric-curvature
+      template <typename number>
+      void $MODEL_invert_metric(const number* __G, number* __Ginv)
+        {
+          using __metric_matrix = Eigen::Matrix<number, $NUMBER_FIELDS, $NUMBER_FIELDS, Eigen::RowMajor>;
+
+          Eigen::Map<const __metric_matrix> __G_matrix(__G);
+          Eigen::Map<__metric_matrix> __Ginv_matrix(__Ginv);
+
+          __Ginv_matrix = __G_matrix.partialPivLu().inverse();
+        }
+    $ENDIF
+
+
     template <typename number>
     void $MODEL<number>::G_covariant(const parameters<number>& __params, const flattened_tensor<number>& __coords,
                                      flattened_tensor<number>& __G) const
@@ -697,14 +731,106 @@ namespace transport
 
         $TEMP_POOL{"const auto $1 = $2;"}
 
-        // force unroll to make explicit that we wish to populate array elements
-        __Ginv[FIELDS_FLATTEN($^a,$^b)] = $METRIC[^ab]|;
+        $IF{numeric_curvature}
+          flattened_tensor<number> __G($NUMBER_FIELDS*$NUMBER_FIELDS);
+          this->G_covariant(__params, __coords, __G);
+          $MODEL_invert_metric(__G.data(), __Ginv.data());
+        $ELSE
+          // force unroll to make explicit that we wish to populate array elements
+          __Ginv[FIELDS_FLATTEN($^a,$^b)] = $METRIC[^ab]|;
+        $ENDIF
       }
 
 
     $IF{!fast}
+      $IF{numeric_curvature}
+        // metric and potential expressed generically in the scalar type, so that they can be evaluated on Taylor jets;
+        // the connexion, curvature and covariant derivatives are then built numerically from the partial derivatives
+        template <typename number, typename Scalar>
+        void $MODEL_generic_G(const number* __raw_params, const Scalar* __x, number __Mp, Scalar* __G)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __G[FIELDS_FLATTEN($_a, $_b)] = $METRIC[_ab]|;
+          }
+
+
+        template <typename number, typename Scalar>
+        Scalar $MODEL_generic_V(const number* __raw_params, const Scalar* __x, number __Mp)
+          {
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            return $POTENTIAL;
+          }
+
+
+        // evaluate the metric together with its partial derivatives up to the given order in a single forward-mode sweep
+        template <unsigned int Order, typename number, typename StateType>
+        std::vector< ad::taylor_jet<number, $NUMBER_FIELDS, Order> > $MODEL_jet_G(const number* __raw_params, const StateType& __x, number __Mp)
+          {
+            using __jet_type = ad::taylor_jet<number, $NUMBER_FIELDS, Order>;
+
+            std::vector<__jet_type> __seeds($NUMBER_FIELDS);
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __seeds[__a] = __jet_type::variable(__x[__a], __a);
+              }
+
+            std::vector<__jet_type> __G($NUMBER_FIELDS*$NUMBER_FIELDS);
+            $MODEL_generic_G(__raw_params, __seeds.data(), __Mp, __G.data());
+
+            return __G;
+          }
+
+
+        // evaluate the potential together with its partial derivatives up to the given order
+        template <unsigned int Order, typename number, typename StateType>
+        ad::taylor_jet<number, $NUMBER_FIELDS, Order> $MODEL_jet_V(const number* __raw_params, const StateType& __x, number __Mp)
+          {
+            using __jet_type = ad::taylor_jet<number, $NUMBER_FIELDS, Order>;
+
+            std::vector<__jet_type> __seeds($NUMBER_FIELDS);
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __seeds[__a] = __jet_type::variable(__x[__a], __a);
+              }
+
+            return $MODEL_generic_V(__raw_params, __seeds.data(), __Mp);
+          }
+
+
+        // extract the momenta p^a from a phase-space state
+        template <typename number, typename StateType>
+        std::array<number, $NUMBER_FIELDS> $MODEL_momenta(const StateType& __x)
+          {
+            DEFINE_INDEX_TOOLS
+
+            std::array<number, $NUMBER_FIELDS> __p;
+            for(unsigned int __a = 0; __a < $NUMBER_FIELDS; ++__a)
+              {
+                __p[__a] = __x[FLATTEN(MOMENTUM(__a))];
+              }
+
+            return __p;
+          }
+      $ENDIF
+
+
       template <typename number, typename StateType>
-      void $MODEL_compute_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
+      void $MODEL_compute_G(const number* __raw_params, const StateType& __x, number __Mp, number* __G)
         {
           DEFINE_INDEX_TOOLS
           $RESOURCE_RELEASE
@@ -715,12 +841,12 @@ namespace transport
           $TEMP_POOL{"const auto $1 = $2;"}
 
           // force unroll to make explicit that we wish to populate array elements
-          __dV[FIELDS_FLATTEN($_a)] = $DV[_a]|;
+          __G[FIELDS_FLATTEN($_a, $_b)] = $METRIC[_ab]|;
         }
 
 
       template <typename number, typename StateType>
-      void $MODEL_compute_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
+      void $MODEL_compute_Ginv(const number* __raw_params, const StateType& __x, number __Mp, number* __Ginv)
         {
           DEFINE_INDEX_TOOLS
           $RESOURCE_RELEASE
@@ -730,13 +856,19 @@ namespace transport
 
           $TEMP_POOL{"const auto $1 = $2;"}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __ddV[FIELDS_FLATTEN($_a, $_b)] = $DDV[_ab]|;
+          $IF{numeric_curvature}
+            number __G[$NUMBER_FIELDS*$NUMBER_FIELDS];
+            $MODEL_compute_G(__raw_params, __x, __Mp, __G);
+            $MODEL_invert_metric(__G, __Ginv);
+          $ELSE
+            // force unroll to make explicit that we wish to populate array elements
+            __Ginv[FIELDS_FLATTEN($^a,$^b)] = $METRIC[^ab]|;
+          $ENDIF
         }
 
 
       template <typename number, typename StateType>
-      void $MODEL_compute_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
+      void $MODEL_compute_dV(const number* __raw_params, const StateType& __x, number __Mp, number* __dV)
         {
           DEFINE_INDEX_TOOLS
           $RESOURCE_RELEASE
@@ -747,55 +879,78 @@ namespace transport
           $TEMP_POOL{"const auto $1 = $2;"}
 
           // force unroll to make explicit that we wish to populate array elements
-          __dddV[FIELDS_FLATTEN($_a, $_b, $_c)] = $DDDV[_abc]|;
+          __dV[FIELDS_FLATTEN($_a)] = $DV[_a]|;
         }
 
 
       template <typename number, typename StateType>
-      void $MODEL_compute_G(const number* __raw_params, const StateType& __x, number __Mp, number* __G)
+      void $MODEL_compute_ddV(const number* __raw_params, const StateType& __x, number __Mp, number* __ddV)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<1>(__raw_params, __x, __Mp);
+            const auto __V = $MODEL_jet_V<2>(__raw_params, __x, __Mp);
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            numeric_geometry<number, $NUMBER_FIELDS, 1> __geometry(__G.data());
+            __geometry.covariant_ddV(__V, __ddV);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __G[FIELDS_FLATTEN($_a, $_b)] = $METRIC[_ab]|;
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __ddV[FIELDS_FLATTEN($_a, $_b)] = $DDV[_ab]|;
+          $ENDIF
         }
 
 
       template <typename number, typename StateType>
-      void $MODEL_compute_Ginv(const number* __raw_params, const StateType& __x, number __Mp, number* __Ginv)
+      void $MODEL_compute_dddV(const number* __raw_params, const StateType& __x, number __Mp, number* __dddV)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<2>(__raw_params, __x, __Mp);
+            const auto __V = $MODEL_jet_V<3>(__raw_params, __x, __Mp);
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            numeric_geometry<number, $NUMBER_FIELDS, 2> __geometry(__G.data());
+            __geometry.covariant_dddV(__V, __dddV);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __Ginv[FIELDS_FLATTEN($^a,$^b)] = $METRIC[^ab]|;
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __dddV[FIELDS_FLATTEN($_a, $_b, $_c)] = $DDDV[_abc]|;
+          $ENDIF
         }
 
 
       template <typename number, typename StateType>
       void $MODEL_compute_connexion(const number* __raw_params, const StateType& __x, number __Mp, number* __Gamma)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
-          
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
-          
-          $TEMP_POOL{"const auto $1 = $2;"}
-    
-          // force unroll to make explicit that we wish to populate array elements
-          __Gamma[FIELDS_FLATTEN($^a,$_b,$_c)] = $CONNECTION[^a_bc]|;
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<1>(__raw_params, __x, __Mp);
+
+            numeric_geometry<number, $NUMBER_FIELDS, 1> __geometry(__G.data());
+            __geometry.connexion(__Gamma);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
+
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __Gamma[FIELDS_FLATTEN($^a,$_b,$_c)] = $CONNECTION[^a_bc]|;
+          $ENDIF
         }
 
 
@@ -803,16 +958,24 @@ namespace transport
       void
       $MODEL_compute_Riemann_A2(const number* __raw_params, const StateType& __x, number __Mp, number* __A2)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<2>(__raw_params, __x, __Mp);
+            const auto __p = $MODEL_momenta<number>(__x);
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            numeric_geometry<number, $NUMBER_FIELDS, 2> __geometry(__G.data());
+            __geometry.Riemann_A2(__p.data(), __A2);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __A2[FIELDS_FLATTEN($_a, $_b)] = $RIEMANN_A2[_ab]|;
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __A2[FIELDS_FLATTEN($_a, $_b)] = $RIEMANN_A2[_ab]|;
+          $ENDIF
         }
 
 
@@ -820,16 +983,24 @@ namespace transport
       void
       $MODEL_compute_Riemann_A3(const number* __raw_params, const StateType& __x, number __Mp, number* __A3)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<3>(__raw_params, __x, __Mp);
+            const auto __p = $MODEL_momenta<number>(__x);
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            numeric_geometry<number, $NUMBER_FIELDS, 3> __geometry(__G.data());
+            __geometry.Riemann_A3(__p.data(), __A3);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __A3[FIELDS_FLATTEN($_a, $_b, $_c)] = $RIEMANN_A3[_abc]|;
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __A3[FIELDS_FLATTEN($_a, $_b, $_c)] = $RIEMANN_A3[_abc]|;
+          $ENDIF
         }
 
 
@@ -837,16 +1008,24 @@ namespace transport
       void
       $MODEL_compute_Riemann_B3(const number* __raw_params, const StateType& __x, number __Mp, number* __B3)
         {
-          DEFINE_INDEX_TOOLS
-          $RESOURCE_RELEASE
+          $IF{numeric_curvature}
+            const auto __G = $MODEL_jet_G<2>(__raw_params, __x, __Mp);
+            const auto __p = $MODEL_momenta<number>(__x);
 
-          $RESOURCE_PARAMETERS{__raw_params}
-          $RESOURCE_COORDINATES{__x}
+            numeric_geometry<number, $NUMBER_FIELDS, 2> __geometry(__G.data());
+            __geometry.Riemann_B3(__p.data(), __B3);
+          $ELSE
+            DEFINE_INDEX_TOOLS
+            $RESOURCE_RELEASE
 
-          $TEMP_POOL{"const auto $1 = $2;"}
+            $RESOURCE_PARAMETERS{__raw_params}
+            $RESOURCE_COORDINATES{__x}
 
-          // force unroll to make explicit that we wish to populate array elements
-          __B3[FIELDS_FLATTEN($_a, $_b, $_c)] = $RIEMANN_B3[_abc]|;
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            // force unroll to make explicit that we wish to populate array elements
+            __B3[FIELDS_FLATTEN($_a, $_b, $_c)] = $RIEMANN_B3[_abc]|;
+          $ENDIF
         }
     $ENDIF
 
@@ -906,6 +1085,27 @@ namespace transport
 
         if(input.size() == $NUMBER_PARAMS)
           {
+            $IF{specialized}
+              // this variant was translated with fixed parameter values, which have been folded into the
+              // generated code; it gives wrong answers for any other values, so reject them
+              const std::vector<unsigned int> __fixed_index = $SPECIALIZED_PARAM_INDICES;
+              const std::vector<double> __fixed_value = $SPECIALIZED_PARAM_VALUES;
+
+              for(unsigned int __i = 0; __i < __fixed_index.size(); ++__i)
+                {
+                  double __supplied = static_cast<double>(input[__fixed_index[__i]]);
+
+                  if(std::abs(__supplied - __fixed_value[__i]) > CPPTRANSPORT_DEFAULT_SPECIALIZATION_TOLERANCE * std::abs(__fixed_value[__i]))
+                    {
+                      std::ostringstream msg;
+                      msg << CPPTRANSPORT_SPECIALIZED_PARAMS_A << this->get_param_names()[__fixed_index[__i]] << " = " << __fixed_value[__i]
+                          << CPPTRANSPORT_SPECIALIZED_PARAMS_B << __supplied;
+
+                      throw std::invalid_argument(msg.str());
+                    }
+                }
+            $ENDIF
+
             output.assign(input.begin(), input.end());
           }
         else
@@ -1439,6 +1639,11 @@ namespace transport
           $RESOURCE_G[_ab]{__G};
         $ENDIF;
 
+        $IF{numeric_curvature}
+          $MODEL_compute_Ginv(__raw_params, __state, __Mp, __Ginv);
+          $RESOURCE_G[^ab]{__Ginv}
+        $ENDIF
+
         $TEMP_POOL{"const auto $1 = $2;"}
 
         __dN[FLATTEN($_A)] = $ZETA_XFM_1[_A];
@@ -1468,6 +1673,11 @@ namespace transport
           $RESOURCE_DV[_a]{__dV}
         $ENDIF
 
+        $IF{numeric_curvature}
+          $MODEL_compute_Ginv(__raw_params, __state, __Mp, __Ginv);
+          $RESOURCE_G[^ab]{__Ginv}
+        $ENDIF
+
         $TEMP_POOL{"const auto $1 = $2;"}
 
         __ddN[FLATTEN($_A,$_B)] = $ZETA_XFM_2[_AB]{__k, __k1, __k2, __a};
@@ -1581,6 +1791,11 @@ namespace transport
           $RESOURCE_RIEMANN_A3[_abc]{__A3}
         $ENDIF
 
+        $IF{numeric_curvature}
+          $MODEL_compute_Ginv(__raw_params, __fields, __Mp, __Ginv);
+          $RESOURCE_G[^ab]{__Ginv}
+        $ENDIF
+
         $TEMP_POOL{"const auto $1 = $2;"}
     
         // compute A with all indices covariant
@@ -1742,6 +1957,215 @@ namespace transport
       }
 
 
+    template <typename number>
+    void $MODEL<number>::u2_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                         const std::vector<double>& __Nsample, const std::vector<double>& __klist,
+                                         std::vector< std::vector< std::vector<number> > >& __u2, unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+        const auto __Noffset = __task->get_astar_normalization() - __task->get_N_horizon_crossing();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        $IF{!fast}
+          std::vector<number> __batch_G($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_Ginv($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_A2($NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            const auto __a = std::exp(__Nsample[__j] + __Noffset);
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_G(__batch_params.data(), __fields, __Mp, __batch_G.data());
+              $MODEL_compute_Ginv(__batch_params.data(), __fields, __Mp, __batch_Ginv.data());
+              $MODEL_compute_dV(__batch_params.data(), __fields, __Mp, __batch_dV.data());
+              $MODEL_compute_ddV(__batch_params.data(), __fields, __Mp, __batch_ddV.data());
+              $MODEL_compute_Riemann_A2(__batch_params.data(), __fields, __Mp, __batch_A2.data());
+              $RESOURCE_G[_ab]{__batch_G}
+              $RESOURCE_G[^ab]{__batch_Ginv}
+              $RESOURCE_DV[_a]{__batch_dV}
+              $RESOURCE_DDV[_ab]{__batch_ddV}
+              $RESOURCE_RIEMANN_A2[_ab]{__batch_A2}
+            $ENDIF
+
+            for(unsigned int __n = 0; __n < __klist.size(); ++__n)
+              {
+                const auto __k = __klist[__n];
+                auto& __u2_n = __u2[__n];
+
+                $TEMP_POOL{"const auto $1 = $2;"}
+
+                __u2_n[FLATTEN($^A,$_B)][__j] = $U2_TENSOR[^A_B]{__k, __a};
+              }
+          }
+      }
+
+
+    template <typename number>
+    void $MODEL<number>::u3_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                         const std::vector<double>& __Nsample, const std::vector<double>& __k1list,
+                                         const std::vector<double>& __k2list, const std::vector<double>& __k3list,
+                                         std::vector< std::vector< std::vector<number> > >& __u3, unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+        const auto __Noffset = __task->get_astar_normalization() - __task->get_N_horizon_crossing();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        $IF{!fast}
+          std::vector<number> __batch_G($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_Ginv($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_dddV($NUMBER_FIELDS * $NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_A2($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_A3($NUMBER_FIELDS * $NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_B3($NUMBER_FIELDS * $NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            const auto __a = std::exp(__Nsample[__j] + __Noffset);
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_G(__batch_params.data(), __fields, __Mp, __batch_G.data());
+              $MODEL_compute_Ginv(__batch_params.data(), __fields, __Mp, __batch_Ginv.data());
+              $MODEL_compute_dV(__batch_params.data(), __fields, __Mp, __batch_dV.data());
+              $MODEL_compute_ddV(__batch_params.data(), __fields, __Mp, __batch_ddV.data());
+              $MODEL_compute_dddV(__batch_params.data(), __fields, __Mp, __batch_dddV.data());
+              $MODEL_compute_Riemann_A2(__batch_params.data(), __fields, __Mp, __batch_A2.data());
+              $MODEL_compute_Riemann_A3(__batch_params.data(), __fields, __Mp, __batch_A3.data());
+              $MODEL_compute_Riemann_B3(__batch_params.data(), __fields, __Mp, __batch_B3.data());
+              $RESOURCE_G[_ab]{__batch_G}
+              $RESOURCE_G[^ab]{__batch_Ginv}
+              $RESOURCE_DV[_a]{__batch_dV}
+              $RESOURCE_DDV[_ab]{__batch_ddV}
+              $RESOURCE_DDDV[_abc]{__batch_dddV}
+              $RESOURCE_RIEMANN_A2[_ab]{__batch_A2}
+              $RESOURCE_RIEMANN_A3[_abc]{__batch_A3}
+              $RESOURCE_RIEMANN_B3[_abc]{__batch_B3}
+            $ENDIF
+
+            for(unsigned int __n = 0; __n < __k1list.size(); ++__n)
+              {
+                const auto __k1 = __k1list[__n];
+                const auto __k2 = __k2list[__n];
+                const auto __k3 = __k3list[__n];
+                auto& __u3_n = __u3[__n];
+
+                $TEMP_POOL{"const auto $1 = $2;"}
+
+                __u3_n[FLATTEN($^A,$_B,$_C)][__j] = $U3_TENSOR[^A_BC]{__k1, __k2, __k3, __a};
+              }
+          }
+      }
+
+
+    template <typename number>
+    void $MODEL<number>::sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* __task, const std::vector< std::vector<number> >& __history,
+                                                           const std::vector<double>& __Nsample, bool __norm, std::vector< std::vector<number> >& __E,
+                                                           unsigned int __begin, unsigned int __end)
+      {
+        DEFINE_INDEX_TOOLS
+        $RESOURCE_RELEASE
+
+        // parameter setup is shared by all samples in the batch
+        std::array<number, $NUMBER_PARAMS> __batch_params;
+        const auto& __pvector = __task->get_params().get_vector();
+        __batch_params[$1] = __pvector[$1];
+
+        const auto __Mp = __task->get_params().get_Mp();
+
+        flattened_tensor<number> __fields(2*$NUMBER_FIELDS);
+        flattened_tensor<number> __M($NUMBER_FIELDS * $NUMBER_FIELDS);
+        std::array<number, $NUMBER_FIELDS> __spectrum;
+        Eigen::Matrix<number, $NUMBER_FIELDS, $NUMBER_FIELDS> __batch_mass_matrix;
+        $IF{!fast}
+          std::vector<number> __batch_G($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_Ginv($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_dV($NUMBER_FIELDS);
+          std::vector<number> __batch_ddV($NUMBER_FIELDS * $NUMBER_FIELDS);
+          std::vector<number> __batch_A2($NUMBER_FIELDS * $NUMBER_FIELDS);
+        $ENDIF
+
+        for(unsigned int __j = __begin; __j < __end; ++__j)
+          {
+            for(unsigned int __i = 0; __i < 2*$NUMBER_FIELDS; ++__i)
+              {
+                __fields[__i] = __history[__i][__j];
+              }
+
+            $RESOURCE_PARAMETERS{__batch_params}
+            $RESOURCE_COORDINATES{__fields}
+            $IF{!fast}
+              $MODEL_compute_G(__batch_params.data(), __fields, __Mp, __batch_G.data());
+              $MODEL_compute_Ginv(__batch_params.data(), __fields, __Mp, __batch_Ginv.data());
+              $MODEL_compute_dV(__batch_params.data(), __fields, __Mp, __batch_dV.data());
+              $MODEL_compute_ddV(__batch_params.data(), __fields, __Mp, __batch_ddV.data());
+              $MODEL_compute_Riemann_A2(__batch_params.data(), __fields, __Mp, __batch_A2.data());
+              $RESOURCE_G[_ab]{__batch_G}
+              $RESOURCE_G[^ab]{__batch_Ginv}
+              $RESOURCE_DV[_a]{__batch_dV}
+              $RESOURCE_DDV[_ab]{__batch_ddV}
+              $RESOURCE_RIEMANN_A2[_ab]{__batch_A2}
+            $ENDIF
+
+            $TEMP_POOL{"const auto $1 = $2;"}
+
+            __M[FIELDS_FLATTEN($^a,$_b)] = $M_TENSOR[^a_b];
+            const auto __Hsq = $HUBBLE_SQ;
+
+            __batch_mass_matrix($^a,$_b) = __M[FIELDS_FLATTEN($^a,$_b)];
+
+            // extract eigenvalues from the self-adjoint view, as for mass_spectrum(), and sort them into order
+            auto __evalues = __batch_mass_matrix.template selfadjointView<Eigen::Upper>().eigenvalues();
+
+            for(unsigned int __i = 0; __i < $NUMBER_FIELDS; ++__i)
+              {
+                __spectrum[__i] = __evalues(__i);
+              }
+            std::sort(__spectrum.begin(), __spectrum.end());
+
+            for(unsigned int __i = 0; __i < $NUMBER_FIELDS; ++__i)
+              {
+                __E[__i][__j] = __norm ? __spectrum[__i] / __Hsq : __spectrum[__i];
+              }
+          }
+      }
+
+
     template <typename number>
     void $MODEL<number>::backend_process_backg(const background_task<number>* tk, backg_history<number>& solution, bool silent)
       {
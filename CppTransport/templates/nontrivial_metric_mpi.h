@@ -142,21 +142,6 @@ namespace transport
         $MODEL_mpi(local_environment& e, argument_cache& a)
           : $MODEL<number>(e, a)
           {
-#ifdef CPPTRANSPORT_INSTRUMENT
-            twopf_setup_timer.stop();
-            twopf_u_tensor_timer.stop();
-            twopf_transport_eq_timer.stop();
-
-            threepf_setup_timer.stop();
-            threepf_u_tensor_timer.stop();
-            threepf_transport_eq_timer.stop();
-
-            twopf_items = 0;
-            threepf_items = 0;
-
-            twopf_invokations = 0;
-            threepf_invokations = 0;
-#endif
           }
 
         // destructor is default unless instrumented
@@ -164,39 +149,8 @@ namespace transport
         //! instrumented destructor
         ~$MODEL_mpi()
           {
-            if(this->twopf_items > 0)
-              {
-                std::cout << '\n' << "TWOPF INSTRUMENTATION REPORT" << '\n';
-                std::cout << "* TOTALS" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user) << " user, " << format_time(twopf_setup_timer.elapsed().system) << " system, " << format_time(twopf_setup_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "* PER ITEM" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_setup_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_setup_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user/this->twopf_items) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system/this->twopf_items) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall/this->twopf_items) << " wall" << '\n';
-                std::cout << "* PER INVOKATION" << '\n';
-                std::cout << "  -- setup: " << format_time(twopf_setup_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_setup_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_setup_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(twopf_u_tensor_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_u_tensor_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_u_tensor_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(twopf_transport_eq_timer.elapsed().user/this->twopf_invokations) << " user, " << format_time(twopf_transport_eq_timer.elapsed().system/this->twopf_invokations) << " system, " << format_time(twopf_transport_eq_timer.elapsed().wall/this->twopf_invokations) << " wall" << '\n';
-              }
-
-            if(this->threepf_items > 0)
-              {
-                std::cout << '\n' << "THREEPF INSTRUMENTATION REPORT" << '\n';
-                std::cout << "* TOTALS" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user) << " user, " << format_time(threepf_setup_timer.elapsed().system) << " system, " << format_time(threepf_setup_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall) << " wall" << '\n';
-                std::cout << "* PER ITEM" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_setup_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_setup_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user/this->threepf_items) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system/this->threepf_items) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall/this->threepf_items) << " wall" << '\n';
-                std::cout << "* PER INVOKATION" << '\n';
-                std::cout << "  -- setup: " << format_time(threepf_setup_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_setup_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_setup_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-                std::cout << "  -- U tensors: " << format_time(threepf_u_tensor_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_u_tensor_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_u_tensor_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-                std::cout << "  -- transport equations: " << format_time(threepf_transport_eq_timer.elapsed().user/this->threepf_invokations) << " user, " << format_time(threepf_transport_eq_timer.elapsed().system/this->threepf_invokations) << " system, " << format_time(threepf_transport_eq_timer.elapsed().wall/this->threepf_invokations) << " wall" << '\n';
-              }
+            if(this->twopf_profile.get_configurations() > 0) this->twopf_profile.write(std::cout, "TWOPF");
+            if(this->threepf_profile.get_configurations() > 0) this->threepf_profile.write(std::cout, "THREEPF");
           }
 #else
         //! uninstrumented destructor
@@ -223,6 +177,11 @@ namespace transport
         //! return perturbations tolerances
         std::pair< double, double > get_pert_tol() const override { return std::make_pair($PERT_ABS_ERR, $PERT_REL_ERR); }
 
+        $IF{dual_unroll}
+          //! return kernel variants selected by calibration
+          std::string get_kernel_variant() const override { return describe_kernel_variants(this->twopf_variant, this->threepf_variant); }
+        $ENDIF
+
 
         // BACKEND INTERFACE
 
@@ -257,6 +216,10 @@ namespace transport
         //! query whether backend support collection of per-configuration statistics
         virtual bool supports_per_configuration_statistics() const override { return(true); }
 
+        //! integrate a 2pf configuration with a stepper selected at runtime, for benchmarking
+        bool backend_autotune(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk, const stepper_candidate& stepper,
+                              std::vector< std::vector<number> >& samples) override;
+
 
         // INTERNAL API
 
@@ -264,11 +227,13 @@ namespace transport
 
         //! integrate a single 2pf k-configuration
         void twopf_kmode(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk,
-                         twopf_batcher<number>& batcher, unsigned int refinement_level);
+                         twopf_batcher<number>& batcher, unsigned int refinement_level,
+                         const typename integration_items<number>::checkpoint_item* resume = nullptr);
 
         //! integrate a single 3pf k-configuration
         void threepf_kmode(const threepf_kconfig_record&, const threepf_task<number>* tk,
-                           threepf_batcher<number>& batcher, unsigned int refinement_level);
+                           threepf_batcher<number>& batcher, unsigned int refinement_level,
+                           const typename integration_items<number>::checkpoint_item* resume = nullptr);
 
         //! populate initial values for a 2pf configuration
         void populate_twopf_ic(twopf_state& x, unsigned int start, double kmode, double Ninit,
@@ -282,25 +247,33 @@ namespace transport
         void populate_threepf_ic(threepf_state& x, unsigned int start, const threepf_kconfig& kconfig,
                                  double Ninit, const twopf_db_task<number>* tk, const std::vector<number>& ic, double k_normalize=1.0);
 
+        $IF{dual_unroll}
+          //! time the unrolled and rolled 2pf kernels on a representative configuration, and select the faster
+          void calibrate_twopf_kernels(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk, twopf_batcher<number>& batcher);
+
+          //! time the unrolled and rolled 3pf kernels on a representative configuration, and select the faster
+          void calibrate_threepf_kernels(const threepf_kconfig_record& kconfig, const threepf_task<number>* tk, threepf_batcher<number>& batcher);
+        $ENDIF
+
 
         // INTERNAL DATA
 
       private:
 
-#ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer twopf_setup_timer;
-        boost::timer::cpu_timer twopf_u_tensor_timer;
-        boost::timer::cpu_timer twopf_transport_eq_timer;
+        $IF{dual_unroll}
+          //! kernel variant selected for 2pf integrations; empty until calibrated
+          boost::optional<kernel_variant> twopf_variant;
 
-        unsigned int twopf_items;
-        unsigned int twopf_invokations;
+          //! kernel variant selected for 3pf integrations; empty until calibrated
+          boost::optional<kernel_variant> threepf_variant;
+        $ENDIF
 
-        boost::timer::cpu_timer threepf_setup_timer;
-        boost::timer::cpu_timer threepf_u_tensor_timer;
-        boost::timer::cpu_timer threepf_transport_eq_timer;
+#ifdef CPPTRANSPORT_INSTRUMENT
+        //! hot-path profile aggregated over all twopf configurations processed by this model instance
+        hot_path::profile_accumulator twopf_profile;
 
-        unsigned int threepf_items;
-        unsigned int threepf_invokations;
+        //! hot-path profile aggregated over all threepf configurations processed by this model instance
+        hot_path::profile_accumulator threepf_profile;
 #endif
 
       };
@@ -325,10 +298,7 @@ namespace transport
         $MODEL_mpi_twopf_functor(const twopf_db_task<number>* tk, const twopf_kconfig& k
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            boost::timer::cpu_timer& st,
-            boost::timer::cpu_timer& ut,
-            boost::timer::cpu_timer& tt,
-            unsigned int& in
+            hot_path::integration_profile& pf
 #endif
         )
           : __params(tk->get_params()),
@@ -349,13 +319,14 @@ namespace transport
               __TimeGamma(nullptr),
             $ENDIF
 
+            $IF{dual_unroll}
+              __variant(kernel_variant::unrolled),
+            $ENDIF
+
             __raw_params(nullptr)
 #ifdef CPPTRANSPORT_INSTRUMENT
             ,
-                __setup_timer(st),
-                __u_tensor_timer(ut),
-                __transport_eq_timer(tt),
-                __invokations(in)
+                __profile(pf)
 #endif
           {
           }
@@ -402,7 +373,25 @@ namespace transport
             delete[] this->__raw_params;
           }
 
-        void operator()(const twopf_state& __x, twopf_state& __dxdt, number __t);
+        $IF{dual_unroll}
+          //! evaluate the RHS using the kernel variant selected by calibration
+          void operator()(const twopf_state& __x, twopf_state& __dxdt, number __t)
+            {
+              if(this->__variant == kernel_variant::rolled) this->rhs_rolled(__x, __dxdt, __t);
+              else                                          this->rhs_unrolled(__x, __dxdt, __t);
+            }
+
+          //! evaluate the RHS using the unrolled kernel
+          void rhs_unrolled(const twopf_state& __x, twopf_state& __dxdt, number __t);
+
+          //! evaluate the RHS using the rolled kernel
+          void rhs_rolled(const twopf_state& __x, twopf_state& __dxdt, number __t);
+
+          //! select kernel variant used by operator()
+          void set_kernel_variant(kernel_variant v) { this->__variant = v; }
+        $ELSE
+          void operator()(const twopf_state& __x, twopf_state& __dxdt, number __t);
+        $ENDIF
 
         // adjust horizon exit time, given an initial time N_init which we wish to move to zero
         void rebase_horizon_exit_time(double N_init) { this->__N_horizon_exit -= N_init; }
@@ -441,13 +430,16 @@ namespace transport
           number* __TimeGamma;
         $ENDIF
 
+        $IF{dual_unroll}
+          //! kernel variant used by operator()
+          kernel_variant __variant;
+        $ENDIF
+
         number* __raw_params;
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer& __setup_timer;
-        boost::timer::cpu_timer& __u_tensor_timer;
-        boost::timer::cpu_timer& __transport_eq_timer;
-        unsigned int& __invokations;
+        //! per-configuration profile; sampled evaluations record their phase timings here
+        hot_path::integration_profile& __profile;
 #endif
 
       };
@@ -501,10 +493,7 @@ namespace transport
         $MODEL_mpi_threepf_functor(const twopf_db_task<number>* tk, const threepf_kconfig& k
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-          boost::timer::cpu_timer& st,
-          boost::timer::cpu_timer& ut,
-          boost::timer::cpu_timer& tt,
-          unsigned int& in
+          hot_path::integration_profile& pf
 #endif
         )
           : __params(tk->get_params()),
@@ -535,13 +524,14 @@ namespace transport
               __TimeGamma(nullptr),
             $ENDIF
 
+            $IF{dual_unroll}
+              __variant(kernel_variant::unrolled),
+            $ENDIF
+
             __raw_params(nullptr)
 #ifdef CPPTRANSPORT_INSTRUMENT
             ,
-            __setup_timer(st),
-            __u_tensor_timer(ut),
-            __transport_eq_timer(tt),
-            __invokations(in)
+            __profile(pf)
 #endif
           {
           }
@@ -606,7 +596,25 @@ namespace transport
             delete[] this->__raw_params;
           }
 
-        void operator()(const threepf_state& __x, threepf_state& __dxdt, number __dt);
+        $IF{dual_unroll}
+          //! evaluate the RHS using the kernel variant selected by calibration
+          void operator()(const threepf_state& __x, threepf_state& __dxdt, number __t)
+            {
+              if(this->__variant == kernel_variant::rolled) this->rhs_rolled(__x, __dxdt, __t);
+              else                                          this->rhs_unrolled(__x, __dxdt, __t);
+            }
+
+          //! evaluate the RHS using the unrolled kernel
+          void rhs_unrolled(const threepf_state& __x, threepf_state& __dxdt, number __t);
+
+          //! evaluate the RHS using the rolled kernel
+          void rhs_rolled(const threepf_state& __x, threepf_state& __dxdt, number __t);
+
+          //! select kernel variant used by operator()
+          void set_kernel_variant(kernel_variant v) { this->__variant = v; }
+        $ELSE
+          void operator()(const threepf_state& __x, threepf_state& __dxdt, number __dt);
+        $ENDIF
 
         // adjust horizon exit time, given an initial time N_init which we wish to move to zero
         void rebase_horizon_exit_time(double N_init) { this->__N_horizon_exit -= N_init; }
@@ -653,13 +661,16 @@ namespace transport
           number* __TimeGamma;
         $ENDIF
 
+        $IF{dual_unroll}
+          //! kernel variant used by operator()
+          kernel_variant __variant;
+        $ENDIF
+
         number* __raw_params;
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        boost::timer::cpu_timer& __setup_timer;
-        boost::timer::cpu_timer& __u_tensor_timer;
-        boost::timer::cpu_timer& __transport_eq_timer;
-        unsigned int& __invokations;
+        //! per-configuration profile; sampled evaluations record their phase timings here
+        hot_path::integration_profile& __profile;
 #endif
 
       };
@@ -761,16 +772,30 @@ namespace transport
         assert(queues.size() == 1);
         const work_queue<twopf_kconfig_record>::device_work_list list = queues[0];
 
+        $IF{dual_unroll}
+          // choose between the unrolled and rolled kernels the first time this model receives 2pf work
+          if(!this->twopf_variant && list.size() > 0) this->calibrate_twopf_kernels(list[0], tk, batcher);
+        $ENDIF
+
         for(unsigned int i = 0; i < list.size(); ++i)
           {
             bool success = false;
             unsigned int refinement_level = 0;
 
+            // if this configuration was in flight when an earlier integration was interrupted, resume it from its checkpoint
+            const typename integration_items<number>::checkpoint_item* resume = batcher.find_resume_checkpoint(list[i]->serial);
+            if(resume != nullptr)
+              {
+                refinement_level = resume->refinement;
+                BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+                    << "** " << CPPTRANSPORT_RESUME_CONFIG << " " << list[i]->serial << " " << CPPTRANSPORT_RESUME_FROM_SAMPLE << " " << resume->samples.size();
+              }
+
             while(!success)
             try
               {
                 // write the time history for this k-configuration
-                this->twopf_kmode(list[i], tk, batcher, refinement_level);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
+                this->twopf_kmode(list[i], tk, batcher, refinement_level, resume);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
                 success = true;
                }
             catch(std::overflow_error& xe)
@@ -779,6 +804,7 @@ namespace transport
                 if(refinement_level == 0) batcher.report_refinement();
                 batcher.unbatch(list[i]->serial);
                 refinement_level++;
+                resume = nullptr;     // a refined mesh is integrated from the beginning
 
                 BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::warning)
                     << "** " << CPPTRANSPORT_RETRY_CONFIG << " " << list[i]->serial << " (" << i+1
@@ -803,7 +829,8 @@ namespace transport
     template <typename number, typename StateType>
     void $MODEL_mpi<number, StateType>::twopf_kmode(const twopf_kconfig_record& kconfig,
                                                     const twopf_db_task<number>* tk,
-                                                    twopf_batcher<number>& batcher, unsigned int refinement_level)
+                                                    twopf_batcher<number>& batcher, unsigned int refinement_level,
+                                                    const typename integration_items<number>::checkpoint_item* resume)
       {
         DEFINE_INDEX_TOOLS
         
@@ -816,15 +843,29 @@ namespace transport
         // this also starts the timers running, so we do it as early as possible
         $MODEL_mpi_twopf_observer< $MODEL_mpi<number, StateType> > obs(batcher, kconfig, tk->get_initial_time(*kconfig), time_db);
 
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // set up a profile for this configuration; it is confined to this thread until merged below
+        hot_path::integration_profile profile;
+        obs.attach_profile(profile);
+#endif
+
+        // set up an agent to checkpoint this integration, so it can be resumed if interrupted
+        checkpoint_agent<number> checkpointer(batcher, kconfig->serial, refinement_level, $PERT_STEP_SIZE/pow(4.0,refinement_level));
+        obs.attach_checkpoint(checkpointer);
+
         // set up a functor to evolve this system
         $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            this->twopf_setup_timer, this->twopf_u_tensor_timer, this->twopf_transport_eq_timer, this->twopf_invokations
+            profile
 #endif
           );
         rhs.set_up_workspace();
 
+        $IF{dual_unroll}
+          if(this->twopf_variant) rhs.set_kernel_variant(*this->twopf_variant);
+        $ENDIF
+
         // set up a state vector
         twopf_state x;
         x.resize($MODEL_pool::twopf_state_size);
@@ -855,6 +896,25 @@ namespace transport
         auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
         auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
 
+        // if resuming from a checkpoint, replay the observer over all but the most recent stored sample,
+        // then restart the integration from that sample (which the integrator will observe as its initial point).
+        // The stepper restarts from its initial step size; the step size controller recovers within a few steps
+        if(resume != nullptr && !resume->samples.empty())
+          {
+            if(resume->samples.back().position != resume->samples.size() || resume->samples.back().state.size() != x.size())
+              throw runtime_exception(exception_type::INTEGRATION_FAILURE, CPPTRANSPORT_CHECKPOINT_MISMATCH);
+
+            for(unsigned int i = 0; i+1 < resume->samples.size(); ++i)
+              {
+                obs(resume->samples[i].state, static_cast<number>(resume->samples[i].time));
+              }
+
+            const std::vector<number>& last = resume->samples.back().state;
+            for(unsigned int i = 0; i < x.size(); ++i) x[i] = last[i];
+
+            std::advance(begin_iterator, resume->samples.size()-1);
+          }
+
         using boost::numeric::odeint::integrate_times;
         
         auto stepper = $MAKE_PERT_STEPPER{twopf_state, number, number, CPPTRANSPORT_ALGEBRA_NAME(twopf_state), CPPTRANSPORT_OPERATIONS_NAME(twopf_state)};
@@ -865,11 +925,70 @@ namespace transport
         rhs.close_down_workspace();
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        ++this->twopf_items;
+        this->twopf_profile.merge(profile);
 #endif
       }
 
 
+    template <typename number, typename StateType>
+    bool $MODEL_mpi<number, StateType>::backend_autotune(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk,
+                                                         const stepper_candidate& stepper, std::vector< std::vector<number> >& samples)
+      {
+        DEFINE_INDEX_TOOLS
+
+        // get time configuration database
+        const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // benchmark integrations are not included in the model's profile
+        hot_path::integration_profile profile;
+#endif
+
+        // set up a functor to evolve this system
+        $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+          ,
+            profile
+#endif
+          );
+        rhs.set_up_workspace();
+
+        $IF{dual_unroll}
+          if(this->twopf_variant) rhs.set_kernel_variant(*this->twopf_variant);
+        $ENDIF
+
+        // set up a state vector
+        twopf_state x;
+        x.resize($MODEL_pool::twopf_state_size);
+
+        // fix initial conditions - background
+        const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+        x[$MODEL_pool::backg_start + FLATTEN($^A)] = ics[$^A];
+
+        // fix initial conditions - tensors and 2pf, exactly as for a production integration
+        this->populate_tensor_ic(x, $MODEL_pool::tensor_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+        this->populate_twopf_ic(x, $MODEL_pool::twopf_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+
+        rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+        auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
+        auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
+
+        // record the state at each time sample; no batcher is involved, so nothing is written to a container
+        samples.clear();
+        auto obs = [&](const twopf_state& s, number t) -> void
+          {
+            samples.emplace_back(s.size());
+            for(unsigned int i = 0; i < s.size(); ++i) samples.back()[i] = s[i];
+          };
+
+        stepper_factory::integrate_times<twopf_state, number, CPPTRANSPORT_ALGEBRA_NAME(twopf_state), CPPTRANSPORT_OPERATIONS_NAME(twopf_state)>
+          (stepper, rhs, x, begin_iterator, end_iterator, static_cast<number>($PERT_STEP_SIZE), obs);
+
+        rhs.close_down_workspace();
+        return(true);
+      }
+
+
     // make initial conditions for each component of the 2pf
     // x           - state vector *containing* space for the 2pf (doesn't have to be entirely the 2pf)
     // start       - starting position of twopf components within the state vector
@@ -941,17 +1060,31 @@ namespace transport
         assert(queues.size() == 1);
         const work_queue<threepf_kconfig_record>::device_work_list list = queues[0];
 
+        $IF{dual_unroll}
+          // choose between the unrolled and rolled kernels the first time this model receives 3pf work
+          if(!this->threepf_variant && list.size() > 0) this->calibrate_threepf_kernels(list[0], tk, batcher);
+        $ENDIF
+
         // step through the queue, solving for the three-point functions in each case
         for(unsigned int i = 0; i < list.size(); ++i)
           {
             bool success = false;
             unsigned int refinement_level = 0;
 
+            // if this configuration was in flight when an earlier integration was interrupted, resume it from its checkpoint
+            const typename integration_items<number>::checkpoint_item* resume = batcher.find_resume_checkpoint(list[i]->serial);
+            if(resume != nullptr)
+              {
+                refinement_level = resume->refinement;
+                BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+                    << "** " << CPPTRANSPORT_RESUME_CONFIG << " " << list[i]->serial << " " << CPPTRANSPORT_RESUME_FROM_SAMPLE << " " << resume->samples.size();
+              }
+
             while(!success)
             try
               {
                 // write the time history for this k-configuration
-                this->threepf_kmode(list[i], tk, batcher, refinement_level);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
+                this->threepf_kmode(list[i], tk, batcher, refinement_level, resume);    // logging and report of successful integration are wrapped up in the observer stop_timers() method
                 success = true;
               }
             catch(std::overflow_error& xe)
@@ -960,6 +1093,7 @@ namespace transport
                 if(refinement_level == 0) batcher.report_refinement();
                 batcher.unbatch(list[i]->serial);
                 refinement_level++;
+                resume = nullptr;     // a refined mesh is integrated from the beginning
 
                 BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::warning)
                     << "** " << CPPTRANSPORT_RETRY_CONFIG << " " << list[i]->serial << " (" << i+1
@@ -985,7 +1119,8 @@ namespace transport
     template <typename number, typename StateType>
     void $MODEL_mpi<number, StateType>::threepf_kmode(const threepf_kconfig_record& kconfig,
                                                       const threepf_task<number>* tk,
-                                                      threepf_batcher<number>& batcher, unsigned int refinement_level)
+                                                      threepf_batcher<number>& batcher, unsigned int refinement_level,
+                                                      const typename integration_items<number>::checkpoint_item* resume)
       {
         DEFINE_INDEX_TOOLS
         
@@ -998,15 +1133,29 @@ namespace transport
         // this also starts the timers running, so we do it as early as possible
         $MODEL_mpi_threepf_observer< $MODEL_mpi<number, StateType> > obs(batcher, kconfig, tk->get_initial_time(*kconfig), time_db);
 
+#ifdef CPPTRANSPORT_INSTRUMENT
+        // set up a profile for this configuration; it is confined to this thread until merged below
+        hot_path::integration_profile profile;
+        obs.attach_profile(profile);
+#endif
+
+        // set up an agent to checkpoint this integration, so it can be resumed if interrupted
+        checkpoint_agent<number> checkpointer(batcher, kconfig->serial, refinement_level, $PERT_STEP_SIZE/pow(4.0,refinement_level));
+        obs.attach_checkpoint(checkpointer);
+
         // set up a functor to evolve this system
         $MODEL_mpi_threepf_functor< $MODEL_mpi<number, StateType> >  rhs(tk, *kconfig
 #ifdef CPPTRANSPORT_INSTRUMENT
           ,
-            this->threepf_setup_timer, this->threepf_u_tensor_timer, this->threepf_transport_eq_timer, this->threepf_invokations
+            profile
 #endif
           );
         rhs.set_up_workspace();
 
+        $IF{dual_unroll}
+          if(this->threepf_variant) rhs.set_kernel_variant(*this->threepf_variant);
+        $ENDIF
+
         // set up a state vector
         threepf_state x;
         x.resize($MODEL_pool::threepf_state_size);
@@ -1054,6 +1203,25 @@ namespace transport
         auto begin_iterator = time_db.value_begin(tk->get_ics().get_N_initial());
         auto end_iterator   = time_db.value_end(tk->get_ics().get_N_initial());
 
+        // if resuming from a checkpoint, replay the observer over all but the most recent stored sample,
+        // then restart the integration from that sample (which the integrator will observe as its initial point).
+        // The stepper restarts from its initial step size; the step size controller recovers within a few steps
+        if(resume != nullptr && !resume->samples.empty())
+          {
+            if(resume->samples.back().position != resume->samples.size() || resume->samples.back().state.size() != x.size())
+              throw runtime_exception(exception_type::INTEGRATION_FAILURE, CPPTRANSPORT_CHECKPOINT_MISMATCH);
+
+            for(unsigned int i = 0; i+1 < resume->samples.size(); ++i)
+              {
+                obs(resume->samples[i].state, static_cast<number>(resume->samples[i].time));
+              }
+
+            const std::vector<number>& last = resume->samples.back().state;
+            for(unsigned int i = 0; i < x.size(); ++i) x[i] = last[i];
+
+            std::advance(begin_iterator, resume->samples.size()-1);
+          }
+
         using boost::numeric::odeint::integrate_times;
         
         auto stepper = $MAKE_PERT_STEPPER{threepf_state, number, number, CPPTRANSPORT_ALGEBRA_NAME(threepf_state), CPPTRANSPORT_OPERATIONS_NAME(threepf_state)};
@@ -1064,7 +1232,7 @@ namespace transport
         rhs.close_down_workspace();
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        ++this->threepf_items;
+        this->threepf_profile.merge(profile);
 #endif
       }
 
@@ -1084,11 +1252,131 @@ namespace transport
       }
 
 
+    $IF{dual_unroll}
+      template <typename number, typename StateType>
+      void $MODEL_mpi<number, StateType>::calibrate_twopf_kernels(const twopf_kconfig_record& kconfig,
+                                                                  const twopf_db_task<number>* tk,
+                                                                  twopf_batcher<number>& batcher)
+        {
+          DEFINE_INDEX_TOOLS
+
+          // get time configuration database
+          const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+          // calibration evaluations are not included in the model's profile
+          hot_path::integration_profile profile;
+#endif
+
+          // set up a functor to evolve this system
+          $MODEL_mpi_twopf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+            ,
+              profile
+#endif
+            );
+          rhs.set_up_workspace();
+
+          // both kernels are timed at the initial conditions for this configuration
+          twopf_state x;
+          x.resize($MODEL_pool::twopf_state_size);
+
+          twopf_state dxdt;
+          dxdt.resize($MODEL_pool::twopf_state_size);
+
+          const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+          x[$MODEL_pool::backg_start + FLATTEN($A)] = ics[$A];
+
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_start, kconfig->k_comoving, *(time_db.value_begin()), tk, ics, kconfig->k_comoving);
+
+          rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+          const number t = *(time_db.value_begin(tk->get_ics().get_N_initial()));
+
+          kernel_calibration calibration = calibrate_kernel_variants([&]() -> void { rhs.rhs_unrolled(x, dxdt, t); },
+                                                                     [&]() -> void { rhs.rhs_rolled(x, dxdt, t); });
+          this->twopf_variant = calibration.get_variant();
+
+          BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+            << "** " << CPPTRANSPORT_KERNEL_TWOPF << " " << calibration;
+
+          rhs.close_down_workspace();
+        }
+
+
+      template <typename number, typename StateType>
+      void $MODEL_mpi<number, StateType>::calibrate_threepf_kernels(const threepf_kconfig_record& kconfig,
+                                                                    const threepf_task<number>* tk,
+                                                                    threepf_batcher<number>& batcher)
+        {
+          DEFINE_INDEX_TOOLS
+
+          // get time configuration database
+          const time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+#ifdef CPPTRANSPORT_INSTRUMENT
+          // calibration evaluations are not included in the model's profile
+          hot_path::integration_profile profile;
+#endif
+
+          // set up a functor to evolve this system
+          $MODEL_mpi_threepf_functor< $MODEL_mpi<number, StateType> > rhs(tk, *kconfig
+#ifdef CPPTRANSPORT_INSTRUMENT
+            ,
+              profile
+#endif
+            );
+          rhs.set_up_workspace();
+
+          // both kernels are timed at the initial conditions for this configuration
+          threepf_state x;
+          x.resize($MODEL_pool::threepf_state_size);
+
+          threepf_state dxdt;
+          dxdt.resize($MODEL_pool::threepf_state_size);
+
+          const std::vector<number> ics = tk->get_ics_vector(*kconfig);
+          x[$MODEL_pool::backg_start + FLATTEN($A)] = ics[$A];
+
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+          this->populate_tensor_ic(x, $MODEL_pool::tensor_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_re_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, false);
+
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k1_start, kconfig->k1_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k2_start, kconfig->k2_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+          this->populate_twopf_ic(x, $MODEL_pool::twopf_im_k3_start, kconfig->k3_comoving, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving, true);
+
+          this->populate_threepf_ic(x, $MODEL_pool::threepf_start, *kconfig, *(time_db.value_begin()), tk, ics, kconfig->kt_comoving);
+
+          rhs.rebase_horizon_exit_time(tk->get_ics().get_N_initial());
+          const number t = *(time_db.value_begin(tk->get_ics().get_N_initial()));
+
+          kernel_calibration calibration = calibrate_kernel_variants([&]() -> void { rhs.rhs_unrolled(x, dxdt, t); },
+                                                                     [&]() -> void { rhs.rhs_rolled(x, dxdt, t); });
+          this->threepf_variant = calibration.get_variant();
+
+          BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal)
+            << "** " << CPPTRANSPORT_KERNEL_THREEPF << " " << calibration;
+
+          rhs.close_down_workspace();
+        }
+    $ENDIF
+
+
     // IMPLEMENTATION - FUNCTOR FOR 2PF INTEGRATION
 
 
+    $VARIANTS
     template <typename Model>
+    $IF{dual_unroll}
+    void $MODEL_mpi_twopf_functor<Model>::rhs_$KERNEL_VARIANT(const twopf_state& __x, twopf_state& __dxdt, number __t)
+    $ELSE
     void $MODEL_mpi_twopf_functor<Model>::operator()(const twopf_state& __x, twopf_state& __dxdt, number __t)
+    $ENDIF
       {
         DEFINE_INDEX_TOOLS
         $RESOURCE_RELEASE
@@ -1119,7 +1407,9 @@ namespace transport
         $TEMP_POOL{"const auto $1 = $2;"}
         
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.resume();
+        // only a fraction of evaluations read the clock, so that instrumentation does not perturb the hot path
+        const bool __sampled = __profile.sample_rhs();
+        const hot_path::tick_type __tick_setup = __sampled ? hot_path::read_clock() : 0;
 #endif
         
         // set up components of the connexion
@@ -1147,8 +1437,7 @@ namespace transport
 #define __dtwopf(a,b)        __dxdt[$MODEL_pool::twopf_start + FLATTEN(a,b)]
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.stop();
-        __u_tensor_timer.resume();
+        const hot_path::tick_type __tick_u_tensor = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the background
@@ -1172,8 +1461,7 @@ namespace transport
         $U2_DECLARE[^A_B] = $U2_TENSOR[^A_B]{__k, __a};
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __u_tensor_timer.stop();
-        __transport_eq_timer.resume();
+        const hot_path::tick_type __tick_transport = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the 2pf
@@ -1190,10 +1478,10 @@ namespace transport
         __dtwopf($^A, MOMENTUM($^b)) $+= - $GAMMA[^b_c] * __twopf($^A, MOMENTUM($^c));
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __transport_eq_timer.stop();
-        ++__invokations;
+        if(__sampled) __profile.record_rhs(__tick_setup, __tick_u_tensor, __tick_transport, hot_path::read_clock());
 #endif
       }
+    $ENDVARIANTS
 
 
     // IMPLEMENTATION - FUNCTOR FOR 2PF OBSERVATION
@@ -1225,6 +1513,7 @@ namespace transport
 
         this->start_batching(static_cast<double>(t), this->get_log(), generic_batcher::log_severity_level::normal);
         this->push(x);
+        this->checkpoint(x, static_cast<double>(t));
         this->stop_batching();
       }
 
@@ -1232,8 +1521,13 @@ namespace transport
     // IMPLEMENTATION - FUNCTOR FOR 3PF INTEGRATION
 
 
+    $VARIANTS
     template <typename Model>
+    $IF{dual_unroll}
+    void $MODEL_mpi_threepf_functor<Model>::rhs_$KERNEL_VARIANT(const threepf_state& __x, threepf_state& __dxdt, number __t)
+    $ELSE
     void $MODEL_mpi_threepf_functor<Model>::operator()(const threepf_state& __x, threepf_state& __dxdt, number __t)
+    $ENDIF
       {
         DEFINE_INDEX_TOOLS
         $RESOURCE_RELEASE
@@ -1268,7 +1562,9 @@ namespace transport
         $ENDIF
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.resume();
+        // only a fraction of evaluations read the clock, so that instrumentation does not perturb the hot path
+        const bool __sampled = __profile.sample_rhs();
+        const hot_path::tick_type __tick_setup = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         $TEMP_POOL{"const auto $1 = $2;"}
@@ -1336,8 +1632,7 @@ namespace transport
 #define __dthreepf(a,b,c)       __dxdt[$MODEL_pool::threepf_start     + FLATTEN(a,b,c)]
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __setup_timer.stop();
-        __u_tensor_timer.resume();
+        const hot_path::tick_type __tick_u_tensor = __sampled ? hot_path::read_clock() : 0;
 #endif
     
         // set up components of the connexion
@@ -1384,8 +1679,7 @@ namespace transport
         $U3_k3k1k2_DECLARE[^A_BC] = $U3_TENSOR[^A_BC]{__k3, __k1, __k2, __a};
 
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __u_tensor_timer.stop();
-        __transport_eq_timer.resume();
+        const hot_path::tick_type __tick_transport = __sampled ? hot_path::read_clock() : 0;
 #endif
 
         // evolve the real and imaginary components of the 2pf
@@ -1476,10 +1770,10 @@ namespace transport
         __dthreepf($^A, $^B, MOMENTUM($^c)) $+= - $GAMMA[^c_d] * __threepf($^A, $^B, MOMENTUM($^d));
         
 #ifdef CPPTRANSPORT_INSTRUMENT
-        __transport_eq_timer.stop();
-        ++__invokations;
+        if(__sampled) __profile.record_rhs(__tick_setup, __tick_u_tensor, __tick_transport, hot_path::read_clock());
 #endif
       }
+    $ENDVARIANTS
 
 
     // IMPLEMENTATION - FUNCTOR FOR 3PF OBSERVATION
@@ -1546,11 +1840,74 @@ namespace transport
 
         this->start_batching(static_cast<double>(t), this->get_log(), generic_batcher::log_severity_level::normal);
         this->push(x);
+        this->checkpoint(x, static_cast<double>(t));
         this->stop_batching();
       }
 
 
+    $IF{split}
+      // SPLIT TRANSLATION UNITS
+
+
+      // with --split, the expensive parts of this implementation are instantiated for the default number and
+      // state types in separate translation units which can be compiled in parallel. Any other translation unit
+      // including this header sees only the explicit instantiation declarations and does not instantiate them
+      // again; models using other number types are instantiated implicitly, as usual
+      namespace $MODEL_split
+        {
+          using number = default_number_type;
+          using model_type = $MODEL_mpi<number, std::vector<number> >;
+          using state_type = model_type::twopf_state;
+        }
+
+
+      extern template void $MODEL<$MODEL_split::number>::u2(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::u3(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::A(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::B(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::C(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      extern template void $MODEL<$MODEL_split::number>::u2_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+      extern template void $MODEL<$MODEL_split::number>::u3_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+
+      extern template class $MODEL_mpi_twopf_functor<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_threepf_functor<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_twopf_observer<$MODEL_split::model_type>;
+      extern template class $MODEL_mpi_threepf_observer<$MODEL_split::model_type>;
+
+#ifdef $SPLIT_UNIT{tensors}
+      template void $MODEL<$MODEL_split::number>::u2(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::u3(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::A(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::B(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::C(const twopf_db_task<$MODEL_split::number>*, const flattened_tensor<$MODEL_split::number>&, double, double, double, double, flattened_tensor<$MODEL_split::number>&);
+      template void $MODEL<$MODEL_split::number>::u2_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+      template void $MODEL<$MODEL_split::number>::u3_batch_kernel(const twopf_db_task<$MODEL_split::number>*, const std::vector< std::vector<$MODEL_split::number> >&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, const std::vector<double>&, std::vector< std::vector< std::vector<$MODEL_split::number> > >&, unsigned int, unsigned int);
+#endif
+
+#ifdef $SPLIT_UNIT{twopf}
+      template class $MODEL_mpi_twopf_functor<$MODEL_split::model_type>;
+#endif
+
+#ifdef $SPLIT_UNIT{threepf}
+      template class $MODEL_mpi_threepf_functor<$MODEL_split::model_type>;
+#endif
+
+#ifdef $SPLIT_UNIT{observers}
+      template class $MODEL_mpi_twopf_observer<$MODEL_split::model_type>;
+      template class $MODEL_mpi_threepf_observer<$MODEL_split::model_type>;
+#endif
+    $ENDIF
+
+
     }   // namespace transport
 
 
+$IF{plugin}
+// entry points used by the runtime to load this model from a plugin; defined only in the plugin's translation unit
+#ifdef CPPTRANSPORT_MODEL_PLUGIN
+CPPTRANSPORT_DEFINE_MODEL_PLUGIN(transport::$MODEL_mpi<>, "$UNIQUE_ID")
+#endif
+$ENDIF
+
+
 #endif  // $GUARD
@@ -0,0 +1,80 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+
+#include "axion_mpi.h"
+
+#include "suite.h"
+#include "models.h"
+
+
+namespace benchmarks
+  {
+
+    void run_suite(report& rep, const configuration& cfg, transport::local_environment& env, transport::argument_cache& cache)
+      {
+        using DataType = double;
+        using StateType = std::vector<DataType>;
+        using Model = transport::axion_mpi<DataType, StateType>;
+
+        transport::model_manager<DataType> finder(env, cache);
+        std::shared_ptr<Model> model = finder.create_model<Model>();
+
+        // parameter choices follow the test-canonical example
+        const DataType M_P = 1.0;
+        const DataType m = 1E-5;
+        const DataType f = M_P;
+        const DataType Lambda = std::pow(5.0 * m * m * f * f / (4.0 * M_PI * M_PI), 0.25);
+
+        transport::parameters<DataType> params{M_P, {m, Lambda, f, M_PI}, model};
+
+        const DataType phi_init = 16.5 * M_P;
+        const DataType chi_init = f/2.0 - 0.001 * M_P;
+
+        const double N_init = 0.0;
+        const double N_pre  = 12.0;
+        const double N_end  = 60.0;
+
+        transport::initial_conditions<DataType> ics{"axion-benchmark", params, {phi_init, chi_init}, N_init, N_pre};
+
+        transport::basic_range<double> times{N_init, N_end, 300, transport::spacing::linear};
+        transport::basic_range<double> ks{std::exp(3.0), std::exp(6.0), 16, transport::spacing::log_bottom};
+        transport::basic_range<double> ks_threepf{std::exp(3.0), std::exp(5.0), 4, transport::spacing::log_bottom};
+
+        transport::twopf_task<DataType> tk2{"axion-benchmark.twopf", ics, times, ks};
+        transport::threepf_cubic_task<DataType> tk3{"axion-benchmark.threepf", ics, times, ks_threepf};
+
+        benchmark_rhs< transport::axion_mpi_twopf_functor<Model>, StateType >(
+          rep, cfg, "axion", "twopf_rhs", tk2, tk2.get_twopf_database(), model->backend_twopf_state_size());
+
+        benchmark_rhs< transport::axion_mpi_threepf_functor<Model>, StateType >(
+          rep, cfg, "axion", "threepf_rhs", tk3, tk3.get_threepf_database(), model->backend_threepf_state_size());
+
+        benchmark_storage< transport::axion_mpi_twopf_observer<Model>, StateType >(
+          rep, cfg, "axion", finder, model.get(), tk2, model->backend_twopf_state_size(), env, cache);
+      }
+
+  }   // namespace benchmarks
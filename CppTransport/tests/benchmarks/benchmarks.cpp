@@ -0,0 +1,106 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+
+#include <fstream>
+
+#include "boost/program_options.hpp"
+
+#include "harness.h"
+#include "models.h"
+
+
+// CppTransport micro-benchmarks: RHS evaluation throughput, observer/batcher push throughput,
+// SQLite container write and aggregation time, and datapipe pull latency from a cold and warm linecache.
+// Results are written as a JSON document, so they can be compared between commits.
+// This driver is linked once per benchmark model; see models.h
+
+
+int main(int argc, char* argv[])
+  {
+    boost::program_options::options_description options("CppTransport benchmark options");
+    options.add_options()
+      ("help,h", "display this message")
+      ("output,o", boost::program_options::value<std::string>(), "write JSON results to the specified file (default: standard output)")
+      ("repeats,r", boost::program_options::value<unsigned int>()->default_value(10000), "number of RHS evaluations per benchmark")
+      ("scratch,s", boost::program_options::value<std::string>(), "scratch directory for repositories and containers")
+      ("keep", "do not delete the scratch directory on exit");
+
+    boost::program_options::variables_map option_map;
+    try
+      {
+        boost::program_options::store(boost::program_options::parse_command_line(argc, argv, options), option_map);
+        boost::program_options::notify(option_map);
+      }
+    catch(boost::program_options::error& xe)
+      {
+        std::cerr << xe.what() << '\n';
+        return(EXIT_FAILURE);
+      }
+
+    if(option_map.count("help"))
+      {
+        std::cout << options << '\n';
+        return(EXIT_SUCCESS);
+      }
+
+    benchmarks::configuration cfg;
+    cfg.repeats = option_map["repeats"].as<unsigned int>();
+    cfg.scratch = option_map.count("scratch")
+                  ? boost::filesystem::path(option_map["scratch"].as<std::string>())
+                  : boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("CppTransport-benchmarks-%%%%-%%%%");
+
+    if(boost::filesystem::exists(cfg.scratch) && !boost::filesystem::is_directory(cfg.scratch))
+      {
+        std::cerr << "Scratch location '" << cfg.scratch.string() << "' exists but is not a directory" << '\n';
+        return(EXIT_FAILURE);
+      }
+    boost::filesystem::create_directories(cfg.scratch);
+
+    transport::local_environment env;
+    transport::argument_cache cache;
+
+    // keep all pushed samples in memory until the batcher is closed, so that push and write costs are measured separately
+    cache.set_batcher_capacity(static_cast<size_t>(1024)*1024*1024);
+
+    benchmarks::report rep;
+
+    benchmarks::run_suite(rep, cfg, env, cache);
+
+    if(option_map.count("output"))
+      {
+        std::ofstream out(option_map["output"].as<std::string>(), std::ios_base::out | std::ios_base::trunc);
+        rep.write(out);
+      }
+    else
+      {
+        rep.write(std::cout);
+      }
+
+    if(!option_map.count("keep")) boost::filesystem::remove_all(cfg.scratch);
+
+    return(EXIT_SUCCESS);
+  }
@@ -0,0 +1,244 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_BENCHMARKS_HARNESS_H
+#define CPPTRANSPORT_BENCHMARKS_HARNESS_H
+
+
+#include <chrono>
+#include <string>
+#include <list>
+#include <iostream>
+
+#include "boost/filesystem/operations.hpp"
+#include "boost/date_time/posix_time/posix_time.hpp"
+
+#include "json/json.h"
+
+#include "transport-runtime/version.h"
+
+
+namespace benchmarks
+  {
+
+    //! configuration shared by all benchmark suites
+    struct configuration
+      {
+        //! number of repetitions for micro-benchmarks, such as RHS evaluations
+        unsigned int repeats;
+
+        //! scratch directory in which repositories and temporary containers are created
+        boost::filesystem::path scratch;
+      };
+
+
+    //! stopwatch measuring wallclock time using a monotonic clock
+    class stopwatch
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor starts the clock running
+        stopwatch()
+          : start_point(std::chrono::steady_clock::now())
+          {
+          }
+
+        //! destructor is default
+        ~stopwatch() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! restart clock
+        void restart() { this->start_point = std::chrono::steady_clock::now(); }
+
+        //! get elapsed time in nanoseconds
+        double elapsed() const
+          {
+            auto now = std::chrono::steady_clock::now();
+            return std::chrono::duration<double, std::nano>(now - this->start_point).count();
+          }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! time at which clock was started
+        std::chrono::steady_clock::time_point start_point;
+
+      };
+
+
+    //! a single benchmark measurement
+    class measurement
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        measurement(std::string m, std::string b, std::string u, unsigned long n, double t)
+          : model(std::move(m)),
+            benchmark(std::move(b)),
+            unit(std::move(u)),
+            count(n),
+            elapsed(t)
+          {
+          }
+
+        //! destructor is default
+        ~measurement() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get model name
+        const std::string& get_model() const { return this->model; }
+
+        //! get benchmark name
+        const std::string& get_benchmark() const { return this->benchmark; }
+
+        //! get unit
+        const std::string& get_unit() const { return this->unit; }
+
+        //! get throughput in units of operations per second
+        double rate() const { return this->elapsed > 0.0 ? 1E9 * static_cast<double>(this->count) / this->elapsed : 0.0; }
+
+        //! get mean latency per operation, in nanoseconds
+        double latency() const { return this->count > 0 ? this->elapsed / static_cast<double>(this->count) : 0.0; }
+
+        //! serialize to JSON
+        Json::Value as_JSON() const
+          {
+            Json::Value v(Json::objectValue);
+
+            v["model"]      = this->model;
+            v["benchmark"]  = this->benchmark;
+            v["unit"]       = this->unit;
+            v["count"]      = static_cast<Json::UInt64>(this->count);
+            v["elapsed_ns"] = this->elapsed;
+            v["rate"]       = this->rate();
+            v["latency_ns"] = this->latency();
+
+            return v;
+          }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! model name
+        std::string model;
+
+        //! benchmark name
+        std::string benchmark;
+
+        //! unit in which operations are counted, eg. "evaluations" or "rows"
+        std::string unit;
+
+        //! number of operations performed
+        unsigned long count;
+
+        //! total elapsed wallclock time in nanoseconds
+        double elapsed;
+
+      };
+
+
+    //! collect measurements and emit them as a machine-readable JSON document
+    class report
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor is default
+        report() = default;
+
+        //! destructor is default
+        ~report() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! add a measurement
+        void add(std::string model, std::string benchmark, std::string unit, unsigned long count, double elapsed)
+          {
+            this->db.emplace_back(std::move(model), std::move(benchmark), std::move(unit), count, elapsed);
+
+            const measurement& m = this->db.back();
+            std::cerr << "-- " << m.get_model() << " | " << m.get_benchmark()
+                      << ": " << m.rate() << " " << m.get_unit() << "/s"
+                      << " (" << m.latency() << " ns each)" << '\n';
+          }
+
+        //! write JSON document to a stream
+        void write(std::ostream& out) const
+          {
+            Json::Value root(Json::objectValue);
+
+            root["suite"]     = "CppTransport-benchmarks";
+            root["version"]   = transport::CPPTRANSPORT_VERSION;
+            root["api"]       = transport::CPPTRANSPORT_RUNTIME_API_VERSION;
+            root["timestamp"] = boost::posix_time::to_iso_extended_string(boost::posix_time::second_clock::universal_time());
+
+            Json::Value results(Json::arrayValue);
+            for(const measurement& m : this->db)
+              {
+                results.append(m.as_JSON());
+              }
+            root["results"] = results;
+
+            Json::StreamWriterBuilder builder;
+            out << Json::writeString(builder, root) << '\n';
+          }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! database of measurements
+        std::list<measurement> db;
+
+      };
+
+  }   // namespace benchmarks
+
+
+#endif //CPPTRANSPORT_BENCHMARKS_HARNESS_H
@@ -0,0 +1,307 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_BENCHMARKS_SUITE_H
+#define CPPTRANSPORT_BENCHMARKS_SUITE_H
+
+
+#include <memory>
+#include <string>
+#include <list>
+#include <vector>
+
+#include "transport-runtime/transport.h"
+
+#include "harness.h"
+
+
+namespace benchmarks
+  {
+
+    //! container dispatcher which simply records the containers it is handed;
+    //! on a worker this would send a message to the master, but here we aggregate in-process
+    class recording_dispatcher: public transport::container_dispatch_function
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor captures list of container paths
+        recording_dispatcher(std::list<boost::filesystem::path>& c)
+          : containers(c)
+          {
+          }
+
+        //! destructor is default
+        ~recording_dispatcher() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! record container path
+        void operator()(transport::generic_batcher& batcher) override { this->containers.push_back(batcher.get_container_path()); }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! list of containers which have been dispatched
+        std::list<boost::filesystem::path>& containers;
+
+      };
+
+
+    //! datapipe dispatcher which does nothing; the benchmarks never generate derived content
+    template <typename number>
+    class null_datapipe_dispatcher: public transport::datapipe_dispatch_function<number>
+      {
+
+      public:
+
+        //! dispatch is a no-op
+        void operator()(transport::datapipe<number>* pipe, transport::derived_data::derived_product<number>* product,
+                        const std::list<std::string>& used_groups) override
+          {
+          }
+
+      };
+
+
+    //! fill a state vector with synthetic values: background fields are taken from the initial conditions
+    //! and everything else is set to a fixed O(1) value, which is enough to exercise each RHS term
+    //! (and each batcher push) with finite data
+    template <typename State, typename number>
+    void populate_synthetic_state(State& x, size_t size, const std::vector<number>& ics)
+      {
+        x.resize(size);
+        for(size_t i = 0; i < size; ++i)
+          {
+            x[i] = i < ics.size() ? ics[i] : static_cast<number>(1.0) / static_cast<number>(1 + i % 7);
+          }
+      }
+
+
+    //! measure throughput of an integration functor: RHS evaluations per second, using the first k-configuration
+    //! in the supplied database
+    template <typename Functor, typename State, typename Task, typename Database>
+    void benchmark_rhs(report& rep, const configuration& cfg, const std::string& model, const std::string& name,
+                       const Task& tk, const Database& db, size_t state_size)
+      {
+        using number = typename Functor::number;
+
+        auto rec = db.record_begin();
+        if(rec == db.record_end()) return;
+
+        Functor rhs(&tk, **rec);
+        rhs.set_up_workspace();
+        rhs.rebase_horizon_exit_time(tk.get_ics().get_N_initial());
+
+        State x;
+        State dxdt(state_size);
+        populate_synthetic_state(x, state_size, tk.get_ics_vector(**rec));
+
+        // evaluate at a time close to horizon crossing, where the integration spends most of its effort
+        const number t = static_cast<number>(tk.get_N_horizon_crossing() - tk.get_ics().get_N_initial());
+
+        // warm up caches and workspace before timing
+        for(unsigned int i = 0; i < 16; ++i) rhs(x, dxdt, t);
+
+        // accumulate into a volatile sink so the compiler cannot elide the evaluations
+        volatile number sink = 0;
+
+        stopwatch timer;
+        for(unsigned int i = 0; i < cfg.repeats; ++i)
+          {
+            rhs(x, dxdt, t);
+            sink = sink + dxdt[i % state_size];
+          }
+        double elapsed = timer.elapsed();
+
+        rhs.close_down_workspace();
+
+        rep.add(model, name, "evaluations", cfg.repeats, elapsed);
+      }
+
+
+    //! measure the storage path for a twopf task: observer/batcher push throughput, SQLite container
+    //! write time, aggregation into the main content database, and finally cold vs. warm
+    //! linecache pull latency through a datapipe attached to the committed content group
+    template <typename Observer, typename State, typename number>
+    void benchmark_storage(report& rep, const configuration& cfg, const std::string& model_name,
+                           transport::model_manager<number>& finder, transport::model<number>* mdl,
+                           transport::twopf_task<number>& source_tk, size_t state_size,
+                           transport::local_environment& env, transport::argument_cache& cache)
+      {
+        const boost::filesystem::path repo_path = cfg.scratch / (model_name + "-repository");
+        if(boost::filesystem::exists(repo_path)) boost::filesystem::remove_all(repo_path);
+
+        // build a fresh repository and commit the task to it, then read it back so that we work with
+        // the same task object the task manager would use
+        auto repo = transport::repository_factory<number>(repo_path.string(), finder, transport::repository_mode::readwrite, env, cache);
+        repo->commit(source_tk);
+
+        std::unique_ptr< transport::task_record<number> > record = repo->query_task(source_tk.get_name());
+        auto int_rec = dynamic_cast< transport::integration_task_record<number>* >(record.get());
+        if(int_rec == nullptr) return;
+
+        auto tk = dynamic_cast< transport::twopf_task<number>* >(int_rec->get_task());
+        if(tk == nullptr) return;
+
+        auto data_mgr = transport::data_manager_factory<number>(env, cache);
+
+        auto writer = repo->new_integration_task_content(*int_rec, std::list<std::string>{}, 0, 0, 1);
+        data_mgr->initialize_writer(*writer);
+        data_mgr->create_tables(*writer, tk);
+        repo->register_writer(*writer);
+
+        std::list<boost::filesystem::path> containers;
+
+        // PUSH: drive the generated observer through every k-configuration and time sample
+        // main() sets the batcher capacity large enough that no flushes occur here
+        unsigned long samples = 0;
+        {
+          transport::twopf_batcher<number> batcher =
+            data_mgr->create_temp_twopf_container(tk, writer->get_abs_tempdir_path(), writer->get_abs_logdir_path(), 0, 0, mdl,
+                                                  std::make_unique<recording_dispatcher>(containers));
+
+          const transport::twopf_kconfig_database& db = tk->get_twopf_database();
+
+          double push_elapsed = 0.0;
+          for(auto t = db.record_begin(); t != db.record_end(); ++t)
+            {
+              const transport::twopf_kconfig_record& kconfig = *t;
+
+              const transport::time_config_database time_db = tk->get_time_config_database(*kconfig);
+
+              State x;
+              populate_synthetic_state(x, state_size, tk->get_ics_vector(*kconfig));
+
+              stopwatch push_timer;
+              Observer obs(batcher, kconfig, tk->get_initial_time(*kconfig), time_db);
+
+              size_t steps = 0;
+              for(auto u = time_db.value_begin(); u != time_db.value_end(); ++u, ++steps)
+                {
+                  obs(x, static_cast<number>(*u));
+                }
+
+              obs.stop_timers(steps, 0);
+              push_elapsed += push_timer.elapsed();
+
+              samples += steps;
+            }
+
+          rep.add(model_name, "twopf_observer_push", "samples", samples, push_elapsed);
+
+          // WRITE: closing the batcher flushes everything it holds into its SQLite container
+          stopwatch write_timer;
+          batcher.close();
+          rep.add(model_name, "twopf_container_write", "samples", samples, write_timer.elapsed());
+        }
+
+        // AGGREGATE: copy each temporary container into the main content database
+        stopwatch aggregate_timer;
+        for(const boost::filesystem::path& ctr : containers)
+          {
+            writer->aggregate(ctr);
+          }
+        rep.add(model_name, "twopf_aggregate", "samples", samples, aggregate_timer.elapsed());
+
+        data_mgr->close_writer(*writer);
+        writer->commit();
+
+        // PULL: attach a datapipe to the new content group, and read every twopf component for every
+        // k-configuration; the first pass must go to the database, the second should be served from the linecache
+        const boost::filesystem::path pipe_root = cfg.scratch / (model_name + "-datapipe");
+        const boost::filesystem::path pipe_logdir  = pipe_root / "logs";
+        const boost::filesystem::path pipe_tempdir = pipe_root / "temp";
+        boost::filesystem::create_directories(pipe_logdir);
+        boost::filesystem::create_directories(pipe_tempdir);
+
+        transport::integration_content_finder<number> i_finder(*repo);
+        transport::postintegration_content_finder<number> p_finder(*repo);
+        null_datapipe_dispatcher<number> dispatcher;
+
+        std::unique_ptr< transport::datapipe<number> > pipe =
+          data_mgr->create_datapipe(pipe_logdir, pipe_tempdir, i_finder, p_finder, dispatcher, 0, true);
+
+        pipe->attach(tk, std::list<std::string>{});
+
+        const transport::derived_data::SQL_time_query tquery("1=1");
+        const transport::derived_data::SQL_twopf_query kquery("1=1");
+
+        typename transport::datapipe<number>::twopf_kconfig_handle& kc_handle = pipe->new_twopf_kconfig_handle(kquery);
+        transport::twopf_kconfig_tag<number> kc_tag = pipe->new_twopf_kconfig_tag();
+        const std::vector<transport::twopf_kconfig> k_configs = kc_handle.lookup_tag(kc_tag);
+
+        typename transport::datapipe<number>::time_data_handle& t_handle = pipe->new_time_data_handle(tquery);
+
+        const unsigned int N = 2*mdl->get_N_fields();
+
+        auto pull_all = [&]() -> unsigned long
+          {
+            unsigned long lines = 0;
+            for(const transport::twopf_kconfig& k : k_configs)
+              {
+                for(unsigned int m = 0; m < N; ++m)
+                  {
+                    for(unsigned int n = 0; n < N; ++n)
+                      {
+                        transport::cf_time_data_tag<number> tag =
+                          pipe->new_cf_time_data_tag(transport::cf_data_type::cf_twopf_re, mdl->flatten(m, n), k.serial);
+                        const std::vector<number>& line = t_handle.lookup_tag(tag);
+                        if(!line.empty()) ++lines;
+                      }
+                  }
+              }
+            return lines;
+          };
+
+        stopwatch cold_timer;
+        unsigned long cold_lines = pull_all();
+        rep.add(model_name, "datapipe_pull_cold", "lines", cold_lines, cold_timer.elapsed());
+
+        unsigned int hits_before = pipe->get_data_cache_hits();
+
+        stopwatch warm_timer;
+        unsigned long warm_lines = pull_all();
+        double warm_elapsed = warm_timer.elapsed();
+        rep.add(model_name, "datapipe_pull_warm", "lines", warm_lines, warm_elapsed);
+
+        // record how many of the warm pass lookups were served from the linecache; if this falls short of the
+        // number of lines, the warm timing includes database reads
+        rep.add(model_name, "datapipe_pull_warm_cache_hits", "hits", pipe->get_data_cache_hits() - hits_before, warm_elapsed);
+
+        pipe->detach();
+      }
+
+  }   // namespace benchmarks
+
+
+#endif //CPPTRANSPORT_BENCHMARKS_SUITE_H
@@ -0,0 +1,88 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+
+#include "yvette_mpi.h"
+
+#include "suite.h"
+#include "models.h"
+
+
+namespace benchmarks
+  {
+
+    void run_suite(report& rep, const configuration& cfg, transport::local_environment& env, transport::argument_cache& cache)
+      {
+        using DataType = double;
+        using StateType = std::vector<DataType>;
+        using Model = transport::yvette_mpi<DataType, StateType>;
+
+        transport::model_manager<DataType> finder(env, cache);
+        std::shared_ptr<Model> model = finder.create_model<Model>();
+
+        // parameter choices follow the PyTransport comparison test
+        const DataType M_P = 1.0;
+
+        const DataType chi0 = 14.7 * M_P;
+        const DataType m = std::sqrt(6.0) * 1.4E-5 * M_P*M_P / chi0;
+        const DataType Gamma0 = 0.9;
+        const DataType DeltaChi = 0.084 * M_P;
+        const DataType M = std::sqrt(300.0/6.0) * m * chi0 / M_P;
+
+        transport::parameters<DataType> params{M_P, {Gamma0, chi0, DeltaChi, m, M}, model};
+
+        const DataType chi_init = chi0 + 3.0*M_P;
+        const DataType psi_init = 0.0;
+
+        const DataType H0 = model->H(params, {chi_init, psi_init, 0.0, 0.0});
+
+        const DataType dchi_init = -1E-6 * M_P*M_P / H0;
+        const DataType dpsi_init = 0.0;
+
+        const double N_init  = 0.0;
+        const double N_cross = 79.091 - 55.0;
+        const double N_end   = 55.0;
+
+        transport::initial_conditions<DataType> ics{"yvette-benchmark", params, {chi_init, psi_init, dchi_init, dpsi_init}, N_init, N_cross};
+
+        transport::basic_range<double> times{N_init, N_end, 300, transport::spacing::linear};
+        transport::basic_range<double> ks{1.0, std::exp(3.0), 16, transport::spacing::log_bottom};
+        transport::basic_range<double> ks_threepf{1.0, std::exp(2.0), 4, transport::spacing::log_bottom};
+
+        transport::twopf_task<DataType> tk2{"yvette-benchmark.twopf", ics, times, ks};
+        transport::threepf_cubic_task<DataType> tk3{"yvette-benchmark.threepf", ics, times, ks_threepf};
+
+        benchmark_rhs< transport::yvette_mpi_twopf_functor<Model>, StateType >(
+          rep, cfg, "yvette", "twopf_rhs", tk2, tk2.get_twopf_database(), model->backend_twopf_state_size());
+
+        benchmark_rhs< transport::yvette_mpi_threepf_functor<Model>, StateType >(
+          rep, cfg, "yvette", "threepf_rhs", tk3, tk3.get_threepf_database(), model->backend_threepf_state_size());
+
+        benchmark_storage< transport::yvette_mpi_twopf_observer<Model>, StateType >(
+          rep, cfg, "yvette", finder, model.get(), tk2, model->backend_twopf_state_size(), env, cache);
+      }
+
+  }   // namespace benchmarks
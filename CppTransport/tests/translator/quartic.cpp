@@ -0,0 +1,67 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#include <cmath>
+#include <iostream>
+
+#include "transport-runtime/transport.h"
+#include "quartic_mpi.h"
+
+
+// the purpose of this test is mostly to check that the translated quartic model compiles;
+// evaluating the potential also checks that the shared powers of phi have the right values
+
+
+int main(int argc, char* argv[])
+  {
+    using DataType = double;
+    using StateType = std::vector<DataType>;
+    using Model = transport::quartic_mpi<DataType, StateType>;
+
+    transport::local_environment env;
+    transport::argument_cache cache;
+
+    transport::model_manager<DataType> finder(env, cache);
+    std::shared_ptr<Model> model = finder.create_model<Model>();
+
+    const DataType M_P = 1.0;
+    const DataType lambda4 = 1E-3;
+    const DataType m = 1E-5;
+
+    transport::parameters<DataType> params{M_P, {lambda4, m}, model};
+
+    const DataType phi = 3.0;
+    const DataType V = model->V(params, {phi, 0.0});
+    const DataType expected = lambda4/4.0 * phi*phi*phi*phi + m*m/2.0 * phi*phi;
+
+    if(std::abs(V - expected) > 1E-12 * std::abs(expected))
+      {
+        std::cerr << "quartic: V = " << V << ", expected " << expected << '\n';
+        return(EXIT_FAILURE);
+      }
+
+    return(EXIT_SUCCESS);
+  }
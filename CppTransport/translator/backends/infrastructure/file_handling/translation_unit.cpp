@@ -30,6 +30,10 @@
 #include "model_descriptor.h"
 #include "output_stack.h"
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
 #include "boost/algorithm/string.hpp"
 #include "boost/range/algorithm/remove_if.hpp"
 
@@ -203,6 +207,9 @@ translation_unit::translation_unit(boost::filesystem::path file, finder& p, argu
     
     // dump results of syntactic analysis -- for debugging
     // this->model.print(std::cerr);
+
+    // if a specialized variant was requested, fix the parameter values before any expressions are generated
+    if(!parse_failed && !cache.specialization_file().empty()) this->read_specialization(cache.specialization_file());
     
     // ask model descriptor to validate itself
     auto validation_errors = model.validate();
@@ -231,11 +238,16 @@ void translation_unit::populate_output_filenames()
     boost::filesystem::path implementation_output;
     std::string             implementation_guard;
 
+    // default filenames for a specialized variant carry the specialization tag, so they do not overwrite the
+    // output for the generic model or for variants specialized to different values
+    std::string variant;
+    if(this->translator_payload.specialized()) variant = this->translator_payload.get_specialization_tag() + "_";
+
     if(this->cache.core_out().length() > 0 ) core_output = this->cache.core_out();
     else
       {
         boost::optional< contexted_value<std::string>& > core = this->model.templates.get_core_template();
-        if(core) core_output = this->mangle_output_name(name, this->get_template_suffix(*core));
+        if(core) core_output = this->mangle_output_name(name, variant + this->get_template_suffix(*core));
       }
     core_guard = boost::to_upper_copy(leafname(core_output.string()));
     core_guard.erase(boost::remove_if(core_guard, boost::is_any_of(INVALID_GUARD_CHARACTERS)), core_guard.end());
@@ -244,7 +256,7 @@ void translation_unit::populate_output_filenames()
     else
       {
         boost::optional< contexted_value<std::string>& > impl = this->model.templates.get_implementation_template();
-        if(impl) implementation_output = this->mangle_output_name(name, this->get_template_suffix(*impl));
+        if(impl) implementation_output = this->mangle_output_name(name, variant + this->get_template_suffix(*impl));
       }
     implementation_guard = boost::to_upper_copy(leafname(implementation_output.string()));
     implementation_guard.erase(boost::remove_if(implementation_guard, boost::is_any_of(INVALID_GUARD_CHARACTERS)), implementation_guard.end());
@@ -254,6 +266,108 @@ void translation_unit::populate_output_filenames()
   }
 
 
+void translation_unit::read_specialization(const boost::filesystem::path& file)
+  {
+    std::ifstream in(file.string());
+    if(!in.is_open() || in.fail())
+      {
+        std::ostringstream msg;
+        msg << ERROR_OPEN_SPECIALIZATION << " '" << file.string() << "'";
+        this->error(msg.str());
+        this->parse_failed = true;
+        return;
+      }
+
+    const std::vector<std::string> names = this->translator_payload.model.get_param_name_list();
+    std::vector< std::pair<unsigned int, GiNaC::ex> > values;
+
+    // values are parsed strictly, so they may be exact (eg. 1/3 or sqrt(2)) but cannot refer to any symbol
+    GiNaC::parser reader(GiNaC::symtab(), true);
+
+    std::string line;
+    unsigned int line_number = 0;
+    while(std::getline(in, line))
+      {
+        ++line_number;
+
+        // strip comments and whitespace; blank lines are ignored
+        auto comment = line.find('#');
+        if(comment != std::string::npos) line.erase(comment);
+        boost::algorithm::trim(line);
+        if(line.empty()) continue;
+
+        std::ostringstream where;
+        where << file.string() << ":" << line_number;
+
+        auto eq = line.find('=');
+        if(eq == std::string::npos)
+          {
+            std::ostringstream msg;
+            msg << ERROR_SPECIALIZATION_SYNTAX << " (" << where.str() << ")";
+            this->error(msg.str());
+            this->parse_failed = true;
+            continue;
+          }
+
+        std::string name = boost::algorithm::trim_copy(line.substr(0, eq));
+        std::string text = boost::algorithm::trim_copy(line.substr(eq+1));
+
+        auto t = std::find(names.begin(), names.end(), name);
+        if(t == names.end())
+          {
+            std::ostringstream msg;
+            msg << ERROR_SPECIALIZATION_UNKNOWN << " '" << name << "' (" << where.str() << ")";
+            this->error(msg.str());
+            this->parse_failed = true;
+            continue;
+          }
+
+        auto index = static_cast<unsigned int>(std::distance(names.begin(), t));
+        if(std::find_if(values.begin(), values.end(),
+                        [=](const std::pair<unsigned int, GiNaC::ex>& v) -> bool { return(v.first == index); }) != values.end())
+          {
+            std::ostringstream msg;
+            msg << ERROR_SPECIALIZATION_DUPLICATE << " '" << name << "' (" << where.str() << ")";
+            this->error(msg.str());
+            this->parse_failed = true;
+            continue;
+          }
+
+        GiNaC::ex value;
+        bool valid = false;
+        try
+          {
+            value = reader(text);
+            GiNaC::ex approx = value.evalf();
+            valid = GiNaC::is_a<GiNaC::numeric>(approx) && GiNaC::ex_to<GiNaC::numeric>(approx).is_real();
+          }
+        catch(std::exception&)
+          {
+            valid = false;
+          }
+
+        if(!valid)
+          {
+            std::ostringstream msg;
+            msg << ERROR_SPECIALIZATION_VALUE << " '" << name << " = " << text << "' (" << where.str() << ")";
+            this->error(msg.str());
+            this->parse_failed = true;
+            continue;
+          }
+
+        values.emplace_back(index, value);
+      }
+
+    if(this->parse_failed) return;
+
+    std::ostringstream msg;
+    msg << MESSAGE_SPECIALIZATION_A << " " << values.size() << " " << MESSAGE_SPECIALIZATION_B << " '" << file.string() << "'";
+    this->print_advisory(msg.str());
+
+    this->translator_payload.set_specialization(std::move(values));
+  }
+
+
 // ******************************************************************
 
 
@@ -309,6 +423,19 @@ unsigned int translation_unit::apply()
         this->error(ERROR_NO_IMPLEMENTATION_TEMPLATE);
       }
 
+    // if the implementation was split, emit the translation units which instantiate each part of it
+    std::list<boost::filesystem::path> auxiliary_output;
+    if(impl && this->errors == 0 && this->translator_payload.split())
+      {
+        auxiliary_output = this->write_split_units(impl_output);
+      }
+
+    // if requested, emit the translation unit and build rules for a runtime-loadable model plugin
+    if(impl && this->errors == 0 && this->translator_payload.plugin())
+      {
+        auxiliary_output.splice(auxiliary_output.end(), this->write_plugin_unit(impl_output));
+      }
+
     if(this->errors > 0)
       {
         this->parse_failed = true;
@@ -316,6 +443,11 @@ unsigned int translation_unit::apply()
         // remove output files
         if(boost::filesystem::exists(core_output)) boost::filesystem::remove(core_output);
         if(boost::filesystem::exists(impl_output)) boost::filesystem::remove(impl_output);
+
+        for(const auto& f : auxiliary_output)
+          {
+            if(boost::filesystem::exists(f)) boost::filesystem::remove(f);
+          }
       }
 
     return(rval);
@@ -325,6 +457,157 @@ unsigned int translation_unit::apply()
 // ******************************************************************
 
 
+std::list<boost::filesystem::path> translation_unit::write_split_units(const boost::filesystem::path& impl_output)
+  {
+    std::list<boost::filesystem::path> written;
+
+    const std::vector<std::string>& units = this->translator_payload.get_split_units();
+    if(units.empty())
+      {
+        this->warn(WARNING_SPLIT_NO_UNITS);
+        return written;
+      }
+
+    boost::filesystem::path parent = impl_output.parent_path();
+    std::string stem = impl_output.stem().string();
+    std::string leaf = impl_output.filename().string();
+
+    std::list<std::string> sources;
+
+    for(const auto& unit : units)
+      {
+        boost::filesystem::path unit_leaf = stem + "_" + unit + OUTPUT_SPLIT_UNIT_EXTENSION;
+        boost::filesystem::path unit_output = parent / unit_leaf;
+
+        std::ofstream out(unit_output.string());
+        if(!out.is_open() || out.fail())
+          {
+            std::ostringstream msg;
+            msg << ERROR_OPEN_SPLIT_UNIT << " '" << unit_output.string() << "'";
+            this->error(msg.str());
+            continue;
+          }
+
+        written.push_back(unit_output);
+        sources.push_back(unit_leaf.string());
+
+        out << "// " << CPPTRANSPORT_NAME << " " << CPPTRANSPORT_VERSION << ": translation unit '" << unit
+            << "' of " << leaf << '\n'
+            << "// generated file; changes will be overwritten when the model is translated" << '\n'
+            << '\n'
+            << "#define " << OUTPUT_SPLIT_UNIT_PREFIX << boost::to_upper_copy(unit) << '\n'
+            << '\n'
+            << "#include \"" << leaf << "\"" << '\n';
+      }
+
+    // CMake fragment listing the units, so that they can be added to the sources of the executable
+    // linking this model
+    boost::filesystem::path cmake_leaf = stem + OUTPUT_SPLIT_CMAKE_EXTENSION;
+    boost::filesystem::path cmake_output = parent / cmake_leaf;
+
+    std::ofstream cmake(cmake_output.string());
+    if(!cmake.is_open() || cmake.fail())
+      {
+        std::ostringstream msg;
+        msg << ERROR_OPEN_SPLIT_UNIT << " '" << cmake_output.string() << "'";
+        this->error(msg.str());
+        return written;
+      }
+
+    written.push_back(cmake_output);
+
+    cmake << "# " << CPPTRANSPORT_NAME << " " << CPPTRANSPORT_VERSION << ": translation units of " << leaf << '\n'
+          << "set(" << boost::to_upper_copy(stem) << OUTPUT_SPLIT_CMAKE_SOURCES;
+    for(const auto& s : sources)
+      {
+        cmake << '\n' << "    ${CMAKE_CURRENT_LIST_DIR}/" << s;
+      }
+    cmake << ")" << '\n';
+
+    std::ostringstream msg;
+    msg << MESSAGE_SPLIT_UNITS_A << " " << sources.size() << " " << MESSAGE_SPLIT_UNITS_B << " '" << cmake_output.string() << "'";
+    this->print_advisory(msg.str());
+
+    return written;
+  }
+
+
+std::list<boost::filesystem::path> translation_unit::write_plugin_unit(const boost::filesystem::path& impl_output)
+  {
+    std::list<boost::filesystem::path> written;
+
+    // the runtime locates plugins by the uid of the model they provide, so the uid must be known
+    const std::string& uid = this->translator_payload.get_unique_id();
+    if(uid.empty())
+      {
+        this->error(ERROR_PLUGIN_NO_UID);
+        return written;
+      }
+
+    boost::filesystem::path parent = impl_output.parent_path();
+    std::string stem = impl_output.stem().string();
+    std::string leaf = impl_output.filename().string();
+    std::string target = stem + OUTPUT_PLUGIN_SUFFIX;
+
+    boost::filesystem::path plugin_leaf = target + OUTPUT_SPLIT_UNIT_EXTENSION;
+    boost::filesystem::path plugin_output = parent / plugin_leaf;
+
+    std::ofstream out(plugin_output.string());
+    if(!out.is_open() || out.fail())
+      {
+        std::ostringstream msg;
+        msg << ERROR_OPEN_PLUGIN_UNIT << " '" << plugin_output.string() << "'";
+        this->error(msg.str());
+        return written;
+      }
+
+    written.push_back(plugin_output);
+
+    out << "// " << CPPTRANSPORT_NAME << " " << CPPTRANSPORT_VERSION << ": model plugin built from " << leaf << '\n'
+        << "// generated file; changes will be overwritten when the model is translated" << '\n'
+        << '\n'
+        << "#define " << OUTPUT_PLUGIN_GUARD << '\n'
+        << '\n'
+        << "#include \"" << leaf << "\"" << '\n';
+
+    // plugins are never split (argument_cache rejects --split with --plugin), so the plugin is a single unit
+    std::list<std::string> sources;
+    sources.push_back(plugin_leaf.string());
+
+    // CMake fragment defining the plugin as a loadable module named by the model's uid;
+    // the plugin should be linked against the same runtime libraries as the driver which loads it
+    boost::filesystem::path cmake_leaf = target + OUTPUT_SPLIT_CMAKE_EXTENSION;
+    boost::filesystem::path cmake_output = parent / cmake_leaf;
+
+    std::ofstream cmake(cmake_output.string());
+    if(!cmake.is_open() || cmake.fail())
+      {
+        std::ostringstream msg;
+        msg << ERROR_OPEN_PLUGIN_UNIT << " '" << cmake_output.string() << "'";
+        this->error(msg.str());
+        return written;
+      }
+
+    written.push_back(cmake_output);
+
+    cmake << "# " << CPPTRANSPORT_NAME << " " << CPPTRANSPORT_VERSION << ": model plugin built from " << leaf << '\n'
+          << "# link with: TARGET_LINK_LIBRARIES(" << target << " ${CPPTRANSPORT_LIBRARIES})" << '\n'
+          << "add_library(" << target << " MODULE";
+    for(const auto& s : sources)
+      {
+        cmake << '\n' << "    ${CMAKE_CURRENT_LIST_DIR}/" << s;
+      }
+    cmake << ")" << '\n'
+          << "set_target_properties(" << target << " PROPERTIES PREFIX \"\" SUFFIX \"" << OUTPUT_PLUGIN_EXTENSION << "\" OUTPUT_NAME \"" << uid << "\")" << '\n';
+
+    std::ostringstream msg;
+    msg << MESSAGE_PLUGIN_UNIT << " '" << cmake_output.string() << "'";
+    this->print_advisory(msg.str());
+
+    return written;
+  }
+
+
 boost::filesystem::path translation_unit::mangle_output_name(const boost::filesystem::path& input, const std::string& tag)
   {
     std::string output;
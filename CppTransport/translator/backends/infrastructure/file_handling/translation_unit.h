@@ -98,6 +98,9 @@ class translation_unit
     //! push names of output files and header guards to translator data payload
     void populate_output_filenames();
 
+    //! read fixed parameter values for a specialized variant, and push them to the translator data payload
+    void read_specialization(const boost::filesystem::path& file);
+
 		//! print an advisory message, if the current verbosity level is set sufficiently high
     void print_advisory(const std::string& msg);
 
@@ -119,6 +122,14 @@ class translation_unit
     //! deduce template suffix from input name (input not const or taken by reference because modified internally)
     std::string get_template_suffix(std::string input);
 
+    //! write one translation unit for each split unit registered while translating the implementation,
+    //! together with a CMake fragment listing them; returns the files written
+    std::list<boost::filesystem::path> write_split_units(const boost::filesystem::path& impl_output);
+
+    //! write a translation unit which builds the implementation as a runtime-loadable model plugin,
+    //! together with a CMake fragment defining the plugin target; returns the files written
+    std::list<boost::filesystem::path> write_plugin_unit(const boost::filesystem::path& impl_output);
+
 
     // INTERNAL DATA
 
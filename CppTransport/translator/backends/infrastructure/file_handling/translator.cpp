@@ -199,10 +199,36 @@ unsigned int translator::process(const boost::filesystem::path& in, buffer& buf,
 
     unsigned int replacements = 0;
 
+    // stream position and line number of the first line in an open $VARIANTS block,
+    // from which the block is replayed for each further kernel variant
+    std::streampos variants_position;
+    unsigned int variants_line = 0;
+
     while(!(*j).eof() && !(*j).fail())
       {
         replacements += this->process_line(*j, *package, agent, buf, os, filter, annotate);
         os.increment_line();
+
+        switch(agent.take_variant_request())
+          {
+            case variant_request::mark:
+              {
+                variants_position = (*j).tellg();
+                variants_line = os.get_line();
+                break;
+              }
+
+            case variant_request::replay:
+              {
+                (*j).clear();
+                (*j).seekg(variants_position);
+                os.set_line(variants_line);
+                break;
+              }
+
+            case variant_request::none:
+              break;
+          }
       }
 
     // report end of input to the backend;
@@ -24,8 +24,18 @@
 //
 
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
 #include "translator_data.h"
 
+#include "core.h"
+
+#include "boost/algorithm/string.hpp"
+
+#include "openssl/md5.h"
+
 
 translator_data::translator_data(const boost::filesystem::path& file, error_context::error_handler e,
                                  error_context::warning_handler w, message_handler m, finder& f, output_stack& os, symbol_factory& s,
@@ -54,6 +64,12 @@ bool translator_data::do_cse() const
   }
 
 
+bool translator_data::do_sparsity() const
+  {
+    return(this->cache.do_sparsity());
+  }
+
+
 bool translator_data::annotate() const
   {
     return(this->cache.annotate());
@@ -72,6 +88,89 @@ bool translator_data::fast() const
   }
 
 
+bool translator_data::numeric_curvature() const
+  {
+    return(this->cache.numeric_curvature());
+  }
+
+
+bool translator_data::autodiff() const
+  {
+    return(this->cache.autodiff());
+  }
+
+
+bool translator_data::autodiff_check() const
+  {
+    return(this->cache.autodiff_check());
+  }
+
+
+bool translator_data::dual_unroll() const
+  {
+    return(this->cache.dual_unroll());
+  }
+
+
+bool translator_data::split() const
+  {
+    return(this->cache.split());
+  }
+
+
+bool translator_data::plugin() const
+  {
+    return(this->cache.plugin());
+  }
+
+
+void translator_data::set_specialization(std::vector< std::pair<unsigned int, GiNaC::ex> > values)
+  {
+    this->specialized_params = std::move(values);
+    std::sort(this->specialized_params.begin(), this->specialized_params.end(),
+              [](const std::pair<unsigned int, GiNaC::ex>& a, const std::pair<unsigned int, GiNaC::ex>& b) -> bool
+                { return(a.first < b.first); });
+
+    auto params = this->model.get_param_symbols();
+
+    auto names = this->model.get_param_name_list();
+
+    this->specialization_map.clear();
+    std::ostringstream values_str;
+    for(const auto& p : this->specialized_params)
+      {
+        this->specialization_map[params[p.first]] = p.second;
+        values_str << names[p.first] << "=" << p.second << ";";
+      }
+
+    this->specialization_tag.clear();
+    if(this->specialized_params.empty()) return;
+
+    // the leading bytes of an MD5 hash are enough to keep variants of one model apart, and hashing
+    // with MD5 guarantees the same tag on all platforms
+    unsigned char result[MD5_DIGEST_LENGTH];
+    MD5(reinterpret_cast<const unsigned char*>(values_str.str().c_str()), values_str.str().length(), result);
+
+    std::ostringstream tag_str;
+    for(unsigned int i = 0; i < SPECIALIZATION_TAG_BYTES; ++i)
+      {
+        tag_str << std::setfill('0') << std::setw(2) << std::hex << static_cast<int>(result[i]);
+      }
+    this->specialization_tag = tag_str.str();
+  }
+
+
+std::string translator_data::add_split_unit(const std::string& name)
+  {
+    if(std::find(this->split_units.begin(), this->split_units.end(), name) == this->split_units.end())
+      {
+        this->split_units.push_back(name);
+      }
+
+    return(OUTPUT_SPLIT_UNIT_PREFIX + boost::to_upper_copy(name));
+  }
+
+
 void translator_data::set_core_implementation(const boost::filesystem::path& co, const std::string& cg,
                                               const boost::filesystem::path& io, const std::string& ig)
   {
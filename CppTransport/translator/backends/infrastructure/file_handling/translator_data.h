@@ -28,6 +28,8 @@
 
 
 #include <functional>
+#include <utility>
+#include <vector>
 
 #include "finder.h"
 #include "output_stack.h"
@@ -39,6 +41,8 @@
 #include "argument_cache.h"
 #include "version_policy.h"
 
+#include "ginac/ginac.h"
+
 
 typedef std::function<void(const std::string&)> message_handler;
 
@@ -106,6 +110,51 @@ class translator_data
     const std::string& get_implementation_guard() const { return(this->implementation_guard); }
 
 
+    // SPLIT TRANSLATION UNITS
+
+  public:
+
+    //! register a translation unit into which the implementation is split; returns the preprocessor
+    //! symbol which selects its explicit instantiations
+    std::string add_split_unit(const std::string& name);
+
+    //! get list of translation units requested by the implementation template, in order of registration
+    const std::vector<std::string>& get_split_units() const { return(this->split_units); }
+
+
+    // MODEL IDENTITY
+
+  public:
+
+    //! record unique identifier assigned to the model; this names the plugin built from it
+    void set_unique_id(const std::string& id) { this->unique_id = id; }
+
+    //! get unique identifier assigned to the model; empty if it has not yet been computed
+    const std::string& get_unique_id() const { return(this->unique_id); }
+
+
+    // PARAMETER SPECIALIZATION
+
+  public:
+
+    //! fix the values of some or all parameters; each entry pairs a parameter index, in declaration order,
+    //! with its value
+    void set_specialization(std::vector< std::pair<unsigned int, GiNaC::ex> > values);
+
+    //! is this a specialized variant with fixed parameter values?
+    bool specialized() const { return(!this->specialized_params.empty()); }
+
+    //! get fixed parameter values, in declaration order
+    const std::vector< std::pair<unsigned int, GiNaC::ex> >& get_specialized_params() const { return(this->specialized_params); }
+
+    //! get substitution map exchanging fixed parameters for their values; empty if the model is not specialized
+    const GiNaC::exmap& get_specialization_map() const { return(this->specialization_map); }
+
+    //! get short hash of the fixed parameter values, used to distinguish the class name and output files
+    //! of a specialized variant from those of the generic model; empty if the model is not specialized
+    const std::string& get_specialization_tag() const { return(this->specialization_tag); }
+
+
     // GET CONFIGURATION OPTIONS
 
   public:
@@ -113,6 +162,9 @@ class translator_data
     //! perform common-subexpression elimination?
     bool do_cse() const;
 
+    //! eliminate symbolically zero terms?
+    bool do_sparsity() const;
+
     //! annotate output?
     bool annotate() const;
 
@@ -122,6 +174,24 @@ class translator_data
     //! get fast option
     bool fast() const;
 
+    //! get numeric curvature option
+    bool numeric_curvature() const;
+
+    //! get automatic differentiation option
+    bool autodiff() const;
+
+    //! get automatic differentiation cross-check option
+    bool autodiff_check() const;
+
+    //! get dual-variant kernel option
+    bool dual_unroll() const;
+
+    //! get split translation unit option
+    bool split() const;
+
+    //! get model plugin option
+    bool plugin() const;
+
     
     // PASS-THROUGH TO UNDERLYING MODEL DESCRIPTOR
     
@@ -223,6 +293,30 @@ class translator_data
     //! implementation header guard
     std::string implementation_guard;
 
+
+    // SPLIT TRANSLATION UNITS
+
+    //! names of translation units requested by the implementation template
+    std::vector<std::string> split_units;
+
+
+    // MODEL IDENTITY
+
+    //! unique identifier assigned to the model
+    std::string unique_id;
+
+
+    // PARAMETER SPECIALIZATION
+
+    //! fixed parameter values
+    std::vector< std::pair<unsigned int, GiNaC::ex> > specialized_params;
+
+    //! substitution map for fixed parameters
+    GiNaC::exmap specialization_map;
+
+    //! short hash of fixed parameter values
+    std::string specialization_tag;
+
   };
 
 
@@ -77,6 +77,7 @@ void cse::clear()
   {
     this->symbols.clear();
     this->decls.clear();
+    this->interned.clear();
 
     this->serial_number++;
     this->symbol_counter = 0;
@@ -85,11 +86,18 @@ void cse::clear()
 
 void cse::deposit(cse_impl::symbol_record& record)
   {
-    if(!record.is_written())
+    if(record.is_written()) return;
+
+    // intermediate results referenced by this target, such as rungs of a ladder of powers, are not necessarily
+    // visited when parsing the expression tree, so declare them first; each is deposited only once
+    for(const auto& dep : record.get_dependencies())
       {
-        this->decls.emplace_back(record.get_symbol(), record.get_target());
-        record.mark_written();
+        auto t = this->symbols.find(dep);
+        if(t != this->symbols.end()) this->deposit(t->second);
       }
+
+    this->decls.emplace_back(record.get_symbol(), record.get_target());
+    record.mark_written();
   }
 
 
@@ -107,7 +115,10 @@ void cse::parse(const GiNaC::ex& expr, const boost::optional<std::string> name)
       {
         // print this subexpression *without* use counting
         // (false means that print will use get_symbol_without_use_count)
+        this->interned.emplace_back();
         std::string target_string = this->print(*t, false);
+        std::vector<std::string> dependencies = std::move(this->interned.back());
+        this->interned.pop_back();
 
         // does this subexpression already exist in the lookup table?
         auto u = this->symbols.find(target_string);
@@ -137,6 +148,7 @@ void cse::parse(const GiNaC::ex& expr, const boost::optional<std::string> name)
             // raise an exception
             if(!result.second) throw cse_exception(*name);
 
+            result.first->second.set_dependencies(std::move(dependencies));
             if(name) deposit(result.first->second);
           }
         else
@@ -228,13 +240,37 @@ std::string cse::get_symbol_with_use_count(const GiNaC::ex& expr)
     // if it was present, check whether this symbol has been written into the list
     // of declarations
 
-    if(!t->second.is_written())
+    this->deposit(t->second);
+
+    return t->second.get_symbol();
+  }
+
+
+std::string cse::intern(const GiNaC::ex& expr, bool use_count)
+  {
+    // if CSE disabled, there is no symbol table in which to share the result
+    if(!this->data_payload.do_cse()) return this->printer.ginac(expr);
+
+    // print expression without use counting; any intermediate results it depends on are interned
+    // recursively during printing, so they are assigned temporaries before this one
+    this->interned.emplace_back();
+    std::string target_string = this->print(expr, false);
+    std::vector<std::string> dependencies = std::move(this->interned.back());
+    this->interned.pop_back();
+
+    auto t = this->symbols.find(target_string);
+    if(t == this->symbols.end())
       {
-        this->decls.emplace_back(t->second.get_symbol(), t->second.get_target());
-        t->second.mark_written();
+        auto result = this->symbols.emplace(target_string, cse_impl::symbol_record{target_string, this->make_symbol()});
+        result.first->second.set_dependencies(std::move(dependencies));
       }
 
-    return t->second.get_symbol();
+    // record this result as a dependency of whichever expression is being printed, so that it is
+    // declared before that expression even if it was interned without use counting
+    if(!this->interned.empty()) this->interned.back().push_back(target_string);
+
+    if(use_count) return this->get_symbol_with_use_count(expr);
+    return this->get_symbol_without_use_count(expr);
   }
 
 
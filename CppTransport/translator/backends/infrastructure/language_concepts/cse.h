@@ -68,6 +68,7 @@
 #include <unordered_map>
 #include <set>
 #include <utility>
+#include <vector>
 #include <stdexcept>
 
 #include "disable_warnings.h"
@@ -116,6 +117,12 @@ namespace cse_impl
         //! mark this symbol as written
         void mark_written() { this->written = true; }
 
+        //! get intermediate results referenced by the target, which must be declared before it
+        const std::vector<std::string>& get_dependencies() const { return(this->dependencies); }
+
+        //! set intermediate results referenced by the target
+        void set_dependencies(std::vector<std::string> d) { this->dependencies = std::move(d); }
+
 
         // INTERNAL DATA
 
@@ -130,6 +137,9 @@ namespace cse_impl
         //! writeen flag
         bool written{false};
 
+        //! printed expressions for intermediate results (eg. rungs of a ladder of powers) referenced by the target
+        std::vector<std::string> dependencies;
+
       };
 
   }   // namespace cse_impl
@@ -189,7 +199,7 @@ class cse
 
   protected:
 
-    //! deposit a symbol record to the declaration list
+    //! deposit a symbol record to the declaration list, preceded by any intermediate results it references
     void deposit(cse_impl::symbol_record& record);
 
 
@@ -245,6 +255,11 @@ class cse
     //! for deposition
     std::string get_symbol_without_use_count(const GiNaC::ex& expr);
 
+    //! get symbol corresponding to an intermediate result which need not occur in any parsed expression,
+    //! such as one rung of a ladder of powers; a temporary is assigned to it if one does not already exist,
+    //! so that it can be shared by every later expression which needs it
+    std::string intern(const GiNaC::ex& expr, bool use_count);
+
 		// !make a temporary symbol
     std::string make_symbol();
 
@@ -287,6 +302,10 @@ class cse
     //! this is to avoid duplicate declarations
     named_symbol_table named_symbols;
 
+    //! intermediate results interned while printing each expression currently being printed, innermost last;
+    //! these become the dependencies of the symbol record for that expression
+    std::vector< std::vector<std::string> > interned;
+
 		// work timer
 		boost::timer::cpu_timer timer;
 
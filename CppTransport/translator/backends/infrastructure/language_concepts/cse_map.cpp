@@ -51,3 +51,11 @@ std::string cse_map::operator[](unsigned int index)
 
     throw std::out_of_range(ERROR_OUT_OF_BOUNDS_CSE_MAP);
   }
+
+
+bool cse_map::is_zero(unsigned int index) const
+  {
+    if(index < this->list->size()) return (*this->list)[index].is_zero();
+
+    throw std::out_of_range(ERROR_OUT_OF_BOUNDS_CSE_MAP);
+  }
@@ -55,6 +55,9 @@ class cse_map
     // not returning a reference disallows using [] as an lvalue
     std::string operator[](unsigned int index);
 
+    //! determine whether the expression at a given index is symbolically zero
+    bool is_zero(unsigned int index) const;
+
 
     // INTERNAL DATA
 
@@ -141,6 +141,13 @@ map_lambda::make_temporary(const std::string& left, const std::string& mid, cons
     unsigned int counter = 0;
     for(const auto& expr : this->map)
       {
+        // cases which vanish identically need no code, since they are caught by the final 'return 0'
+        if(expr.is_zero())
+          {
+            ++counter;
+            continue;
+          }
+
         std::list< GiNaC::ex > conditions;
         unsigned int state = counter;
 
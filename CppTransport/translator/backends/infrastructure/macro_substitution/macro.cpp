@@ -44,7 +44,10 @@ macro_agent::macro_agent(translator_data& p, package_group& pkg, std::string pf,
     recursion_max(dm),
     recursion_depth(0),
     package(pkg),
-    output_enabled(true)
+    output_enabled(true),
+    variants_open(false),
+    variant(kernel_variant::none),
+    request(variant_request::none)
   {
     assert(recursion_max > 0);
 
@@ -89,6 +92,41 @@ std::unique_ptr< std::list<std::string> > macro_agent::apply(const std::string&
   }
 
 
+void macro_agent::begin_variants(bool dual)
+  {
+    this->variants_open = true;
+    if(!dual) return;
+
+    // emit the unrolled variant first, and ask the template reader to mark the start of the block
+    // so that it can be replayed for the rolled variant
+    this->variant = kernel_variant::unrolled;
+    this->request = variant_request::mark;
+  }
+
+
+bool macro_agent::end_variants()
+  {
+    if(this->variant == kernel_variant::unrolled)
+      {
+        this->variant = kernel_variant::rolled;
+        this->request = variant_request::replay;
+        return true;
+      }
+
+    this->variants_open = false;
+    this->variant = kernel_variant::none;
+    return false;
+  }
+
+
+variant_request macro_agent::take_variant_request()
+  {
+    variant_request rval = this->request;
+    this->request = variant_request::none;
+    return rval;
+  }
+
+
 std::unique_ptr<token_list>
 macro_agent::tokenize(const std::string& line, boost::optional<index_literal_database&> validate_db, bool strict)
   {
@@ -194,6 +232,11 @@ bool macro_agent::apply_unroll_policy(const token_list& left_tokens, const token
     // if the total assignment size is smaller than the unroll policy size, then we would typically unroll
     // unless it is prevented
     bool unroll_by_policy = total_assignment_size <= data_payload.unroll_policy();
+
+    // within a block of kernel variants, the variant being emitted replaces the size-based policy;
+    // rules which force or prevent unrolling are still respected
+    if(this->variant == kernel_variant::unrolled) unroll_by_policy = true;
+    if(this->variant == kernel_variant::rolled) unroll_by_policy = false;
     
     // determine whether the LHS and RHS force or prevent unrolling
     unsigned int prevent = 0;
@@ -224,15 +267,17 @@ bool macro_agent::apply_unroll_policy(const token_list& left_tokens, const token
         return false;
       }
 
-    // emit warnings if there is a policy violation that was not mandated by an explicit specifier
+    // emit warnings if there is a policy violation that was not mandated by an explicit specifier;
+    // within a block of kernel variants there is no size-based policy to violate
     bool emit = false;
-    if(unroll_by_policy && prevent > 0 && !left_tokens.has_explicit_prevent() && !right_tokens.has_explicit_prevent())
+    bool policy_in_force = this->variant == kernel_variant::none;
+    if(policy_in_force && unroll_by_policy && prevent > 0 && !left_tokens.has_explicit_prevent() && !right_tokens.has_explicit_prevent())
       {
         // issue notification that unrolling has been prevented, if we have been asked to do so
         ctx.warn(WARN_POLICY_WOULD_UNROLL);
         emit = true;
       }
-    if(!unroll_by_policy && force > 0 && !left_tokens.has_explicit_force() && !right_tokens.has_explicit_force())
+    if(policy_in_force && !unroll_by_policy && force > 0 && !left_tokens.has_explicit_force() && !right_tokens.has_explicit_force())
       {
         ctx.warn(WARN_POLICY_WOULD_ROLLUP);
         emit = true;
@@ -310,14 +355,8 @@ void macro_agent::unroll_index_assignment(token_list& left_tokens, token_list& r
 
         if(RHS_assignments.size() > 1)   // multiple RHS assignments
           {
-            // push the LHS evaluated on this assignment into the output list, if it is non-empty
-            if(left_tokens.size() > 0)
-              {
-                std::string lhs = left_tokens.to_string();
-                if(split_result.get_split_type() == macro_impl::split_type::sum) lhs += " = ";
-                if(split_result.get_split_type() == macro_impl::split_type::sum_equal) lhs += " += ";
-                r_list.push_back(lhs);
-              }
+            // RHS evaluations are collected separately, so that the LHS can be omitted if every term vanishes
+            std::list<std::string> rhs_list;
 
             // now generate a set of RHS evaluations for this LHS evaluation
             for(std::unique_ptr<indices_assignment> RHS_assign : RHS_assignments)
@@ -337,6 +376,9 @@ void macro_agent::unroll_index_assignment(token_list& left_tokens, token_list& r
                 counter += right_tokens.evaluate_macros(total_assignment);
                 counter += right_tokens.evaluate_macros(simple_macro_type::post);
 
+                if(left_tokens.size() == 0) this->record_sparsity(right_tokens);
+                else if(this->is_zero_term(right_tokens, split_result)) continue;
+
                 // set up replacement right hand side; add trailing ; and , only if the LHS is empty
                 std::string this_line = right_tokens.to_string() +
                                         (left_tokens.size() == 0 && split_result.has_trailing_semicolon() ? ";" : "") +
@@ -345,14 +387,34 @@ void macro_agent::unroll_index_assignment(token_list& left_tokens, token_list& r
                 if(left_tokens.size() ==
                    0)   // no need to format for indentation if no LHS; RHS will already include indentation
                   {
-                    r_list.push_back(this_line);
+                    rhs_list.push_back(this_line);
                   }
                 else
                   {
-                    r_list.push_back(this->dress(this_line, raw_indent, 3));
+                    rhs_list.push_back(this->dress(this_line, raw_indent, 3));
+                  }
+              }
+
+            // push the LHS evaluated on this assignment into the output list, if it is non-empty.
+            // If every term vanished, an accumulation can be dropped entirely and an assignment becomes
+            // an assignment to zero
+            if(left_tokens.size() > 0)
+              {
+                std::string lhs = left_tokens.to_string();
+
+                if(rhs_list.empty())
+                  {
+                    if(split_result.get_split_type() != macro_impl::split_type::sum) continue;
+                    rhs_list.push_back(this->dress("0", raw_indent, 3));
                   }
+
+                if(split_result.get_split_type() == macro_impl::split_type::sum) lhs += " = ";
+                if(split_result.get_split_type() == macro_impl::split_type::sum_equal) lhs += " += ";
+                r_list.push_back(lhs);
               }
 
+            r_list.splice(r_list.end(), rhs_list);
+
             // add a trailing ; and , if the LHS is nonempty
             if(left_tokens.size() > 0 && r_list.size() > 0)
               {
@@ -385,13 +447,20 @@ void macro_agent::unroll_index_assignment(token_list& left_tokens, token_list& r
             counter += right_tokens.evaluate_macros(total_assignment);
             counter += right_tokens.evaluate_macros(simple_macro_type::post);
 
+            bool zero = false;
+            if(left_tokens.size() == 0) this->record_sparsity(right_tokens);
+            else zero = this->is_zero_term(right_tokens, split_result);
+
+            // a vanishing accumulation can be dropped entirely
+            if(zero && split_result.get_split_type() == macro_impl::split_type::sum_equal) continue;
+
             // set up line with macro replacements, and add trailing ; and , if necessary;
             // since the line includes the full LHS it needs no special formatting to account for indentation
             std::string full_line = left_tokens.to_string();
             if(split_result.get_split_type() == macro_impl::split_type::sum) full_line += " =";
             if(split_result.get_split_type() == macro_impl::split_type::sum_equal) full_line += " +=";
 
-            full_line += (left_tokens.size() > 0 ? " " : "") + right_tokens.to_string() +
+            full_line += (left_tokens.size() > 0 ? " " : "") + (zero ? std::string{"0"} : right_tokens.to_string()) +
                          (split_result.has_trailing_semicolon() ? ";" : "") +
                          (split_result.has_trailing_comma() ? "," : "");
             r_list.push_back(full_line);
@@ -400,6 +469,30 @@ void macro_agent::unroll_index_assignment(token_list& left_tokens, token_list& r
 	}
 
 
+void macro_agent::record_sparsity(const token_list& tokens)
+  {
+    if(!this->data_payload.do_sparsity()) return;
+
+    auto init = tokens.get_initialization();
+    if(!init) return;
+
+    // a later initialization of the same target with a nonzero value supersedes an earlier zero one
+    if(init->second) this->zero_targets.insert(init->first);
+    else             this->zero_targets.erase(init->first);
+  }
+
+
+bool macro_agent::is_zero_term(const token_list& right_tokens, const macro_impl::split_string& split_result) const
+  {
+    if(!this->data_payload.do_sparsity()) return false;
+
+    // only terms in a sum can be dropped
+    if(split_result.get_split_type() == macro_impl::split_type::none) return false;
+
+    return right_tokens.is_zero_product(this->zero_targets);
+  }
+
+
 void macro_agent::forloop_index_assignment(token_list& left_tokens, token_list& right_tokens,
                                            assignment_set& LHS_assignments, assignment_set& RHS_assignments,
                                            unsigned int& counter, macro_impl::split_string& split_result,
@@ -408,6 +501,10 @@ void macro_agent::forloop_index_assignment(token_list& left_tokens, token_list&
     std::string raw_indent = this->compute_prefix(split_result);
     unsigned int current_indent = 0;
 
+    // a rolled loop gives no per-component information, so any targets previously known to vanish
+    // may have been overwritten
+    this->zero_targets.clear();
+
     if(LHS_assignments.size() == 0)
       {
         language_printer& prn = this->package.get_language_printer();
@@ -33,6 +33,7 @@
 #include <list>
 #include <string>
 #include <functional>
+#include <unordered_set>
 
 #include "core.h"
 #include "index_assignment.h"
@@ -157,6 +158,10 @@ class macro_agent
     //! inject a new macro definition
     void inject_macro(std::reference_wrapper< macro_packages::replacement_rule_index > rule);
 
+    //! forget which targets are known to vanish; called at function boundaries, since target names
+    //! are reused between functions and a zero initialization in one says nothing about another
+    void reset_sparsity() { this->zero_targets.clear(); }
+
 
     // INTERFACE -- OUTPUT CONTROL
 
@@ -172,6 +177,26 @@ class macro_agent
     bool is_enabled() const { return this->output_enabled; }
 
 
+    // INTERFACE -- KERNEL VARIANTS
+
+  public:
+
+    //! open a block of template text; if dual is true, the block is emitted once for each kernel variant
+    void begin_variants(bool dual);
+
+    //! close a block of kernel variants; returns true if the block is to be replayed for a further variant
+    bool end_variants();
+
+    //! query whether a block of kernel variants is open
+    bool in_variants() const { return this->variants_open; }
+
+    //! get kernel variant currently being emitted
+    kernel_variant get_kernel_variant() const { return this->variant; }
+
+    //! collect any outstanding request to mark or replay the template; the request is cleared
+    variant_request take_variant_request();
+
+
 		// INTERFACE - STATISTICS
 
   public:
@@ -230,6 +255,12 @@ class macro_agent
                                  unsigned int& counter, macro_impl::split_string& split_result,
                                  error_context& ctx, std::list<std::string>& r_list);
 
+    //! record whether an unrolled statement initializes a temporary to a symbolically zero value
+    void record_sparsity(const token_list& tokens);
+
+    //! determine whether an unrolled term can be dropped from a sum because it is known to vanish
+    bool is_zero_term(const token_list& right_tokens, const macro_impl::split_string& split_result) const;
+
 
     // INTERNAL API -- HANDLE INDEX SET BY FOR-LOOP
 
@@ -272,6 +303,19 @@ class macro_agent
     //! output currently enabled?
     bool output_enabled;
 
+    //! is a block of kernel variants open?
+    bool variants_open;
+
+    //! kernel variant currently being emitted
+    kernel_variant variant;
+
+    //! outstanding request to the template reader
+    variant_request request;
+
+    //! targets which unrolled statements have initialized to a symbolically zero value;
+    //! terms in unrolled sums which contain one of these as a factor are dropped
+    std::unordered_set<std::string> zero_targets;
+
 
     // TRANSLATOR-SUPPLIED PAYLOAD AND CONFIGURATION DATA
 
@@ -164,6 +164,7 @@ namespace token_list_impl
         indices(std::move(i)),
         rule(r),
         initialized(false),
+        zero(false),
         argument_error(false),
         index_error(false)
       {
@@ -212,9 +213,12 @@ namespace token_list_impl
             index_values.emplace_back(std::make_pair(std::cref(l), std::cref(rec)));
           }
 
+        this->zero = false;
+
         try
           {
             this->conversion = this->rule.evaluate_unroll(this->args, index_values);
+            this->zero = this->rule.is_zero(this->args, index_values);
           }
         catch(macro_packages::argument_mismatch& xe)
           {
@@ -245,6 +249,7 @@ namespace token_list_impl
         // as a performance optimization, 'pre' handler is not called for roll-up evaluation;
         // it just results in lots of CSE being performed which is unnecessary for roll-up
         // cases
+        this->zero = false;
 
         try
           {
@@ -286,6 +291,8 @@ namespace token_list_impl
             remap_list.emplace_back(std::make_shared<index_literal>(mapped_idx));
           }
 
+        this->zero = false;
+
         try
           {
             this->conversion = this->rule.evaluate_roll(this->args, remap_list);
@@ -346,6 +353,12 @@ namespace token_list_impl
               {
                 this->error(xe.what());
               }
+            catch(resource_failure& xe)
+              {
+                std::ostringstream msg;
+                msg << ERROR_RESOURCE_FAILURE_UNROLL << " '" << xe.what() << "'";
+                this->error(msg.str());
+              }
         
             initialized = true;
           }
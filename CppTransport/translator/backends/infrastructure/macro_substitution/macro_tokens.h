@@ -269,6 +269,9 @@ namespace token_list_impl
 
         //! call post-hook and reset initialization status
         void reset();
+
+        //! was the most recent unrolled evaluation symbolically zero?
+        bool is_zero() const { return this->zero; }
         
       protected:
         
@@ -295,6 +298,9 @@ namespace token_list_impl
         //! flag to determine whether 'pre' handler has been called
         bool initialized;
 
+        //! was the most recent unrolled evaluation symbolically zero?
+        bool zero;
+
         //! have argument-related errors been reported yet? if so, silence further errors
         bool argument_error;
 
@@ -37,5 +37,11 @@ enum class simple_macro_type { pre, post };
 
 enum class unroll_state { force, prevent, allow };
 
+//! kernel variant being emitted within a $VARIANTS block; 'none' outside a block, or if only one variant is emitted
+enum class kernel_variant { none, unrolled, rolled };
+
+//! request made of the template reader by a $VARIANTS block
+enum class variant_request { none, mark, replay };
+
 
 #endif //CPPTRANSPORT_MACRO_TYPES_H
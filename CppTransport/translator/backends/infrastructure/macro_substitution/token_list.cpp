@@ -26,10 +26,13 @@
 
 #include <assert.h>
 #include <sstream>
+#include <cctype>
 
 #include "token_list.h"
 #include "package_group.h"
 
+#include "boost/algorithm/string.hpp"
+
 
 namespace macro_tokenizer_impl
   {
@@ -1043,6 +1046,110 @@ std::string token_list::to_string()
 	}
 
 
+boost::optional< std::pair<std::string, bool> > token_list::get_initialization() const
+  {
+    // find the last index macro token; it should be followed only by whitespace or a statement terminator
+    auto t = this->tokens.crbegin();
+    for(; t != this->tokens.crend(); ++t)
+      {
+        if(dynamic_cast<const token_list_impl::index_macro_token*>(t->get()) != nullptr) break;
+
+        std::string trailer = (*t)->to_string();
+        if(trailer.find_first_not_of(" \t;,") != std::string::npos) return boost::none;
+      }
+
+    if(t == this->tokens.crend()) return boost::none;
+
+    const auto& macro = dynamic_cast<const token_list_impl::index_macro_token&>(**t);
+
+    // the token immediately preceding the macro should be a text token ending with a plain assignment
+    ++t;
+    if(t == this->tokens.crend() || dynamic_cast<const token_list_impl::text_token*>(t->get()) == nullptr) return boost::none;
+
+    std::string assign = (*t)->to_string();
+    boost::algorithm::trim_right(assign);
+    if(assign.empty() || assign.back() != '=') return boost::none;
+    assign.pop_back();
+    if(!assign.empty() && std::string("=!<>+-*/%&|^").find(assign.back()) != std::string::npos) return boost::none;
+
+    // assemble target from the remaining tokens
+    std::string target = assign;
+    for(++t; t != this->tokens.crend(); ++t)
+      {
+        target = (*t)->to_string() + target;
+      }
+
+    boost::algorithm::trim(target);
+    if(target.empty() || target.find('=') != std::string::npos) return boost::none;
+
+    // strip declaration specifiers
+    for(const std::string& spec : std::vector<std::string>{ "const ", "auto " })
+      {
+        if(boost::algorithm::starts_with(target, spec))
+          {
+            target.erase(0, spec.length());
+            boost::algorithm::trim_left(target);
+          }
+      }
+
+    return std::make_pair(target, macro.is_zero());
+  }
+
+
+bool token_list::is_zero_product(const std::unordered_set<std::string>& zeros) const
+  {
+    std::string expr;
+    std::unordered_set<std::string> zero_macros;
+
+    for(const auto& t : this->tokens)
+      {
+        expr += t->to_string();
+      }
+
+    for(const auto& t : this->index_macro_tokens)
+      {
+        const auto& T = t.get();
+        if(T.is_zero()) zero_macros.insert(T.to_string());
+      }
+
+    // remove statement terminators and a leading sign
+    boost::algorithm::trim(expr);
+    while(!expr.empty() && (expr.back() == ';' || expr.back() == ',')) expr.pop_back();
+    if(!expr.empty() && (expr.front() == '+' || expr.front() == '-')) expr.erase(0, 1);
+
+    // split into top-level factors; anything other than a pure product is conservatively treated as nonzero
+    std::list<std::string> factors;
+    std::string current;
+    int depth = 0;
+
+    for(char c : expr)
+      {
+        if(c == '(' || c == '[' || c == '{') ++depth;
+        if(c == ')' || c == ']' || c == '}') --depth;
+
+        if(depth == 0 && c == '*')
+          {
+            factors.push_back(current);
+            current.clear();
+            continue;
+          }
+
+        if(depth == 0 && std::string("+-/%?:=<>,;&|!").find(c) != std::string::npos) return false;
+
+        current += c;
+      }
+    factors.push_back(current);
+
+    for(std::string& f : factors)
+      {
+        boost::algorithm::trim(f);
+        if(f == "0" || zero_macros.count(f) > 0 || zeros.count(f) > 0) return true;
+      }
+
+    return false;
+  }
+
+
 unroll_state token_list::unroll_status() const
   {
     if(this->force_unroll.size() > 0 && this->prevent_unroll.size() == 0) return unroll_state::force;
@@ -31,6 +31,7 @@
 #include <vector>
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <string>
 #include <functional>
 
@@ -154,6 +155,22 @@ class token_list
     bool is_directive() const { return !this->simple_directive_tokens.empty() || !this->index_directive_tokens.empty(); }
 
 
+    // INTERFACE -- SPARSITY
+
+  public:
+
+    //! if the tokenized form is an initialization 'target = $MACRO' of a single index macro, return the
+    //! evaluated target (stripped of declaration specifiers such as 'const auto') and a flag indicating
+    //! whether the macro was symbolically zero on the most recent unrolled assignment
+    boost::optional< std::pair<std::string, bool> > get_initialization() const;
+
+    //! determine whether the tokenized form, evaluated on the most recent unrolled assignment, is a
+    //! product with a symbolically zero factor.
+    //! A factor is zero if it is a literal 0, an index macro which evaluated to a zero component,
+    //! or one of the supplied names (eg. temporaries previously initialized to zero)
+    bool is_zero_product(const std::unordered_set<std::string>& zeros) const;
+
+
     // INTERNAL API
 
   protected:
@@ -41,6 +41,19 @@ std::string macro_packages::cse_map_field1::unroll(const macro_argument_list& ar
   }
 
 
+bool macro_packages::cse_map_field1::unroll_zero(const macro_argument_list& args,
+                                                 const index_literal_assignment& indices)
+  {
+    if(!this->map) throw rule_apply_fail(ERROR_NO_PRE_MAP);
+
+    const index_value& idx = indices[0].second.get();
+
+    field_index i_label = field_index(idx.get_numeric_value());
+
+    return this->map->is_zero(this->fl.flatten(i_label));
+  }
+
+
 std::string macro_packages::cse_map_field2::unroll(const macro_argument_list& args,
                                                    const index_literal_assignment& indices)
   {
@@ -56,6 +69,21 @@ std::string macro_packages::cse_map_field2::unroll(const macro_argument_list& ar
   }
 
 
+bool macro_packages::cse_map_field2::unroll_zero(const macro_argument_list& args,
+                                                 const index_literal_assignment& indices)
+  {
+    if(!this->map) throw rule_apply_fail(ERROR_NO_PRE_MAP);
+
+    const index_value& idx_i = indices[0].second.get();
+    const index_value& idx_j = indices[1].second.get();
+
+    field_index i_label = field_index(idx_i.get_numeric_value());
+    field_index j_label = field_index(idx_j.get_numeric_value());
+
+    return this->map->is_zero(this->fl.flatten(i_label, j_label));
+  }
+
+
 std::string macro_packages::cse_map_field3::unroll(const macro_argument_list& args,
                                                    const index_literal_assignment& indices)
   {
@@ -71,3 +99,20 @@ std::string macro_packages::cse_map_field3::unroll(const macro_argument_list& ar
 
     return((*this->map)[this->fl.flatten(i_label, j_label, k_label)]);
   }
+
+
+bool macro_packages::cse_map_field3::unroll_zero(const macro_argument_list& args,
+                                                 const index_literal_assignment& indices)
+  {
+    if(!this->map) throw rule_apply_fail(ERROR_NO_PRE_MAP);
+
+    const index_value& idx_i = indices[0].second.get();
+    const index_value& idx_j = indices[1].second.get();
+    const index_value& idx_k = indices[2].second.get();
+
+    field_index i_label = field_index(idx_i.get_numeric_value());
+    field_index j_label = field_index(idx_j.get_numeric_value());
+    field_index k_label = field_index(idx_k.get_numeric_value());
+
+    return this->map->is_zero(this->fl.flatten(i_label, j_label, k_label));
+  }
@@ -61,6 +61,9 @@ namespace macro_packages
         //! evaluate
         std::string unroll(const macro_argument_list& args, const index_literal_assignment& indices) override;
 
+        //! query sparsity
+        bool unroll_zero(const macro_argument_list& args, const index_literal_assignment& indices) override;
+
         //! default post-hook will release CSE map
         void post_hook(const macro_argument_list&) override { this->map.release(); }
 
@@ -103,6 +106,9 @@ namespace macro_packages
         //! evaluate
         std::string unroll(const macro_argument_list& args, const index_literal_assignment& indices) override;
 
+        //! query sparsity
+        bool unroll_zero(const macro_argument_list& args, const index_literal_assignment& indices) override;
+
         //! default post-hook will release CSE map
         void post_hook(const macro_argument_list&) override { this->map.release(); }
 
@@ -145,6 +151,9 @@ namespace macro_packages
         //! evaluate
         std::string unroll(const macro_argument_list& args, const index_literal_assignment& indices) override;
 
+        //! query sparsity
+        bool unroll_zero(const macro_argument_list& args, const index_literal_assignment& indices) override;
+
         //! default post-hook will release CSE map
         void post_hook(const macro_argument_list&) override { this->map.release(); }
 
@@ -59,6 +59,12 @@ namespace macro_packages
       }
 
 
+    bool replacement_rule_index::is_zero(const macro_argument_list& args, const index_literal_assignment& indices)
+      {
+        return this->unroll_zero(args, indices);
+      }
+
+
     void replacement_rule_index::pre(const macro_argument_list& args, const index_literal_list& indices)
       {
         this->validate(args);
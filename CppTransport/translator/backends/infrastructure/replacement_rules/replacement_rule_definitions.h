@@ -154,6 +154,10 @@ namespace macro_packages
         //! evaluate the macro on a concrete (unrolled) index assignment
         std::string evaluate_unroll(const macro_argument_list& args, const index_literal_assignment& indices);
 
+        //! determine whether the macro is symbolically zero on a concrete (unrolled) index assignment;
+        //! must be called after evaluate_unroll() for the same assignment
+        bool is_zero(const macro_argument_list& args, const index_literal_assignment& indices);
+
         //! evaluate the macro on an abstract (rolled-up) index assignment
         std::string evaluate_roll(const macro_argument_list& args, const index_literal_list& indices);
 
@@ -195,6 +199,10 @@ namespace macro_packages
         //! evaluation function for unrolled index sets; has to be supplied by implementation
         virtual std::string unroll(const macro_argument_list& args, const index_literal_assignment& indices) = 0;
 
+        //! sparsity query for unrolled index sets; if the implementation knows which components vanish
+        //! it can override this, but the default is to assume every component is nonzero
+        virtual bool unroll_zero(const macro_argument_list& args, const index_literal_assignment& indices) { return false; }
+
         //! pre-evaluation; if needed, can be supplied by implementation; default is no-op
         virtual void pre_hook(const macro_argument_list& args, const index_literal_list& indices) { return; }
 
@@ -57,13 +57,16 @@ namespace cpp
     static std::string
     replace_stepper(boost::optional<contexted_value<std::shared_ptr<stepper> > > s, const std::string& state_name,
                     const std::string& value_type, const std::string& time_type, const std::string& algebra_name,
-                    const std::string& operations_name)
+                    const std::string& operations_name, bool allow_implicit)
       {
         std::ostringstream out;
 
-        // note that we need a generic stepper which works with an arbitrary state type; see
+        // note that the explicit steppers are generic and work with an arbitrary state type; see
         // http://headmyshoulder.github.io/odeint-v2/doc/boost_numeric_odeint/concepts/system.html
-        // we can't use things like rosenbrock4 or the implicit euler methods which work only with boost matrices
+        // rosenbrock_w2 is a W-method supplied by the runtime; it also needs an approximate factorization of
+        // I - gamma h J, which the templates provide via the $IF{implicit_pert} directive.
+        // We only support this for the perturbations, because the background is never stiff in the sense
+        // that matters here and is integrated using adaptive time ranges which would need a separate implementation
 
         // exactly when the steppers call the observer functor depends which stepper is in use; see
         // http://headmyshoulder.github.io/odeint-v2/doc/boost_numeric_odeint/odeint_in_detail/integrate_functions.html
@@ -87,6 +90,13 @@ namespace cpp
             auto& step = ***s;
             name = step.get_name();
 
+            if(step.is_implicit() && !allow_implicit)
+              {
+                std::ostringstream msg;
+                msg << ERROR_IMPLICIT_BACKG_STEPPER << " '" << name << "'";
+                throw macro_packages::rule_apply_fail(msg.str());
+              }
+
             if(name == "runge_kutta_dopri5")
               {
                 out << "boost::numeric::odeint::make_dense_output< boost::numeric::odeint::runge_kutta_dopri5< "
@@ -129,6 +139,13 @@ namespace cpp
                     << algebra_name << ", " << operations_name
                     << " > >(" << step.get_abserr() << ", " << step.get_relerr() << ")";
               }
+            else if(name == IMPLICIT_STEPPER_ROSENBROCK_W2)
+              {
+                // rosenbrock_w2 indexes the state directly, so algebra_name and operations_name are not needed
+                out << "transport::rosenbrock_w2< "
+                    << state_name << ", " << value_type << ", " << time_type
+                    << " >(" << step.get_abserr() << ", " << step.get_relerr() << ")";
+              }
             else
               {
                 std::ostringstream msg;
@@ -158,7 +175,7 @@ namespace cpp
         std::string algebra_name = args[BACKG_STEPPER_ALGEBRA_ARGUMENT];
         std::string operations_name = args[BACKG_STEPPER_OPERATIONS_ARGUMENT];
 
-        return(replace_stepper(s, state_name, value_type, time_type, algebra_name, operations_name));
+        return(replace_stepper(s, state_name, value_type, time_type, algebra_name, operations_name, false));
       }
 
 
@@ -171,7 +188,7 @@ namespace cpp
         std::string algebra_name = args[BACKG_STEPPER_ALGEBRA_ARGUMENT];
         std::string operations_name = args[BACKG_STEPPER_OPERATIONS_ARGUMENT];
 
-        return(replace_stepper(s, state_name, value_type, time_type, algebra_name, operations_name));
+        return(replace_stepper(s, state_name, value_type, time_type, algebra_name, operations_name, true));
       }
 
 
@@ -26,7 +26,9 @@
 
 #include <string>
 #include <sstream>
+#include <cstdlib>
 
+#include "core.h"
 #include "cse.h"
 #include "cpp_cse.h"
 #include "error.h"
@@ -38,26 +40,26 @@ namespace cpp
     
     const std::map< std::string, std::string > func_convert
       {
-        {"abs", "std::abs"},
-        {"sqrt", "std::sqrt"},
-        {"sin", "std::sin"},
-        {"cos", "std::cos"},
-        {"tan", "std::tan"},
-        {"asin", "std::asin"},
-        {"acos", "std::acos"},
-        {"atan", "std::atan"},
-        {"atan2", "std::atan2"},
-        {"sinh", "std::sinh"},
-        {"cosh", "std::cosh"},
-        {"tanh", "std::tanh"},
-        {"asinh", "std::asinh"},
-        {"acosh", "std::acosh"},
-        {"atanh", "std::atanh"},
-        {"exp", "std::exp"},
-        {"log", "std::log"},
-        {"pow", "std::pow"},
-        {"tgamma", "std::tgamma"},
-        {"lgamma", "std::lgamma"}
+        {"abs", "abs"},
+        {"sqrt", "sqrt"},
+        {"sin", "sin"},
+        {"cos", "cos"},
+        {"tan", "tan"},
+        {"asin", "asin"},
+        {"acos", "acos"},
+        {"atan", "atan"},
+        {"atan2", "atan2"},
+        {"sinh", "sinh"},
+        {"cosh", "cosh"},
+        {"tanh", "tanh"},
+        {"asinh", "asinh"},
+        {"acosh", "acosh"},
+        {"atanh", "atanh"},
+        {"exp", "exp"},
+        {"log", "log"},
+        {"pow", "pow"},
+        {"tgamma", "tgamma"},
+        {"lgamma", "lgamma"}
       };
     
 
@@ -95,7 +97,7 @@ namespace cpp
             return std::string{};
           }
 
-        std::string rval{t->second};
+        std::string rval{this->maths_function(t->second)};
         rval.append("(");
         rval.append(this->print_operands(expr, ",", use_count));
         rval.append(")");
@@ -131,32 +133,76 @@ namespace cpp
       }
 
 
-    // utility function to properly bracket the base of a power expression
-    static std::string unwrap_power(const std::string& base_str, const GiNaC::ex& base_expr, unsigned int factors)
+    std::string cpp_cse::maths_function(const std::string& name) const
       {
-        bool simple = GiNaC::is_a<GiNaC::symbol>(base_expr)
-                      || GiNaC::is_a<GiNaC::constant>(base_expr)
-                      || GiNaC::is_a<GiNaC::function>(base_expr);
+        // in automatic differentiation and numeric curvature modes, calls are routed through the runtime's AD namespace,
+        // which forwards ordinary numbers to the standard library and supplies overloads for Taylor jets
+        const bool jets = this->data_payload.autodiff() || this->data_payload.numeric_curvature();
+        std::string rval{jets ? OUTPUT_CPP_AUTODIFF_NAMESPACE : OUTPUT_CPP_MATHS_NAMESPACE};
+        rval.append(name);
 
-        std::ostringstream buf;
+        return rval;
+      }
+
+
+    // powers whose multiplication ladder is estimated to cost more than this many multiplications
+    // are left to pow(); a call to pow() typically costs a few tens of multiplications, but ladder steps
+    // are shared between powers of the same base, so the marginal cost of a ladder is usually lower than its estimate
+    constexpr unsigned int MAX_LADDER_COST = 6;
 
-        unsigned int count = 0;
-        while(factors > 0)
-          {
-            if(count > 0) buf << "*";
-            if(simple) buf << base_str;
-            else       buf << "(" << base_str << ")";
 
-            --factors;
-            ++count;
+    // estimate number of multiplications needed to compute x^n by repeated squaring
+    static unsigned int ladder_cost(unsigned int n)
+      {
+        unsigned int squarings = 0;
+        unsigned int multiplications = 0;
+
+        while(n > 1)
+          {
+            if(n % 2 == 1) ++multiplications;
+            n = n / 2;
+            ++squarings;
           }
 
-        return buf.str();
+        return squarings + multiplications;
       }
 
 
-    // treat powers specially, because it's better to unroll them and
-    // avoid a function call if we have an exact integral power
+    // utility function to bracket a factor, unless it is a plain identifier or number
+    static std::string bracket_factor(const std::string& factor)
+      {
+        if(factor.find_first_of("+-*/(), ") == std::string::npos) return factor;
+
+        return "(" + factor + ")";
+      }
+
+
+    std::string cpp_cse::print_ladder(const GiNaC::ex& base_expr, const std::string& base, int n, bool use_count)
+      {
+        // x^1 and x^-1 are the foundations of the ladder; the reciprocal is interned like any other rung,
+        // so every negative power of the same base shares a single division
+        if(n == 1) return base;
+        if(n == -1) return "1.0/" + bracket_factor(base);
+
+        // otherwise split x^n into two lower rungs, each of which is interned so that it can be shared
+        // with other powers of the same base: x^2m = x^m * x^m, and x^(2m+1) = x^2m * x
+        int sign = n > 0 ? 1 : -1;
+        int lower = n % 2 == 0 ? n/2 : n - sign;
+        int upper = n - lower;
+
+        auto rung = [&](int m) -> std::string
+          { return m == 1 ? base : this->intern(GiNaC::pow(base_expr, m), use_count); };
+
+        std::string lower_str = rung(lower);
+        std::string upper_str = rung(upper);
+
+        return "(" + bracket_factor(lower_str) + "*" + bracket_factor(upper_str) + ")";
+      }
+
+
+    // treat powers specially: integer and half-integer powers are strength-reduced to ladders of
+    // multiplications (and a square root), whose rungs are shared through the CSE symbol table,
+    // whenever the cost model prefers that to a call to pow()
     std::string cpp_cse::print_power(const GiNaC::ex& expr, bool use_count)
       {
         std::ostringstream out;
@@ -166,7 +212,7 @@ namespace cpp
           {
             error_context err_ctx = this->data_payload.make_error_context();
             err_ctx.error(ERROR_CSE_POWER_ARGUMENTS);
-            out << "std::pow(" << this->print_operands(expr, ",", use_count) << ")";
+            out << this->maths_function("pow") << "(" << this->print_operands(expr, ",", use_count) << ")";
             return std::string{};
           }
 
@@ -180,41 +226,57 @@ namespace cpp
         if(use_count) exponent = this->get_symbol_with_use_count(exponent_expr);
         else exponent = this->get_symbol_without_use_count(exponent_expr);
 
+        std::string base;
+        if(use_count) base = this->get_symbol_with_use_count(base_expr);
+        else base = this->get_symbol_without_use_count(base_expr);
+
         if(GiNaC::is_a<GiNaC::numeric>(exponent_expr))
           {
             const auto& exp_numeric = GiNaC::ex_to<GiNaC::numeric>(exponent_expr);
-        
-            std::string base;
-            if(use_count) base = this->get_symbol_with_use_count(expr.op(0));
-            else base = this->get_symbol_without_use_count(expr.op(0));
 
             if(GiNaC::is_integer(exp_numeric))
               {
-                if(GiNaC::is_nonneg_integer(exp_numeric))
-                  {
-                    if(exp_numeric.to_int() == 0) out << "1.0";
-                    else if(exp_numeric.to_int() == 1) out << unwrap_power(base, base_expr, 1);
-                    else if(exp_numeric.to_int() == 2) out << "(" << unwrap_power(base, base_expr, 2) << ")";
-                    else if(exp_numeric.to_int() == 3) out << "(" << unwrap_power(base, base_expr, 3) << ")";
-                    else if(exp_numeric.to_int() == 4) out << "(" << unwrap_power(base, base_expr, 4) << ")";
-                    else out << "std::pow(" << base << "," << exp_numeric.to_int() << ")";
-                  }
-                else  // negative integer
-                  {
-                    if(exp_numeric.to_int() == -0) out << "1.0";
-                    else if(exp_numeric.to_int() == -1) out << "1.0/" << unwrap_power(base, base_expr, 1);
-                    else if(exp_numeric.to_int() == -2) out << "1.0/" << "(" << unwrap_power(base, base_expr, 2) << ")";
-                    else if(exp_numeric.to_int() == -3) out << "1.0/" << "(" << unwrap_power(base, base_expr, 3) << ")";
-                    else if(exp_numeric.to_int() == -4) out << "1.0/" << "(" << unwrap_power(base, base_expr, 4) << ")";
-                    else out << "std::pow(" << base << "," << exp_numeric.to_int() << ")";
-                  }
+                int exp_int = exp_numeric.to_int();
+
+                if(exp_int == 0) out << "1.0";
+                else if(ladder_cost(static_cast<unsigned int>(std::abs(exp_int))) <= MAX_LADDER_COST)
+                  out << this->print_ladder(base_expr, base, exp_int, use_count);
+                else out << this->maths_function("pow") << "(" << base << "," << exp_int << ")";
+
+                return(out.str());
               }
-            else  // not an integer
+
+            // half-integer powers x^(m+1/2) are computed as x^m * sqrt(x), or as the reciprocal of the
+            // corresponding positive power if the exponent is negative
+            const GiNaC::numeric twice = exp_numeric * 2;
+            if(GiNaC::is_integer(twice))
               {
-                out << "std::pow(" << base << "," << exponent << ")";
+                int twice_int = twice.to_int();
+                unsigned int m = static_cast<unsigned int>(std::abs(twice_int)) / 2;
+
+                if(ladder_cost(m) + 1 <= MAX_LADDER_COST)
+                  {
+                    if(twice_int == 1)
+                      {
+                        out << this->maths_function("sqrt") << "(" << base << ")";
+                      }
+                    else if(twice_int < 0)
+                      {
+                        out << "1.0/" << bracket_factor(this->intern(GiNaC::pow(base_expr, -exp_numeric), use_count));
+                      }
+                    else
+                      {
+                        std::string root = this->intern(GiNaC::pow(base_expr, GiNaC::numeric(1, 2)), use_count);
+                        std::string rung = m == 1 ? base : this->intern(GiNaC::pow(base_expr, m), use_count);
+                        out << "(" << bracket_factor(rung) << "*" << bracket_factor(root) << ")";
+                      }
+
+                    return(out.str());
+                  }
               }
           }
 
+        out << this->maths_function("pow") << "(" << base << "," << exponent << ")";
         return(out.str());
       }
 
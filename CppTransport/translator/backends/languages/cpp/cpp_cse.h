@@ -67,9 +67,17 @@ namespace cpp
         std::string print_operands(const GiNaC::ex& expr, std::string op, bool use_count) override;
     
         //! special implementation of print_operands() to print a power;
-        //! uses strength reduction to compute integer powers by multiplication for small enough exponents
+        //! uses strength reduction to compute integer and half-integer powers by multiplication
+        //! whenever the cost model prefers this to a call to pow()
         std::string print_power(const GiNaC::ex& expr, bool use_count);
 
+        //! print an integer power x^n as a product of two lower powers of x, each of which is
+        //! interned in the symbol table so that the rungs of the ladder are shared between powers of x
+        std::string print_ladder(const GiNaC::ex& base_expr, const std::string& base, int n, bool use_count);
+
+        //! qualify the name of a mathematical function with the namespace appropriate for the current output mode
+        std::string maths_function(const std::string& name) const;
+
       };
 
   } // namespace cpp
@@ -46,6 +46,9 @@ namespace macro_packages
         EMPLACE(simple_package, BIND_IF_SYMBOL(else_directive, "ELSE"));
         EMPLACE(simple_package, BIND_IF_SYMBOL(endif_directive, "ENDIF"));
 
+        EMPLACE(simple_package, BIND_SYMBOL(variants_directive, "VARIANTS"));
+        EMPLACE(simple_package, BIND_SYMBOL(endvariants_directive, "ENDVARIANTS"));
+
         EMPLACE(index_package, BIND_SYMBOL(set_directive, "SET"));
       }
 
@@ -143,14 +146,33 @@ namespace macro_packages
 
         macro_agent& ma = this->payload.get_stack().top_macro_package();
 
-        // currently we support only the "fast" condition, so we can bodge the job
-        // of evaluating the conditional clause; in general, this would require
-        // tokenization, parsing, and the result would be a lot more complex
+        // currently we support only the "fast", "implicit_pert", "numeric_curvature", "autodiff", "autodiff_check",
+        // "dual_unroll", "split", "plugin" and "specialized" conditions, so we can bodge the job of evaluating the conditional clause; in general,
+        // this would require tokenization, parsing, and the result would be a lot more complex
         if(condition == std::string("fast") && this->payload.fast()) truth = true;
         else if(condition == std::string("!fast") && !this->payload.fast()) truth = true;
+        else if(condition == std::string("implicit_pert") && this->implicit_pert()) truth = true;
+        else if(condition == std::string("!implicit_pert") && !this->implicit_pert()) truth = true;
+        else if(condition == std::string("numeric_curvature") && this->payload.numeric_curvature()) truth = true;
+        else if(condition == std::string("!numeric_curvature") && !this->payload.numeric_curvature()) truth = true;
+        else if(condition == std::string("autodiff") && this->payload.autodiff()) truth = true;
+        else if(condition == std::string("!autodiff") && !this->payload.autodiff()) truth = true;
+        else if(condition == std::string("autodiff_check") && this->payload.autodiff_check()) truth = true;
+        else if(condition == std::string("!autodiff_check") && !this->payload.autodiff_check()) truth = true;
+        else if(condition == std::string("dual_unroll") && this->payload.dual_unroll()) truth = true;
+        else if(condition == std::string("!dual_unroll") && !this->payload.dual_unroll()) truth = true;
+        else if(condition == std::string("split") && this->payload.split()) truth = true;
+        else if(condition == std::string("!split") && !this->payload.split()) truth = true;
+        else if(condition == std::string("plugin") && this->payload.plugin()) truth = true;
+        else if(condition == std::string("!plugin") && !this->payload.plugin()) truth = true;
+        else if(condition == std::string("specialized") && this->payload.specialized()) truth = true;
+        else if(condition == std::string("!specialized") && !this->payload.specialized()) truth = true;
+
+        // a clause nested inside a disabled clause can never enable output
+        bool parent_enabled = this->istack.size() == 0 || this->istack.top().is_enabled();
 
         // push a new clause onto the "if" stack, with the determined truth value
-        this->istack.emplace(condition, truth);
+        this->istack.emplace(condition, truth, parent_enabled);
 
         // enable or disable output, as appropriate
         if(this->istack.top().is_enabled())
@@ -168,6 +190,16 @@ namespace macro_packages
       }
     
     
+    bool if_directive::implicit_pert() const
+      {
+        auto s = this->payload.templates.get_perturbations_stepper();
+        if(!s) return false;
+
+        auto& step = ***s;
+        return step.is_implicit();
+      }
+
+
     std::string else_directive::apply(const macro_argument_list& args)
       {
         // check for unpaired or duplicate "else" clause
@@ -224,6 +256,39 @@ namespace macro_packages
       }
 
 
+    std::string variants_directive::apply(const macro_argument_list& args)
+      {
+        macro_agent& ma = this->payload.get_stack().top_macro_package();
+
+        // blocks of variants cannot be nested, since replaying the inner block would need a stack of marks
+        if(ma.in_variants()) throw rule_apply_fail(ERROR_NESTED_VARIANTS);
+
+        bool dual = this->payload.dual_unroll();
+        ma.begin_variants(dual);
+
+        std::ostringstream msg;
+        msg << "VARIANTS";
+        if(dual) msg << " " << OUTPUT_KERNEL_VARIANT_UNROLLED;
+        return msg.str();
+      }
+
+
+    std::string endvariants_directive::apply(const macro_argument_list& args)
+      {
+        macro_agent& ma = this->payload.get_stack().top_macro_package();
+
+        if(!ma.in_variants()) throw rule_apply_fail(ERROR_UNPAIRED_ENDVARIANTS);
+
+        // if a further variant is needed, the template reader will replay the block from its beginning
+        bool replay = ma.end_variants();
+
+        std::ostringstream msg;
+        msg << "ENDVARIANTS";
+        if(replay) msg << " -- VARIANTS " << OUTPUT_KERNEL_VARIANT_ROLLED;
+        return msg.str();
+      }
+
+
     namespace directives_impl
       {
 
@@ -49,6 +49,10 @@ namespace macro_packages
 
     constexpr unsigned int ENDIF_DIRECTIVE_TOTAL_ARGUMENTS = 0;
 
+    constexpr unsigned int VARIANTS_DIRECTIVE_TOTAL_ARGUMENTS = 0;
+
+    constexpr unsigned int ENDVARIANTS_DIRECTIVE_TOTAL_ARGUMENTS = 0;
+
 
     namespace directives_impl
       {
@@ -126,12 +130,13 @@ namespace macro_packages
 
           public:
 
-            if_record(std::string c, bool v)
+            if_record(std::string c, bool v, bool p = true)
               : condition(std::move(c)),
                 value(v),
+                parent_enabled(p),
                 if_branch(true)
               {
-                if(value) enabled = true;
+                if(value) enabled = parent_enabled;
                 else      enabled = false;
               }
 
@@ -152,7 +157,7 @@ namespace macro_packages
             bool in_if_branch() const { return(this->if_branch); }
 
             //! mark as in else-branch
-            void mark_else_branch() { this->if_branch = false; if(value) enabled = false; else enabled = true; }
+            void mark_else_branch() { this->if_branch = false; if(value) enabled = false; else enabled = parent_enabled; }
 
             //! get current output-enabled status
             bool is_enabled() const { return(this->enabled); }
@@ -168,6 +173,9 @@ namespace macro_packages
             //! record truth value
             bool value;
 
+            //! was output enabled in the enclosing clause?
+            bool parent_enabled;
+
             //! which branch are we in?
             bool if_branch;
 
@@ -251,6 +259,9 @@ namespace macro_packages
 
         //! force evaluation even when output is disabled
         bool always_apply() const override { return true; }
+
+        //! determine whether the perturbations stepper is implicit
+        bool implicit_pert() const;
         
 
         // INTERNAL DATA
@@ -341,6 +352,63 @@ namespace macro_packages
       };
 
 
+    //! $VARIANTS opens a block of template text which is emitted once for each kernel variant
+    //! (first with all index sets unrolled, and then with all index sets rolled up) when --dual-unroll
+    //! is in use; otherwise the block is emitted once, under the usual unroll policy
+    class variants_directive: public directive_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        variants_directive(std::string n, translator_data& p)
+          : directive_simple(n, VARIANTS_DIRECTIVE_TOTAL_ARGUMENTS, p)
+          {
+          }
+
+        //! destructor
+        virtual ~variants_directive() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! apply
+        std::string apply(const macro_argument_list& args) override;
+
+      };
+
+
+    class endvariants_directive: public directive_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        endvariants_directive(std::string n, translator_data& p)
+          : directive_simple(n, ENDVARIANTS_DIRECTIVE_TOTAL_ARGUMENTS, p)
+          {
+          }
+
+        //! destructor
+        virtual ~endvariants_directive() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! apply
+        std::string apply(const macro_argument_list& args) override;
+
+      };
+
+
     class directives: public directive_package
       {
 
@@ -25,10 +25,13 @@
 
 
 #include <functional>
+#include <iomanip>
+#include <limits>
 #include <time.h>
 
 #include "boost/date_time/posix_time/posix_time.hpp"
 #include "fundamental.h"
+#include "macro.h"
 #include "to_printable.h"
 #include "translation_unit.h"
 #include "formatter.h"
@@ -77,6 +80,8 @@ namespace macro_packages
         EMPLACE(pre_package, BIND(replace_latex_list, "LATEX_NAME_LIST"));
         EMPLACE(pre_package, BIND(replace_param_list, "PARAM_NAME_LIST"));
         EMPLACE(pre_package, BIND(replace_platx_list, "PLATX_NAME_LIST"));
+        EMPLACE(pre_package, BIND(replace_specialized_indices, "SPECIALIZED_PARAM_INDICES"));
+        EMPLACE(pre_package, BIND(replace_specialized_values, "SPECIALIZED_PARAM_VALUES"));
         EMPLACE(pre_package, BIND(replace_state_list, "STATE_NAME_LIST"));
         EMPLACE(pre_package, BIND(replace_b_abs_err, "BACKG_ABS_ERR"));
         EMPLACE(pre_package, BIND(replace_b_rel_err, "BACKG_REL_ERR"));
@@ -86,6 +91,8 @@ namespace macro_packages
         EMPLACE(pre_package, BIND(replace_p_rel_err, "PERT_REL_ERR"));
         EMPLACE(pre_package, BIND(replace_p_step, "PERT_STEP_SIZE"));
         EMPLACE(pre_package, BIND(replace_p_stepper, "PERT_STEPPER"));
+        EMPLACE(pre_package, BIND(replace_kernel_variant, "KERNEL_VARIANT"));
+        EMPLACE(pre_package, BIND(replace_split_unit, "SPLIT_UNIT"));
 
         EMPLACE(post_package, BIND(replace_unique, "UNIQUE"));
       }
@@ -165,6 +172,17 @@ namespace macro_packages
         auto rv_value = this->data_payload.meta.get_revision();
         if(rv_value) uid_str << static_cast<unsigned int>(*rv_value);
 
+        // a specialized variant cannot be used with arbitrary parameter values, so it must not share
+        // an identifier with the generic model or with variants specialized to different values
+        if(this->data_payload.specialized())
+          {
+            std::vector<std::string> names = this->data_payload.model.get_param_name_list();
+            for(const auto& p : this->data_payload.get_specialized_params())
+              {
+                uid_str << names[p.first] << "=" << p.second;
+              }
+          }
+
         // hash using MD5 so we are guaranteed to get the same result on all platforms
         unsigned char result[MD5_DIGEST_LENGTH];
         MD5(reinterpret_cast<const unsigned char*>(uid_str.str().c_str()), uid_str.str().length(), result);
@@ -187,7 +205,11 @@ namespace macro_packages
         boost::uuids::string_generator gen;
         boost::uuids::uuid id = gen(id_str.str());
 
-        return(boost::uuids::to_string(id));
+        // record identifier, which is needed to name the model plugin if one is requested
+        std::string uid = boost::uuids::to_string(id);
+        this->data_payload.set_unique_id(uid);
+
+        return(uid);
       }
 
 
@@ -340,14 +362,13 @@ namespace macro_packages
     std::string replace_model::evaluate(const macro_argument_list& args)
       {
         auto value = this->data_payload.templates.get_model();
-        if(value)
-          {
-            return *value;
-          }
-        else
-          {
-            return(std::string(DEFAULT_MODEL_NAME));
-          }
+        std::string name = value ? static_cast<std::string>(*value) : std::string(DEFAULT_MODEL_NAME);
+
+        // a specialized variant must be distinguishable from the generic model when both are compiled into one
+        // executable, so its class (and every name derived from it) carries the specialization tag
+        if(this->data_payload.specialized()) name += "_" + this->data_payload.get_specialization_tag();
+
+        return name;
       }
 
 
@@ -407,6 +428,36 @@ namespace macro_packages
       }
 
 
+    std::string replace_specialized_indices::evaluate(const macro_argument_list& args)
+      {
+        std::vector<std::string> list;
+
+        for(const auto& p : this->data_payload.get_specialized_params())
+          {
+            list.push_back(boost::lexical_cast<std::string>(p.first));
+          }
+
+        return this->printer.initialization_list(list, false);
+      }
+
+
+    std::string replace_specialized_values::evaluate(const macro_argument_list& args)
+      {
+        std::vector<std::string> list;
+
+        for(const auto& p : this->data_payload.get_specialized_params())
+          {
+            // emit enough digits that the value round-trips exactly through a double
+            std::ostringstream value;
+            value << std::setprecision(std::numeric_limits<double>::max_digits10)
+                  << GiNaC::ex_to<GiNaC::numeric>(p.second.evalf()).to_double();
+            list.push_back(value.str());
+          }
+
+        return this->printer.initialization_list(list, false);
+      }
+
+
     std::string replace_platx_list::evaluate(const macro_argument_list& args)
       {
         std::vector<std::string> list = this->data_payload.model.get_param_latex_list();
@@ -563,6 +614,32 @@ namespace macro_packages
       }
 
 
+    std::string replace_kernel_variant::evaluate(const macro_argument_list& args)
+      {
+        macro_agent& ma = this->data_payload.get_stack().top_macro_package();
+
+        switch(ma.get_kernel_variant())
+          {
+            case kernel_variant::unrolled: return OUTPUT_KERNEL_VARIANT_UNROLLED;
+            case kernel_variant::rolled:   return OUTPUT_KERNEL_VARIANT_ROLLED;
+            case kernel_variant::none:     break;
+          }
+
+        throw macro_packages::rule_apply_fail(ERROR_KERNEL_VARIANT_OUTSIDE_BLOCK);
+      }
+
+
+    std::string replace_split_unit::evaluate(const macro_argument_list& args)
+      {
+        std::string name = args[SPLIT_UNIT_NAME_ARGUMENT];
+
+        if(name.empty()) throw macro_packages::rule_apply_fail(ERROR_SPLIT_UNIT_NAME);
+
+        // register the unit, so that a translation unit is generated for it once the implementation is complete
+        return this->data_payload.add_split_unit(name);
+      }
+
+
     // POST macros
 
 
@@ -63,6 +63,8 @@ namespace macro_packages
     constexpr unsigned int LATEX_LIST_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int PARAM_LIST_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int PLATX_LIST_TOTAL_ARGUMENTS = 0;
+    constexpr unsigned int SPECIALIZED_INDICES_TOTAL_ARGUMENTS = 0;
+    constexpr unsigned int SPECIALIZED_VALUES_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int STATE_LIST_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int BACKG_ABS_ERR_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int BACKG_REL_ERR_TOTAL_ARGUMENTS = 0;
@@ -72,6 +74,9 @@ namespace macro_packages
     constexpr unsigned int PERT_REL_ERR_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int PERT_STEP_TOTAL_ARGUMENTS = 0;
     constexpr unsigned int PERT_NAME_TOTAL_ARGUMENTS = 0;
+    constexpr unsigned int KERNEL_VARIANT_TOTAL_ARGUMENTS = 0;
+    constexpr unsigned int SPLIT_UNIT_NAME_ARGUMENT = 0;
+    constexpr unsigned int SPLIT_UNIT_TOTAL_ARGUMENTS = 1;
     constexpr unsigned int UNIQUE_TOTAL_ARGUMENTS = 0;
 
 
@@ -1009,6 +1014,88 @@ namespace macro_packages
       };
 
 
+    //! initialization list of parameter indices fixed in a specialized variant
+    class replace_specialized_indices : public replacement_rule_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        replace_specialized_indices(std::string n, translator_data& p, language_printer& prn)
+          : replacement_rule_simple(std::move(n), SPECIALIZED_INDICES_TOTAL_ARGUMENTS),
+            data_payload(p),
+            printer(prn)
+          {
+          }
+
+        //! destructor
+        virtual ~replace_specialized_indices() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! evaluate
+        virtual std::string evaluate(const macro_argument_list& args) override;
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! data payload
+        translator_data& data_payload;
+
+        //! language printer
+        language_printer& printer;
+
+      };
+
+
+    //! initialization list of the values fixed in a specialized variant, in the same order as their indices
+    class replace_specialized_values : public replacement_rule_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        replace_specialized_values(std::string n, translator_data& p, language_printer& prn)
+          : replacement_rule_simple(std::move(n), SPECIALIZED_VALUES_TOTAL_ARGUMENTS),
+            data_payload(p),
+            printer(prn)
+          {
+          }
+
+        //! destructor
+        virtual ~replace_specialized_values() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! evaluate
+        virtual std::string evaluate(const macro_argument_list& args) override;
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! data payload
+        translator_data& data_payload;
+
+        //! language printer
+        language_printer& printer;
+
+      };
+
+
     class replace_platx_list : public replacement_rule_simple
       {
 
@@ -1409,6 +1496,86 @@ namespace macro_packages
       };
 
 
+    class replace_kernel_variant : public replacement_rule_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        replace_kernel_variant(std::string n, translator_data& p, language_printer& prn)
+          : replacement_rule_simple(std::move(n), KERNEL_VARIANT_TOTAL_ARGUMENTS),
+            data_payload(p),
+            printer(prn)
+          {
+          }
+
+        //! destructor
+        virtual ~replace_kernel_variant() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! evaluate
+        virtual std::string evaluate(const macro_argument_list& args) override;
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! data payload
+        translator_data& data_payload;
+
+        //! language printer
+        language_printer& printer;
+
+      };
+
+
+    class replace_split_unit : public replacement_rule_simple
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        replace_split_unit(std::string n, translator_data& p, language_printer& prn)
+          : replacement_rule_simple(std::move(n), SPLIT_UNIT_TOTAL_ARGUMENTS),
+            data_payload(p),
+            printer(prn)
+          {
+          }
+
+        //! destructor
+        virtual ~replace_split_unit() = default;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! evaluate
+        virtual std::string evaluate(const macro_argument_list& args) override;
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! data payload
+        translator_data& data_payload;
+
+        //! language printer
+        language_printer& printer;
+
+      };
+
+
     class replace_unique : public replacement_rule_simple
       {
 
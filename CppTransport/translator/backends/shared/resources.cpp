@@ -32,6 +32,7 @@
 #include "nontrivial-metric/resource_manager.h"
 
 #include "flow_tensors.h"
+#include "macro.h"
 
 
 #define BIND(X, N) std::move(std::make_unique<X>(N, m, p))
@@ -409,6 +410,11 @@ namespace macro_packages
       {
         this->mgr.release();
 
+        // every function body in the templates begins by releasing resources, so this also marks the point
+        // at which sparsity information gathered from the previous function must be discarded
+        macro_agent& ma = this->payload.get_stack().top_macro_package();
+        ma.reset_sparsity();
+
         return RESOURCE_RELEASE;
       }
 
@@ -53,6 +53,7 @@ constexpr auto ZETA2_P_SYMBOL_NAME                   = "_InternalZ2p";
 
 constexpr auto DEFAULT_RECURSION_DEPTH               = (127);
 constexpr auto DEFAULT_MODEL_NAME                    = "UNKNOWN_MODEL";
+constexpr unsigned int SPECIALIZATION_TAG_BYTES      = (4);
 
 constexpr auto CPPTRANSPORT_PATH_ENV                 = "CPPTRANSPORT_PATH";
 constexpr auto CPPTRANSPORT_TEMPLATE_PATH            = "templates";
@@ -85,6 +86,18 @@ constexpr auto OUTPUT_TEMPORARY_POOL_END             = "END TEMPORARY POOL";
 constexpr auto OUTPUT_TEMPORARY_POOL_SEQUENCE        = "sequence";
 constexpr auto OUTPUT_KERNEL_LOCATION                = "VEXCL KERNEL INSERTION";
 
+constexpr auto OUTPUT_KERNEL_VARIANT_UNROLLED        = "unrolled";
+constexpr auto OUTPUT_KERNEL_VARIANT_ROLLED          = "rolled";
+
+constexpr auto OUTPUT_SPLIT_UNIT_PREFIX              = "CPPTRANSPORT_UNIT_";
+constexpr auto OUTPUT_SPLIT_UNIT_EXTENSION           = ".cpp";
+constexpr auto OUTPUT_SPLIT_CMAKE_EXTENSION          = ".cmake";
+constexpr auto OUTPUT_SPLIT_CMAKE_SOURCES            = "_SOURCES";
+
+constexpr auto OUTPUT_PLUGIN_GUARD                   = "CPPTRANSPORT_MODEL_PLUGIN";
+constexpr auto OUTPUT_PLUGIN_SUFFIX                  = "_plugin";
+constexpr auto OUTPUT_PLUGIN_EXTENSION               = ".so";
+
 constexpr auto OUTPUT_VEXCL_KERNEL_PRE               = ", \"";
 constexpr auto OUTPUT_VEXCL_KERNEL_POST              = "\"";
 
@@ -93,4 +106,7 @@ constexpr auto OUTPUT_VEXCL_KERNEL_LINE_POST         = "\\n\"";
 
 constexpr auto OUTPUT_OPENCL_QUALIFIER               = "global";
 
+constexpr auto OUTPUT_CPP_MATHS_NAMESPACE            = "std::";
+constexpr auto OUTPUT_CPP_AUTODIFF_NAMESPACE         = "transport::ad::";
+
 #endif //CPPTRANSPORT_CORE_H
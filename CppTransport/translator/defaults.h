@@ -32,6 +32,9 @@ constexpr double DEFAULT_REL_ERR   = 1E-6;
 constexpr double DEFAULT_STEP_SIZE = 1E-12;
 constexpr auto   DEFAULT_STEPPER   = "runge_kutta_dopri5";
 
+// implicit steppers require the translator to emit an approximate W-matrix for the perturbation system
+constexpr auto   IMPLICIT_STEPPER_ROSENBROCK_W2 = "rosenbrock_w2";
+
 constexpr unsigned int DEFAULT_MAX_ERROR_COUNT = 20;
 
 
@@ -55,13 +55,17 @@ int main(int argc, const char *argv[])
 
 		// emit any messages generated during argument parsing
 		auto& messages = args.get_messages();
+    bool arg_errors = false;
 		for(const auto& m : messages)
 			{
         // first component of pair is a flag that indicates whether this is an error or a warning
-				if(m.first) error(m.second, args, env);
+				if(m.first) { error(m.second, args, env); arg_errors = true; }
 				if(!m.first) warn(m.second, args, env);
 			}
 
+    // an inconsistent command line should not produce any output
+    if(arg_errors) return(EXIT_FAILURE);
+
     // set up the initial search path;
     // this should consist of the current working directory, but also
     // any include paths set using environment variables
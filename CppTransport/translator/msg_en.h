@@ -45,6 +45,10 @@ constexpr auto ERROR_TOKEN                           = "error: ";
 constexpr auto FATAL_TOKEN                           = "fatal: ";
 
 constexpr auto NOTIFY_PATH_INCLUDES_TEMPLATES        = "Note: search path includes leaf 'templates'";
+constexpr auto NOTIFY_NUMERIC_CURVATURE_NOT_FAST     = "Note: --fast is ignored when --numeric-curvature is in use";
+constexpr auto NOTIFY_AUTODIFF_NOT_FAST              = "Note: --fast is ignored when --autodiff is in use";
+constexpr auto NOTIFY_DUAL_UNROLL_NOT_FAST           = "Note: --fast is ignored when --dual-unroll is in use";
+constexpr auto ERROR_SPLIT_WITH_PLUGIN               = "--split cannot be combined with --plugin";
 
 constexpr auto WARNING_PARSING_FAILED                = "Failed to parse file";
 constexpr auto WARNING_VALIDATION_ERRORS             = "The following validation errors occurred:";
@@ -90,6 +94,7 @@ constexpr auto ERROR_NO_PERTURBATIONS_STEPPER_BLOCK  = "No perturbations stepper
 constexpr auto ERROR_NO_MODEL_BLOCK                  = "No model block specified";
 constexpr auto ERROR_NO_POTENTIAL                    = "Model specification requires a potential";
 constexpr auto ERROR_NO_METRIC                       = "Model specification requires a field-space metric";
+constexpr auto ERROR_IMPLICIT_STEPPER_NONCANONICAL   = "Implicit steppers are currently supported only for canonical models";
 
 constexpr auto WARNING_VEXCL_STEPPER_IGNORED_A       = "Using stepper type";
 constexpr auto WARNING_VEXCL_STEPPER_IGNORED_B       = "; VexCL backend ignores stepper specification";
@@ -304,6 +309,7 @@ constexpr auto ERROR_SET_REDEFINITION                = "Redefinition of replacem
 constexpr auto WARN_PRIOR_REDEFINITION               = "Earlier definition of this rule was here";
 constexpr auto ERROR_INDEX_SUBSTITUTION              = "Missing substitution for index";
 constexpr auto ERROR_RESOURCE_FAILURE                = "Could not evaluate roll-up due to missing resource";
+constexpr auto ERROR_RESOURCE_FAILURE_UNROLL         = "Could not evaluate macro due to missing resource";
 
 constexpr auto ERROR_LHS_INDEX_DUPLICATE             = "Left-hand side contains duplicated index";
 constexpr auto NOTIFY_RHS_INDEX_SINGLE_OCCURRENCE    = "Note: index occurs only once on right-hand side";
@@ -312,6 +318,19 @@ constexpr auto NOTIFY_RHS_INDEX_SINGLE_VARIANCE      = "Note: right-hand side in
 constexpr auto ERROR_UNPAIRED_ELSE                   = "Unexpected $ELSE without opening $IF";
 constexpr auto ERROR_UNPAIRED_ENDIF                  = "Unexpected $ENDIF without opening $IF";
 constexpr auto ERROR_DUPLICATE_ELSE                  = "Duplicate $ELSE clause";
+constexpr auto ERROR_NESTED_VARIANTS                 = "Unexpected $VARIANTS inside an open $VARIANTS block";
+constexpr auto ERROR_UNPAIRED_ENDVARIANTS            = "Unexpected $ENDVARIANTS without opening $VARIANTS";
+constexpr auto ERROR_KERNEL_VARIANT_OUTSIDE_BLOCK    = "$KERNEL_VARIANT is defined only within a $VARIANTS block when --dual-unroll is in use";
+constexpr auto ERROR_SPLIT_UNIT_NAME                 = "$SPLIT_UNIT requires a non-empty unit name";
+constexpr auto ERROR_OPEN_SPLIT_UNIT                 = "Could not open split translation unit";
+constexpr auto WARNING_SPLIT_NO_UNITS                = "--split was requested, but the implementation template declares no translation units";
+constexpr auto ERROR_OPEN_PLUGIN_UNIT                = "Could not open model plugin source";
+constexpr auto ERROR_PLUGIN_NO_UID                   = "--plugin was requested, but the templates did not assign a unique identifier to the model";
+constexpr auto ERROR_OPEN_SPECIALIZATION             = "Could not open parameter specialization file";
+constexpr auto ERROR_SPECIALIZATION_SYNTAX           = "Expected 'name = value' in parameter specialization file";
+constexpr auto ERROR_SPECIALIZATION_UNKNOWN          = "Parameter specialization file assigns a value to undeclared parameter";
+constexpr auto ERROR_SPECIALIZATION_DUPLICATE        = "Parameter specialization file assigns more than one value to parameter";
+constexpr auto ERROR_SPECIALIZATION_VALUE            = "Parameter specialization value is not a real number:";
 
 constexpr auto WARNING_UNKNOWN_SWITCH                = "Ignored unknown command-line switch";
 
@@ -341,11 +360,18 @@ constexpr auto MESSAGE_TRANSLATING                   = "translating";
 constexpr auto MESSAGE_TRANSLATING_TO                = "into";
 constexpr auto ANNOTATE_EXPANSION_OF_LINE            = "expansion of template line";
 
+constexpr auto MESSAGE_SPLIT_UNITS_A                 = "wrote";
+constexpr auto MESSAGE_SPLIT_UNITS_B                 = "split translation units; source list in";
+constexpr auto MESSAGE_PLUGIN_UNIT                   = "wrote model plugin build rules to";
+constexpr auto MESSAGE_SPECIALIZATION_A              = "fixed values for";
+constexpr auto MESSAGE_SPECIALIZATION_B              = "parameters read from";
+
 constexpr auto MESSAGE_TRANSLATION_RESULT            = "translation finished with";
 constexpr auto MESSAGE_REPLACEMENT_RULE_EXPANSIONS   = "replacement rule expansions";
 
 constexpr auto ERROR_UNKNOWN_STEPPER                 = "Unknown or unimplemented odeint-v2 stepper";
 constexpr auto ERROR_UNDEFINED_STEPPER               = "Stepper block not declared";
+constexpr auto ERROR_IMPLICIT_BACKG_STEPPER          = "Implicit steppers are supported only for the perturbations; background stepper must be explicit, but received";
 
 constexpr auto ERROR_SYMBOL_DATABASE_EMPLACE_FAIL    = "Internal error: emplace to symbol database failed";
 
@@ -58,5 +58,13 @@ validation_exceptions model_descriptor::validate() const
     list.merge(templates_list);
     list.merge(misc_list);
     
+    // implicit steppers are currently supported only for canonical models, because the templates
+    // emit a Jacobian only for the canonical transport equations
+    auto pert = this->templates.get_perturbations_stepper();
+    if(pert && (***pert).is_implicit() && this->model.get_lagrangian_type() != model_type::canonical)
+      {
+        list.push_back(std::make_unique<validation_message>(true, ERROR_IMPLICIT_STEPPER_NONCANONICAL));
+      }
+    
     return list;
   }
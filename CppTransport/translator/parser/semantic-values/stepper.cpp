@@ -49,3 +49,9 @@ bool stepper::set_abserr(double d, y::lexeme_type& l)
   {
     return SetContextedValue(this->abserr, d, l, ERROR_ABSERR_REDECLARATION);
   }
+
+
+bool stepper::is_implicit() const
+  {
+    return this->get_name() == IMPLICIT_STEPPER_ROSENBROCK_W2;
+  }
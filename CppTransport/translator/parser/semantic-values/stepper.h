@@ -75,6 +75,9 @@ class stepper
     //! get name of stepper; returns default if no value has been set
     const std::string get_name() const { if(this->name) return *this->name; else return(DEFAULT_STEPPER); }
 
+    //! determine whether this stepper is implicit, and so requires a Jacobian for the system it integrates
+    bool is_implicit() const;
+
 
     // INTERNAL DATA
 
@@ -58,6 +58,9 @@
 #define NO_CSE_SWITCH                 "no-cse"
 #define NO_CSE_HELP                   "disable common sub-expression elimination"
 
+#define NO_SPARSITY_SWITCH            "no-sparsity"
+#define NO_SPARSITY_HELP              "disable elimination of symbolically zero terms in unrolled contractions"
+
 #define NO_COLOUR_SWITCH              "no-colour"
 #define NO_COLOUR_HELP                "disable colourized output"
 
@@ -79,6 +82,27 @@
 #define FAST_SWITCH                   "fast"
 #define FAST_HELP                     "unroll all loops and optimize for speed"
 
+#define NUMERIC_CURVATURE_SWITCH      "numeric-curvature"
+#define NUMERIC_CURVATURE_HELP        "compute inverse metric, connexion and curvature numerically at runtime (nontrivial metric models)"
+
+#define AUTODIFF_SWITCH               "autodiff"
+#define AUTODIFF_HELP                 "compute derivatives of the potential by automatic differentiation at runtime (canonical models)"
+
+#define AUTODIFF_CHECK_SWITCH         "autodiff-check"
+#define AUTODIFF_CHECK_HELP           "as --autodiff, but also emit symbolic derivatives and cross-check against them"
+
+#define DUAL_UNROLL_SWITCH            "dual-unroll"
+#define DUAL_UNROLL_HELP              "emit unrolled and rolled variants of the integration kernels, and select between them at runtime"
+
+#define SPLIT_SWITCH                  "split"
+#define SPLIT_HELP                    "emit the implementation as separately-compilable translation units, with a CMake fragment listing them"
+
+#define PLUGIN_SWITCH                 "plugin"
+#define PLUGIN_HELP                   "also emit a source file and CMake fragment building the model as a runtime-loadable plugin"
+
+#define SPECIALIZE_SWITCH             "specialize"
+#define SPECIALIZE_HELP               "fix parameter values from the named file (one 'name = value' per line) and fold them into the generated code"
+
 #define PROFILING_SWITCH              "profile"
 #define PROFILING_HELP                "display profiling information"
 
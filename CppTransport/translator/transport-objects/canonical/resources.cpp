@@ -53,6 +53,10 @@ namespace canonical
         // if no potential was set, fail gracefully; errors should have been emitted before this point
         if(pot) V = **(pot.get()); else V = GiNaC::ex(0);
 
+        // in a specialized variant, fix parameter values before any derivatives are taken, so that terms
+        // which vanish or combine for these values are simplified away before CSE
+        if(p.specialized()) V = V.subs(p.get_specialization_map(), GiNaC::subs_options::no_pattern);
+
         // switch off compute timer (it will be restarted if needed during subsequent computations)
         compute_timer.stop();
       }
@@ -459,7 +463,11 @@ namespace canonical
               {
                 unsigned int index = this->fl.flatten(i,j);
 
-                std::string variable = printer.array_subscript(resource, this->fl.flatten(i), this->fl.flatten(j),
+                // read only canonically-ordered components, so that symmetric components share a symbol
+                // and the generated code does not load them separately
+                auto c = canonical_order<2>(RESOURCE_SYMMETRIES::DDV_SYMMETRY, { i, j });
+
+                std::string variable = printer.array_subscript(resource, this->fl.flatten(c[0]), this->fl.flatten(c[1]),
                                                                *flatten);
 
                 list[index] = this->sym_factory.get_real_symbol(variable);
@@ -486,6 +494,16 @@ namespace canonical
                 GiNaC::ex ddV;
                 unsigned int index = this->fl.flatten(i,j);
 
+                // components which are not canonically ordered are copies of a canonical component computed earlier
+                auto c = canonical_order<2>(RESOURCE_SYMMETRIES::DDV_SYMMETRY, { i, j });
+                unsigned int c_index = this->fl.flatten(c[0], c[1]);
+
+                if(c_index != index)
+                  {
+                    list[index] = list[c_index];
+                    continue;
+                  }
+
                 if(!this->cache.query(expression_item_types::ddV_item, index, args, ddV))
                   {
                     timing_instrument timer(this->compute_timer);
@@ -543,8 +561,11 @@ namespace canonical
                   {
                     unsigned int index = this->fl.flatten(i,j,k);
 
-                    std::string variable = printer.array_subscript(resource, this->fl.flatten(i), this->fl.flatten(j),
-                                                                   this->fl.flatten(k), *flatten);
+                    // read only canonically-ordered components, so that symmetric components share a symbol
+                    auto c = canonical_order<3>(RESOURCE_SYMMETRIES::DDDV_SYMMETRY, { i, j, k });
+
+                    std::string variable = printer.array_subscript(resource, this->fl.flatten(c[0]), this->fl.flatten(c[1]),
+                                                                   this->fl.flatten(c[2]), *flatten);
 
                     list[index] = this->sym_factory.get_real_symbol(variable);
                   }
@@ -574,6 +595,16 @@ namespace canonical
                     GiNaC::ex dddV;
                     unsigned int index = this->fl.flatten(i,j,k);
 
+                    // components which are not canonically ordered are copies of a canonical component computed earlier
+                    auto c = canonical_order<3>(RESOURCE_SYMMETRIES::DDDV_SYMMETRY, { i, j, k });
+                    unsigned int c_index = this->fl.flatten(c[0], c[1], c[2]);
+
+                    if(c_index != index)
+                      {
+                        list[index] = list[c_index];
+                        continue;
+                      }
+
                     if(!this->cache.query(expression_item_types::dddV_item, index, args, dddV))
                       {
                         timing_instrument timer(this->compute_timer);
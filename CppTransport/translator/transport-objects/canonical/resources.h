@@ -37,6 +37,7 @@
 #include "index_flatten.h"
 
 #include "shared_resources.h"
+#include "index_symmetry.h"
 #include "cse.h"
 #include "language_printer.h"
 
@@ -55,6 +56,14 @@ namespace canonical
     constexpr unsigned int use_ddV = 1 << 1;
     constexpr unsigned int use_dddV = 1 << 2;
 
+    //! permutation symmetries of the canonical resources; partial derivatives commute, so
+    //! derivatives of the potential are totally symmetric
+    namespace RESOURCE_SYMMETRIES
+      {
+        constexpr auto DDV_SYMMETRY = index_symmetry::total;
+        constexpr auto DDDV_SYMMETRY = index_symmetry::total;
+      }
+
     //! implements resources for canonical models, ie. trivial kinetic terms and just a potential
     class resources
       {
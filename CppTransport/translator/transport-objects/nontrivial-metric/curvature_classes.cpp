@@ -32,8 +32,9 @@
 
 //! Christoffel functions
 
-Christoffel::Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, const symbol_list& c_)
+Christoffel::Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, const symbol_list& c_, bool opaque_)
   : N(G_.rows()),
+    opaque(opaque_),
     G(G_),
     Ginv(Ginv_),
     coords(c_)
@@ -42,6 +43,19 @@ Christoffel::Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, co
     if(Ginv.rows() != Ginv.cols()) throw std::runtime_error(ERROR_METRIC_NOT_SQUARE);
     if(G.rows() != Ginv.rows()) throw std::runtime_error(ERROR_METRIC_DIMENSION);
 
+    // compute components of the connexion of the first kind and cache them;
+    // these are independent of the inverse metric
+    for(unsigned int m = 0; m < N; ++m)
+      {
+        for(unsigned int j = 0; j < N; ++j)
+          {
+            for(unsigned int k = 0; k <= j; ++k)
+              {
+                gamma_first.push_back((GiNaC::diff(G(m, j), coords[k]) + GiNaC::diff(G(m, k), coords[j]) - GiNaC::diff(G(j, k), coords[m])) / 2);
+              }
+          }
+      }
+
     // compute components of the connexion and cache them
     for(unsigned int i = 0; i < N; ++i)
       {
@@ -53,13 +67,40 @@ Christoffel::Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, co
 
                 for(unsigned int m = 0; m < N; ++m)
                   {
-                    temp += Ginv(i, m) * (diff(G(m, j), coords[k]) + diff(G(m, k), coords[j]) - diff(G(j, k), coords[m])) / 2;
+                    temp += Ginv(i, m) * this->first_kind(m, j, k);
                   }
 
                 gamma.push_back(temp);
               }
           }
       }
+
+    // if the inverse metric is opaque, cache its coordinate derivatives
+    // dG^{ab}/dx^k = -G^{ac} (dG_cd/dx^k) G^{db}, so that expressions containing it can be differentiated.
+    // The inverse is symmetric, so only the lower triangle a >= b is needed
+    if(opaque)
+      {
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int b = 0; b <= a; ++b)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    GiNaC::ex temp = 0;
+
+                    for(unsigned int c = 0; c < N; ++c)
+                      {
+                        for(unsigned int d = 0; d < N; ++d)
+                          {
+                            temp -= Ginv(a, c) * GiNaC::diff(G(c, d), coords[k]) * Ginv(d, b);
+                          }
+                      }
+
+                    dGinv.push_back(temp);
+                  }
+              }
+          }
+      }
   }
 
 
@@ -74,12 +115,54 @@ const GiNaC::ex& Christoffel::operator()(unsigned int i, unsigned int j, unsigne
   }
 
 
+const GiNaC::ex& Christoffel::first_kind(unsigned int i, unsigned int j, unsigned int k) const
+  {
+    if(k > j) std::swap(k, j);
+
+    // flatten (i,j,k) index arrangement
+    unsigned int index = (i * N * (N+1)) / 2 + (j*(j + 1))/2 + k;
+
+    return gamma_first[index];
+  }
+
+
 size_t Christoffel::size() const
   {
     return gamma.size();
   }
 
 
+GiNaC::ex Christoffel::diff(const GiNaC::ex& expr, unsigned int k) const
+  {
+    GiNaC::ex result = GiNaC::diff(expr, coords[k]);
+
+    if(!opaque) return result;
+
+    for(unsigned int a = 0; a < N; ++a)
+      {
+        for(unsigned int b = 0; b <= a; ++b)
+          {
+            const GiNaC::ex& g = Ginv(a, b);
+            if(!GiNaC::is_a<GiNaC::symbol>(g) || !expr.has(g)) continue;
+
+            result += GiNaC::diff(expr, GiNaC::ex_to<GiNaC::symbol>(g)) * this->inverse_derivative(a, b, k);
+          }
+      }
+
+    return result;
+  }
+
+
+const GiNaC::ex& Christoffel::inverse_derivative(unsigned int a, unsigned int b, unsigned int k) const
+  {
+    if(b > a) std::swap(a, b);
+
+    unsigned int index = ((a*(a + 1))/2 + b) * N + k;
+
+    return dGinv[index];
+  }
+
+
 //! Riemann_T functions
 
 Riemann_T::Riemann_T(const Christoffel& Gamma_)
@@ -88,6 +171,7 @@ Riemann_T::Riemann_T(const Christoffel& Gamma_)
   {
     const symbol_list& coords = Gamma_.get_coords();
     const GiNaC::matrix& G = Gamma_.get_G();
+    const GiNaC::matrix& Ginv = Gamma_.get_Ginv();
 
     for(unsigned int i = 0; i < N; ++i)
       {
@@ -107,13 +191,35 @@ Riemann_T::Riemann_T(const Christoffel& Gamma_)
 
                     GiNaC::ex temp = 0;
 
-                    for(int n = 0; n < N; ++n)
+                    if(Gamma.is_opaque())
                       {
-                        temp += G(n, i) * (diff(Gamma(n, l, j), coords[k]) - (diff(Gamma(n, k, j), coords[l])));
-
-                        for(int m = 0; m < N; ++m)
+                        // the inverse metric cannot be differentiated directly, so use the equivalent form
+                        // R_ijkl = (G_il,jk + G_jk,il - G_ik,jl - G_jl,ik)/2 + G^ab (Gamma_ajk Gamma_bil - Gamma_ajl Gamma_bik)
+                        // which involves only derivatives of the metric and the connexion of the first kind
+                        temp = (GiNaC::diff(GiNaC::diff(G(i, l), coords[j]), coords[k])
+                                + GiNaC::diff(GiNaC::diff(G(j, k), coords[i]), coords[l])
+                                - GiNaC::diff(GiNaC::diff(G(i, k), coords[j]), coords[l])
+                                - GiNaC::diff(GiNaC::diff(G(j, l), coords[i]), coords[k])) / 2;
+
+                        for(unsigned int a = 0; a < N; ++a)
                           {
-                            temp += G(n, i) * (Gamma(n, k, m) * Gamma(m, l, j) - (Gamma(n, l, m) * Gamma(m, k, j)));
+                            for(unsigned int b = 0; b < N; ++b)
+                              {
+                                temp += Ginv(a, b) * (Gamma.first_kind(a, j, k) * Gamma.first_kind(b, i, l)
+                                                      - Gamma.first_kind(a, j, l) * Gamma.first_kind(b, i, k));
+                              }
+                          }
+                      }
+                    else
+                      {
+                        for(int n = 0; n < N; ++n)
+                          {
+                            temp += G(n, i) * (diff(Gamma(n, l, j), coords[k]) - (diff(Gamma(n, k, j), coords[l])));
+
+                            for(int m = 0; m < N; ++m)
+                              {
+                                temp += G(n, i) * (Gamma(n, k, m) * Gamma(m, l, j) - (Gamma(n, l, m) * Gamma(m, k, j)));
+                              }
                           }
                       }
 
@@ -179,7 +285,6 @@ DRiemann_T::DRiemann_T(const Riemann_T& R_)
     R(R_)
   {
     const Christoffel& Gamma = R.get_connexion();
-    const symbol_list& coords = Gamma.get_coords();
     
     for(unsigned int m = 0; m < N; ++m)
       {
@@ -199,7 +304,7 @@ DRiemann_T::DRiemann_T(const Riemann_T& R_)
 
                         if(s > r) continue;
 
-                        GiNaC::ex temp = diff(R(i, j, k, l), coords[m]);
+                        GiNaC::ex temp = Gamma.diff(R(i, j, k, l), m);
 
                         for(unsigned int n = 0; n < N; ++n)
                           {
@@ -44,8 +44,10 @@ class Christoffel
   public:
 
     //! constructor accepts a GiNaC matrix and its inverse, and a list of symbols representing the fields of
-    //! the model
-    Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, const symbol_list& c_);
+    //! the model.
+    //! If opaque_ is true then the components of the inverse are taken to be symbols standing for values
+    //! computed numerically at runtime, rather than explicit functions of the fields
+    Christoffel(const GiNaC::matrix& G_, const GiNaC::matrix& Ginv_, const symbol_list& c_, bool opaque_=false);
 
     //! destructor is default
     ~Christoffel() = default;
@@ -58,6 +60,10 @@ class Christoffel
     //! extract a component; i = top index, (j,k) = symmetric lower indices
     const GiNaC::ex& operator()(unsigned int i, unsigned int j, unsigned int k) const;
 
+    //! extract a component of the connexion of the first kind Gamma_{ijk}, with all indices lowered;
+    //! i = lowered top index, (j,k) = symmetric lower indices
+    const GiNaC::ex& first_kind(unsigned int i, unsigned int j, unsigned int k) const;
+
     //! get number of fields
     unsigned int get_number_fields() const { return this->N; }
 
@@ -73,6 +79,22 @@ class Christoffel
     //! get size
     size_t size() const;
 
+    //! is the inverse metric opaque?
+    bool is_opaque() const { return this->opaque; }
+
+
+    // DIFFERENTIATION
+
+  public:
+
+    //! differentiate an expression with respect to the k-th coordinate.
+    //! If the inverse metric is opaque, its coordinate dependence is supplied using the chain rule
+    GiNaC::ex diff(const GiNaC::ex& expr, unsigned int k) const;
+
+    //! extract the derivative of the opaque inverse metric component G^{ab} with respect to the k-th coordinate,
+    //! expressed in terms of the opaque components; only meaningful if the inverse metric is opaque
+    const GiNaC::ex& inverse_derivative(unsigned int a, unsigned int b, unsigned int k) const;
+
 
     // INTERNAL DATA
 
@@ -81,9 +103,18 @@ class Christoffel
     //! cache number of fields
     const unsigned int N;
 
+    //! is the inverse metric opaque?
+    const bool opaque;
+
     //! flattened tensor representing the components of the connexion
     flattened_tensor gamma;
 
+    //! flattened tensor representing the components of the connexion of the first kind
+    flattened_tensor gamma_first;
+
+    //! flattened tensor representing coordinate derivatives of the opaque inverse metric, if in use
+    flattened_tensor dGinv;
+
     //! reference to matrix used to construct connexion
     const GiNaC::matrix& G;
 
@@ -24,6 +24,8 @@
 //
 
 
+#include <sstream>
+
 #include "resources.h"
 
 #include "concepts/tensor_exception.h"
@@ -57,7 +59,8 @@ namespace nontrivial_metric
         field_list(p.model.get_field_symbols()),
         deriv_list(p.model.get_deriv_symbols()),
         param_list(p.model.get_param_symbols()),
-        fl(p.model.get_number_params(), p.model.get_number_fields())
+        fl(p.model.get_number_params(), p.model.get_number_fields()),
+        opaque_Ginv(false)
       {
         // get potential stored by the model descriptor, if one is available
         auto pot = p.model.get_potential();
@@ -65,6 +68,10 @@ namespace nontrivial_metric
         // if no potential was set, fail gracefully; errors should have been emitted before this point
         if(pot) V = **(pot.get()); else V = GiNaC::ex(0);
 
+        // in a specialized variant, fix parameter values before any derivatives are taken, so that terms
+        // which vanish or combine for these values are simplified away before CSE
+        if(p.specialized()) V = V.subs(p.get_specialization_map(), GiNaC::subs_options::no_pattern);
+
         // get number of fields in the current model
         auto N = payload.model.get_number_fields();
 
@@ -88,12 +95,34 @@ namespace nontrivial_metric
                 for(unsigned int j = 0; j < N; ++j)
                   {
                     field_metric::index_type idx = std::make_pair(field_list[i].get_name(), field_list[j].get_name());
-                    this->G->set(i, j, G(idx));
+                    this->G->set(i, j, G(idx).subs(p.get_specialization_map(), GiNaC::subs_options::no_pattern));
                   }
               }
 
-            // construct inverse metric
-            *this->Ginv = GiNaC::ex_to<GiNaC::matrix>(this->G->inverse());
+            if(p.numeric_curvature())
+              {
+                // the inverse metric will be computed numerically at runtime, so represent each of its
+                // components by an opaque symbol; these are exchanged for resource labels during substitution
+                for(unsigned int i = 0; i < N; ++i)
+                  {
+                    for(unsigned int j = 0; j <= i; ++j)
+                      {
+                        std::ostringstream name;
+                        name << GINV_PLACEHOLDER_NAME << i << "_" << j;
+
+                        auto sym = this->sym_factory.get_real_symbol(name.str());
+                        this->Ginv->set(i, j, sym);
+                        this->Ginv->set(j, i, sym);
+                      }
+                  }
+
+                this->opaque_Ginv = true;
+              }
+            else
+              {
+                // construct inverse metric
+                *this->Ginv = GiNaC::ex_to<GiNaC::matrix>(this->G->inverse());
+              }
           }
         else    // unexpected case that no metric has been provided; attempt to recover gracefully (errors should have been emitted before this stage)
           {
@@ -102,9 +131,15 @@ namespace nontrivial_metric
           }
 
         // construct curvature tensors based on this metric
-        this->Crstfl = std::make_unique<Christoffel>(*this->G, *this->Ginv, field_list);
-        this->Rie_T = std::make_unique<Riemann_T>(*this->Crstfl);
-        this->DRie_T = std::make_unique<DRiemann_T>(*this->Rie_T);
+        this->Crstfl = std::make_unique<Christoffel>(*this->G, *this->Ginv, field_list, this->opaque_Ginv);
+
+        // in numeric curvature mode the Riemann tensor and its covariant derivative are computed at runtime from
+        // Taylor jets of the metric, so there is no need to pay for building them symbolically
+        if(!this->opaque_Ginv)
+          {
+            this->Rie_T = std::make_unique<Riemann_T>(*this->Crstfl);
+            this->DRie_T = std::make_unique<DRiemann_T>(*this->Rie_T);
+          }
 
         // switch off compute timer (it will be restarted if needed during subsequent computations)
         compute_timer.stop();
@@ -524,10 +559,79 @@ namespace nontrivial_metric
               }
           }
 
+        const auto Ginv_resource = mgr.metric_inverse();
+        const auto& field_flatten = mgr.field_flatten();
+
+        if(this->opaque_Ginv && Ginv_resource && field_flatten)
+          {
+            auto Ginv_labels = this->metric_inverse_resource(printer);
+
+            // exchange opaque inverse-metric symbols for the corresponding resource labels
+            const field_index max_i = share.get_max_field_index(variance::contravariant);
+            for(field_index i = field_index(0, variance::contravariant); i < max_i; ++i)
+              {
+                for(field_index j = field_index(0, variance::contravariant); j <= i; ++j)
+                  {
+                    auto ui = static_cast<unsigned int>(i);
+                    auto uj = static_cast<unsigned int>(j);
+                    subs_map[(*this->Ginv)(ui, uj)] = (*Ginv_labels)[fl.flatten(i,j)];
+                  }
+              }
+          }
+
         return subs_map;
       }
 
 
+    void resources::require_metric_inverse() const
+      {
+        if(!this->opaque_Ginv) return;
+
+        const auto resource = this->mgr.metric_inverse();
+        const auto& flatten = this->mgr.field_flatten();
+
+        if(!resource || !flatten) throw resource_failure("metric inverse");
+      }
+
+
+    void resources::require_symbolic_curvature() const
+      {
+        if(!this->Rie_T || !this->DRie_T) throw resource_failure("Riemann tensor");
+      }
+
+
+    GiNaC::ex resources::diff_coordinate(const GiNaC::ex& expr, const symbol_list& f_list, field_index k,
+                                         const language_printer& printer) const
+      {
+        auto uk = static_cast<unsigned int>(k);
+        GiNaC::ex result = GiNaC::diff(expr, f_list[this->fl.flatten(k)]);
+
+        if(!this->opaque_Ginv) return result;
+
+        auto Ginv_labels = this->metric_inverse_resource(printer);
+        GiNaC::exmap subs_map = this->make_substitution_map(printer);
+
+        // the inverse metric labels depend on the coordinates, through dG^{ab}/dx^k = -G^{ac} (dG_cd/dx^k) G^{db}
+        const field_index max_i = this->share.get_max_field_index(variance::contravariant);
+        for(field_index i = field_index(0, variance::contravariant); i < max_i; ++i)
+          {
+            for(field_index j = field_index(0, variance::contravariant); j <= i; ++j)
+              {
+                const GiNaC::ex& label = (*Ginv_labels)[this->fl.flatten(i,j)];
+                if(!GiNaC::is_a<GiNaC::symbol>(label) || !expr.has(label)) continue;
+
+                auto ui = static_cast<unsigned int>(i);
+                auto uj = static_cast<unsigned int>(j);
+
+                GiNaC::ex dGinv = this->Crstfl->inverse_derivative(ui, uj, uk).subs(subs_map, GiNaC::subs_options::no_pattern);
+                result += GiNaC::diff(expr, GiNaC::ex_to<GiNaC::symbol>(label)) * dGinv;
+              }
+          }
+
+        return result;
+      }
+
+
     GiNaC::ex resources::eps_resource(cse& cse_worker, const language_printer& printer) const
       {
         if(this->payload.do_cse())
@@ -754,6 +858,9 @@ namespace nontrivial_metric
     std::unique_ptr<flattened_tensor>
     resources::raw_Ginv_resource(const language_printer& printer) const
       {
+        // the opaque inverse metric has no explicit expression
+        this->require_metric_inverse();
+
         auto Ginv = std::make_unique<flattened_tensor>(this->fl.get_flattened_size<field_index>(2));
     
         auto args = this->generate_cache_arguments(printer);
@@ -857,7 +964,8 @@ namespace nontrivial_metric
           {
             try
               {
-                this->tensor_resource_label(*list, resource.get().first, { vi, vj }, resource.get().second, *flatten, printer);
+                this->tensor_resource_label(*list, resource.get().first, { vi, vj }, RESOURCE_SYMMETRIES::DDV_SYMMETRY,
+                                            resource.get().second, *flatten, printer);
                 return list;
               }
             catch(resource_failure& xe)
@@ -869,7 +977,8 @@ namespace nontrivial_metric
 
         // either resources were not available, or a resource failure occurred when raising and lowering indices
         CovariantddVCache cache{*this, printer};
-        this->tensor_resource_expr(*list, std::array<variance, 2>{ vi, vj }, expression_item_types::ddV_item, printer, cache);
+        this->tensor_resource_expr(*list, std::array<variance, 2>{ vi, vj }, RESOURCE_SYMMETRIES::DDV_SYMMETRY,
+                                   expression_item_types::ddV_item, printer, cache);
 
         return list;
       }
@@ -898,7 +1007,9 @@ namespace nontrivial_metric
           {
             try
               {
-                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vj }, resource.get().second, *flatten, printer);
+                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vk }, RESOURCE_SYMMETRIES::DDDV_SYMMETRY,
+                                            resource.get().second, *flatten, printer);
+                return list;
               }
             catch(resource_failure& xe)
               {
@@ -909,7 +1020,8 @@ namespace nontrivial_metric
 
         // either resources were not available, or a resource failure occurred when raising and lowering indices
         CovariantdddVCache cache{*this, printer};
-        this->tensor_resource_expr(*list, std::array<variance, 3>{ vi, vj, vk }, expression_item_types::dddV_item, printer, cache);
+        this->tensor_resource_expr(*list, std::array<variance, 3>{ vi, vj, vk }, RESOURCE_SYMMETRIES::DDDV_SYMMETRY,
+                                   expression_item_types::dddV_item, printer, cache);
 
         return(list);
       }
@@ -939,7 +1051,8 @@ namespace nontrivial_metric
           {
             try
               {
-                this->tensor_resource_label(*list, resource.get().first, { vi, vj }, resource.get().second, *flatten, printer);
+                this->tensor_resource_label(*list, resource.get().first, { vi, vj }, RESOURCE_SYMMETRIES::RIEMANN_A2_SYMMETRY,
+                                            resource.get().second, *flatten, printer);
                 return list;
               }
             catch(resource_failure& xe)
@@ -951,7 +1064,8 @@ namespace nontrivial_metric
 
         // either resources were not available, or a resource failure occurred when raising and lowering indices
         CovariantRiemannA2Cache cache{*this, printer};
-        this->tensor_resource_expr(*list, std::array<variance, 2>{ vi, vj }, expression_item_types::Riemann_A2_item, printer, cache);
+        this->tensor_resource_expr(*list, std::array<variance, 2>{ vi, vj }, RESOURCE_SYMMETRIES::RIEMANN_A2_SYMMETRY,
+                                   expression_item_types::Riemann_A2_item, printer, cache);
 
         return list;
       }
@@ -981,7 +1095,8 @@ namespace nontrivial_metric
           {
             try
               {
-                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vk }, resource.get().second, *flatten, printer);
+                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vk }, RESOURCE_SYMMETRIES::RIEMANN_A3_SYMMETRY,
+                                            resource.get().second, *flatten, printer);
                 return list;
               }
             catch(resource_failure& xe)
@@ -993,7 +1108,8 @@ namespace nontrivial_metric
 
         // either resources were not available, or a resource failure occurred when raising and lowering indices
         CovariantRiemannA3Cache cache{*this, printer};
-        this->tensor_resource_expr(*list, std::array<variance, 3>{ vi, vj, vk }, expression_item_types::Riemann_A3_item, printer, cache);
+        this->tensor_resource_expr(*list, std::array<variance, 3>{ vi, vj, vk }, RESOURCE_SYMMETRIES::RIEMANN_A3_SYMMETRY,
+                                   expression_item_types::Riemann_A3_item, printer, cache);
 
         return list;
       }
@@ -1023,7 +1139,8 @@ namespace nontrivial_metric
           {
             try
               {
-                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vk }, resource.get().second, *flatten, printer);
+                this->tensor_resource_label(*list, resource.get().first, { vi, vj, vk }, RESOURCE_SYMMETRIES::RIEMANN_B3_SYMMETRY,
+                                            resource.get().second, *flatten, printer);
                 return list;
               }
             catch(resource_failure& xe)
@@ -1035,7 +1152,8 @@ namespace nontrivial_metric
 
         // either resources were not available, or a resource failure occurred when raising and lowering indices
         CovariantRiemannB3Cache cache{*this, printer};
-        this->tensor_resource_expr(*list, { vi, vj, vk }, expression_item_types::Riemann_B3_item, printer, cache);
+        this->tensor_resource_expr(*list, std::array<variance, 3>{ vi, vj, vk }, RESOURCE_SYMMETRIES::RIEMANN_B3_SYMMETRY,
+                                   expression_item_types::Riemann_B3_item, printer, cache);
 
         return list;
       }
@@ -1074,6 +1192,7 @@ namespace nontrivial_metric
     void resources::tensor_resource_label(flattened_tensor& list,
                                           const std::array<variance, 2>& avail,
                                           const std::array<variance, 2> reqd,
+                                          index_symmetry sym,
                                           const contexted_value<std::string>& resource,
                                           const contexted_value<std::string>& flatten,
                                           const language_printer& printer) const
@@ -1087,7 +1206,12 @@ namespace nontrivial_metric
               {
                 unsigned int index = this->fl.flatten(i,j);
 
-                list[index] = this->position_indices<2, field_index>(avail, { i, j }, resource, *flatten, printer);
+                // components related by symmetry share the label of their canonical representative
+                auto c = canonical_order<2>(sym, { i, j });
+                unsigned int c_index = this->fl.flatten(c[0], c[1]);
+
+                list[index] = c_index != index ? list[c_index]
+                                               : this->position_indices<2, field_index>(avail, { i, j }, resource, *flatten, printer);
               }
           }
       }
@@ -1096,6 +1220,7 @@ namespace nontrivial_metric
     void resources::tensor_resource_label(flattened_tensor& list,
                                           const std::array<variance, 3>& avail,
                                           const std::array<variance, 3> reqd,
+                                          index_symmetry sym,
                                           const contexted_value<std::string>& resource,
                                           const contexted_value<std::string>& flatten,
                                           const language_printer& printer) const
@@ -1112,7 +1237,12 @@ namespace nontrivial_metric
                   {
                     unsigned int index = this->fl.flatten(i,j,k);
 
-                    list[index] = this->position_indices<3, field_index>(avail, { i, j, k }, resource, *flatten, printer);
+                    // components related by symmetry share the label of their canonical representative
+                    auto c = canonical_order<3>(sym, { i, j, k });
+                    unsigned int c_index = this->fl.flatten(c[0], c[1], c[2]);
+
+                    list[index] = c_index != index ? list[c_index]
+                                                   : this->position_indices<3, field_index>(avail, { i, j, k }, resource, *flatten, printer);
                   }
               }
           }
@@ -1157,7 +1287,7 @@ namespace nontrivial_metric
 
     template <typename CacheObject>
     void
-    resources::tensor_resource_expr(flattened_tensor& list, const std::array<variance, 2> reqd,
+    resources::tensor_resource_expr(flattened_tensor& list, const std::array<variance, 2> reqd, index_symmetry sym,
                                     expression_item_types type, const language_printer& printer, CacheObject& cache) const
       {
         const field_index max_i = this->share.get_max_field_index(reqd[0]);
@@ -1177,6 +1307,16 @@ namespace nontrivial_metric
                 GiNaC::ex expr;
                 unsigned int index = this->fl.flatten(i,j);
 
+                // components which are not canonically ordered are copies of a canonical component computed earlier
+                auto c = canonical_order<2>(sym, { i, j });
+                unsigned int c_index = this->fl.flatten(c[0], c[1]);
+
+                if(c_index != index)
+                  {
+                    list[index] = list[c_index];
+                    continue;
+                  }
+
                 if(!this->cache.query(type, index, args, expr))
                   {
                     timing_instrument timer(this->compute_timer);
@@ -1198,7 +1338,7 @@ namespace nontrivial_metric
 
     template <typename CacheObject>
     void
-    resources::tensor_resource_expr(flattened_tensor& list, const std::array<variance, 3> reqd,
+    resources::tensor_resource_expr(flattened_tensor& list, const std::array<variance, 3> reqd, index_symmetry sym,
                                     expression_item_types type, const language_printer& printer, CacheObject& cache) const
       {
         const field_index max_i = this->share.get_max_field_index(reqd[0]);
@@ -1222,6 +1362,16 @@ namespace nontrivial_metric
                     GiNaC::ex expr;
                     unsigned int index = this->fl.flatten(i,j,k);
 
+                    // components which are not canonically ordered are copies of a canonical component computed earlier
+                    auto c = canonical_order<3>(sym, { i, j, k });
+                    unsigned int c_index = this->fl.flatten(c[0], c[1], c[2]);
+
+                    if(c_index != index)
+                      {
+                        list[index] = list[c_index];
+                        continue;
+                      }
+
                     if(!this->cache.query(type, index, args, expr))
                       {
                         timing_instrument timer(this->compute_timer);
@@ -1406,6 +1556,9 @@ namespace nontrivial_metric
         // if a coordinate resource is being used, push its label onto the argument list
         if(flatten) this->push_resource_tag(args, this->mgr.coordinates());
 
+        // in numeric curvature mode, expressions involving the inverse metric depend on its resource label
+        if(this->opaque_Ginv && this->mgr.field_flatten()) this->push_resource_tag(args, this->mgr.metric_inverse());
+
         return args;
       }
 
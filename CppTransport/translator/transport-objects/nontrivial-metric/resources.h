@@ -37,6 +37,7 @@
 #include "index_flatten.h"
 
 #include "shared_resources.h"
+#include "index_symmetry.h"
 #include "curvature_classes.h"
 #include "cse.h"
 #include "language_printer.h"
@@ -60,6 +61,18 @@ namespace nontrivial_metric
     constexpr unsigned int use_Riemann_A3 = 1 << 5;
     constexpr unsigned int use_Riemann_B3 = 1 << 6;
 
+    //! permutation symmetries of the covariant resources. V;ij is symmetric because the connexion is torsion-free,
+    //! but V;ijk is symmetric only in its first pair because covariant derivatives do not commute.
+    //! The Riemann combinations are explicitly symmetrized over the indices shown
+    namespace RESOURCE_SYMMETRIES
+      {
+        constexpr auto DDV_SYMMETRY = index_symmetry::total;
+        constexpr auto DDDV_SYMMETRY = index_symmetry::first_pair;
+        constexpr auto RIEMANN_A2_SYMMETRY = index_symmetry::total;
+        constexpr auto RIEMANN_A3_SYMMETRY = index_symmetry::total;
+        constexpr auto RIEMANN_B3_SYMMETRY = index_symmetry::first_pair;
+      }
+
 
     class PotentialResourceCache;
     class SubstitutionMapCache;
@@ -322,9 +335,23 @@ namespace nontrivial_metric
         //! used internally and as the first step in generating an external argument list
         cache_tags generate_cache_arguments(const language_printer& printer) const;
 
-        //! generate substitution map for parameter and coordinate labels
+        //! generate substitution map for parameter and coordinate labels, and (in numeric curvature mode)
+        //! the labels of the inverse metric
         GiNaC::exmap make_substitution_map(const language_printer& printer) const;
 
+        //! in numeric curvature mode, check that a resource label for the inverse metric is available;
+        //! throws resource_failure if not
+        void require_metric_inverse() const;
+
+        //! check that symbolic expressions for the Riemann tensor and its covariant derivative are available;
+        //! in numeric curvature mode they are not built, and throws resource_failure
+        void require_symbolic_curvature() const;
+
+        //! differentiate a substituted expression with respect to the coordinate labelled by k in f_list.
+        //! In numeric curvature mode, dependence carried by the inverse metric labels is supplied using the chain rule
+        GiNaC::ex diff_coordinate(const GiNaC::ex& expr, const symbol_list& f_list, field_index k,
+                                  const language_printer& printer) const;
+
 
         // INTERNAL API -- RAISE AND LOWER INDICES
 
@@ -365,14 +392,16 @@ namespace nontrivial_metric
                                    const std::array<variance, 1> reqd, const contexted_value<std::string>& resource,
                                    const contexted_value<std::string>& flatten, const language_printer& printer) const;
 
-        //! generate 2-index labels
+        //! generate 2-index labels; components related by the symmetry sym share a label
         void tensor_resource_label(flattened_tensor& list, const std::array<variance, 2>& avail,
-                                   const std::array<variance, 2> reqd, const contexted_value<std::string>& resource,
+                                   const std::array<variance, 2> reqd, index_symmetry sym,
+                                   const contexted_value<std::string>& resource,
                                    const contexted_value<std::string>& flatten, const language_printer& printer) const;
 
-        //! generate 3-index labels
+        //! generate 3-index labels; components related by the symmetry sym share a label
         void tensor_resource_label(flattened_tensor& list, const std::array<variance, 3>& avail,
-                                   const std::array<variance, 3> reqd, const contexted_value<std::string>& resource,
+                                   const std::array<variance, 3> reqd, index_symmetry sym,
+                                   const contexted_value<std::string>& resource,
                                    const contexted_value<std::string>& flatten, const language_printer& printer) const;
 
         //! generate 2-index labels, no index repositioning
@@ -395,14 +424,14 @@ namespace nontrivial_metric
         void tensor_resource_expr(flattened_tensor& list, const std::array<variance, 1> reqd,
                                   expression_item_types type, const language_printer& printer, CacheObject& cache) const;
 
-        //! generate 2-index
+        //! generate 2-index; only components which are canonical under the symmetry sym are computed
         template <typename CacheObject>
-        void tensor_resource_expr(flattened_tensor& list, const std::array<variance, 2> reqd,
+        void tensor_resource_expr(flattened_tensor& list, const std::array<variance, 2> reqd, index_symmetry sym,
                                   expression_item_types type, const language_printer& printer, CacheObject& cache) const;
 
-        //! generate 3-index
+        //! generate 3-index; only components which are canonical under the symmetry sym are computed
         template <typename CacheObject>
-        void tensor_resource_expr(flattened_tensor& list, const std::array<variance, 3> reqd,
+        void tensor_resource_expr(flattened_tensor& list, const std::array<variance, 3> reqd, index_symmetry sym,
                                   expression_item_types type, const language_printer& printer, CacheObject& cache) const;
 
         
@@ -448,16 +477,19 @@ namespace nontrivial_metric
         //! field metric
         std::unique_ptr<GiNaC::matrix> G;
 
-        //! inverse field metric
+        //! inverse field metric; in numeric curvature mode its components are opaque symbols
         std::unique_ptr<GiNaC::matrix> Ginv;
 
+        //! is the inverse metric opaque, ie. computed numerically at runtime?
+        bool opaque_Ginv;
+
         //! Christoffel symbols
         std::unique_ptr<Christoffel> Crstfl;
 
-        //! Riemann tensor components
+        //! Riemann tensor components; not built in numeric curvature mode
         std::unique_ptr<Riemann_T> Rie_T;
         
-        //! covariant derivative of Riemann tensor
+        //! covariant derivative of Riemann tensor; not built in numeric curvature mode
         std::unique_ptr<DRiemann_T> DRie_T;
 
         // AGENTS
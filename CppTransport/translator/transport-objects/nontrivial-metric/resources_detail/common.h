@@ -37,12 +37,16 @@ namespace nontrivial_metric
         const auto J_INDEX_NAME = "j";
         const auto K_INDEX_NAME = "k";
 
+        //! stem for symbols standing in for components of the inverse metric in numeric curvature mode
+        const auto GINV_PLACEHOLDER_NAME = "__Ginv_opaque_";
+
       }   // namespace resource_impl
 
 
     using resource_impl::I_INDEX_NAME;
     using resource_impl::J_INDEX_NAME;
     using resource_impl::K_INDEX_NAME;
+    using resource_impl::GINV_PLACEHOLDER_NAME;
   
   }   // namespace nontrivial_metric
 
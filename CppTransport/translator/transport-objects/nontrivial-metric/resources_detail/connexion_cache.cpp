@@ -35,6 +35,9 @@ namespace nontrivial_metric
         
         this->Gamma = std::make_unique<flattened_tensor>(res.fl.get_flattened_size<field_index>(RESOURCE_INDICES::CONNEXION_INDICES));
         
+        // in numeric curvature mode, these expressions can be built only if the inverse metric is available as a resource
+        res.require_metric_inverse();
+
         auto args = res.generate_cache_arguments(printer);
         // no need to tag with indices, since only one index arrangement is possible
         
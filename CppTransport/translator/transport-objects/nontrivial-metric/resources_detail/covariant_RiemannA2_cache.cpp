@@ -35,6 +35,10 @@ namespace nontrivial_metric
       {
         if(this->A2) return *this->A2;
         
+        // in numeric curvature mode, the Riemann tensor is not available symbolically and these expressions must be
+        // supplied as resources computed at runtime
+        res.require_symbolic_curvature();
+
         auto args = res.generate_cache_arguments(printer);
         
         this->A2 = std::make_unique<flattened_tensor>(res.fl.get_flattened_size<field_index>(RESOURCE_INDICES::RIEMANN_A2_INDICES));
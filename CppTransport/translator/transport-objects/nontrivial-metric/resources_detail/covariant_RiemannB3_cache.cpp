@@ -35,6 +35,10 @@ namespace nontrivial_metric
       {
         if(this->B3) return *this->B3;
     
+        // in numeric curvature mode, the Riemann tensor is not available symbolically and these expressions must be
+        // supplied as resources computed at runtime
+        res.require_symbolic_curvature();
+
         auto args = res.generate_cache_arguments(printer);
     
         this->B3 = std::make_unique<flattened_tensor>(res.fl.get_flattened_size<field_index>(RESOURCE_INDICES::RIEMANN_B3_INDICES));
@@ -52,6 +56,16 @@ namespace nontrivial_metric
                 for(field_index k = field_index(0, variance::covariant); k < max; ++k)
                   {
                     unsigned int index = res.fl.flatten(i,j,k);
+
+                    // the combination is symmetrized over (i,j), so components with j < i are copies of (j,i,k)
+                    auto c = canonical_order<3>(RESOURCE_SYMMETRIES::RIEMANN_B3_SYMMETRY, { i, j, k });
+                    unsigned int c_index = res.fl.flatten(c[0], c[1], c[2]);
+
+                    if(c_index != index)
+                      {
+                        (*this->B3)[index] = (*this->B3)[c_index];
+                        continue;
+                      }
     
                     GiNaC::ex subs_expr = 0;
     
@@ -62,6 +62,16 @@ namespace nontrivial_metric
                   {
                     GiNaC::ex dddV;
                     unsigned int index = res.fl.flatten(i,j,k);
+
+                    // V;ij is symmetric, so components with j < i are copies of the (j,i,k) component
+                    auto c = canonical_order<3>(RESOURCE_SYMMETRIES::DDDV_SYMMETRY, { i, j, k });
+                    unsigned int c_index = res.fl.flatten(c[0], c[1], c[2]);
+
+                    if(c_index != index)
+                      {
+                        (*this->dddV)[index] = (*this->dddV)[c_index];
+                        continue;
+                      }
                     
                     if(!res.cache.query(expression_item_types::dddV_item, index, args, dddV))
                       {
@@ -71,8 +81,9 @@ namespace nontrivial_metric
                         auto& ddV = ddV_cache.get();
                         
                         // partial derivative term is partial_k (V;ij)
-                        const symbol_wrapper& x3 = f_list[res.fl.flatten(k)];
-                        dddV = GiNaC::diff(ddV[res.fl.flatten(i,j)], x3);
+                        // (in numeric curvature mode ddV may involve the inverse metric, whose coordinate dependence
+                        // is handled by diff_coordinate())
+                        dddV = res.diff_coordinate(ddV[res.fl.flatten(i,j)], f_list, k, printer);
                         
                         // include connexion terms, which are -Gamma^l_ik V;lj - Gamma^l_jk V;ik
                         auto& Gamma = Gamma_cache.get();
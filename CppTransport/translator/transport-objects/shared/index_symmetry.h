@@ -0,0 +1,73 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+
+#ifndef CPPTRANSPORT_INDEX_SYMMETRY_H
+#define CPPTRANSPORT_INDEX_SYMMETRY_H
+
+
+#include <array>
+#include <utility>
+
+#include "indices.h"
+
+
+//! permutation symmetries of the field-space indices of a tensor
+enum class index_symmetry
+  {
+    none,           // components are unrelated
+    first_pair,     // symmetric under exchange of the first two indices
+    total           // symmetric under any permutation of the indices
+  };
+
+
+//! map an index assignment to the canonical representative of its orbit under a symmetry,
+//! so that only canonical components need be computed and the rest can be copied from them.
+//! The canonical representative has symmetric indices in ascending order, and is therefore reached
+//! no later than any other member of its orbit by loops which run i, j, k, ... in ascending order.
+//! Indices of different variance are never exchanged, because raising or lowering one of them
+//! breaks the symmetry between them
+template <size_t Indices>
+std::array<field_index, Indices> canonical_order(index_symmetry sym, std::array<field_index, Indices> idx)
+  {
+    if(sym == index_symmetry::none) return idx;
+
+    // number of leading indices which participate in the symmetry
+    const size_t span = (sym == index_symmetry::first_pair && Indices > 2) ? 2 : Indices;
+
+    for(size_t a = 0; a < span; ++a)
+      {
+        for(size_t b = a+1; b < span; ++b)
+          {
+            if(idx[a].get_variance() == idx[b].get_variance() && idx[b].get() < idx[a].get()) std::swap(idx[a], idx[b]);
+          }
+      }
+
+    return idx;
+  }
+
+
+#endif //CPPTRANSPORT_INDEX_SYMMETRY_H
@@ -91,10 +91,17 @@ argument_cache::argument_cache(int argc, const char** argv, local_environment& e
   : verbose_flag(false),
     colour_flag(true),
     cse_flag(true),
+    sparsity_flag(true),
     no_search_environment(false),
     annotate_flag(false),
     unroll_policy_size(DEFAULT_UNROLL_MAX),
     fast_flag(false),
+    numeric_curvature_flag(false),
+    autodiff_flag(false),
+    autodiff_check_flag(false),
+    dual_unroll_flag(false),
+    split_flag(false),
+    plugin_flag(false),
     profile_flag(false),
     develop_warnings(false),
     unroll_warnings(false),
@@ -121,9 +128,17 @@ argument_cache::argument_cache(int argc, const char** argv, local_environment& e
     boost::program_options::options_description generation(GENERATION_OPTIONS);
     generation.add_options()
       (NO_CSE_SWITCH,                                                                                            NO_CSE_HELP)
+      (NO_SPARSITY_SWITCH,                                                                                       NO_SPARSITY_HELP)
       (ANNOTATE_SWITCH,                                                                                          ANNOTATE_HELP)
       (UNROLL_POLICY_SWITCH, boost::program_options::value< unsigned int >()->default_value(DEFAULT_UNROLL_MAX), UNROLL_POLICY_HELP)
       (FAST_SWITCH,                                                                                              FAST_HELP)
+      (NUMERIC_CURVATURE_SWITCH,                                                                                 NUMERIC_CURVATURE_HELP)
+      (AUTODIFF_SWITCH,                                                                                          AUTODIFF_HELP)
+      (AUTODIFF_CHECK_SWITCH,                                                                                    AUTODIFF_CHECK_HELP)
+      (DUAL_UNROLL_SWITCH,                                                                                       DUAL_UNROLL_HELP)
+      (SPLIT_SWITCH,                                                                                             SPLIT_HELP)
+      (PLUGIN_SWITCH,                                                                                            PLUGIN_HELP)
+      (SPECIALIZE_SWITCH,    boost::program_options::value< std::string >()->default_value(""),                  SPECIALIZE_HELP)
       ;
 
     boost::program_options::options_description warnings(WARNING_OPTIONS);
@@ -267,9 +282,48 @@ argument_cache::argument_cache(int argc, const char** argv, local_environment& e
 
     // CODE GENERATION OPTIONS
     if(option_map.count(NO_CSE_SWITCH)) this->cse_flag = false;
+    if(option_map.count(NO_SPARSITY_SWITCH)) this->sparsity_flag = false;
     if(option_map.count(ANNOTATE_SWITCH)) this->annotate_flag = true;
     if(option_map.count(UNROLL_POLICY_SWITCH)) this->unroll_policy_size = option_map[UNROLL_POLICY_SWITCH].as<unsigned int>();
     if(option_map.count(FAST_SWITCH)) this->fast_flag = true;
+    if(option_map.count(NUMERIC_CURVATURE_SWITCH)) this->numeric_curvature_flag = true;
+
+    // numeric curvature relies on runtime resources, which are not used in fast mode
+    if(this->fast_flag && this->numeric_curvature_flag)
+      {
+        this->err_msgs.push_back(std::make_pair(false, NOTIFY_NUMERIC_CURVATURE_NOT_FAST));
+        this->fast_flag = false;
+      }
+
+    // the cross-check implies automatic differentiation
+    if(option_map.count(AUTODIFF_SWITCH)) this->autodiff_flag = true;
+    if(option_map.count(AUTODIFF_CHECK_SWITCH)) this->autodiff_flag = this->autodiff_check_flag = true;
+
+    // automatic differentiation replaces the runtime derivative resources, which are not used in fast mode
+    if(this->fast_flag && this->autodiff_flag)
+      {
+        this->err_msgs.push_back(std::make_pair(false, NOTIFY_AUTODIFF_NOT_FAST));
+        this->fast_flag = false;
+      }
+
+    // the rolled kernel variant needs the runtime workspace, which is not allocated in fast mode
+    if(option_map.count(DUAL_UNROLL_SWITCH)) this->dual_unroll_flag = true;
+    if(this->fast_flag && this->dual_unroll_flag)
+      {
+        this->err_msgs.push_back(std::make_pair(false, NOTIFY_DUAL_UNROLL_NOT_FAST));
+        this->fast_flag = false;
+      }
+
+    if(option_map.count(SPLIT_SWITCH)) this->split_flag = true;
+    if(option_map.count(PLUGIN_SWITCH)) this->plugin_flag = true;
+
+    // a plugin must be a single self-contained module; split units are built into the driver, not the plugin
+    if(this->split_flag && this->plugin_flag)
+      {
+        this->err_msgs.push_back(std::make_pair(true, ERROR_SPLIT_WITH_PLUGIN));
+        this->plugin_flag = false;
+      }
+    if(option_map.count(SPECIALIZE_SWITCH) > 0) this->specialize_file = option_map[SPECIALIZE_SWITCH].as<std::string>();
 
     // CONFIGURATION OPTIONS
     if(option_map.count(VERBOSE_SWITCH_LONG)) this->verbose_flag = true;
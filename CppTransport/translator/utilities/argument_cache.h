@@ -92,6 +92,9 @@ class argument_cache
     //! get common-subexpression elimination setting
     bool do_cse() const { return(this->cse_flag); }
 
+    //! get sparsity setting
+    bool do_sparsity() const { return(this->sparsity_flag); }
+
     //! get code annotation setting
     bool annotate() const { return(this->annotate_flag); }
 
@@ -100,6 +103,27 @@ class argument_cache
 
     bool fast() const { return(this->fast_flag); }
 
+    //! get numeric curvature setting
+    bool numeric_curvature() const { return(this->numeric_curvature_flag); }
+
+    //! get automatic differentiation setting
+    bool autodiff() const { return(this->autodiff_flag); }
+
+    //! get automatic differentiation cross-check setting
+    bool autodiff_check() const { return(this->autodiff_check_flag); }
+
+    //! get dual-variant kernel setting
+    bool dual_unroll() const { return(this->dual_unroll_flag); }
+
+    //! get split translation unit setting
+    bool split() const { return(this->split_flag); }
+
+    //! get model plugin setting
+    bool plugin() const { return(this->plugin_flag); }
+
+    //! get file of parameter values for a specialized variant; empty if none was requested
+    const std::string& specialization_file() const { return(this->specialize_file); }
+
 
     // WARNINGS
 
@@ -172,12 +196,36 @@ class argument_cache
     //! CSE flag
     bool cse_flag;
 
+    //! sparsity flag
+    bool sparsity_flag;
+
     //! unroll policy - maximum size of index set above which unrolling is disabled
     unsigned int unroll_policy_size;
 
     //! fast setting
     bool fast_flag;
 
+    //! numeric curvature setting
+    bool numeric_curvature_flag;
+
+    //! automatic differentiation setting
+    bool autodiff_flag;
+
+    //! automatic differentiation cross-check setting
+    bool autodiff_check_flag;
+
+    //! dual-variant kernel setting
+    bool dual_unroll_flag;
+
+    //! split translation unit setting
+    bool split_flag;
+
+    //! model plugin setting
+    bool plugin_flag;
+
+    //! file of parameter values for a specialized variant
+    std::string specialize_file;
+
 
     // WARNINGS
 
@@ -236,7 +236,7 @@ namespace transport
     
     
     // overload << to push log_severity_level to stream
-    std::ostream& operator<<(std::ostream& stream, generic_batcher::log_severity_level level)
+    inline std::ostream& operator<<(std::ostream& stream, generic_batcher::log_severity_level level)
       {
         static const std::map< generic_batcher::log_severity_level, std::string > stringize_map =
           {
@@ -255,8 +255,8 @@ namespace transport
     
     // overload << to push log_severity_level to Boost.Log log
     struct generic_batcher_severity_tag;
-    boost::log::formatting_ostream& operator<<(boost::log::formatting_ostream& stream,
-                                               const boost::log::to_log_manip<generic_batcher::log_severity_level, generic_batcher_severity_tag> manip)
+    inline boost::log::formatting_ostream& operator<<(boost::log::formatting_ostream& stream,
+                                                      const boost::log::to_log_manip<generic_batcher::log_severity_level, generic_batcher_severity_tag> manip)
       {
         static const std::map< generic_batcher::log_severity_level, std::string > stringize_map =
           {
@@ -376,7 +376,7 @@ namespace transport
 	    }
 
 
-    generic_batcher::~generic_batcher()
+    inline generic_batcher::~generic_batcher()
 	    {
         if(this->log_sink)    // implicitly converts to bool, value true if not null
 	        {
@@ -386,13 +386,13 @@ namespace transport
 	    }
 
 
-    void generic_batcher::close()
+    inline void generic_batcher::close()
 	    {
         this->flush(replacement_action::action_close);
 	    }
 
 
-    void generic_batcher::check_for_flush()
+    inline void generic_batcher::check_for_flush()
 	    {
         if(this->storage() > this->capacity)
 	        {
@@ -410,7 +410,7 @@ namespace transport
 	    }
 
 
-    void generic_batcher::flush(replacement_action action)
+    inline void generic_batcher::flush(replacement_action action)
       {
         // reset checkpoint timer
         this->checkpoint_timer.stop();
@@ -30,6 +30,8 @@
 
 #include <vector>
 #include <set>
+#include <map>
+#include <list>
 #include <functional>
 
 #include "transport-runtime/enumerations.h"
@@ -93,6 +95,12 @@ namespace transport
 
 		    //! Host information writer function
 		    typedef std::function<void(transaction_manager&, integration_batcher<number>*)> host_info_writer;
+
+        //! Checkpoint writer function for in-flight k-configurations
+        typedef std::function<void(transaction_manager&, integration_batcher<number>*, const typename integration_items<number>::checkpoint_item&)> checkpoint_writer;
+
+        //! Checkpoint removal function, used once a k-configuration has completed or failed
+        typedef std::function<void(transaction_manager&, integration_batcher<number>*, unsigned int)> checkpoint_drop;
 			};
 
 
@@ -140,6 +148,9 @@ namespace transport
         //! Return stepper tolerance - perturbations evolution
         std::pair< double, double > get_pert_tol() const { return(this->mdl->get_pert_tol()); }
 
+        //! Return integration kernel variants
+        std::string get_kernel_variant() const { return(this->mdl->get_kernel_variant()); }
+
         //! Close this batcher -- called at the end of an integration
         virtual void close() override;
 
@@ -149,7 +160,8 @@ namespace transport
       public:
 
         //! Add integration details, plus report a k-configuration serial number and mesh refinement level for storing per-configuration statistics
-        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement);
+        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement,
+                                                const hot_path::profile_summary& profile = hot_path::profile_summary());
 
         //! Report a failed integration for a specific serial number
         virtual void report_integration_failure(unsigned int kserial);
@@ -178,6 +190,45 @@ namespace transport
         void end_assignment();
 
 
+        // CHECKPOINTING OF IN-FLIGHT CONFIGURATIONS
+
+      public:
+
+        //! Query whether in-flight configurations are being checkpointed
+        bool is_checkpointing() const { return(this->checkpoint_interval > 0); }
+
+        //! Query whether a checkpoint of the in-flight configuration is due;
+        //! uses the same interval as checkpointing of complete configurations, measured from the last checkpoint
+        bool is_checkpoint_due() const { return(this->checkpoint_interval > 0 && this->inflight_timer.elapsed().wall > this->checkpoint_interval); }
+
+        //! Write a checkpoint for an in-flight configuration into the current container
+        void write_checkpoint(const typename integration_items<number>::checkpoint_item& item);
+
+      protected:
+
+        //! Discard any checkpoint held for a configuration; called once the configuration has completed, failed,
+        //! or is about to be retried
+        void discard_checkpoint(unsigned int kserial);
+
+        //! Write checkpoint rows into the current container -- implemented by concrete batchers, which own the writers
+        virtual void write_checkpoint_rows(const typename integration_items<number>::checkpoint_item& item) = 0;
+
+        //! Remove checkpoint rows from the current container
+        virtual void drop_checkpoint_rows(unsigned int kserial) = 0;
+
+
+        // RESUMPTION OF INTERRUPTED CONFIGURATIONS
+
+      public:
+
+        //! Set checkpoints for configurations which were in flight when an earlier integration was interrupted;
+        //! each is used to resume its configuration if that is assigned to this worker
+        void set_resume_checkpoints(std::list< typename integration_items<number>::checkpoint_item > checkpoints);
+
+        //! Look up a checkpoint from which to resume a configuration; returns nullptr if there is none
+        const typename integration_items<number>::checkpoint_item* find_resume_checkpoint(unsigned int kserial) const;
+
+
 		    // PER-CONFIGURATION STATISTICS AND AUXILIARY INFORMATION
 
       public:
@@ -272,6 +323,18 @@ namespace transport
         unsigned int refinements;
 
 
+        // CHECKPOINTS
+
+        //! serial numbers of in-flight configurations which have a checkpoint in the current container
+        std::set< unsigned int > checkpointed_serials;
+
+        //! time since last checkpoint of an in-flight configuration, or since the last configuration finished
+        boost::timer::cpu_timer inflight_timer;
+
+        //! checkpoints left by an earlier, interrupted integration, indexed by serial number
+        std::map< unsigned int, typename integration_items<number>::checkpoint_item > resume_checkpoints;
+
+
         // INTEGRATION STATISTICS
 
         //! Are we collecting per-configuration statistics?
@@ -320,6 +383,8 @@ namespace transport
             typename integration_writers<number>::stats_writer        stats;
             typename integration_writers<number>::ics_writer          ics;
             typename integration_writers<number>::host_info_writer    host_info;
+            typename integration_writers<number>::checkpoint_writer   checkpoint;
+            typename integration_writers<number>::checkpoint_drop     drop_checkpoint;
 	        };
 
 
@@ -371,7 +436,8 @@ namespace transport
       public:
 
         //! Add integration details, plus report a k-configuration serial number and mesh refinement level for storing per-configuration statistics
-        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement) override;
+        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement,
+                                                const hot_path::profile_summary& profile = hot_path::profile_summary()) override;
 
         //! Report a failed integration for a specific serial number
         virtual void report_integration_failure(unsigned int kserial) override;
@@ -401,6 +467,12 @@ namespace transport
 
         virtual void flush(replacement_action action) override;
 
+        //! write checkpoint rows using our writer group
+        virtual void write_checkpoint_rows(const typename integration_items<number>::checkpoint_item& item) override;
+
+        //! remove checkpoint rows using our writer group
+        virtual void drop_checkpoint_rows(unsigned int kserial) override;
+
 
         // INTERNAL DATA
 
@@ -462,6 +534,8 @@ namespace transport
             typename integration_writers<number>::ics_writer              ics;
             typename integration_writers<number>::ics_kt_writer           kt_ics;
             typename integration_writers<number>::host_info_writer        host_info;
+            typename integration_writers<number>::checkpoint_writer       checkpoint;
+            typename integration_writers<number>::checkpoint_drop         drop_checkpoint;
 	        };
 
 
@@ -489,7 +563,8 @@ namespace transport
       public:
 
         //! Add integration details, plus report a k-configuration serial number and mesh refinement level for storing per-configuration statistics
-        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement) override;
+        virtual void report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching, unsigned int kserial, size_t steps, unsigned int refinement,
+                                                const hot_path::profile_summary& profile = hot_path::profile_summary()) override;
 
         //! Report a failed integration for a specific serial number
         virtual void report_integration_failure(unsigned int kserial) override;
@@ -558,6 +633,12 @@ namespace transport
 
         virtual void flush(replacement_action action) override;
 
+        //! write checkpoint rows using our writer group
+        virtual void write_checkpoint_rows(const typename integration_items<number>::checkpoint_item& item) override;
+
+        //! remove checkpoint rows using our writer group
+        virtual void drop_checkpoint_rows(unsigned int kserial) override;
+
 
         // INTERNAL DATA
 
@@ -651,8 +732,13 @@ namespace transport
 
     template <typename number>
     void integration_batcher<number>::report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching,
-                                                                 unsigned int kserial, size_t steps, unsigned int refinements)
+                                                                 unsigned int kserial, size_t steps, unsigned int refinements,
+                                                                 const hot_path::profile_summary& profile)
 	    {
+        // the configuration is complete, so its checkpoint is no longer needed; it must be removed
+        // before any flush, so that the container is dispatched without it
+        this->discard_checkpoint(kserial);
+
         this->integration_time += integration;
         this->batching_time += batching;
     
@@ -680,7 +766,7 @@ namespace transport
 
 		    if(this->collect_statistics)
 			    {
-		        this->stats_batch.emplace_back(std::make_unique<typename integration_items<number>::configuration_statistics>(kserial, integration, batching, refinements, steps));
+		        this->stats_batch.emplace_back(std::make_unique<typename integration_items<number>::configuration_statistics>(kserial, integration, batching, refinements, steps, profile));
 			    }
 
         if(this->flush_due)
@@ -711,6 +797,8 @@ namespace transport
     template <typename number>
     void integration_batcher<number>::report_integration_failure(unsigned int kserial)
       {
+        this->discard_checkpoint(kserial);
+
         this->failed_serials.insert(kserial);
         this->failures++;
         this->check_for_flush();
@@ -730,6 +818,67 @@ namespace transport
       }
 
 
+    template <typename number>
+    void integration_batcher<number>::write_checkpoint(const typename integration_items<number>::checkpoint_item& item)
+      {
+        if(!item.samples.empty())
+          {
+            boost::timer::cpu_timer checkpoint_timer;
+            this->write_checkpoint_rows(item);
+            this->checkpointed_serials.insert(item.serial);
+            checkpoint_timer.stop();
+
+            BOOST_LOG_SEV(this->log_source, generic_batcher::log_severity_level::normal)
+              << "** Checkpointed in-flight configuration " << item.serial << " at sample " << item.samples.back().position
+              << " (" << item.samples.size() << " samples) in time " << format_time(checkpoint_timer.elapsed().wall);
+          }
+
+        this->inflight_timer.start();
+      }
+
+
+    template <typename number>
+    void integration_batcher<number>::discard_checkpoint(unsigned int kserial)
+      {
+        std::set< unsigned int >::iterator t = this->checkpointed_serials.find(kserial);
+        if(t != this->checkpointed_serials.end())
+          {
+            this->drop_checkpoint_rows(kserial);
+            this->checkpointed_serials.erase(t);
+          }
+
+        this->inflight_timer.start();
+      }
+
+
+    template <typename number>
+    void integration_batcher<number>::set_resume_checkpoints(std::list< typename integration_items<number>::checkpoint_item > checkpoints)
+      {
+        this->resume_checkpoints.clear();
+
+        for(typename integration_items<number>::checkpoint_item& item : checkpoints)
+          {
+            unsigned int serial = item.serial;
+            this->resume_checkpoints.emplace(serial, std::move(item));
+          }
+
+        if(!this->resume_checkpoints.empty())
+          {
+            BOOST_LOG_SEV(this->log_source, generic_batcher::log_severity_level::normal)
+              << "** Holding checkpoints for " << this->resume_checkpoints.size() << " interrupted configurations";
+          }
+      }
+
+
+    template <typename number>
+    const typename integration_items<number>::checkpoint_item* integration_batcher<number>::find_resume_checkpoint(unsigned int kserial) const
+      {
+        auto t = this->resume_checkpoints.find(kserial);
+        if(t == this->resume_checkpoints.end()) return nullptr;
+        return &t->second;
+      }
+
+
     template <typename number>
     void integration_batcher<number>::report_refinement()
 	    {
@@ -933,15 +1082,37 @@ namespace transport
                                              UnbatchPredicate<typename integration_items<number>::ics_item>(source_serial)),
                               this->ics_batch.end());
 
+        // any checkpoint belongs to the integration being unwound, so it is no longer valid
+        this->discard_checkpoint(source_serial);
+
         if(this->paired_batcher != nullptr) this->paired_batcher->unbatch(source_serial);
 	    }
 
 
+    template <typename number>
+    void twopf_batcher<number>::write_checkpoint_rows(const typename integration_items<number>::checkpoint_item& item)
+      {
+        transaction_manager mgr = this->writers.factory(this);
+        this->writers.checkpoint(mgr, this, item);
+        mgr.commit();
+      }
+
+
+    template <typename number>
+    void twopf_batcher<number>::drop_checkpoint_rows(unsigned int kserial)
+      {
+        transaction_manager mgr = this->writers.factory(this);
+        this->writers.drop_checkpoint(mgr, this, kserial);
+        mgr.commit();
+      }
+
+
     template <typename number>
     void twopf_batcher<number>::report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching,
-                                                           unsigned int kserial, size_t steps, unsigned int refinement)
+                                                           unsigned int kserial, size_t steps, unsigned int refinement,
+                                                           const hot_path::profile_summary& profile)
       {
-        this->integration_batcher<number>::report_integration_success(integration, batching, kserial, steps, refinement);
+        this->integration_batcher<number>::report_integration_success(integration, batching, kserial, steps, refinement, profile);
         if(this->paired_batcher != nullptr) this->paired_batcher->report_finished_item(integration);
       }
 
@@ -1236,15 +1407,37 @@ namespace transport
                            source_serial)),
           this->kt_ics_batch.end());
 
+        // any checkpoint belongs to the integration being unwound, so it is no longer valid
+        this->discard_checkpoint(source_serial);
+
         if(this->paired_batcher != nullptr) this->paired_batcher->unbatch(source_serial);
       }
 
 
+    template <typename number>
+    void threepf_batcher<number>::write_checkpoint_rows(const typename integration_items<number>::checkpoint_item& item)
+      {
+        transaction_manager mgr = this->writers.factory(this);
+        this->writers.checkpoint(mgr, this, item);
+        mgr.commit();
+      }
+
+
+    template <typename number>
+    void threepf_batcher<number>::drop_checkpoint_rows(unsigned int kserial)
+      {
+        transaction_manager mgr = this->writers.factory(this);
+        this->writers.drop_checkpoint(mgr, this, kserial);
+        mgr.commit();
+      }
+
+
     template <typename number>
     void threepf_batcher<number>::report_integration_success(boost::timer::nanosecond_type integration, boost::timer::nanosecond_type batching,
-                                                             unsigned int kserial, size_t steps, unsigned int refinement)
+                                                             unsigned int kserial, size_t steps, unsigned int refinement,
+                                                             const hot_path::profile_summary& profile)
       {
-        this->integration_batcher<number>::report_integration_success(integration, batching, kserial, steps, refinement);
+        this->integration_batcher<number>::report_integration_success(integration, batching, kserial, steps, refinement, profile);
         if(this->paired_batcher != nullptr) this->paired_batcher->report_finished_item(integration);
       }
 
@@ -28,6 +28,9 @@
 #define CPPTRANSPORT_INTEGRATION_ITEMS_H
 
 
+#include "transport-runtime/utilities/hot_path_instrument.h"
+
+
 namespace transport
 	{
 
@@ -276,12 +279,14 @@ namespace transport
         class configuration_statistics
 	        {
           public:
-            configuration_statistics(unsigned int s, boost::timer::nanosecond_type i, boost::timer::nanosecond_type b, unsigned int r, size_t st)
+            configuration_statistics(unsigned int s, boost::timer::nanosecond_type i, boost::timer::nanosecond_type b, unsigned int r, size_t st,
+                                     const hot_path::profile_summary& p = hot_path::profile_summary())
               : serial(s),
                 integration(i),
                 batching(b),
                 refinements(r),
-                steps(st)
+                steps(st),
+                profile(p)
               {
               }
 
@@ -299,6 +304,9 @@ namespace transport
 
             //! number of steps taken by the stepper
             size_t steps;
+
+            //! hot-path instrumentation summary; not available unless the integration was instrumented
+            hot_path::profile_summary profile;
 	        };
 
 
@@ -369,6 +377,55 @@ namespace transport
             std::vector<number> coords;
 	        };
 
+
+        //! Stores a single observed sample from an in-flight integration.
+        //! The full integrator state is kept, so that the observer can be replayed when the integration is resumed
+        class checkpoint_sample
+          {
+          public:
+            checkpoint_sample(unsigned int p, double t, std::vector<number> x)
+              : position(p),
+                time(t),
+                state(std::move(x))
+              {
+              }
+
+            //! position of this sample in the time configuration database, counting both stored and unstored steps
+            unsigned int position;
+
+            //! integration time of this sample, measured from the initial time used by the integrator
+            double time;
+
+            //! integrator state
+            std::vector<number> state;
+          };
+
+
+        //! Stores a checkpoint for an in-flight k-configuration.
+        //! The complete observed history is carried, so each checkpoint supersedes the previous one
+        class checkpoint_item
+          {
+          public:
+            checkpoint_item(unsigned int s, unsigned int r, double st)
+              : serial(s),
+                refinement(r),
+                step(st)
+              {
+              }
+
+            //! kconfig serial number for the integration being checkpointed
+            unsigned int serial;
+
+            //! mesh refinement level in use
+            unsigned int refinement;
+
+            //! initial step size to use when the stepper is restarted
+            double step;
+
+            //! samples observed so far, in order
+            std::vector<checkpoint_sample> samples;
+          };
+
 	    };
 
 	}   // namespace transport
@@ -37,6 +37,8 @@
 
 #include "transport-runtime/derived-products/derived-content/correlation-functions/compute-gadgets/common.h"
 
+#include "transport-runtime/utilities/tensor_contraction.h"
+
 
 namespace transport
   {
@@ -130,6 +132,20 @@ namespace transport
         //! C-tensor cache (need two, because need two different index arrangements)
         std::vector<number> C_prq;
 
+        //! contraction engine; each call processes a single time sample
+        contraction::contraction_engine<number> engine;
+
+        //! threepf with its trailing index contracted against the gauge transformation
+        contraction::component_block<number> B_dN;
+
+        //! twopfs with their trailing index contracted against the gauge transformation
+        contraction::component_block<number> k1_re_dN;
+        contraction::component_block<number> k1_im_dN;
+        contraction::component_block<number> k2_re_dN;
+        contraction::component_block<number> k2_im_dN;
+        contraction::component_block<number> k3_re_dN;
+        contraction::component_block<number> k3_im_dN;
+
       };
 
 
@@ -155,15 +171,12 @@ namespace transport
 
         if(!precomputed) this->mdl->compute_gauge_xfm_1(this->parent_task, bg, gauge_xfm);
 
+        const unsigned int N = 2*this->Nfields;
+
         // compute twopf
-        for(unsigned int m = 0; m < 2*this->Nfields; ++m)
-          {
-            for(unsigned int n = 0; n < 2*this->Nfields; ++n)
-              {
-                number component = gauge_xfm[m]*gauge_xfm[n] * twopf[this->mdl->flatten(m, n)];
-                zeta_twopf += component;
-              }
-          }
+        contraction::component_view<number> sigma(twopf.data(), N*N, 1, 1);
+        contraction::component_view<number> dN(gauge_xfm.data(), N, 1, 1);
+        this->engine.contract_bilinear(sigma, dN, dN, 1.0, &zeta_twopf);
 			}
 
 
@@ -198,60 +211,46 @@ namespace transport
         this->mdl->compute_gauge_xfm_2(this->parent_task, bg, k2, k1, k3, t, gauge_xfm2_213);
         this->mdl->compute_gauge_xfm_2(this->parent_task, bg, k3, k1, k2, t, gauge_xfm2_312);
 
+        const unsigned int N = 2*this->Nfields;
+
+        // each tensor is stored component-major for a single time sample, so it can be used directly
+        // as a one-column block
+        auto view = [](const std::vector<number>& v, unsigned int rows) -> contraction::component_view<number>
+          { return contraction::component_view<number>(v.data(), rows, 1, 1); };
+
+        const contraction::component_view<number> dN = view(gauge_xfm1, N);
+
         // compute linear part of gauge transformation
-        for(unsigned int l = 0; l < 2*this->Nfields; ++l)
-          {
-            for(unsigned int m = 0; m < 2*this->Nfields; ++m)
-              {
-                for(unsigned int n = 0; n < 2*this->Nfields; ++n)
-                  {
-                    // no need to shift 3pf; the input is assumed already to have been shifted
-                    zeta_threepf += gauge_xfm1[l]*gauge_xfm1[m]*gauge_xfm1[n] * threepf[this->mdl->flatten(l,m,n)];
-                  }
-              }
-          }
+        // no need to shift 3pf; the input is assumed already to have been shifted
+        this->engine.contract_trailing(view(threepf, N*N*N), dN, this->B_dN);
+        this->engine.contract_bilinear(this->B_dN, dN, dN, 1.0, &zeta_threepf);
 
         // quadratic part of gauge transformation
-        for(unsigned int l = 0; l < 2*this->Nfields; ++l)
-          {
-            for(unsigned int m = 0; m < 2*this->Nfields; ++m)
-              {
-                for(unsigned int p = 0; p < 2*this->Nfields; ++p)
-                  {
-                    for(unsigned int q = 0; q < 2*this->Nfields; ++q)
-                      {
-                        // as of 14 Jan 2016 the database stores dimensionless quantities k^3 * 2pf and (k1 k2 k3)^2 * 3pf
-                        // to accommodate this we need factors k1k2, k1k3, k2k3 to convert from k^3 * 2pf objects to appropriately
-                        // normalized 3pf shapes
-
-                        number component1 = gauge_xfm2_123[this->mdl->flatten(l,m)]*gauge_xfm1[p]*gauge_xfm1[q]
-                                            * k2k3
-                                            * (k2_re[this->mdl->flatten(l,p)]*k3_re[this->mdl->flatten(m,q)]
-                                               - k2_im[this->mdl->flatten(l,p)]*k3_im[this->mdl->flatten(m,q)]);
-                        number component2 = gauge_xfm2_213[this->mdl->flatten(l,m)]*gauge_xfm1[p]*gauge_xfm1[q]
-                                            * k1k3
-                                            * (k1_re[this->mdl->flatten(l,p)]*k3_re[this->mdl->flatten(m,q)]
-                                               - k1_im[this->mdl->flatten(l,p)]*k3_im[this->mdl->flatten(m,q)]);
-                        number component3 = gauge_xfm2_312[this->mdl->flatten(l,m)]*gauge_xfm1[p]*gauge_xfm1[q]
-                                            * k1k2
-                                            * (k1_re[this->mdl->flatten(l,p)]*k2_re[this->mdl->flatten(m,q)]
-                                               - k1_im[this->mdl->flatten(l,p)]*k2_im[this->mdl->flatten(m,q)]);
-
-                        zeta_threepf += component1;
-                        zeta_threepf += component2;
-                        zeta_threepf += component3;
-                      }
-                  }
-              }
-          }
-
-        // compute reduced bispectrum
-        number z_tpf_k1;
-        number z_tpf_k2;
-        number z_tpf_k3;
-        this->zeta_twopf(k1_re, bg, z_tpf_k1, gauge_xfm1, true);  // 'true' flags that the gauge transformation is precomputed, so there is no need to recompute it
-        this->zeta_twopf(k2_re, bg, z_tpf_k2, gauge_xfm1, true);  // 'true' flags that the gauge transformation is precomputed, so there is no need to recompute it
-        this->zeta_twopf(k3_re, bg, z_tpf_k3, gauge_xfm1, true);  // 'true' flags that the gauge transformation is precomputed, so there is no need to recompute it
+        // N_lm N_p N_q sigma_lp sigma_mq factorizes as N_lm (sigma_lp N_p)(sigma_mq N_q), so contract each twopf with N first
+        this->engine.contract_trailing(view(k1_re, N*N), dN, this->k1_re_dN);
+        this->engine.contract_trailing(view(k1_im, N*N), dN, this->k1_im_dN);
+        this->engine.contract_trailing(view(k2_re, N*N), dN, this->k2_re_dN);
+        this->engine.contract_trailing(view(k2_im, N*N), dN, this->k2_im_dN);
+        this->engine.contract_trailing(view(k3_re, N*N), dN, this->k3_re_dN);
+        this->engine.contract_trailing(view(k3_im, N*N), dN, this->k3_im_dN);
+
+        // as of 14 Jan 2016 the database stores dimensionless quantities k^3 * 2pf and (k1 k2 k3)^2 * 3pf
+        // to accommodate this we need factors k1k2, k1k3, k2k3 to convert from k^3 * 2pf objects to appropriately
+        // normalized 3pf shapes
+        this->engine.contract_bilinear(view(gauge_xfm2_123, N*N), this->k2_re_dN, this->k3_re_dN,  k2k3, &zeta_threepf);
+        this->engine.contract_bilinear(view(gauge_xfm2_123, N*N), this->k2_im_dN, this->k3_im_dN, -k2k3, &zeta_threepf);
+        this->engine.contract_bilinear(view(gauge_xfm2_213, N*N), this->k1_re_dN, this->k3_re_dN,  k1k3, &zeta_threepf);
+        this->engine.contract_bilinear(view(gauge_xfm2_213, N*N), this->k1_im_dN, this->k3_im_dN, -k1k3, &zeta_threepf);
+        this->engine.contract_bilinear(view(gauge_xfm2_312, N*N), this->k1_re_dN, this->k2_re_dN,  k1k2, &zeta_threepf);
+        this->engine.contract_bilinear(view(gauge_xfm2_312, N*N), this->k1_im_dN, this->k2_im_dN, -k1k2, &zeta_threepf);
+
+        // compute reduced bispectrum; the zeta twopfs are N_m (sigma_mn N_n), which we already have
+        number z_tpf_k1 = 0.0;
+        number z_tpf_k2 = 0.0;
+        number z_tpf_k3 = 0.0;
+        this->engine.contract_vector(this->k1_re_dN, dN, 1.0, &z_tpf_k1);
+        this->engine.contract_vector(this->k2_re_dN, dN, 1.0, &z_tpf_k2);
+        this->engine.contract_vector(this->k3_re_dN, dN, 1.0, &z_tpf_k3);
 
         number form_factor = (6.0/5.0) * (z_tpf_k1*z_tpf_k2*k1k2 + z_tpf_k1*z_tpf_k3*k1k3 + z_tpf_k2*z_tpf_k3*k2k3);
         redbsp = zeta_threepf / form_factor;
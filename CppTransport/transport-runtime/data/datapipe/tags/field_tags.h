@@ -32,6 +32,7 @@
 #include <list>
 #include <functional>
 #include <memory>
+#include <utility>
 
 #include "transport-runtime/derived-products/derived-content/SQL_query/SQL_query.h"
 
@@ -75,12 +76,19 @@ namespace transport
 
       public:
 
+        //! list of sibling cache lines, used to return lines obtained by a bulk pull
+        typedef std::list< std::pair< std::unique_ptr< data_tag<number> >, std::vector<number> > > sibling_list;
+
         //! check for tag equality
         virtual bool operator==(const data_tag<number>& obj) const = 0;
 
         //! virtual function to pull a cache line
         virtual void pull(derived_data::SQL_query& query, std::vector<number>& data) = 0;
 
+        //! virtual function to pull a cache line, together with any sibling lines which can be read by the
+        //! same database operation; by default there are no siblings
+        virtual void pull_page(derived_data::SQL_query& query, std::vector<number>& data, sibling_list& siblings) { this->pull(query, data); }
+
         //! emit a log item for this tag
         void log(const std::string& log_item) const { BOOST_LOG_SEV(this->pipe->get_log(), datapipe<number>::log_severity_level::normal) << log_item; }
 
@@ -113,6 +121,24 @@ namespace transport
 	    };
 
 
+    namespace linecache
+      {
+
+        //! data tags may supply sibling lines, so route cache misses through pull_page()
+        template <typename number>
+        struct line_puller< std::vector<number>, data_tag<number>, derived_data::SQL_query >
+          {
+            typedef typename data_tag<number>::sibling_list sibling_list;
+
+            static void pull(data_tag<number>& tag, derived_data::SQL_query& query, std::vector<number>& data, sibling_list& siblings)
+              {
+                tag.pull_page(query, data, siblings);
+              }
+          };
+
+      }   // namespace linecache
+
+
     //! background time data group tag
     template <typename number>
     class background_time_data_tag: public data_tag<number>
@@ -201,6 +227,9 @@ namespace transport
         //! pull data corresponding to this tag
         virtual void pull(derived_data::SQL_query& query, std::vector<number>& data) override;
 
+        //! pull data corresponding to this tag, and every other component stored in the same database page
+        virtual void pull_page(derived_data::SQL_query& query, std::vector<number>& data, typename data_tag<number>::sibling_list& siblings) override;
+
         //! identify this tag
         virtual std::string name() const override;
 
@@ -267,6 +296,9 @@ namespace transport
         //! pull data corresponding to this tag
         virtual void pull(derived_data::SQL_query& query, std::vector<number>& data) override;
 
+        //! pull data corresponding to this tag, and every other component stored in the same database page
+        virtual void pull_page(derived_data::SQL_query& query, std::vector<number>& data, typename data_tag<number>::sibling_list& siblings) override;
+
         //! identify this tag
         virtual std::string name() const override;
 
@@ -527,6 +559,141 @@ namespace transport
 	    }
 
 
+    // TAG PAGE PULL -- IMPLEMENTATION
+
+
+    template <typename number>
+    void cf_time_data_tag<number>::pull_page(derived_data::SQL_query& query, std::vector<number>& sample, typename data_tag<number>::sibling_list& siblings)
+      {
+        // check that we are attached to an integration content group
+        assert(this->pipe->validate_attached(datapipe<number>::attachment_type::integration_attached));
+        if(!this->pipe->validate_attached(datapipe<number>::attachment_type::integration_attached)) throw runtime_exception(exception_type::DATAPIPE_ERROR, CPPTRANSPORT_DATAMGR_PIPE_NOT_ATTACHED);
+
+#ifdef CPPTRANSPORT_DEBUG_DATAPIPE
+        BOOST_LOG_SEV(this->pipe->get_log(), datapipe<number>::log_severity_level::datapipe_pull) << "** PULL page containing " << this->name();
+#endif
+
+        std::vector< std::vector<number> > page;
+        unsigned int first_id = 0;
+
+        {
+          timing_instrument timer(this->pipe->database_timer);
+          switch(this->type)
+            {
+              case cf_data_type::cf_twopf_re:
+                {
+                  this->pipe->data_mgr.pull_twopf_time_page(this->pipe, this->id, query, this->kserial, page, first_id, twopf_type::real);
+                  break;
+                }
+
+              case cf_data_type::cf_twopf_im:
+                {
+                  this->pipe->data_mgr.pull_twopf_time_page(this->pipe, this->id, query, this->kserial, page, first_id, twopf_type::imag);
+                  break;
+                }
+
+              case cf_data_type::cf_threepf_momentum:
+                {
+                  this->pipe->data_mgr.pull_threepf_time_page(this->pipe, this->id, query, this->kserial, page, first_id, threepf_type::momentum);
+                  break;
+                }
+
+              case cf_data_type::cf_threepf_Nderiv:
+                {
+                  this->pipe->data_mgr.pull_threepf_time_page(this->pipe, this->id, query, this->kserial, page, first_id, threepf_type::Nderiv);
+                  break;
+                }
+
+              case cf_data_type::cf_tensor_twopf:
+                {
+                  this->pipe->data_mgr.pull_tensor_twopf_time_page(this->pipe, this->id, query, this->kserial, page, first_id);
+                  break;
+                }
+            }
+        }
+
+        // scatter columns: the requested component goes to 'sample', all others become sibling cache lines
+        for(unsigned int i = 0; i < page.size(); ++i)
+          {
+            if(first_id + i == this->id)
+              {
+                sample = std::move(page[i]);
+              }
+            else
+              {
+                std::unique_ptr< data_tag<number> > tag(new cf_time_data_tag<number>(this->pipe, this->type, first_id + i, this->kserial));
+                siblings.emplace_back(std::move(tag), std::move(page[i]));
+              }
+          }
+      }
+
+
+    template <typename number>
+    void cf_kconfig_data_tag<number>::pull_page(derived_data::SQL_query& query, std::vector<number>& sample, typename data_tag<number>::sibling_list& siblings)
+      {
+        // check that we are attached to an integration content group
+        assert(this->pipe->validate_attached(datapipe<number>::attachment_type::integration_attached));
+        if(!this->pipe->validate_attached(datapipe<number>::attachment_type::integration_attached)) throw runtime_exception(exception_type::DATAPIPE_ERROR, CPPTRANSPORT_DATAMGR_PIPE_NOT_ATTACHED);
+
+#ifdef CPPTRANSPORT_DEBUG_DATAPIPE
+        BOOST_LOG_SEV(this->pipe->get_log(), datapipe<number>::log_severity_level::datapipe_pull) << "** PULL page containing " << this->name();
+#endif
+
+        std::vector< std::vector<number> > page;
+        unsigned int first_id = 0;
+
+        {
+          timing_instrument timer(this->pipe->database_timer);
+          switch(this->type)
+            {
+              case cf_data_type::cf_twopf_re:
+                {
+                  this->pipe->data_mgr.pull_twopf_kconfig_page(this->pipe, this->id, query, this->tserial, page, first_id, twopf_type::real);
+                  break;
+                }
+
+              case cf_data_type::cf_twopf_im:
+                {
+                  this->pipe->data_mgr.pull_twopf_kconfig_page(this->pipe, this->id, query, this->tserial, page, first_id, twopf_type::imag);
+                  break;
+                }
+
+              case cf_data_type::cf_threepf_momentum:
+                {
+                  this->pipe->data_mgr.pull_threepf_kconfig_page(this->pipe, this->id, query, this->tserial, page, first_id, threepf_type::momentum);
+                  break;
+                }
+
+              case cf_data_type::cf_threepf_Nderiv:
+                {
+                  this->pipe->data_mgr.pull_threepf_kconfig_page(this->pipe, this->id, query, this->tserial, page, first_id, threepf_type::Nderiv);
+                  break;
+                }
+
+              case cf_data_type::cf_tensor_twopf:
+                {
+                  this->pipe->data_mgr.pull_tensor_twopf_kconfig_page(this->pipe, this->id, query, this->tserial, page, first_id);
+                  break;
+                }
+            }
+        }
+
+        // scatter columns: the requested component goes to 'sample', all others become sibling cache lines
+        for(unsigned int i = 0; i < page.size(); ++i)
+          {
+            if(first_id + i == this->id)
+              {
+                sample = std::move(page[i]);
+              }
+            else
+              {
+                std::unique_ptr< data_tag<number> > tag(new cf_kconfig_data_tag<number>(this->pipe, this->type, first_id + i, this->tserial));
+                siblings.emplace_back(std::move(tag), std::move(page[i]));
+              }
+          }
+      }
+
+
     // TAG EQUALITY -- IMPLEMENTATION
 
 
@@ -67,6 +67,12 @@ namespace transport
         //! note, argument_cache stores the capacity in bytes so no conversion is needed
         size_t get_pipe_capacity() const { return this->args.get_datapipe_capacity(); }
 
+        //! Return layout to be applied to finalized containers
+        container_layout get_container_layout() const { return this->args.get_container_layout(); }
+
+        //! Return encoding of stored values in finalized containers
+        storage_codec get_storage_codec() const { return this->args.get_storage_codec(); }
+
 
         // CHECKPOINTING ADMIN
 
@@ -129,6 +135,16 @@ namespace transport
         virtual void close_writer(integration_writer<number>& i_writer, postintegration_writer<number>& p_writer) = 0;
 
 
+        // RECOVERY
+
+      public:
+
+        //! Aggregate temporary containers left behind when an integration was interrupted, and retain checkpoints of
+        //! any configurations which were in flight. Those configurations are still reported missing, but are resumed
+        //! from their checkpoints by workers when the content group is used as a seed
+        virtual void recover_temporary_containers(integration_writer<number>& writer) = 0;
+
+
         // WRITE TABLES FOR A DATA CONTAINER
 
       public:
@@ -433,6 +449,21 @@ namespace transport
         virtual void pull_tensor_twopf_time_sample(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
                                                    unsigned int k_serial, std::vector<number>& sample) = 0;
 
+        //! Pull time samples for every twopf component sharing a database page with component 'id', in one operation;
+        //! on exit sample[i] holds component first_id+i
+        virtual void pull_twopf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                          unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                          twopf_type type) = 0;
+
+        //! Pull time samples for every threepf component sharing a database page with component 'id', in one operation
+        virtual void pull_threepf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                            unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                            threepf_type type) = 0;
+
+        //! Pull time samples for every tensor twopf component sharing a database page with component 'id', in one operation
+        virtual void pull_tensor_twopf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                                 unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id) = 0;
+
         //! Pull a sample of the zeta twopf at fixed k-configuration from a datapipe
         virtual void pull_zeta_twopf_time_sample(datapipe<number>*, const derived_data::SQL_query& query,
                                                  unsigned int k_serial, std::vector<number>& sample) = 0;
@@ -469,6 +500,21 @@ namespace transport
         virtual void pull_tensor_twopf_kconfig_sample(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
                                                       unsigned int t_serial, std::vector<number>& sample) = 0;
 
+        //! Pull kconfig samples for every twopf component sharing a database page with component 'id', in one operation;
+        //! on exit sample[i] holds component first_id+i
+        virtual void pull_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                             unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                             twopf_type type) = 0;
+
+        //! Pull kconfig samples for every threepf component sharing a database page with component 'id', in one operation
+        virtual void pull_threepf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                               unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                               threepf_type type) = 0;
+
+        //! Pull kconfig samples for every tensor twopf component sharing a database page with component 'id', in one operation
+        virtual void pull_tensor_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                                    unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id) = 0;
+
         //! Pull a kconfig sample of the zeta twopf at fixed time from a datapipe
         virtual void pull_zeta_twopf_kconfig_sample(datapipe<number>*, const derived_data::SQL_query& query,
                                                     unsigned int t_serial, std::vector<number>& sample) = 0;
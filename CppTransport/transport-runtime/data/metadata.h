@@ -30,6 +30,8 @@
 #include <string>
 #include <map>
 
+#include "transport-runtime/utilities/hot_path_instrument.h"
+
 #include "boost/timer/timer.hpp"
 
 
@@ -47,7 +49,7 @@ namespace transport
         worker_record(unsigned int wg, unsigned int wk, std::string be, std::string bs,
                       const std::string ps, double b_atol, double b_rtol, double p_atol, double p_rtol,
                       std::string hn, std::string on, std::string ov, std::string orl,
-                      std::string ar, std::string cb, std::string cv)
+                      std::string ar, std::string cb, std::string cv, std::string kv)
           : workgroup(wg),
             worker(wk),
             backend(std::move(be)),
@@ -61,7 +63,8 @@ namespace transport
             os_release(std::move(orl)),
             architecture(std::move(ar)),
             cpu_brand(std::move(cb)),
-            cpu_vendor(std::move(cv))
+            cpu_vendor(std::move(cv)),
+            kernels(std::move(kv))
           {
           }
 
@@ -115,6 +118,9 @@ namespace transport
         //! return CPU vendor
         const std::string& get_cpu_vendor() const { return cpu_vendor; }
 
+        //! return integration kernel variants
+        const std::string& get_kernel_variant() const { return kernels; }
+
 
         // INTERNAL DATA
 
@@ -162,6 +168,9 @@ namespace transport
         //! CPU vendor
         std::string cpu_vendor;
 
+        //! integration kernel variants
+        std::string kernels;
+
       };
 
 
@@ -179,14 +188,16 @@ namespace transport
 
         //! constructor
         timing_record(unsigned int sn, boost::timer::nanosecond_type it, boost::timer::nanosecond_type bt,
-                      unsigned int st, unsigned int rf, unsigned int wg, unsigned int wk)
+                      unsigned int st, unsigned int rf, unsigned int wg, unsigned int wk,
+                      const hot_path::profile_summary& pf = hot_path::profile_summary())
           : serial(sn),
             integration_time(it),
             batch_time(bt),
             steps(st),
             refinements(rf),
             workgroup(wg),
-            worker(wk)
+            worker(wk),
+            profile(pf)
           {
           }
 
@@ -219,6 +230,9 @@ namespace transport
         //! get worker identifier
         unsigned int get_worker() const { return worker; }
 
+        //! get hot-path profile summary
+        const hot_path::profile_summary& get_profile() const { return profile; }
+
 
         // INTERNAL DATA
 
@@ -245,6 +259,9 @@ namespace transport
         //! worker identifier of the worker which processed this configuration
         unsigned int worker;
 
+        //! hot-path profile summary, if the integration was instrumented
+        hot_path::profile_summary profile;
+
     };
 
 
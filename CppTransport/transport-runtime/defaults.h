@@ -50,6 +50,7 @@ namespace transport
     constexpr unsigned int CPPTRANSPORT_DEFAULT_HTML_EFOLDS_PRECISION      = 3;
     constexpr unsigned int CPPTRANSPORT_DEFAULT_HTML_DATABASE_PRECISION    = 6;
     constexpr unsigned int CPPTRANSPORT_DEFAULT_HTML_PAGEABLE_TABLE_SIZE   = 10;
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_HTML_PLOT_CACHE_SIZE       = (256*1024*1024);
 
     constexpr unsigned int CPPTRANSPORT_DEFAULT_TERMINAL_WIDTH             = (135);
 
@@ -82,6 +83,7 @@ namespace transport
 
     constexpr auto         CPPTRANSPORT_HOME_ENV                           = "HOME";
     constexpr auto         CPPTRANSPORT_PATH_ENV                           = "CPPTRANSPORT_PATH";
+    constexpr auto         CPPTRANSPORT_PLUGIN_PATH_ENV                    = "CPPTRANSPORT_PLUGIN_PATH";
     constexpr auto         CPPTRANSPORT_SHELL_PATH_ENV                     = "PATH";
     constexpr auto         CPPTRANSPORT_TERM_ENV                           = "TERM";
     constexpr auto         CPPTRANSPORT_COLUMNS_ENV                        = "COLUMNS";
@@ -89,6 +91,9 @@ namespace transport
     constexpr auto         CPPTRANSPORT_PROFILE_CONFIG_FILE                = ".profile";
     constexpr auto         CPPTRANSPORT_HTML_RESOURCE_DIRECTORY            = "HTML";
 
+    // model plugins are shared libraries named by the uid of the model they provide, with this extension
+    constexpr auto         CPPTRANSPORT_PLUGIN_EXTENSION                   = ".so";
+
     constexpr auto         CPPTRANSPORT_DEFAULT_COMPLETION_UNSET           = "unset";
     
     // name of global timer used in master and slave controllers
@@ -104,6 +109,21 @@ namespace transport
     // default size of the k-configuration caches - 1 Mb
     constexpr unsigned int CPPTRANSPORT_DEFAULT_CONFIGURATION_CACHE_SIZE   = (1*1024*1024);
 
+    // number of time samples processed together by the tensor-contraction engine; a tile of this
+    // size for each operand should fit comfortably in L1 cache
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_CONTRACTION_TILE           = (256);
+
+    // number of bispectrum triangles batched together when computing fNL inner products
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_CONTRACTION_BATCH          = (64);
+
+    // default number of work assignments which may be outstanding on each worker; assignments beyond the
+    // first are prefetched into the worker's MPI queue, hiding the round-trip to the master between assignments
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_SCHEDULING_LOOKAHEAD       = (2);
+
+    // default number of workers coordinated by each group leader; 0 indicates that all workers report
+    // directly to the master
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_GROUP_SIZE                 = (0);
+
     // default checkpointing interval measured in seconds. 0 indicates that checkpointing is disabled
     constexpr unsigned int CPPTRANSPORT_DEFAULT_CHECKPOINT_INTERVAL        = (0);
     
@@ -112,6 +132,38 @@ namespace transport
     constexpr unsigned int CPPTRANSPORT_DEFAULT_REPORT_TIME_INTERVAL       = (0);
     constexpr unsigned int CPPTRANSPORT_DEFAULT_REPORT_TIME_DELAY          = (60*5);
 
+    // default number of k-configurations sampled when autotuning steppers, and the tolerance
+    // used to compute the reference solution against which candidates are compared
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_AUTOTUNE_SAMPLE            = (8);
+    constexpr double       CPPTRANSPORT_AUTOTUNE_REFERENCE_TOLERANCE       = (1E-14);
+    constexpr auto         CPPTRANSPORT_AUTOTUNE_REFERENCE_STEPPER         = "runge_kutta_fehlberg78";
+
+    // tolerances tried for each candidate stepper when autotuning; each is used as both the absolute and relative tolerance
+    constexpr double       CPPTRANSPORT_AUTOTUNE_TOLERANCES[]              = { 1E-6, 1E-8, 1E-10, 1E-12 };
+
+    // number of RHS evaluations in each timed trial, and number of trials, used to choose between the unrolled
+    // and rolled integration kernels of models translated with --dual-unroll
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_KERNEL_CALIBRATION_EVALUATIONS = (32);
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_KERNEL_CALIBRATION_TRIALS      = (5);
+
+    // largest relative discrepancy tolerated between derivatives of the potential computed by automatic differentiation
+    // and by the symbolic expressions, when the translator's cross-check is enabled
+    constexpr double       CPPTRANSPORT_DEFAULT_AUTODIFF_CHECK_TOLERANCE   = (1E-8);
+
+    // default number of threads used by each worker when evaluating model tensors over a batch of time samples,
+    // and the smallest number of samples allocated to each thread; workers already occupy the available cores
+    // under MPI, so by default batches are evaluated serially
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_BATCH_THREADS              = (1);
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_BATCH_GRAIN                = (64);
+
+    // largest number of tensor elements materialized by a single batched evaluation; derived lines that need
+    // tensors for many k-configurations evaluate them in blocks of k so that memory use stays bounded
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_BATCH_ELEMENTS             = (4*1024*1024);
+
+    // largest relative discrepancy tolerated between a supplied parameter value and the value fixed when a
+    // specialized model variant was translated
+    constexpr double       CPPTRANSPORT_DEFAULT_SPECIALIZATION_TOLERANCE   = (1E-12);
+
     // tolerance when merging axis points; points closer than this are considered equivalent
     constexpr double       CPPTRANSPORT_AXIS_MERGE_TOLERANCE               = (1E-8);
 
@@ -142,6 +194,13 @@ namespace transport
     // notification delay for slow integrations; default is 10 minutes
     constexpr boost::timer::nanosecond_type CPPTRANSPORT_DEFAULT_SLOW_INTEGRATION_NOTIFY = boost::timer::nanosecond_type(10)*60*1000*1000*1000;
 
+    // hot-path instrumentation times one RHS evaluation in every CPPTRANSPORT_DEFAULT_INSTRUMENT_SAMPLE_PERIOD;
+    // must be a power of 2
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_INSTRUMENT_SAMPLE_PERIOD   = (16);
+
+    // interval used to calibrate the timestamp counter against the system's monotonic clock, in microseconds
+    constexpr unsigned int CPPTRANSPORT_DEFAULT_INSTRUMENT_CALIBRATION     = (2000);
+
   }   // namespace transport
 
 
@@ -117,7 +117,7 @@ namespace transport
 					};
 
 
-				SQL_policy::SQL_policy(std::string time, std::string time_s,
+				inline SQL_policy::SQL_policy(std::string time, std::string time_s,
 				                       std::string twopf, std::string twopf_s,
 				                       std::string threepf, std::string threepf_s,
 				                       std::string k1_s, std::string k2_s, std::string k3_s)
@@ -42,7 +42,7 @@ namespace transport
 				namespace SQL_query_helper
 					{
 
-						std::unique_ptr<SQL_query> deserialize(Json::Value& reader)
+						inline std::unique_ptr<SQL_query> deserialize(Json::Value& reader)
 							{
 						    std::string type = reader[CPPTRANSPORT_NODE_SQL_QUERY_TYPE].asString();
 
@@ -121,29 +121,32 @@ namespace transport
 				    //! class id
 				    unsigned int my_id;
 
-            //! global id counter; initialized below
-				    static unsigned int current_id;
+            //! global id counter; held as a function-local static so the definition can live in a header
+				    static unsigned int next_id();
 
 			    };
 
 
-				// initialize static member
-				unsigned int SQL_threepf_query::current_id = 0;
+				inline unsigned int SQL_threepf_query::next_id()
+					{
+						static unsigned int current_id = 0;
+						return current_id++;
+					}
 
 
 		    // SQL THREEPF QUERY
 
 
-		    SQL_threepf_query::SQL_threepf_query(const std::string q)
+		    inline SQL_threepf_query::SQL_threepf_query(const std::string q)
 			    : query(q),
 			      config(SQL_config_type::kconfig),
-		        my_id(current_id++)
+		        my_id(next_id())
 			    {
 			    }
 
 
-		    SQL_threepf_query::SQL_threepf_query(Json::Value& reader)
-		      : my_id(current_id++)
+		    inline SQL_threepf_query::SQL_threepf_query(Json::Value& reader)
+		      : my_id(next_id())
 			    {
 		        query = reader[CPPTRANSPORT_NODE_SQL_THREEPF_KCONFIG_QUERY].asString();
 
@@ -158,7 +161,7 @@ namespace transport
 			    }
 
 
-		    void SQL_threepf_query::serialize(Json::Value& writer) const
+		    inline void SQL_threepf_query::serialize(Json::Value& writer) const
 			    {
 		        writer[CPPTRANSPORT_NODE_SQL_QUERY_TYPE]            = std::string(CPPTRANSPORT_NODE_SQL_THREEPF_KCONFIG_QUERY_TYPE);
 		        writer[CPPTRANSPORT_NODE_SQL_THREEPF_KCONFIG_QUERY] = this->query;
@@ -184,7 +187,7 @@ namespace transport
 			    }
 
 
-		    std::string SQL_threepf_query::make_query(const SQL_policy& policy, bool serials_only) const
+		    inline std::string SQL_threepf_query::make_query(const SQL_policy& policy, bool serials_only) const
 			    {
 		        std::ostringstream query;
 
@@ -257,7 +260,7 @@ namespace transport
 			    }
 
 
-		    bool SQL_threepf_query::operator==(const SQL_query& query) const
+		    inline bool SQL_threepf_query::operator==(const SQL_query& query) const
 			    {
 		        const SQL_threepf_query* ptr = dynamic_cast<const SQL_threepf_query*>(&query);
 
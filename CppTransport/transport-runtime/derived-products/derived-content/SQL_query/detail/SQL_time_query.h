@@ -102,26 +102,26 @@ namespace transport
         // SQL TIME QUERY
 
 
-        SQL_time_query::SQL_time_query(const std::string q)
+        inline SQL_time_query::SQL_time_query(const std::string q)
 	        : query(q)
 	        {
 	        }
 
 
-        SQL_time_query::SQL_time_query(Json::Value& reader)
+        inline SQL_time_query::SQL_time_query(Json::Value& reader)
 	        {
 		        query = reader[CPPTRANSPORT_NODE_SQL_TIME_QUERY].asString();
 	        }
 
 
-        void SQL_time_query::serialize(Json::Value& writer) const
+        inline void SQL_time_query::serialize(Json::Value& writer) const
 	        {
             writer[CPPTRANSPORT_NODE_SQL_QUERY_TYPE] = std::string(CPPTRANSPORT_NODE_SQL_TIME_QUERY_TYPE);
             writer[CPPTRANSPORT_NODE_SQL_TIME_QUERY] = this->query;
 	        }
 
 
-        std::string SQL_time_query::make_query(const SQL_policy& policy, bool serials_only) const
+        inline std::string SQL_time_query::make_query(const SQL_policy& policy, bool serials_only) const
 	        {
             std::ostringstream query;
 
@@ -136,7 +136,7 @@ namespace transport
 	        }
 
 
-        bool SQL_time_query::operator==(const SQL_query& query) const
+        inline bool SQL_time_query::operator==(const SQL_query& query) const
 	        {
             const SQL_time_query* ptr = dynamic_cast<const SQL_time_query*>(&query);
 
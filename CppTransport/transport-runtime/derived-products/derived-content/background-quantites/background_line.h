@@ -476,19 +476,26 @@ namespace transport
                 line_data[j].resize(t_axis.size());
               }
 
-            // allocate workspace for computation
-            std::vector<number> M(2*N * 2*N);
-            std::vector<number> E(N);
-
-            // for each time sample point, compute mass spectrum and store in line_data
+            // the batched evaluator expects one time series per background component, so transpose bg_data
+            std::vector< std::vector<number> > history(2*N, std::vector<number>(t_axis.size()));
             for(unsigned int j = 0; j < t_axis.size(); ++j)
               {
-                mdl->sorted_mass_spectrum(this->gadget.get_integration_task(), bg_data[j], t_axis[j], norm, M, E);
+                for(unsigned int m = 0; m < 2*N; ++m)
+                  {
+                    history[m][j] = bg_data[j][m];
+                  }
+              }
+
+            // compute the mass spectrum at every time sample point in one call, then store in line_data
+            std::vector< std::vector<number> > E;
+            mdl->sorted_mass_spectrum_batch(this->gadget.get_integration_task(), history, t_axis, norm, E);
 
-                for(unsigned int i = 0; i < N; ++i)
+            for(unsigned int i = 0; i < N; ++i)
+              {
+                for(unsigned int j = 0; j < t_axis.size(); ++j)
                   {
-                    auto absE = std::abs(E[i]);
-                    auto sign = E[i] / absE;
+                    auto absE = std::abs(E[i][j]);
+                    auto sign = E[i][j] / absE;
                     line_data[i][j] = sign * std::sqrt(absE);
                   }
               }
@@ -202,38 +202,40 @@ namespace transport
             twopf_kconfig_tag<number>  kc_tag                          = pipe.new_twopf_kconfig_tag();
             std::vector<twopf_kconfig> k_configs                       = kc_handle.lookup_tag(kc_tag);
 
-				    // pull background data
+				    // pull background data; the model's batched evaluators accept it in the same layout the datapipe
+				    // returns it, as one time series per component, so there is no need to transpose
 				    typename datapipe<number>::time_data_handle& handle = pipe.new_time_data_handle(this->tquery);
-				    std::vector<std::vector<number> > bg_data(t_axis.size());
 
             unsigned int Nfields = this->gadget.get_N_fields();
+				    std::vector<std::vector<number> > bg_data(2*Nfields);
 
 				    for(unsigned int m = 0; m < 2*Nfields; ++m)
 					    {
-				        std::array<unsigned int, 1>      index_set = { m };
-				        background_time_data_tag<number> tag       = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
-
-				        // safe to take a reference here and avoid a copy
-				        const std::vector<number>& bg = handle.lookup_tag(tag);
-
-				        for(unsigned int j = 0; j < t_axis.size(); ++j)
-					        {
-				            bg_data[j].push_back(bg[j]);
-					        }
+				        background_time_data_tag<number> tag = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
+				        bg_data[m] = handle.lookup_tag(tag);
 					    }
 
 		        model<number>* mdl = this->gadget.get_model();
 		        assert(mdl != nullptr);
 
-            std::vector<number> u2_tensor(2*Nfields * 2*Nfields);
+            std::vector<double> N_samples;
+            N_samples.reserve(t_configs.size());
+            for(const time_config& c : t_configs) N_samples.push_back(c.t);
+
+            std::vector<double> k_samples;
+            k_samples.reserve(k_configs.size());
+            for(const twopf_kconfig& c : k_configs) k_samples.push_back(c.k_comoving);
+
+            std::vector< std::vector< std::vector<number> > > u2_tensor;
+            mdl->u2_batch(this->gadget.get_integration_task(), bg_data, N_samples, k_samples, u2_tensor);
 
-            for(std::vector<twopf_kconfig>::iterator t = k_configs.begin(); t != k_configs.end(); ++t)
+            for(unsigned int i = 0; i < k_configs.size(); ++i)
               {
+                std::vector<twopf_kconfig>::const_iterator t = k_configs.begin() + i;
                 std::vector<number> line_data(t_axis.size());
 
                 for(unsigned int j = 0; j < line_data.size(); ++j)
                   {
-                    mdl->u2(this->gadget.get_integration_task(), bg_data[j], t->k_comoving, t_configs[j].t, u2_tensor);
                     number val = -std::numeric_limits<number>::max();
 
                     for(unsigned int m = 0; m < 2*Nfields; ++m)
@@ -242,7 +244,7 @@ namespace transport
                           {
                             if(mdl->is_momentum(m) && mdl->is_field(n)) // only look at the momentum-field block, which is M/H^2; the other blocks aren't relate to SR
                               {
-                                number value = std::abs(u2_tensor[mdl->flatten(m,n)]);
+                                number value = std::abs(u2_tensor[i][mdl->flatten(m,n)][j]);
                                 if(value > val) val = value;
                               }
                           }
@@ -240,57 +240,80 @@ namespace transport
             threepf_kconfig_tag<number>  kc_tag                          = pipe.new_threepf_kconfig_tag();
             std::vector<threepf_kconfig> k_configs                       = kc_handle.lookup_tag(kc_tag);
 
-				    // pull background data
+				    // pull background data; the model's batched evaluators accept it in the same layout the datapipe
+				    // returns it, as one time series per component, so there is no need to transpose
 				    typename datapipe<number>::time_data_handle& handle = pipe.new_time_data_handle(this->tquery);
-				    std::vector<std::vector<number> > bg_data(t_axis.size());
 
             unsigned int Nfields = this->gadget.get_N_fields();
+				    std::vector<std::vector<number> > bg_data(2*Nfields);
 
 				    for(unsigned int m = 0; m < 2*Nfields; ++m)
 					    {
-				        std::array<unsigned int, 1>      index_set = { m };
-				        background_time_data_tag<number> tag       = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
-
-				        // safe to take a reference here and avoid a copy
-				        const std::vector<number>& bg = handle.lookup_tag(tag);
-
-				        for(unsigned int j = 0; j < t_axis.size(); ++j)
-					        {
-				            bg_data[j].push_back(bg[j]);
-					        }
+				        background_time_data_tag<number> tag = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
+				        bg_data[m] = handle.lookup_tag(tag);
 					    }
 
 		        model<number>* mdl = this->gadget.get_model();
 		        assert(mdl != nullptr);
 
-            std::vector<number> u3_tensor(2*Nfields * 2*Nfields * 2*Nfields);
+            std::vector<double> N_samples;
+            N_samples.reserve(t_configs.size());
+            for(const time_config& c : t_configs) N_samples.push_back(c.t);
+
+            // u3 has (2N)^3 components per (k, N) sample, so evaluating every k-configuration at once would
+            // materialize k x (2N)^3 x samples elements; instead evaluate in blocks of k-configurations
+            const std::size_t k_elements = static_cast<std::size_t>(8*Nfields*Nfields*Nfields) * std::max(N_samples.size(), std::size_t(1));
+            const std::size_t k_block = std::max(static_cast<std::size_t>(CPPTRANSPORT_DEFAULT_BATCH_ELEMENTS) / k_elements, std::size_t(1));
 
-            for(std::vector<threepf_kconfig>::iterator t = k_configs.begin(); t != k_configs.end(); ++t)
+            std::vector< std::vector< std::vector<number> > > u3_tensor;
+            std::vector<double> k1_samples;
+            std::vector<double> k2_samples;
+            std::vector<double> k3_samples;
+
+            for(std::size_t k_start = 0; k_start < k_configs.size(); k_start += k_block)
               {
-                std::vector<number> line_data(t_axis.size());
+                const std::size_t k_end = std::min(k_start + k_block, k_configs.size());
 
-                for(unsigned int j = 0; j < line_data.size(); ++j)
+                k1_samples.clear();
+                k2_samples.clear();
+                k3_samples.clear();
+                for(std::size_t i = k_start; i < k_end; ++i)
                   {
-                    mdl->u3(this->gadget.get_integration_task(), bg_data[j], t->k1_comoving, t->k2_comoving, t->k3_comoving, t_configs[j].t, u3_tensor);
-                    number val = -std::numeric_limits<number>::max();
+                    k1_samples.push_back(k_configs[i].k1_comoving);
+                    k2_samples.push_back(k_configs[i].k2_comoving);
+                    k3_samples.push_back(k_configs[i].k3_comoving);
+                  }
+
+                mdl->u3_batch(this->gadget.get_integration_task(), bg_data, N_samples, k1_samples, k2_samples, k3_samples, u3_tensor);
 
-                    for(unsigned int l = 0; l < 2*Nfields; ++l)
+                for(std::size_t i = k_start; i < k_end; ++i)
+                  {
+                    std::vector<threepf_kconfig>::const_iterator t = k_configs.begin() + i;
+                    const std::vector< std::vector<number> >& u3_k = u3_tensor[i - k_start];
+                    std::vector<number> line_data(t_axis.size());
+
+                    for(unsigned int j = 0; j < line_data.size(); ++j)
                       {
-                        for(unsigned int m = 0; m < 2*Nfields; ++m)
+                        number val = -std::numeric_limits<number>::max();
+
+                        for(unsigned int l = 0; l < 2*Nfields; ++l)
                           {
-                            for(unsigned int n = 0; n < 2*Nfields; ++n)
+                            for(unsigned int m = 0; m < 2*Nfields; ++m)
                               {
-                                number value = std::abs(u3_tensor[mdl->flatten(l,m,n)]);
-                                if(value > val) val = value;
+                                for(unsigned int n = 0; n < 2*Nfields; ++n)
+                                  {
+                                    number value = std::abs(u3_k[mdl->flatten(l,m,n)][j]);
+                                    if(value > val) val = value;
+                                  }
                               }
                           }
+
+                        line_data[j] = val;
                       }
 
-                    line_data[j] = val;
+                    lines.emplace_back(group, this->x_type, value_type::dimensionless, t_axis, line_data,
+                                       this->get_LaTeX_label(*t), this->get_non_LaTeX_label(*t), messages);
                   }
-
-                lines.emplace_back(group, this->x_type, value_type::dimensionless, t_axis, line_data,
-                                   this->get_LaTeX_label(*t), this->get_non_LaTeX_label(*t), messages);
               }
 
             this->detach(pipe);
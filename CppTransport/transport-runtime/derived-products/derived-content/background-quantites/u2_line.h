@@ -210,33 +210,38 @@ namespace transport
             twopf_kconfig_tag<number>  kc_tag                          = pipe.new_twopf_kconfig_tag();
             std::vector<twopf_kconfig> k_configs                       = kc_handle.lookup_tag(kc_tag);
 
-				    // pull background data
+				    // pull background data; the model's batched evaluators accept it in the same layout the datapipe
+				    // returns it, as one time series per component, so there is no need to transpose
 				    typename datapipe<number>::time_data_handle& handle = pipe.new_time_data_handle(this->tquery);
-				    std::vector<std::vector<number> > bg_data(t_axis.size());
 
             unsigned int Nfields = this->gadget.get_N_fields();
+				    std::vector<std::vector<number> > bg_data(2*Nfields);
 
 				    for(unsigned int m = 0; m < 2*Nfields; ++m)
 					    {
-				        std::array<unsigned int, 1>      index_set = { m };
-				        background_time_data_tag<number> tag       = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
-
-				        // safe to take a reference here and avoid a copy
-				        const std::vector<number>& bg = handle.lookup_tag(tag);
-
-				        for(unsigned int j = 0; j < t_axis.size(); ++j)
-					        {
-				            bg_data[j].push_back(bg[j]);
-					        }
+				        background_time_data_tag<number> tag = pipe.new_background_time_data_tag(this->gadget.get_model()->flatten(m));
+				        bg_data[m] = handle.lookup_tag(tag);
 					    }
 
 		        model<number>* mdl = this->gadget.get_model();
 		        assert(mdl != nullptr);
 
-            std::vector<number> u2_tensor(2*Nfields * 2*Nfields);
+            std::vector<double> N_samples;
+            N_samples.reserve(t_configs.size());
+            for(const time_config& c : t_configs) N_samples.push_back(c.t);
+
+            std::vector<double> k_samples;
+            k_samples.reserve(k_configs.size());
+            for(const twopf_kconfig& c : k_configs) k_samples.push_back(c.k_comoving);
 
-            for(std::vector<twopf_kconfig>::iterator t = k_configs.begin(); t != k_configs.end(); ++t)
+            // evaluate u2 once for every (k, N) sample; each line is then a single component of the result
+            std::vector< std::vector< std::vector<number> > > u2_tensor;
+            mdl->u2_batch(this->gadget.get_integration_task(), bg_data, N_samples, k_samples, u2_tensor);
+
+            for(unsigned int i = 0; i < k_configs.size(); ++i)
               {
+                std::vector<twopf_kconfig>::const_iterator t = k_configs.begin() + i;
+
                 for(unsigned int m = 0; m < 2*Nfields; ++m)
                   {
                     for(unsigned int n = 0; n < 2*Nfields; ++n)
@@ -244,13 +249,7 @@ namespace transport
                         std::array<unsigned int, 2> index_set = { m, n };
                         if(this->active_indices.is_on(index_set))
                           {
-                            std::vector<number> line_data(t_axis.size());
-
-                            for(unsigned int j = 0; j < line_data.size(); ++j)
-                              {
-                                mdl->u2(this->gadget.get_integration_task(), bg_data[j], t->k_comoving, t_configs[j].t, u2_tensor);
-                                line_data[j] = u2_tensor[mdl->flatten(m,n)];
-                              }
+                            const std::vector<number>& line_data = u2_tensor[i][mdl->flatten(m,n)];
 
                             lines.emplace_back(group, this->x_type, value_type::dimensionless, t_axis, line_data,
                                                this->get_LaTeX_label(m,n,*t), this->get_non_LaTeX_label(m,n,*t), messages);
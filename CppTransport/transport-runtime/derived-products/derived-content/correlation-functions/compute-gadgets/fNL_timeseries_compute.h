@@ -36,6 +36,8 @@
 // need data_manager for datapipe
 #include "transport-runtime/data/data_manager.h"
 
+#include "transport-runtime/utilities/tensor_contraction.h"
+
 
 namespace transport
 	{
@@ -136,6 +138,12 @@ namespace transport
 
 		      protected:
 
+            //! compute shape functions for the bispectrum and template on triangle i of the work list,
+            //! and store them in row r of the supplied batches
+            void shape_components(handle& h, typename datapipe<number>::time_zeta_handle& z_handle, unsigned int i,
+                                  contraction::component_block<number>& S_bispectrum_batch,
+                                  contraction::component_block<number>& S_template_batch, unsigned int r) const;
+
 		        //! compute shape function for a given bispectrum
 		        void shape_function(const std::vector<number>& bispectrum,
                                 const std::vector<number>& twopf_k1, const std::vector<number>& twopf_k2,
@@ -273,54 +281,84 @@ namespace transport
             TT.clear();
             TT.assign(h.t_axis.size(), 0.0);
 
+            const unsigned int T = h.t_axis.size();
+            const unsigned int batch = CPPTRANSPORT_DEFAULT_CONTRACTION_BATCH;
+
+            // shape functions for a batch of triangles are collected into component-major blocks
+            // (one row per triangle), and the inner products are then formed for the whole batch at once
+            contraction::component_block<number> S_bispectrum_batch(batch, T);
+            contraction::component_block<number> S_template_batch(batch, T);
+            std::vector<number> measure(batch);
+
+            contraction::contraction_engine<number> engine;
+
             // loop over all sampled k-configurations, adding their contributions to the integral
-            for(unsigned int i = 0; i < h.work_list.size(); ++i)
+            for(unsigned int i0 = 0; i0 < h.work_list.size(); i0 += batch)
               {
-                zeta_threepf_time_data_tag<number> bsp_tag = h.pipe.new_zeta_threepf_time_data_tag(*(h.work_list[i]));
+                const unsigned int n = std::min(batch, static_cast<unsigned int>(h.work_list.size()) - i0);
 
-                // pull bispectrum information for this triangle
-                const std::vector<number> bispectrum = z_handle.lookup_tag(bsp_tag);
+                for(unsigned int r = 0; r < n; ++r)
+                  {
+                    this->shape_components(h, z_handle, i0 + r, S_bispectrum_batch, S_template_batch, r);
+                    measure[r] = h.tk->measure(*(h.work_list[i0 + r]));
+                  }
 
-                twopf_kconfig k1;
-                twopf_kconfig k2;
-                twopf_kconfig k3;
+                contraction::component_view<number> S_bispectrum(S_bispectrum_batch.row(0), n, T, T);
+                contraction::component_view<number> S_template(S_template_batch.row(0), n, T, T);
 
-                k1.serial         = h.work_list[i]->k1_serial;
-                k1.k_comoving     = h.work_list[i]->k1_comoving;
-                k1.k_conventional = h.work_list[i]->k1_conventional;
+                engine.contract_weighted(S_bispectrum, S_bispectrum, measure, BB.data());
+                engine.contract_weighted(S_bispectrum, S_template, measure, BT.data());
+                engine.contract_weighted(S_template, S_template, measure, TT.data());
+              }
+          }
 
-                k2.serial         = h.work_list[i]->k2_serial;
-                k2.k_comoving     = h.work_list[i]->k2_comoving;
-                k2.k_conventional = h.work_list[i]->k2_conventional;
 
-                k3.serial         = h.work_list[i]->k3_serial;
-                k3.k_comoving     = h.work_list[i]->k3_comoving;
-                k3.k_conventional = h.work_list[i]->k3_conventional;
+        template <typename number>
+        void fNL_timeseries_compute<number>::shape_components(typename fNL_timeseries_compute<number>::handle& h,
+                                                              typename datapipe<number>::time_zeta_handle& z_handle, unsigned int i,
+                                                              contraction::component_block<number>& S_bispectrum_batch,
+                                                              contraction::component_block<number>& S_template_batch,
+                                                              unsigned int r) const
+          {
+            zeta_threepf_time_data_tag<number> bsp_tag = h.pipe.new_zeta_threepf_time_data_tag(*(h.work_list[i]));
 
-                zeta_twopf_time_data_tag<number> k1_tag = h.pipe.new_zeta_twopf_time_data_tag(k1);
-                zeta_twopf_time_data_tag<number> k2_tag = h.pipe.new_zeta_twopf_time_data_tag(k2);
-                zeta_twopf_time_data_tag<number> k3_tag = h.pipe.new_zeta_twopf_time_data_tag(k3);
+            // pull bispectrum information for this triangle
+            const std::vector<number> bispectrum = z_handle.lookup_tag(bsp_tag);
 
-                // as of 14 Jan 2016 we store dimensionless twopf objects k^3 * 2pf in the database
-                // so these will require conversion
-                const std::vector<number> twopf_k1 = z_handle.lookup_tag(k1_tag);
-                const std::vector<number> twopf_k2 = z_handle.lookup_tag(k2_tag);
-                const std::vector<number> twopf_k3 = z_handle.lookup_tag(k3_tag);
+            twopf_kconfig k1;
+            twopf_kconfig k2;
+            twopf_kconfig k3;
 
-                // compute shape functions for template
-                std::vector<number> S_bispectrum;
-                std::vector<number> S_template;
-                this->shape_function(bispectrum, twopf_k1, twopf_k2, twopf_k3, S_bispectrum);
-                this->shape_function(h.type, *(h.work_list[i]), twopf_k1, twopf_k2, twopf_k3, S_template);
+            k1.serial         = h.work_list[i]->k1_serial;
+            k1.k_comoving     = h.work_list[i]->k1_comoving;
+            k1.k_conventional = h.work_list[i]->k1_conventional;
 
-                number measure = h.tk->measure(*(h.work_list[i]));
-                for(unsigned int j = 0; j < h.t_axis.size(); ++j)
-                  {
-                    BB[j] += measure * S_bispectrum[j] * S_bispectrum[j];
-                    BT[j] += measure * S_bispectrum[j] * S_template[j];
-                    TT[j] += measure * S_template[j]   * S_template[j];
-                  }
-              }
+            k2.serial         = h.work_list[i]->k2_serial;
+            k2.k_comoving     = h.work_list[i]->k2_comoving;
+            k2.k_conventional = h.work_list[i]->k2_conventional;
+
+            k3.serial         = h.work_list[i]->k3_serial;
+            k3.k_comoving     = h.work_list[i]->k3_comoving;
+            k3.k_conventional = h.work_list[i]->k3_conventional;
+
+            zeta_twopf_time_data_tag<number> k1_tag = h.pipe.new_zeta_twopf_time_data_tag(k1);
+            zeta_twopf_time_data_tag<number> k2_tag = h.pipe.new_zeta_twopf_time_data_tag(k2);
+            zeta_twopf_time_data_tag<number> k3_tag = h.pipe.new_zeta_twopf_time_data_tag(k3);
+
+            // as of 14 Jan 2016 we store dimensionless twopf objects k^3 * 2pf in the database
+            // so these will require conversion
+            const std::vector<number> twopf_k1 = z_handle.lookup_tag(k1_tag);
+            const std::vector<number> twopf_k2 = z_handle.lookup_tag(k2_tag);
+            const std::vector<number> twopf_k3 = z_handle.lookup_tag(k3_tag);
+
+            // compute shape functions for template
+            std::vector<number> S_bispectrum;
+            std::vector<number> S_template;
+            this->shape_function(bispectrum, twopf_k1, twopf_k2, twopf_k3, S_bispectrum);
+            this->shape_function(h.type, *(h.work_list[i]), twopf_k1, twopf_k2, twopf_k3, S_template);
+
+            S_bispectrum_batch.assign_row(r, S_bispectrum);
+            S_template_batch.assign_row(r, S_template);
           }
 
 
@@ -35,6 +35,8 @@
 // need data_manager for datapipe
 #include "transport-runtime/data/data_manager.h"
 
+#include "transport-runtime/utilities/tensor_contraction.h"
+
 
 namespace transport
   {
@@ -93,6 +95,12 @@ namespace transport
                 //! cached gauge transformation coefficients
                 std::vector< std::vector<number> > dN;
 
+                //! cached gauge transformation coefficients, component-major
+                contraction::component_block<number> dN_block;
+
+                //! contraction engine, which owns scratch space for the tile currently being processed
+                contraction::contraction_engine<number> engine;
+
                 friend class zeta_timeseries_compute;
 
               };
@@ -133,6 +141,10 @@ namespace transport
             //! compute a time series for the zeta two-point function (don't copy gauge xfms)
             void twopf(handle& h, std::vector<number>& zeta_twopf, const twopf_kconfig& k) const;
 
+            //! pull all components of a twopf for all time samples, and contract its trailing index with dN;
+            //! the result has one row for each phase-space index
+            void contract_twopf(handle& h, cf_data_type type, unsigned int serial, contraction::component_block<number>& out) const;
+
           };
 
 
@@ -183,6 +195,8 @@ namespace transport
                 dN[j].resize(2*N_fields);
                 mdl->compute_gauge_xfm_1(tk, background[j], dN[j]);
               }
+
+            dN_block.assign_transposed(dN, 2*N_fields);
           }
 
 
@@ -198,32 +212,41 @@ namespace transport
 
 
         template <typename number>
-        void zeta_timeseries_compute<number>::twopf(typename zeta_timeseries_compute<number>::handle& h,
-                                                    std::vector<number>& zeta_twopf, const twopf_kconfig& k) const
+        void zeta_timeseries_compute<number>::contract_twopf(typename zeta_timeseries_compute<number>::handle& h,
+                                                             cf_data_type type, unsigned int serial,
+                                                             contraction::component_block<number>& out) const
           {
-            unsigned int N_fields = h.N_fields;
+            const unsigned int N = 2*h.N_fields;
 
-            zeta_twopf.clear();
-            zeta_twopf.assign(h.t_axis.size(), 0.0);
+            // gather every component into a single component-major block, so the contraction can run
+            // over all time samples at once; lines have to be copied because the linecache may evict them
+            contraction::component_block<number> sigma(N*N, h.t_axis.size());
 
-            // compute zeta twopf
-            for(unsigned int m = 0; m < 2*N_fields; ++m)
+            for(unsigned int m = 0; m < N; ++m)
               {
-                for(unsigned int n = 0; n < 2*N_fields; ++n)
+                for(unsigned int n = 0; n < N; ++n)
                   {
-                    cf_time_data_tag<number> tag =
-                                               h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_re, h.mdl->flatten(m,n), k.serial);
-
-                    // pull twopf data for this component; can use a reference to avoid copying
-                    const std::vector<number>& sigma_line = h.t_handle.lookup_tag(tag);
-
-                    for(unsigned int j = 0; j < h.t_axis.size(); ++j)
-                      {
-                        number component = h.dN[j][m]*h.dN[j][n]*sigma_line[j];
-                        zeta_twopf[j] += component;
-                      }
+                    cf_time_data_tag<number> tag = h.pipe.new_cf_time_data_tag(type, h.mdl->flatten(m,n), serial);
+                    sigma.assign_row(m*N + n, h.t_handle.lookup_tag(tag));
                   }
               }
+
+            h.engine.contract_trailing(sigma, h.dN_block, out);
+          }
+
+
+        template <typename number>
+        void zeta_timeseries_compute<number>::twopf(typename zeta_timeseries_compute<number>::handle& h,
+                                                    std::vector<number>& zeta_twopf, const twopf_kconfig& k) const
+          {
+            zeta_twopf.clear();
+            zeta_twopf.assign(h.t_axis.size(), 0.0);
+
+            // zeta twopf = N_m N_n sigma_mn = N_m (sigma_mn N_n)
+            contraction::component_block<number> sigma_dN;
+            this->contract_twopf(h, cf_data_type::cf_twopf_re, k.serial, sigma_dN);
+
+            h.engine.contract_vector(sigma_dN, h.dN_block, 1.0, zeta_twopf.data());
           }
 
 
@@ -244,8 +267,6 @@ namespace transport
                                                       std::vector< std::vector<number> >& gauge_xfm2_123, std::vector< std::vector<number> >& gauge_xfm2_213,
                                                       std::vector< std::vector<number> >& gauge_xfm2_312, const threepf_kconfig& k) const
           {
-            unsigned int N_fields = h.N_fields;
-
             zeta_threepf.clear();
             zeta_threepf.assign(h.t_axis.size(), 0.0);
             redbsp.clear();
@@ -270,102 +291,74 @@ namespace transport
                 h.mdl->compute_gauge_xfm_2(h.tk, h.background[j], k3, k1, k2, h.t_axis[j].t, gauge_xfm2_312[j]);
               }
 
-            // linear component of the gauge transformation
-            for(unsigned int l = 0; l < 2*N_fields; ++l)
-              {
-                for(unsigned int m = 0; m < 2*N_fields; ++m)
-                  {
-                    for(unsigned int n = 0; n < 2*N_fields; ++n)
-                      {
-                        // pull threepf data for this component
-                        cf_time_data_tag<number> tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_threepf_Nderiv, h.mdl->flatten(l,m,n), k.serial);
-
-                        const std::vector<number>& threepf_line = h.t_handle.lookup_tag(tag);
+            const unsigned int N = 2*h.N_fields;
+            const unsigned int T = h.t_axis.size();
 
-                        for(unsigned int j = 0; j < h.t_axis.size(); ++j)
-                          {
-                            number component = h.dN[j][l]*h.dN[j][m]*h.dN[j][n] * threepf_line[j];
-                            zeta_threepf[j] += component;
-                          }
-                      }
-                  }
-              }
+            // linear component of the gauge transformation, N_l N_m N_n B_lmn
+            // the threepf is processed one slab of fixed l at a time, which bounds the working set
+            // to (2N)^2 lines rather than (2N)^3
+            contraction::component_block<number> slab(N*N, T);
+            contraction::component_block<number> B_dN_dN(N, T);
 
-            // quadratic component of the gauge transformation
-            for(unsigned int l = 0; l < 2*N_fields; ++l)
+            for(unsigned int l = 0; l < N; ++l)
               {
-                for(unsigned int m = 0; m < 2*N_fields; ++m)
+                for(unsigned int m = 0; m < N; ++m)
                   {
-                    for(unsigned int p = 0; p < 2*N_fields; ++p)
+                    for(unsigned int n = 0; n < N; ++n)
                       {
-                        for(unsigned int q = 0; q < 2*N_fields; ++q)
-                          {
-                            // the indices are N_lm, N_p, N_q, so the 2pfs we sum over are
-                            // sigma_lp(k2)*sigma_mq(k3) etc.
-
-                            cf_time_data_tag<number> k1_re_lp_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_re, h.mdl->flatten(l,p), k.k1_serial);
-                            cf_time_data_tag<number> k1_im_lp_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_im, h.mdl->flatten(l,p), k.k1_serial);
-
-                            cf_time_data_tag<number> k2_re_lp_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_re, h.mdl->flatten(l,p), k.k2_serial);
-                            cf_time_data_tag<number> k2_im_lp_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_im, h.mdl->flatten(l,p), k.k2_serial);
-
-                            cf_time_data_tag<number> k2_re_mq_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_re, h.mdl->flatten(m,q), k.k2_serial);
-                            cf_time_data_tag<number> k2_im_mq_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_im, h.mdl->flatten(m,q), k.k2_serial);
-
-                            cf_time_data_tag<number> k3_re_mq_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_re, h.mdl->flatten(m,q), k.k3_serial);
-                            cf_time_data_tag<number> k3_im_mq_tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_twopf_im, h.mdl->flatten(m,q), k.k3_serial);
-
-                            // can only take reference for the last lookup, because previous items may be evicted
-                            const std::vector<number>  k1_re_lp = h.t_handle.lookup_tag(k1_re_lp_tag);
-                            const std::vector<number>  k1_im_lp = h.t_handle.lookup_tag(k1_im_lp_tag);
-                            const std::vector<number>  k2_re_lp = h.t_handle.lookup_tag(k2_re_lp_tag);
-                            const std::vector<number>  k2_im_lp = h.t_handle.lookup_tag(k2_im_lp_tag);
-                            const std::vector<number>  k2_re_mq = h.t_handle.lookup_tag(k2_re_mq_tag);
-                            const std::vector<number>  k2_im_mq = h.t_handle.lookup_tag(k2_im_mq_tag);
-                            const std::vector<number>  k3_re_mq = h.t_handle.lookup_tag(k3_re_mq_tag);
-                            const std::vector<number>& k3_im_mq = h.t_handle.lookup_tag(k3_im_mq_tag);
-
-                            // as of 14 Jan 2016 the database stores dimensionless quantities k^3 * 2pf, (k1 k2 k3) * 3pf
-                            // this means we need some dimensionless factors k1k2, k1k3, k2k3 to convert between the different normalization conventions
-
-                            for(unsigned int j = 0; j < h.t_axis.size(); ++j)
-                              {
-                                number component1 = gauge_xfm2_123[j][h.mdl->flatten(l,m)] * h.dN[j][p] * h.dN[j][q] * k2k3 * (k2_re_lp[j]*k3_re_mq[j] - k2_im_lp[j]*k3_im_mq[j]);
-                                number component2 = gauge_xfm2_213[j][h.mdl->flatten(l,m)] * h.dN[j][p] * h.dN[j][q] * k1k3 * (k1_re_lp[j]*k3_re_mq[j] - k1_im_lp[j]*k3_im_mq[j]);
-                                number component3 = gauge_xfm2_312[j][h.mdl->flatten(l,m)] * h.dN[j][p] * h.dN[j][q] * k1k2 * (k1_re_lp[j]*k2_re_mq[j] - k1_im_lp[j]*k2_im_mq[j]);
-
-                                zeta_threepf[j] += component1;
-                                zeta_threepf[j] += component2;
-                                zeta_threepf[j] += component3;
-                              }
-                          }
+                        cf_time_data_tag<number> tag = h.pipe.new_cf_time_data_tag(cf_data_type::cf_threepf_Nderiv, h.mdl->flatten(l,m,n), k.serial);
+                        slab.assign_row(m*N + n, h.t_handle.lookup_tag(tag));
                       }
                   }
+
+                std::fill(B_dN_dN.row(l), B_dN_dN.row(l) + T, number(0));
+                h.engine.contract_bilinear(slab, h.dN_block, h.dN_block, 1.0, B_dN_dN.row(l));
               }
 
-            // compute reduced bispectrum
-            std::vector<number> twopf_k1;
-            std::vector<number> twopf_k2;
-            std::vector<number> twopf_k3;
-
-            twopf_kconfig k1_config;
-            k1_config.serial         = k.k1_serial;
-            k1_config.k_comoving     = k.k1_comoving;
-            k1_config.k_conventional = k.k1_conventional;
-
-            twopf_kconfig k2_config;
-            k2_config.serial         = k.k2_serial;
-            k2_config.k_comoving     = k.k2_comoving;
-            k2_config.k_conventional = k.k2_conventional;
-
-            twopf_kconfig k3_config;
-            k3_config.serial         = k.k3_serial;
-            k3_config.k_comoving     = k.k3_comoving;
-            k3_config.k_conventional = k.k3_conventional;
-
-            this->twopf(h, twopf_k1, k1_config);
-            this->twopf(h, twopf_k2, k2_config);
-            this->twopf(h, twopf_k3, k3_config);
+            h.engine.contract_vector(B_dN_dN, h.dN_block, 1.0, zeta_threepf.data());
+
+            // quadratic component of the gauge transformation, N_lm N_p N_q sigma_lp(k_i) sigma_mq(k_j)
+            // this factorizes as N_lm (sigma_lp N_p)(sigma_mq N_q), so we contract each twopf with N first,
+            // reducing the cost from (2N)^4 to (2N)^2 operations per time sample
+            contraction::component_block<number> k1_re;
+            contraction::component_block<number> k1_im;
+            contraction::component_block<number> k2_re;
+            contraction::component_block<number> k2_im;
+            contraction::component_block<number> k3_re;
+            contraction::component_block<number> k3_im;
+
+            this->contract_twopf(h, cf_data_type::cf_twopf_re, k.k1_serial, k1_re);
+            this->contract_twopf(h, cf_data_type::cf_twopf_im, k.k1_serial, k1_im);
+            this->contract_twopf(h, cf_data_type::cf_twopf_re, k.k2_serial, k2_re);
+            this->contract_twopf(h, cf_data_type::cf_twopf_im, k.k2_serial, k2_im);
+            this->contract_twopf(h, cf_data_type::cf_twopf_re, k.k3_serial, k3_re);
+            this->contract_twopf(h, cf_data_type::cf_twopf_im, k.k3_serial, k3_im);
+
+            contraction::component_block<number> xfm2_123;
+            contraction::component_block<number> xfm2_213;
+            contraction::component_block<number> xfm2_312;
+
+            xfm2_123.assign_transposed(gauge_xfm2_123, N*N);
+            xfm2_213.assign_transposed(gauge_xfm2_213, N*N);
+            xfm2_312.assign_transposed(gauge_xfm2_312, N*N);
+
+            // as of 14 Jan 2016 the database stores dimensionless quantities k^3 * 2pf, (k1 k2 k3) * 3pf
+            // this means we need some dimensionless factors k1k2, k1k3, k2k3 to convert between the different normalization conventions
+            h.engine.contract_bilinear(xfm2_123, k2_re, k3_re,  k2k3, zeta_threepf.data());
+            h.engine.contract_bilinear(xfm2_123, k2_im, k3_im, -k2k3, zeta_threepf.data());
+            h.engine.contract_bilinear(xfm2_213, k1_re, k3_re,  k1k3, zeta_threepf.data());
+            h.engine.contract_bilinear(xfm2_213, k1_im, k3_im, -k1k3, zeta_threepf.data());
+            h.engine.contract_bilinear(xfm2_312, k1_re, k2_re,  k1k2, zeta_threepf.data());
+            h.engine.contract_bilinear(xfm2_312, k1_im, k2_im, -k1k2, zeta_threepf.data());
+
+            // compute reduced bispectrum; the zeta twopfs are N_m (sigma_mn N_n), which we already have
+            std::vector<number> twopf_k1(T, 0.0);
+            std::vector<number> twopf_k2(T, 0.0);
+            std::vector<number> twopf_k3(T, 0.0);
+
+            h.engine.contract_vector(k1_re, h.dN_block, 1.0, twopf_k1.data());
+            h.engine.contract_vector(k2_re, h.dN_block, 1.0, twopf_k2.data());
+            h.engine.contract_vector(k3_re, h.dN_block, 1.0, twopf_k3.data());
 
             // build the reduced bispectrum
             for(unsigned int j = 0; j < h.t_axis.size(); ++j)
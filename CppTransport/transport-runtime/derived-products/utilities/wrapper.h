@@ -100,7 +100,7 @@ namespace transport
 			    };
 
 
-		    void wrapped_output::wrap_out(std::ostream& out, const std::string& text)
+		    inline void wrapped_output::wrap_out(std::ostream& out, const std::string& text)
 			    {
 		        if(this->cpos + text.length() >= this->wrap_width) this->wrap_newline(out);
 		        out << text;
@@ -108,7 +108,7 @@ namespace transport
 			    }
 
 
-		    void wrapped_output::wrap_list_item(std::ostream& out, bool value, const std::string& label, unsigned int& count)
+		    inline void wrapped_output::wrap_list_item(std::ostream& out, bool value, const std::string& label, unsigned int& count)
 			    {
 		        if(value)
 			        {
@@ -121,7 +121,7 @@ namespace transport
 			    }
 
 
-		    void wrapped_output::wrap_value(std::ostream& out, const std::string& value, const std::string& label, unsigned int& count)
+		    inline void wrapped_output::wrap_value(std::ostream& out, const std::string& value, const std::string& label, unsigned int& count)
 			    {
 		        if(count > 0) out << ", ";
 		        if(this->cpos + value.length() + label.length() + 5 >= this->wrap_width) this->wrap_newline(out);
@@ -131,7 +131,7 @@ namespace transport
 			    }
 
 
-				void wrapped_output::wrap_newline(std::ostream& out)
+				inline void wrapped_output::wrap_newline(std::ostream& out)
 					{
 				    out << '\n';
 
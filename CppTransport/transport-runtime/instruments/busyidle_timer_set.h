@@ -309,7 +309,7 @@ namespace transport
       };
     
     
-    void busyidle_timer_set::add_new_timer(const std::string& name)
+    inline void busyidle_timer_set::add_new_timer(const std::string& name)
       {
         std::unique_ptr<busyidle_timer> timer = std::make_unique<busyidle_timer>();
 
@@ -334,7 +334,7 @@ namespace transport
       }
     
     
-    void busyidle_timer_set::stop_timer(const std::string& name)
+    inline void busyidle_timer_set::stop_timer(const std::string& name)
       {
         active_timer_db::iterator t = this->active_timers.find(name);
         if(t == this->active_timers.end())
@@ -351,7 +351,7 @@ namespace transport
       }
     
     
-    void busyidle_timer_set::busy()
+    inline void busyidle_timer_set::busy()
       {
         if(this->busy_mode) return;    // nothing to do
         
@@ -364,7 +364,7 @@ namespace transport
       }
     
     
-    void busyidle_timer_set::idle()
+    inline void busyidle_timer_set::idle()
       {
         if(!this->busy_mode) return;   // nothing to do
         
@@ -377,7 +377,7 @@ namespace transport
       }
     
     
-    boost::timer::nanosecond_type busyidle_timer_set::get_total_time(const std::string& name)
+    inline boost::timer::nanosecond_type busyidle_timer_set::get_total_time(const std::string& name)
       {
         timer_db::iterator t = this->timers.find(name);
         if(t == this->timers.end())
@@ -391,7 +391,7 @@ namespace transport
       }
     
     
-    boost::timer::nanosecond_type busyidle_timer_set::get_busy_time(const std::string& name)
+    inline boost::timer::nanosecond_type busyidle_timer_set::get_busy_time(const std::string& name)
       {
         timer_db::iterator t = this->timers.find(name);
         if(t == this->timers.end())
@@ -405,7 +405,7 @@ namespace transport
       }
     
     
-    boost::timer::nanosecond_type busyidle_timer_set::get_idle_time(const std::string& name)
+    inline boost::timer::nanosecond_type busyidle_timer_set::get_idle_time(const std::string& name)
       {
         timer_db::iterator t = this->timers.find(name);
         if(t == this->timers.end())
@@ -419,7 +419,7 @@ namespace transport
       }
     
     
-    double busyidle_timer_set::get_load_average(const std::string& name)
+    inline double busyidle_timer_set::get_load_average(const std::string& name)
       {
         timer_db::iterator t = this->timers.find(name);
         if(t == this->timers.end())
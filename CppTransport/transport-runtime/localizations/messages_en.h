@@ -48,6 +48,7 @@
 #include "transport-runtime/localizations/messages_en/tasks/tasks.h"
 #include "transport-runtime/localizations/messages_en/tasks/twopf_config_database.h"
 #include "transport-runtime/localizations/messages_en/tasks/threepf_config_database.h"
+#include "transport-runtime/localizations/messages_en/tasks/kconfig_database_image.h"
 
 #include "transport-runtime/localizations/messages_en/manager.h"
 #include "transport-runtime/localizations/messages_en/data_manager.h"
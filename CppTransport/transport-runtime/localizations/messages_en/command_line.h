@@ -50,6 +50,9 @@
 #define CPPTRANSPORT_SWITCH_INCLUDE_LONG      "include"
 #define CPPTRANSPORT_HELP_INCLUDE             "add specified path to search list"
 
+#define CPPTRANSPORT_SWITCH_PLUGIN_PATH       "plugins"
+#define CPPTRANSPORT_HELP_PLUGIN_PATH         "add specified path to model plugin search list"
+
 #define CPPTRANSPORT_SWITCH_NETWORK_MODE      "network-mode"
 #define CPPTRANSPORT_HELP_NETWORK_MODE        "must be set if repository is on a network filing system (NFS, Lustre)"
 
@@ -81,6 +84,30 @@
 #define CPPTRANSPORT_SWITCH_CHECKPOINT        "checkpoint"
 #define CPPTRANSPORT_HELP_CHECKPOINT          "commit data after given interval, measured in minutes (default off)"
 
+#define CPPTRANSPORT_SWITCH_PREFETCH          "prefetch"
+#define CPPTRANSPORT_HELP_PREFETCH            "number of work assignments queued on each worker (default 2; 1 disables prefetching)"
+
+#define CPPTRANSPORT_SWITCH_GROUP_SIZE        "group-size"
+#define CPPTRANSPORT_HELP_GROUP_SIZE          "divide workers into groups of given size, each coordinated by a group leader (default off)"
+
+#define CPPTRANSPORT_SWITCH_BATCH_THREADS     "batch-threads"
+#define CPPTRANSPORT_HELP_BATCH_THREADS       "number of threads used by each worker to evaluate model tensors for derived content (default 1)"
+
+#define CPPTRANSPORT_SWITCH_NO_FUSION         "no-fusion"
+#define CPPTRANSPORT_HELP_NO_FUSION           "do not fuse zeta tasks with a parent integration scheduled immediately before them"
+
+#define CPPTRANSPORT_SWITCH_LAYOUT            "layout"
+#define CPPTRANSPORT_HELP_LAYOUT              "layout of finalized containers: indexed (default), composite, or clustered"
+
+#define CPPTRANSPORT_SWITCH_CODEC             "codec"
+#define CPPTRANSPORT_HELP_CODEC               "encoding of stored correlation-function values in finalized containers: none (default) or xor"
+
+#define CPPTRANSPORT_SWITCH_AUTOTUNE          "autotune"
+#define CPPTRANSPORT_HELP_AUTOTUNE            "benchmark candidate steppers for the specified integration tasks against the given relative accuracy target, instead of running them"
+
+#define CPPTRANSPORT_SWITCH_TUNE_SAMPLE       "autotune-sample"
+#define CPPTRANSPORT_HELP_TUNE_SAMPLE         "number of k-configurations sampled when autotuning (default 8)"
+
 #define CPPTRANSPORT_SWITCH_RECOVER           "recover"
 #define CPPTRANSPORT_HELP_RECOVER             "attempt to recover crashed tasks or jobs"
 
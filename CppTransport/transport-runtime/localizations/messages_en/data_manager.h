@@ -50,6 +50,8 @@
 #define CPPTRANSPORT_DATACTR_STATS_INSERT_FAIL                   "Data container error: Failed to create per-configuration statistics table in data container (backend code="
 #define CPPTRANSPORT_DATACTR_ICS_INSERT_FAIL                     "Data container error: Failed to create initial conditions table in data container (backend code="
 #define CPPTRANSPORT_DATACTR_WORKER_INSERT_FAIL                  "Data container error: Failed to create worker information table in data container (backend code="
+#define CPPTRANSPORT_DATACTR_CHECKPOINT_INSERT_FAIL              "Data container error: Failed to write checkpoint for in-flight configuration (backend code="
+#define CPPTRANSPORT_DATACTR_CHECKPOINT_STATE_SIZE               "Data container error: Checkpoint state has unexpected size for configuration"
 #define CPPTRANSPORT_DATACTR_BACKG_DATATAB_FAIL                  "Data container error: Failed to create background-value table in data container (backend code="
 #define CPPTRANSPORT_DATACTR_TWOPF_DATATAB_FAIL                  "Data container error: Failed to create twopf-value table in data container (backend code="
 #define CPPTRANSPORT_DATACTR_TENSOR_TWOPF_DATATAB_FAIL           "Data container error: Failed to creata tensor twopf-value table in data container (backend code="
@@ -98,8 +100,13 @@
 #define CPPTRANSPORT_DATAMGR_KCONFIG_SERIAL_READ_FAIL            "Data manager error: Failed to select k-configuration sample (backend code="
 #define CPPTRANSPORT_DATAMGR_WORKER_TABLE_READ_FAIL              "Data manager error: Failed to read worker information table (backend code="
 #define CPPTRANSPORT_DATAMGR_STATISTICS_TABLE_READ_FAIL          "Data manager error: Failed to read statistics information table (backend code="
+#define CPPTRANSPORT_DATAMGR_CHECKPOINT_TABLE_READ_FAIL          "Data manager error: Failed to read checkpoint table (backend code="
 
 #define CPPTRANSPORT_DATAMGR_INTEGRITY_READ_FAIL                 "Data manager error: Failure while performing integrity check (backend code="
+#define CPPTRANSPORT_DATAMGR_LAYOUT_READ_FAIL                    "Data manager error: Failure while inspecting table layout during finalization (backend code="
+#define CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL                    "Data manager error: Failure while encoding value table during finalization (backend code="
+#define CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL                     "Data manager error: Failed to read encoded value block (backend code="
+#define CPPTRANSPORT_DATAMGR_CODEC_CORRUPT                       "Data manager error: Encoded value block is damaged or has an unknown format in table"
 
 
 #endif // CPPTRANSPORT_MESSAGES_EN_DATA_MANAGER_H
@@ -33,5 +33,19 @@
 #define CPPTRANSPORT_INSTANCES_MISSING_A   "No registered instance of model with uid"
 #define CPPTRANSPORT_INSTANCES_MISSING_B   "and minimum revision number"
 
+#define CPPTRANSPORT_PLUGIN_OPEN_FAIL       "Could not load model plugin"
+#define CPPTRANSPORT_PLUGIN_SYMBOL_MISSING  "Model plugin does not export required symbol"
+#define CPPTRANSPORT_PLUGIN_IN              "in"
+#define CPPTRANSPORT_PLUGIN_API_A           "Model plugin"
+#define CPPTRANSPORT_PLUGIN_API_B           "was built against runtime API"
+#define CPPTRANSPORT_PLUGIN_API_C           "but this runtime provides API"
+#define CPPTRANSPORT_PLUGIN_NUMBER_TYPE     "was built for a different number type and cannot be used by this runtime"
+#define CPPTRANSPORT_PLUGIN_ABI_A           "was built with a different compiler, runtime installation or configuration (ABI hash"
+#define CPPTRANSPORT_PLUGIN_ABI_B           "expected"
+#define CPPTRANSPORT_PLUGIN_UID_A           "provides model with uid"
+#define CPPTRANSPORT_PLUGIN_UID_B           "but was located when searching for uid"
+#define CPPTRANSPORT_PLUGIN_CREATE_FAIL     "failed to construct its model"
+#define CPPTRANSPORT_PLUGIN_LOADED          "loaded from plugin"
+
 
 #endif // CPPTRANSPORT_MESSAGES_EN_MODEL_MANAGER_H
@@ -38,6 +38,8 @@
 #define CPPTRANSPORT_WRONG_P_LATEX_NAMES_B "] does not match expected number of parameters [= "
 #define CPPTRANSPORT_WRONG_PARAMS_A        "Error: supplied number of parameters [= "
 #define CPPTRANSPORT_WRONG_PARAMS_B        "] does not match expected number [= "
+#define CPPTRANSPORT_SPECIALIZED_PARAMS_A  "Error: this model variant was specialized to parameter value "
+#define CPPTRANSPORT_SPECIALIZED_PARAMS_B  ", but was supplied with value "
 
 #define CPPTRANSPORT_WRONG_ICS_A           "Error: supplied number of initial conditions [= "
 #define CPPTRANSPORT_WRONG_COORDS_A        "Error: supplied number of phase-space coordinates [= "
@@ -71,4 +73,23 @@
 
 #define CPPTRANSPORT_INTEGRATOR_NAN_OR_INF "Integration error: encountered NaN or infinity"
 
+#define CPPTRANSPORT_CHECKPOINT_MISMATCH   "Integration error: checkpoint is incomplete or does not match this configuration"
+#define CPPTRANSPORT_RESUME_CONFIG         "Resuming configuration"
+#define CPPTRANSPORT_RESUME_FROM_SAMPLE    "from checkpoint at sample"
+
+#define CPPTRANSPORT_AUTOTUNE_UNKNOWN_STEPPER "Autotuning error: unknown or implicit stepper cannot be selected at runtime"
+
+#define CPPTRANSPORT_AUTODIFF_CHECK_FAILED_A "Automatic differentiation error: relative discrepancy from symbolic derivatives of the potential [= "
+#define CPPTRANSPORT_AUTODIFF_CHECK_FAILED_B "] exceeds tolerance [= "
+
+#define CPPTRANSPORT_KERNEL_VARIANT_FIXED    "fixed"
+#define CPPTRANSPORT_KERNEL_VARIANT_UNROLLED "unrolled"
+#define CPPTRANSPORT_KERNEL_VARIANT_ROLLED   "rolled"
+#define CPPTRANSPORT_KERNEL_VARIANT_UNKNOWN  "Internal error: unknown kernel variant"
+#define CPPTRANSPORT_KERNEL_UNCALIBRATED     "uncalibrated"
+#define CPPTRANSPORT_KERNEL_TWOPF            "twopf"
+#define CPPTRANSPORT_KERNEL_THREEPF          "threepf"
+#define CPPTRANSPORT_KERNEL_CALIBRATION      "Kernel calibration"
+#define CPPTRANSPORT_KERNEL_SELECTED         "selected"
+
 #endif // CPPTRANSPORT_MESSAGES_EN_MODELS_H
@@ -28,6 +28,9 @@
 
 
 constexpr auto CPPTRANSPORT_FAILED_SERIALS_MISMATCH = "Internal error: list of failed serial numbers and reported failures do not agree";
+constexpr auto CPPTRANSPORT_SNAPSHOT_FAILED         = "Could not build task snapshot; workers will read the task from the repository";
+constexpr auto CPPTRANSPORT_GROUP_NOT_MEMBER        = "Internal error: group leader received a message from a worker outside its group";
+constexpr auto CPPTRANSPORT_GROUP_NO_ASSIGNMENT     = "Internal error: group leader received a completion report from a worker with no outstanding assignment";
 
 
 #endif //CPPTRANSPORT_MESSAGES_EN_MPI_H
@@ -33,6 +33,9 @@
 
 #define CPPTRANSPORT_REPO_FAIL_INTEGRATION_TASK_TYPE        "Repository error: unknown integration task type"
 
+#define CPPTRANSPORT_REPO_SNAPSHOT_READ_FAIL                "Repository error: could not read record while building snapshot for task"
+#define CPPTRANSPORT_REPO_SNAPSHOT_TRANSACTION              "Repository error: cannot install a task snapshot while a transaction is in progress"
+
 #define CPPTRANSPORT_REPO_DATABASES_OPEN                    "Repository error: SQLite database handles unexpectedly open"
 #define CPPTRANSPORT_REPO_DATABASES_CLOSED                  "Repository error: SQLite database handles unexpectedly closed"
 #define CPPTRANSPORT_REPO_DATABASES_NOT_OPEN                "Repository error: SQLite database handles closed, but should be open"
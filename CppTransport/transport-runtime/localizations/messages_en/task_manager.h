@@ -52,6 +52,24 @@
 #define CPPTRANSPORT_SEED_GROUP_MISMATCHED_SERIALS_B "and"
 #define CPPTRANSPORT_SEED_GROUP_MISMATCHED_SERIALS_C "do not have the same missing k-configurations and cannot be used to seed a paired integration"
 
+#define CPPTRANSPORT_FUSED_TASKS_A                   "Fusing task"
+#define CPPTRANSPORT_FUSED_TASKS_B                   "with parent integration"
+
+#define CPPTRANSPORT_AUTOTUNE_TASK_A                 "Autotuning steppers for task"
+#define CPPTRANSPORT_AUTOTUNE_TASK_B                 "using"
+#define CPPTRANSPORT_AUTOTUNE_TASK_C                 "k-configurations and relative accuracy target"
+#define CPPTRANSPORT_AUTOTUNE_SKIP                   "Autotuning applies only to integration tasks; skipping task"
+#define CPPTRANSPORT_AUTOTUNE_UNSUPPORTED            "Compute backend does not support runtime stepper selection; cannot autotune task"
+#define CPPTRANSPORT_AUTOTUNE_NO_REFERENCE           "Could not compute reference solution; cannot autotune task"
+#define CPPTRANSPORT_AUTOTUNE_CANDIDATE              "candidate"
+#define CPPTRANSPORT_AUTOTUNE_TOLERANCE              "tolerance"
+#define CPPTRANSPORT_AUTOTUNE_TIME                   "time"
+#define CPPTRANSPORT_AUTOTUNE_ERROR                  "max relative error"
+#define CPPTRANSPORT_AUTOTUNE_FAILED                 "failed"
+#define CPPTRANSPORT_AUTOTUNE_CURRENT                "Stepper currently used by model:"
+#define CPPTRANSPORT_AUTOTUNE_RECOMMEND              "Fastest stepper meeting accuracy target:"
+#define CPPTRANSPORT_AUTOTUNE_NONE                   "No candidate stepper met the accuracy target for task"
+
 #define CPPTRANSPORT_PROCESSING_GANTT_CHART          "generating process Gantt chart"
 #define CPPTRANSPORT_PROCESSING_ACTIVITY_JOURNAL     "generating activity journal"
 
@@ -64,6 +82,8 @@
 #define CPPTRANSPORT_UNKNOWN_REPORT_INTERVAL         "Ignored unrecognized report interval"
 #define CPPTRANSPORT_UNKNOWN_REPORT_DELAY            "Ignored unrecognized report time delay"
 #define CPPTRANSPORT_UNKNOWN_CHECKPOINT_INTERVAL     "Ignored unrecognized checkpoint interval"
+#define CPPTRANSPORT_UNKNOWN_CONTAINER_LAYOUT        "Ignored unknown container layout"
+#define CPPTRANSPORT_UNKNOWN_STORAGE_CODEC           "Ignored unknown storage codec"
 #define CPPTRANSPORT_UNKNOWN_REPORT_FLAGS            "Ignored unrecognized email reporting flags"
 
 #define CPPTRANSPORT_MASTER_REPORTED_BY_WORKER       "reported by worker"
@@ -30,6 +30,7 @@
 
 #define CPPTRANSPORT_THREEPF_DATABASE_WRITE_FAIL   "Internal error: failed to write threepf k-configuration database (backend code="
 #define CPPTRANSPORT_THREEPF_DATABASE_READ_FAIL    "Internal error: failed to read threepf k-configuration database (backend code="
+#define CPPTRANSPORT_THREEPF_DATABASE_IMAGE_MISS   "Internal error: k-configuration database image is missing a twopf wavenumber for threepf configuration"
 
 
 #endif //CPPTRANSPORT_THREEPF_CONFIG_DATABASE_MESSAGES_H
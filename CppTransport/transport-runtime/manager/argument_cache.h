@@ -62,6 +62,21 @@ namespace transport
         PDF
       };
 
+    //! storage layout applied to value tables when a data container is finalized
+    enum class container_layout
+      {
+        indexed,      // single-column indices on tserial and kserial
+        composite,    // composite indices matching the (serial, page, serial) access paths
+        clustered     // WITHOUT ROWID tables clustered on (kserial, page, tserial)
+      };
+
+    //! encoding applied to stored values when a data container is finalized
+    enum class storage_codec
+      {
+        none,         // values stored as one DOUBLE per column
+        xor_delta     // time series for each (kserial, page) stored as a single XOR-delta encoded block
+      };
+
 
     class argument_cache
 	    {
@@ -155,6 +170,55 @@ namespace transport
         unsigned int get_checkpoint_interval() const              { return(this->checkpoint_interval); }
 
 
+        // SCHEDULING
+
+      public:
+
+        //! Set number of work assignments which may be outstanding on each worker
+        void set_prefetch_depth(unsigned int d)                   { this->prefetch_depth = d; }
+
+        //! Get number of work assignments which may be outstanding on each worker
+        unsigned int get_prefetch_depth() const                   { return(this->prefetch_depth); }
+
+        //! Set number of workers coordinated by each group leader; 0 disables group leaders
+        void set_group_size(unsigned int g)                       { this->group_size = g; }
+
+        //! Get number of workers coordinated by each group leader
+        unsigned int get_group_size() const                       { return(this->group_size); }
+
+        //! Set number of threads used by each worker for batched evaluation of model tensors
+        void set_batch_threads(unsigned int t)                    { this->batch_threads = t; }
+
+        //! Get number of threads used by each worker for batched evaluation of model tensors
+        unsigned int get_batch_threads() const                    { return(this->batch_threads); }
+
+        //! Set whether postintegration tasks may be fused with a parent integration scheduled immediately before them
+        void set_postintegration_fusion(bool f)                   { this->fuse_postintegration = f; }
+
+        //! Get whether postintegration tasks may be fused with their parent integration
+        bool get_postintegration_fusion() const                   { return(this->fuse_postintegration); }
+
+
+        // AUTOTUNING
+
+      public:
+
+        //! Enable autotuning mode with a given relative accuracy target
+        void set_autotune(double t)                               { this->autotune = true; this->autotune_target = t; }
+
+        //! Get autotuning mode status
+        bool get_autotune() const                                 { return(this->autotune); }
+
+        //! Get autotuning accuracy target
+        double get_autotune_target() const                        { return(this->autotune_target); }
+
+        //! Set number of k-configurations sampled when autotuning
+        void set_autotune_sample(unsigned int n)                  { this->autotune_sample = n; }
+
+        //! Get number of k-configurations sampled when autotuning
+        unsigned int get_autotune_sample() const                  { return(this->autotune_sample); }
+
+
         // CACHE CAPACITIES
 
       public:
@@ -172,6 +236,23 @@ namespace transport
         size_t get_datapipe_capacity() const                      { return(this->pipe_capacity); }
 
 
+        // CONTAINER STORAGE
+
+      public:
+
+        //! Set layout of finalized containers; returns true if layout was recognized or false if it was not
+        bool set_container_layout(std::string l);
+
+        //! Get layout of finalized containers
+        container_layout get_container_layout() const             { return(this->layout); }
+
+        //! Set encoding of stored values in finalized containers; returns true if codec was recognized or false if it was not
+        bool set_storage_codec(std::string c);
+
+        //! Get encoding of stored values in finalized containers
+        storage_codec get_storage_codec() const                   { return(this->codec); }
+
+
         // MPI VISUALIZATION OPTIONS
 
       public:
@@ -268,6 +349,13 @@ namespace transport
 
         //! get search paths
         const std::list< boost::filesystem::path > get_search_paths();
+
+        //! set model plugin search paths
+        template <typename Container>
+        void set_plugin_paths(const Container& path_set);
+
+        //! get model plugin search paths
+        const std::list< boost::filesystem::path > get_plugin_paths() const;
         
         
         // UTILITY FUNCTIONS
@@ -329,9 +417,36 @@ namespace transport
         //! Data cache capacity per datapipe
         size_t pipe_capacity;
 
+        //! layout of finalized containers
+        container_layout layout;
+
+        //! encoding of stored values in finalized containers
+        storage_codec codec;
+
         //! checkpoint interval in seconds. Zero indicates that checkpointing is disabled
         unsigned int checkpoint_interval;
 
+        //! number of work assignments which may be outstanding on each worker
+        unsigned int prefetch_depth;
+
+        //! number of workers coordinated by each group leader; 0 indicates a flat topology
+        unsigned int group_size;
+
+        //! number of threads used by each worker for batched evaluation of model tensors
+        unsigned int batch_threads;
+
+        //! fuse postintegration tasks with a parent integration scheduled immediately before them?
+        bool fuse_postintegration;
+
+        //! benchmark steppers rather than running integration tasks?
+        bool autotune;
+
+        //! relative accuracy target for autotuning
+        double autotune_target;
+
+        //! number of k-configurations sampled when autotuning
+        unsigned int autotune_sample;
+
         //! plotting environment
         plot_style plot_env;
 
@@ -341,6 +456,9 @@ namespace transport
         //! search paths for assets, eg. jQuery, bootstrap ...
         //! have to use std::string internally since boost::filesystem::path won't serialize
         std::list< std::string > search_paths;
+
+        //! search paths for runtime-loadable model plugins
+        std::list< std::string > plugin_paths;
         
         //! percentage interval between updates
         unsigned int report_percent_interval;
@@ -384,10 +502,20 @@ namespace transport
             ar & commit_failed;
             ar & batcher_capacity;
             ar & pipe_capacity;
+            ar & layout;
+            ar & codec;
             ar & checkpoint_interval;
+            ar & prefetch_depth;
+            ar & group_size;
+            ar & batch_threads;
+            ar & fuse_postintegration;
+            ar & autotune;
+            ar & autotune_target;
+            ar & autotune_sample;
             ar & plot_env;
             ar & mpl_backend;
             ar & search_paths;
+            ar & plugin_paths;
             ar & report_percent_interval;
             ar & report_time_interval;
             ar & report_time_delay;
@@ -400,7 +528,7 @@ namespace transport
 	    };
 
 
-    argument_cache::argument_cache()
+    inline argument_cache::argument_cache()
 	    : gantt_chart(false),
         journal(false),
 	      verbose(false),
@@ -414,7 +542,16 @@ namespace transport
         commit_failed(true),
         batcher_capacity(CPPTRANSPORT_DEFAULT_BATCHER_STORAGE),
         pipe_capacity(CPPTRANSPORT_DEFAULT_PIPE_STORAGE),
+        layout(container_layout::indexed),
+        codec(storage_codec::none),
         checkpoint_interval(CPPTRANSPORT_DEFAULT_CHECKPOINT_INTERVAL),
+        prefetch_depth(CPPTRANSPORT_DEFAULT_SCHEDULING_LOOKAHEAD),
+        group_size(CPPTRANSPORT_DEFAULT_GROUP_SIZE),
+        batch_threads(CPPTRANSPORT_DEFAULT_BATCH_THREADS),
+        fuse_postintegration(true),
+        autotune(false),
+        autotune_target(0.0),
+        autotune_sample(CPPTRANSPORT_DEFAULT_AUTOTUNE_SAMPLE),
         plot_env(plot_style::raw_matplotlib),
         mpl_backend(matplotlib_backend::unset),
         report_percent_interval(CPPTRANSPORT_DEFAULT_REPORT_PERCENT_INTERVAL),
@@ -427,7 +564,7 @@ namespace transport
 	    }
 
 
-    bool argument_cache::set_plot_environment(std::string e)
+    inline bool argument_cache::set_plot_environment(std::string e)
       {
         boost::algorithm::to_lower(e);
 
@@ -440,7 +577,7 @@ namespace transport
       }
 
 
-    bool argument_cache::set_matplotlib_backend(std::string e)
+    inline bool argument_cache::set_matplotlib_backend(std::string e)
       {
         boost::algorithm::to_lower(e);
 
@@ -453,6 +590,29 @@ namespace transport
       }
 
 
+    inline bool argument_cache::set_container_layout(std::string l)
+      {
+        boost::algorithm::to_lower(l);
+
+        if(l == "indexed")        { this->layout = container_layout::indexed; return true; }
+        else if(l == "composite") { this->layout = container_layout::composite; return true; }
+        else if(l == "clustered") { this->layout = container_layout::clustered; return true; }
+
+        return false;
+      }
+
+
+    inline bool argument_cache::set_storage_codec(std::string c)
+      {
+        boost::algorithm::to_lower(c);
+
+        if(c == "none")     { this->codec = storage_codec::none; return true; }
+        else if(c == "xor") { this->codec = storage_codec::xor_delta; return true; }
+
+        return false;
+      }
+
+
     template <typename Container>
     void argument_cache::set_search_paths(const Container& path_set)
       {
@@ -471,15 +631,41 @@ namespace transport
       }
 
 
-    const std::list<boost::filesystem::path> argument_cache::get_search_paths()
+    inline const std::list<boost::filesystem::path> argument_cache::get_search_paths()
       {
         std::list<boost::filesystem::path> list;
         std::copy(this->search_paths.cbegin(), this->search_paths.cend(), std::back_inserter(list));
         return list;
       }
+
+
+    template <typename Container>
+    void argument_cache::set_plugin_paths(const Container& path_set)
+      {
+        for(const std::string& path : path_set)
+          {
+            boost::filesystem::path p = path;
+
+            // if path is not absolute, make relative to current directory
+            if(!p.is_absolute())
+              {
+                p = boost::filesystem::absolute(p);
+              }
+
+            this->plugin_paths.emplace_back(p.string());
+          }
+      }
+
+
+    inline const std::list<boost::filesystem::path> argument_cache::get_plugin_paths() const
+      {
+        std::list<boost::filesystem::path> list;
+        std::copy(this->plugin_paths.cbegin(), this->plugin_paths.cend(), std::back_inserter(list));
+        return list;
+      }
     
     
-    bool argument_cache::set_report_percent_interval(unsigned int interval)
+    inline bool argument_cache::set_report_percent_interval(unsigned int interval)
       {
         if(interval >= 100) return false;
         
@@ -488,21 +674,21 @@ namespace transport
       }
     
     
-    bool argument_cache::set_report_time_interval(std::string interval)
+    inline bool argument_cache::set_report_time_interval(std::string interval)
       {
         // unit defaults to minutes if no interval is given
         return this->parse_time_interval(std::move(interval), this->report_time_interval);
       }
     
     
-    bool argument_cache::set_report_time_delay(std::string interval)
+    inline bool argument_cache::set_report_time_delay(std::string interval)
       {
         // unit defaults to minutes if no interval is given
         return this->parse_time_interval(std::move(interval), this->report_time_delay);
       }
     
     
-    bool argument_cache::parse_time_interval(std::string interval, unsigned int& result, unsigned int unit)
+    inline bool argument_cache::parse_time_interval(std::string interval, unsigned int& result, unsigned int unit)
       {
         constexpr unsigned int second = 1;
         constexpr unsigned int minute = 60;
@@ -555,21 +741,21 @@ namespace transport
       }
     
     
-    void argument_cache::set_report_email(const std::vector<std::string>& email)
+    inline void argument_cache::set_report_email(const std::vector<std::string>& email)
       {
         this->report_email.clear();
         std::copy(email.begin(), email.end(), std::back_inserter(this->report_email));
       }
     
     
-    bool argument_cache::set_checkpoint_interval(std::string interval)
+    inline bool argument_cache::set_checkpoint_interval(std::string interval)
       {
         // unit defaults to minutes if not specified explicitly, as here
         return this->parse_time_interval(interval, this->checkpoint_interval);
       }
     
     
-    bool argument_cache::set_email_flags(const std::string& flags)
+    inline bool argument_cache::set_email_flags(const std::string& flags)
       {
         // cache current values, to be reset in the event of failure
         bool begin = this->mail_begin;
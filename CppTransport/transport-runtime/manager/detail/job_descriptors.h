@@ -55,7 +55,8 @@ namespace transport
                 name(n),
                 tags(tg),
                 output(o),
-                seeded(false)
+                seeded(false),
+                fused(false)
               {
               }
 
@@ -63,7 +64,8 @@ namespace transport
               : type(t),
                 name(n),
                 tags(tg),
-                seeded(false)
+                seeded(false),
+                fused(false)
               {
               }
 
@@ -122,6 +124,20 @@ namespace transport
               };
 
 
+            //! mark job as fused with its parent integration, which is then computed in the same pass
+            void set_fused(bool f)
+              {
+                this->fused = f;
+              }
+
+
+            //! determine whether job is fused with its parent integration
+            bool is_fused() const
+              {
+                return (this->fused);
+              }
+
+
             // INTERNAL DATA
 
           private:
@@ -144,6 +160,9 @@ namespace transport
             //! seed group, if used
             std::string seed_group;
 
+            //! is this job fused with its parent integration?
+            bool fused;
+
           };
 
 
@@ -218,7 +237,7 @@ namespace transport
           };
 
 
-        CompareJobDescriptorByList::CompareJobDescriptorByList(const std::list<std::string>& order)
+        inline CompareJobDescriptorByList::CompareJobDescriptorByList(const std::list<std::string>& order)
           {
             unsigned int number = 0;
             for(const std::string& object : order)
@@ -228,7 +247,7 @@ namespace transport
           }
 
 
-        bool CompareJobDescriptorByList::operator()(const job_descriptor& A, const job_descriptor& B)
+        inline bool CompareJobDescriptorByList::operator()(const job_descriptor& A, const job_descriptor& B)
           {
             return this->order_map[A.get_name()] < this->order_map[B.get_name()];
           }
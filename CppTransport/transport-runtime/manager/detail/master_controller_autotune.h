@@ -0,0 +1,254 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_MANAGER_DETAIL_MASTER_CONTROLLER_AUTOTUNE_H
+#define CPPTRANSPORT_MANAGER_DETAIL_MASTER_CONTROLLER_AUTOTUNE_H
+
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <iomanip>
+
+#include "transport-runtime/manager/detail/master_controller_decl.h"
+
+#include "transport-runtime/models/stepper_candidate.h"
+#include "transport-runtime/utilities/formatter.h"
+
+#include "transport-runtime/defaults.h"
+#include "transport-runtime/messages.h"
+#include "transport-runtime/exceptions.h"
+
+#include "boost/timer/timer.hpp"
+
+
+namespace transport
+  {
+
+    namespace master_controller_impl
+      {
+
+        //! result of benchmarking a single candidate stepper
+        class autotune_result
+          {
+
+          public:
+
+            //! constructor
+            autotune_result(stepper_candidate c)
+              : candidate(std::move(c)),
+                succeeded(false),
+                time(0),
+                error(0.0)
+              {
+              }
+
+            //! candidate stepper
+            stepper_candidate candidate;
+
+            //! did the candidate integrate every sampled configuration?
+            bool succeeded;
+
+            //! total wallclock time spent integrating sampled configurations
+            boost::timer::nanosecond_type time;
+
+            //! largest relative error measured against the reference solution
+            double error;
+
+          };
+
+
+        //! compute the largest relative deviation of a sampled solution from the reference solution.
+        //! Each component is normalized to the largest magnitude it attains in the reference solution,
+        //! so components which pass through zero do not dominate. The normalization is floored at the absolute
+        //! tolerance of the reference solution, below which it cannot resolve anything, so components which are
+        //! zero up to roundoff are measured absolutely rather than inflated into large relative errors.
+        //! Returns infinity if the solutions do not have the same shape
+        template <typename number>
+        double autotune_error(const std::vector< std::vector<number> >& samples, const std::vector< std::vector<number> >& reference)
+          {
+            if(samples.size() != reference.size()) return std::numeric_limits<double>::infinity();
+            if(reference.empty()) return 0.0;
+
+            const size_t components = reference.front().size();
+            for(size_t t = 0; t < reference.size(); ++t)
+              {
+                if(samples[t].size() != components || reference[t].size() != components) return std::numeric_limits<double>::infinity();
+              }
+
+            double error = 0.0;
+            for(size_t i = 0; i < components; ++i)
+              {
+                double scale = 0.0;
+                double deviation = 0.0;
+
+                for(size_t t = 0; t < reference.size(); ++t)
+                  {
+                    scale     = std::max(scale, std::abs(static_cast<double>(reference[t][i])));
+                    deviation = std::max(deviation, std::abs(static_cast<double>(samples[t][i] - reference[t][i])));
+                  }
+
+                if(!std::isfinite(deviation)) return std::numeric_limits<double>::infinity();
+                error = std::max(error, deviation/std::max(scale, CPPTRANSPORT_AUTOTUNE_REFERENCE_TOLERANCE));
+              }
+
+            return error;
+          }
+
+      }   // namespace master_controller_impl
+
+
+    template <typename number>
+    void master_controller<number>::autotune_integration_task(integration_task_record<number>& rec)
+      {
+        twopf_db_task<number>* tk = dynamic_cast< twopf_db_task<number>* >(rec.get_task());
+
+        if(tk == nullptr)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_UNKNOWN_DERIVED_TASK << " '" << rec.get_name() << "'";
+            throw runtime_exception(exception_type::REPOSITORY_ERROR, msg.str());
+          }
+
+        model<number>* m = tk->get_model();
+        const twopf_kconfig_database& db = tk->get_twopf_database();
+
+        // choose a representative sample of k-configurations, spread evenly through the database
+        // (which is ordered by serial number, and hence by wavenumber for tasks built from a single axis)
+        std::vector<const twopf_kconfig_record*> configs;
+        const size_t N = std::min(static_cast<size_t>(this->arg_cache.get_autotune_sample()), db.size());
+        size_t index = 0;
+        for(twopf_kconfig_database::const_record_iterator t = db.record_cbegin(); t != db.record_cend() && configs.size() < N; ++t, ++index)
+          {
+            // include configuration i*size/N for i = 0, 1, ..., N-1
+            if(index*N >= configs.size()*db.size()) configs.push_back(&(*t));
+          }
+
+        std::ostringstream header;
+        header << CPPTRANSPORT_AUTOTUNE_TASK_A << " '" << rec.get_name() << "' " << CPPTRANSPORT_AUTOTUNE_TASK_B << " "
+               << configs.size() << " " << CPPTRANSPORT_AUTOTUNE_TASK_C << " " << this->arg_cache.get_autotune_target();
+        this->msg(header.str());
+
+        // compute reference solution at tight tolerance
+        std::vector< std::vector< std::vector<number> > > reference(configs.size());
+        const stepper_candidate ref_stepper(CPPTRANSPORT_AUTOTUNE_REFERENCE_STEPPER, CPPTRANSPORT_AUTOTUNE_REFERENCE_TOLERANCE, CPPTRANSPORT_AUTOTUNE_REFERENCE_TOLERANCE);
+        try
+          {
+            for(size_t i = 0; i < configs.size(); ++i)
+              {
+                if(!m->backend_autotune(*configs[i], tk, ref_stepper, reference[i]))
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_AUTOTUNE_UNSUPPORTED << " '" << rec.get_name() << "'";
+                    this->err(msg.str());
+                    return;
+                  }
+              }
+          }
+        catch(std::exception& xe)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_AUTOTUNE_NO_REFERENCE << " '" << rec.get_name() << "' (" << xe.what() << ")";
+            this->err(msg.str());
+            return;
+          }
+
+        // benchmark each candidate stepper at each tolerance
+        std::vector<master_controller_impl::autotune_result> results;
+        for(const std::string& name : runtime_steppers())
+          {
+            for(double tol : CPPTRANSPORT_AUTOTUNE_TOLERANCES)
+              {
+                master_controller_impl::autotune_result result(stepper_candidate(name, tol, tol));
+                std::vector< std::vector<number> > samples;
+
+                try
+                  {
+                    result.succeeded = true;
+                    for(size_t i = 0; i < configs.size() && result.succeeded; ++i)
+                      {
+                        boost::timer::cpu_timer timer;
+                        m->backend_autotune(*configs[i], tk, result.candidate, samples);
+                        timer.stop();
+
+                        result.time += timer.elapsed().wall;
+                        result.error = std::max(result.error, master_controller_impl::autotune_error(samples, reference[i]));
+                        if(!std::isfinite(result.error)) result.succeeded = false;
+                      }
+                  }
+                catch(std::exception& xe)
+                  {
+                    result.succeeded = false;
+                  }
+
+                std::ostringstream line;
+                line << "  " << std::left << std::setw(26) << name << " " << CPPTRANSPORT_AUTOTUNE_TOLERANCE << " " << std::setw(6) << tol << " | ";
+                if(result.succeeded)
+                  {
+                    line << CPPTRANSPORT_AUTOTUNE_TIME << " " << std::setw(10) << format_time(result.time)
+                         << " " << CPPTRANSPORT_AUTOTUNE_ERROR << " " << result.error;
+                  }
+                else
+                  {
+                    line << CPPTRANSPORT_AUTOTUNE_FAILED;
+                  }
+                this->msg(line.str());
+
+                results.push_back(std::move(result));
+              }
+          }
+
+        // report current stepper, and the fastest candidate which meets the accuracy target
+        std::ostringstream current;
+        std::pair< double, double > current_tol = m->get_pert_tol();
+        current << CPPTRANSPORT_AUTOTUNE_CURRENT << " " << m->get_pert_stepper()
+                << " (abserr=" << current_tol.first << ", relerr=" << current_tol.second << ")";
+        this->msg(current.str());
+
+        const master_controller_impl::autotune_result* best = nullptr;
+        for(const master_controller_impl::autotune_result& result : results)
+          {
+            if(result.succeeded && result.error <= this->arg_cache.get_autotune_target()
+               && (best == nullptr || result.time < best->time)) best = &result;
+          }
+
+        if(best == nullptr)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_AUTOTUNE_NONE << " '" << rec.get_name() << "'";
+            this->warn(msg.str());
+            return;
+          }
+
+        std::ostringstream recommend;
+        recommend << CPPTRANSPORT_AUTOTUNE_RECOMMEND << " " << best->candidate.get_name()
+                  << " (abserr=" << best->candidate.get_abs_err() << ", relerr=" << best->candidate.get_rel_err() << ")";
+        this->msg(recommend.str(), message_handler::highlight::heading);
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_MANAGER_DETAIL_MASTER_CONTROLLER_AUTOTUNE_H
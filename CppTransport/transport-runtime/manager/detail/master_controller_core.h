@@ -59,6 +59,7 @@ namespace transport
         cmdline_reports(le, ac),
         HTML_reports(le, ac),
         last_push_to_repo(boost::posix_time::second_clock::universal_time()),
+        topology(static_cast<unsigned int>(w.size()), CPPTRANSPORT_DEFAULT_GROUP_SIZE),
         work_scheduler(w.size() > 0 ? static_cast<unsigned int>(w.size()-1) : 0),
         work_manager(w.size() > 0 ? static_cast<unsigned int>(w.size()-1) : 0),
         reporter(work_scheduler, work_manager, busyidle_timers, le, ac)
@@ -268,6 +269,73 @@ namespace transport
       }
 
 
+    template <typename number>
+    void master_controller<number>::fuse_postintegration_jobs()
+      {
+        // capture busy/idle timers and switch to busy mode
+        busyidle_instrument timers(this->busyidle_timers);
+
+        if(!this->arg_cache.get_postintegration_fusion()) return;
+
+        // job queue is in topological order, so a zeta task which immediately follows its parent integration
+        // can be computed alongside it: the zeta batcher is paired with the integration batcher on each worker,
+        // and consumes each k-configuration while it is still in memory, rather than re-reading it from the
+        // aggregated container.
+        // The integration still commits a content group, so any later jobs which depend on it are unaffected
+        std::list<job_descriptor>::iterator t = this->job_queue.begin();
+        while(t != this->job_queue.end())
+          {
+            std::list<job_descriptor>::iterator u = std::next(t);
+            if(u == this->job_queue.end()) break;
+
+            if(this->can_fuse(*t, *u))
+              {
+                std::ostringstream note;
+                note << CPPTRANSPORT_FUSED_TASKS_A << " '" << u->get_name() << "' " << CPPTRANSPORT_FUSED_TASKS_B << " '" << t->get_name() << "'";
+                this->msg(note.str());
+
+                u->set_fused(true);
+                t = this->job_queue.erase(t);   // leaves t pointing to the fused job
+              }
+
+            ++t;
+          }
+      }
+
+
+    template <typename number>
+    bool master_controller<number>::can_fuse(const job_descriptor& parent, const job_descriptor& child)
+      {
+        if(parent.get_type() != job_type::job_task || child.get_type() != job_type::job_task) return false;
+
+        // seeded jobs resume from a specific content group, which can't be reproduced by a fused job
+        if(parent.is_seeded() || child.is_seeded()) return false;
+
+        // both content groups will receive the same tags
+        if(parent.get_tags() != child.get_tags()) return false;
+
+        std::unique_ptr< task_record<number> > rec = this->repo->query_task(child.get_name());
+        if(!rec || rec->get_type() != task_type::postintegration) return false;
+
+        const postintegration_task_record<number>& prec = dynamic_cast< const postintegration_task_record<number>& >(*rec);
+        const postintegration_task<number>& tk = *prec.get_task();
+
+        // only zeta 2pf and zeta 3pf tasks can be paired; tasks which are already paired are handled separately
+        if(tk.get_task_type() == postintegration_task_type::twopf)
+          {
+            const zeta_twopf_task<number>& ztk = dynamic_cast< const zeta_twopf_task<number>& >(tk);
+            return !ztk.is_paired() && ztk.get_parent_task()->get_name() == parent.get_name();
+          }
+        else if(tk.get_task_type() == postintegration_task_type::threepf)
+          {
+            const zeta_threepf_task<number>& ztk = dynamic_cast< const zeta_threepf_task<number>& >(tk);
+            return !ztk.is_paired() && ztk.get_parent_task()->get_name() == parent.get_name();
+          }
+
+        return false;
+      }
+
+
     template <typename number>
     void master_controller<number>::validate_tasks()
       {
@@ -331,6 +399,9 @@ namespace transport
         // schedule extra tasks if any explicitly-required tasks depend on content from
         // a second task, but no content group is available
         this->autocomplete_task_schedule();
+
+        // compute zeta tasks in the same pass as their parent integration, where possible
+        this->fuse_postintegration_jobs();
     
         unsigned int tasks_complete = 0;
         unsigned int tasks_processed = 0;
@@ -491,6 +562,15 @@ namespace transport
             return;
           }
 
+        // in autotuning mode only integration tasks are processed, and they are benchmarked rather than run
+        if(this->arg_cache.get_autotune() && record->get_type() != task_type::integration)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_AUTOTUNE_SKIP << " '" << job.get_name() << "'";
+            this->warn(msg.str());
+            return;
+          }
+
         // introspect task type
         switch(record->get_type())
           {
@@ -501,7 +581,8 @@ namespace transport
                 assert(int_rec != nullptr);
                 if(int_rec == nullptr) throw runtime_exception(exception_type::REPOSITORY_ERROR, CPPTRANSPORT_REPO_RECORD_CAST_FAILED);
 
-                this->dispatch_integration_task(*int_rec, job.is_seeded(), job.get_seed_group(), job.get_tags());
+                if(this->arg_cache.get_autotune()) this->autotune_integration_task(*int_rec);
+                else this->dispatch_integration_task(*int_rec, job.is_seeded(), job.get_seed_group(), job.get_tags());
                 break;
               }
 
@@ -523,7 +604,7 @@ namespace transport
                 assert(pint_rec != nullptr);
                 if(pint_rec == nullptr) throw runtime_exception(exception_type::REPOSITORY_ERROR, CPPTRANSPORT_REPO_RECORD_CAST_FAILED);
 
-                this->dispatch_postintegration_task(*pint_rec, job.is_seeded(), job.get_seed_group(), job.get_tags());
+                this->dispatch_postintegration_task(*pint_rec, job.is_seeded(), job.get_seed_group(), job.get_tags(), job.is_fused());
                 break;
               }
           }
@@ -548,7 +629,16 @@ namespace transport
         // rebuild information about our workers; this information
         // it is updated whenever we start a new task, because the details can vary
         // between model instances (eg. CPU or GPU backends)
-        this->work_scheduler.reset();
+        this->topology = worker_topology(static_cast<unsigned int>(this->world.size()), this->arg_cache.get_group_size());
+        this->work_scheduler.reset(this->topology.get_number_peers());
+        this->work_scheduler.set_lookahead(this->arg_cache.get_prefetch_depth());
+
+        if(this->topology.is_hierarchical())
+          {
+            BOOST_LOG_SEV(log, base_writer::log_severity_level::normal)
+              << "++ Scheduling through " << this->topology.get_number_peers() << " group leader"
+              << (this->topology.get_number_peers() > 1 ? std::string{"s"} : std::string{});
+          }
         this->work_manager.new_task(writer.get_name());
 
         while(!this->work_scheduler.is_ready())
@@ -563,7 +653,7 @@ namespace transport
                   {
                     MPI::slave_information_payload payload;
                     this->world.recv(stat.source(), MPI::WORKER_IDENTIFICATION, payload);
-                    this->work_scheduler.initialize_worker(log, this->worker_number(stat.source()), payload);
+                    this->work_scheduler.initialize_worker(log, this->peer_number(stat.source()), payload);
                     break;
                   }
 
@@ -590,10 +680,13 @@ namespace transport
 
         BOOST_LOG_SEV(log, base_writer::log_severity_level::notification) << "++ Notifying workers of end-of-work";
 
-        std::vector<boost::mpi::request> requests(this->world.size()-1);
-        for(unsigned int i = 0; i < this->world.size()-1; ++i)
+        // only peers take part in scheduling; group leaders pass end-of-work on to their groups
+        // once their own queues have drained
+        unsigned int peers = this->topology.get_number_peers();
+        std::vector<boost::mpi::request> requests(peers);
+        for(unsigned int i = 0; i < peers; ++i)
           {
-            requests[i] = this->world.isend(this->worker_rank(i), MPI::END_OF_WORK);
+            requests[i] = this->world.isend(this->peer_rank(i), MPI::END_OF_WORK);
           }
 
         // wait for all messages to be received, then return
@@ -675,7 +768,7 @@ namespace transport
             MPI::work_assignment_payload payload(assgn.get_items());
 
             // send message to worker with new assignment information
-            msg_status[c] = this->world.isend(this->worker_rank(assgn.get_worker()), MPI::NEW_WORK_ASSIGNMENT, payload);
+            msg_status[c] = this->world.isend(this->peer_rank(assgn.get_worker()), MPI::NEW_WORK_ASSIGNMENT, payload);
 
             // mark this worker, and these work items, as assigned
             this->work_scheduler.mark_assigned(assgn);
@@ -686,7 +779,7 @@ namespace transport
     
             BOOST_LOG_SEV(log, base_writer::log_severity_level::normal)
               << "++ Assigned " << items << " work item" << (items == 1 ? std::string{} : std::string{"s"})
-              << " to worker " << worker << " [MPI rank=" << this->worker_rank(worker) << "]";
+              << " to worker " << worker << " [MPI rank=" << this->peer_rank(worker) << "]";
           }
 
         // wait for all assignments to be received
@@ -774,7 +867,7 @@ namespace transport
                 last_msg_time = boost::posix_time::second_clock::universal_time();
                 emit_agg_queue_msg = true;
 
-                this->work_manager.update_contact_time(this->worker_number(stat->source()), last_msg_time);
+                this->work_manager.update_contact_time(this->peer_number(stat->source()), last_msg_time);
 
                 switch(stat->tag())
                   {
@@ -784,8 +877,8 @@ namespace transport
                           {
                             MPI::data_ready_payload payload;
                             this->world.recv(stat->source(), MPI::INTEGRATION_DATA_READY, payload);
-                            this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), slave_work_event::event_type::integration_aggregation, payload.get_timestamp(), aggregation_counter));
-                            aggregation_queue.push_back(std::make_unique< integration_aggregation_record<number> >(this->worker_number(stat->source()), aggregation_counter++, int_agg, int_metadata, payload));
+                            this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), slave_work_event::event_type::integration_aggregation, payload.get_timestamp(), aggregation_counter));
+                            aggregation_queue.push_back(std::make_unique< integration_aggregation_record<number> >(this->peer_number(stat->source()), aggregation_counter++, int_agg, int_metadata, payload));
                             BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " sent aggregation notification for container '" << payload.get_container_path().string() << "'";
                           }
                         else
@@ -801,8 +894,8 @@ namespace transport
                           {
                             MPI::content_ready_payload payload;
                             this->world.recv(stat->source(), MPI::DERIVED_CONTENT_READY, payload);
-                            this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), slave_work_event::event_type::derived_content_aggregation, payload.get_timestamp(), aggregation_counter));
-                            aggregation_queue.push_back(std::make_unique< derived_content_aggregation_record<number> >(this->worker_number(stat->source()), aggregation_counter++, derived_agg, out_metadata, payload));
+                            this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), slave_work_event::event_type::derived_content_aggregation, payload.get_timestamp(), aggregation_counter));
+                            aggregation_queue.push_back(std::make_unique< derived_content_aggregation_record<number> >(this->peer_number(stat->source()), aggregation_counter++, derived_agg, out_metadata, payload));
                             BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " sent content-ready notification";
                           }
                         else
@@ -818,8 +911,8 @@ namespace transport
                           {
                             MPI::data_ready_payload payload;
                             this->world.recv(stat->source(), MPI::POSTINTEGRATION_DATA_READY, payload);
-                            this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), slave_work_event::event_type::postintegration_aggregation, payload.get_timestamp(), aggregation_counter));
-                            aggregation_queue.push_back(std::make_unique< postintegration_aggregation_record<number> >(this->worker_number(stat->source()), aggregation_counter++, post_agg, out_metadata, payload));
+                            this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), slave_work_event::event_type::postintegration_aggregation, payload.get_timestamp(), aggregation_counter));
+                            aggregation_queue.push_back(std::make_unique< postintegration_aggregation_record<number> >(this->peer_number(stat->source()), aggregation_counter++, post_agg, out_metadata, payload));
                             BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " sent aggregation notification for container '" << payload.get_container_path().string() << "'";
                           }
                         else
@@ -833,7 +926,7 @@ namespace transport
                       {
                         MPI::work_acknowledgment_payload payload;
                         this->world.recv(stat->source(), MPI::NEW_WORK_ACKNOWLEDGMENT, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), begin_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), begin_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " advising receipt of work assignment at time " << boost::posix_time::to_simple_string(payload.get_timestamp());
 
                         break;
@@ -843,11 +936,11 @@ namespace transport
                       {
                         MPI::finished_integration_payload payload;
                         this->world.recv(stat->source(), MPI::FINISHED_INTEGRATION, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " advising finished work assignment in wallclock time " << format_time(payload.get_wallclock_time());
 
                         // mark this worker as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_integration_metadata(payload, int_metadata);
                         if(payload.get_num_failures() > 0) writer.merge_failure_list(payload.get_failed_serials());
@@ -859,11 +952,11 @@ namespace transport
                       {
                         MPI::finished_integration_payload payload;
                         this->world.recv(stat->source(), MPI::INTEGRATION_FAIL, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "!! Worker " << stat->source() << " advising failure of work assignment (successful work items consumed wallclock time " << format_time(payload.get_wallclock_time()) << ")";
     
                         // mark this worker as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_integration_metadata(payload, int_metadata);
                         if(payload.get_num_failures() > 0) writer.merge_failure_list(payload.get_failed_serials());
@@ -876,11 +969,11 @@ namespace transport
                       {
                         MPI::finished_derived_payload payload;
                         this->world.recv(stat->source(), MPI::FINISHED_DERIVED_CONTENT, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " advising finished work assignment in CPU time " << format_time(payload.get_wallclock_time());
 
                         // mark this scheduler as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_output_metadata(payload, out_metadata);
                         this->update_content_group_list(payload, content_groups);
@@ -892,11 +985,11 @@ namespace transport
                       {
                         MPI::finished_derived_payload payload;
                         this->world.recv(stat->source(), MPI::DERIVED_CONTENT_FAIL, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "!! Worker " << stat->source() << " advising failure of work assignment (successful work items consumed wallclock time " << format_time(payload.get_wallclock_time()) << ")";
     
                         // mark this scheduler as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_output_metadata(payload, out_metadata);
                         this->update_content_group_list(payload, content_groups);
@@ -909,11 +1002,11 @@ namespace transport
                       {
                         MPI::finished_postintegration_payload payload;
                         this->world.recv(stat->source(), MPI::FINISHED_POSTINTEGRATION, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "++ Worker " << stat->source() << " advising finished work assignment in wallclock time " << format_time(payload.get_cpu_time());
     
                         // mark this scheduler as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_output_metadata(payload, out_metadata);
                         this->update_content_group_list(payload, content_groups);
@@ -925,11 +1018,11 @@ namespace transport
                       {
                         MPI::finished_postintegration_payload payload;
                         this->world.recv(stat->source(), MPI::POSTINTEGRATION_FAIL, payload);
-                        this->journal.add_entry(slave_work_event(this->worker_number(stat->source()), end_label, payload.get_timestamp()));
+                        this->journal.add_entry(slave_work_event(this->peer_number(stat->source()), end_label, payload.get_timestamp()));
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << "!! Worker " << stat->source() << " advising failure of work assignment (successful work items consumed wallclock time " << format_time(payload.get_cpu_time()) << ")";
     
                         // mark this scheduler as unassigned, and update its mean time per work item
-                        this->unassign_worker(this->worker_number(stat->source()), writer, payload);
+                        this->unassign_worker(this->peer_number(stat->source()), writer, payload);
 
                         this->update_output_metadata(payload, out_metadata);
                         this->update_content_group_list(payload, content_groups);
@@ -942,8 +1035,8 @@ namespace transport
                       {
                         MPI::performance_data_payload payload;
                         this->world.recv(stat->source(), MPI::WORKER_CLOSE_DOWN, payload);
-                        this->work_scheduler.mark_inactive(this->worker_number(stat->source()));
-                        this->work_manager.update_load_average(this->worker_number(stat->source()), payload.get_load_average());
+                        this->work_scheduler.mark_inactive(this->peer_number(stat->source()));
+                        this->work_manager.update_load_average(this->peer_number(stat->source()), payload.get_load_average());
 
                         unsigned int num_active = this->work_scheduler.get_number_active();
                         BOOST_LOG_SEV(log, base_writer::log_severity_level::normal)
@@ -45,6 +45,7 @@
 #include "transport-runtime/data/data_manager.h"
 
 #include "transport-runtime/manager/worker_scheduler.h"
+#include "transport-runtime/manager/worker_topology.h"
 #include "transport-runtime/manager/worker_manager.h"
 #include "transport-runtime/manager/work_journal.h"
 #include "transport-runtime/manager/argument_cache.h"
@@ -160,6 +161,13 @@ namespace transport
         //! insert job descriptors for required jobs, and sort jobs into correct topological order
         void insert_job_descriptors(const std::set<std::string>& required_tasks, const std::list<std::string>& order);
 
+        //! fuse zeta tasks with a parent integration scheduled immediately before them, so that both are
+        //! computed in a single pass using paired batchers
+        void fuse_postintegration_jobs();
+
+        //! determine whether a job can be fused with the job scheduled immediately before it
+        bool can_fuse(const job_descriptor& parent, const job_descriptor& child);
+
 
         // MPI FUNCTIONS
 
@@ -181,6 +189,13 @@ namespace transport
         // TODO: replace with a better abstraction
         constexpr unsigned int worker_number(unsigned int worker_rank) const { return(worker_rank-1); }
 
+        //! Map peer number to communicator rank; peers are the processes which exchange scheduling
+        //! messages with the master -- group leaders if they are in use, otherwise every worker
+        unsigned int peer_rank(unsigned int n) const { return(this->topology.peer_rank(n)); }
+
+        //! Map communicator rank to peer number; members of a group map to their group leader
+        unsigned int peer_number(unsigned int rank) const { return(this->topology.peer_number(rank)); }
+
 
         // MASTER JOB HANDLING
 
@@ -245,6 +260,10 @@ namespace transport
         //! Makes a queue then invokes master_dispatch_integration_queue()
         void dispatch_integration_task(integration_task_record<number>& rec, bool seeded, const std::string& seed_group, const std::list<std::string>& tags);
 
+        //! Master node: Benchmark candidate steppers on a sample of k-configurations from an integration task,
+        //! and report the fastest which meets the requested accuracy target. Nothing is written to the repository
+        void autotune_integration_task(integration_task_record<number>& rec);
+
         //! Master node: Dispatch an integration queue to the worker processes.
         template <typename TaskObject>
         void schedule_integration(integration_task_record<number>& rec, TaskObject* tk,
@@ -277,7 +296,8 @@ namespace transport
       protected:
 
         //! Master node: Dispatch a postintegration task to the worker processes.
-        void dispatch_postintegration_task(postintegration_task_record<number>& rec, bool seeded, const std::string& seed_group, const std::list<std::string>& tags);
+        void dispatch_postintegration_task(postintegration_task_record<number>& rec, bool seeded, const std::string& seed_group, const std::list<std::string>& tags,
+                                           bool fused=false);
 
         //! Master node: validate that a suitable content group exists before scheduling a postintegration task
         void validate_content_group(integration_task<number>* tk, const std::list<std::string>& tags);
@@ -428,6 +448,9 @@ namespace transport
 
         // AGENTS
 
+        //! arrangement of workers beneath the master
+        worker_topology topology;
+
         //! work scheduler
         worker_scheduler work_scheduler;
         
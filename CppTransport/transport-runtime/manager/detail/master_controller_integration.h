@@ -213,6 +213,22 @@ namespace transport
           // wait for all messages to be received
           boost::mpi::wait_all(requests.begin(), requests.end());
           BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification) << "++ All workers received NEW_INTEGRATION instruction";
+
+          // broadcast a snapshot of the task, so workers do not each have to deserialize it from the repository;
+          // the broadcast is collective, so it must go ahead even if the snapshot could not be built -- in that
+          // case workers receive an empty snapshot and fall back to querying the repository
+          task_snapshot snapshot;
+          try
+            {
+              snapshot = this->repo->snapshot_integration_task(writer.get_task_name());
+            }
+          catch(runtime_exception& xe)
+            {
+              BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::warning) << "!! " << CPPTRANSPORT_SNAPSHOT_FAILED << ": " << xe.what();
+            }
+
+          boost::mpi::broadcast(this->world, snapshot, MPI::RANK_MASTER);
+          BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification) << "++ Broadcast task snapshot (" << format_memory(snapshot.get_kconfig_database().size()) << " k-configuration database)";
         }
 
         bool success = this->poll_workers(i_agg, p_agg, d_agg, i_metadata, o_metadata, content_groups, writer, begin_label, end_label);
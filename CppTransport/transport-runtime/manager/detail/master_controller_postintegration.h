@@ -41,7 +41,7 @@ namespace transport
 
     template <typename number>
     void master_controller<number>::dispatch_postintegration_task(postintegration_task_record<number>& rec, bool seeded, const std::string& seed_group,
-                                                                  const std::list<std::string>& tags)
+                                                                  const std::list<std::string>& tags, bool fused)
       {
         // can't process a task if there are no workers
         if(this->world.size() <= 1) throw runtime_exception(exception_type::MPI_ERROR, CPPTRANSPORT_TOO_FEW_WORKERS);
@@ -64,8 +64,8 @@ namespace transport
                 throw runtime_exception(exception_type::REPOSITORY_ERROR, msg.str());
               }
 
-            // is this 2pf task paired?
-            if(z2pf->is_paired())
+            // is this 2pf task paired, or fused with its parent integration in the job queue?
+            if(z2pf->is_paired() || fused)
               {
                 model<number>* m = ptk->get_model();
                 this->work_scheduler.set_state_size(m->backend_twopf_state_size());
@@ -92,8 +92,8 @@ namespace transport
                 throw runtime_exception(exception_type::REPOSITORY_ERROR, msg.str());
               }
 
-            // is this 3pf task apired?
-            if(z3pf->is_paired())
+            // is this 3pf task paired, or fused with its parent integration in the job queue?
+            if(z3pf->is_paired() || fused)
               {
                 model<number>* m = ptk->get_model();
                 this->work_scheduler.set_state_size(m->backend_threepf_state_size());
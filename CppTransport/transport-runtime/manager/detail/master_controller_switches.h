@@ -126,6 +126,7 @@ namespace transport
           (CPPTRANSPORT_SWITCH_NO_COLOUR, CPPTRANSPORT_HELP_NO_COLOUR)
           (CPPTRANSPORT_SWITCH_WIDTH, boost::program_options::value<int>(), CPPTRANSPORT_HELP_WIDTH)
           (CPPTRANSPORT_SWITCH_INCLUDE, boost::program_options::value<std::vector<std::string> >()->composing(), CPPTRANSPORT_HELP_INCLUDE)
+          (CPPTRANSPORT_SWITCH_PLUGIN_PATH, boost::program_options::value<std::vector<std::string> >()->composing(), CPPTRANSPORT_HELP_PLUGIN_PATH)
           (CPPTRANSPORT_SWITCH_REPO, boost::program_options::value<std::string>(), CPPTRANSPORT_HELP_REPO)
           (CPPTRANSPORT_SWITCH_CAPACITY, boost::program_options::value<long int>(), CPPTRANSPORT_HELP_CAPACITY)
           (CPPTRANSPORT_SWITCH_BATCHER_CAPACITY, boost::program_options::value<long int>(), CPPTRANSPORT_HELP_BATCHER_CAPACITY)
@@ -161,6 +162,14 @@ namespace transport
           (CPPTRANSPORT_SWITCH_TASK, boost::program_options::value<std::vector<std::string> >()->composing(), CPPTRANSPORT_HELP_TASK)
           (CPPTRANSPORT_SWITCH_TAG, boost::program_options::value<std::vector<std::string> >()->composing(), CPPTRANSPORT_HELP_TAG)
           (CPPTRANSPORT_SWITCH_CHECKPOINT, boost::program_options::value<std::string>(), CPPTRANSPORT_HELP_CHECKPOINT)
+          (CPPTRANSPORT_SWITCH_PREFETCH, boost::program_options::value<int>(), CPPTRANSPORT_HELP_PREFETCH)
+          (CPPTRANSPORT_SWITCH_GROUP_SIZE, boost::program_options::value<int>(), CPPTRANSPORT_HELP_GROUP_SIZE)
+          (CPPTRANSPORT_SWITCH_BATCH_THREADS, boost::program_options::value<int>(), CPPTRANSPORT_HELP_BATCH_THREADS)
+          (CPPTRANSPORT_SWITCH_NO_FUSION, CPPTRANSPORT_HELP_NO_FUSION)
+          (CPPTRANSPORT_SWITCH_LAYOUT, boost::program_options::value<std::string>(), CPPTRANSPORT_HELP_LAYOUT)
+          (CPPTRANSPORT_SWITCH_CODEC, boost::program_options::value<std::string>(), CPPTRANSPORT_HELP_CODEC)
+          (CPPTRANSPORT_SWITCH_AUTOTUNE, boost::program_options::value<double>(), CPPTRANSPORT_HELP_AUTOTUNE)
+          (CPPTRANSPORT_SWITCH_TUNE_SAMPLE, boost::program_options::value<int>(), CPPTRANSPORT_HELP_TUNE_SAMPLE)
           (CPPTRANSPORT_SWITCH_SEED, boost::program_options::value<std::string>(), CPPTRANSPORT_HELP_SEED)
           ;
         
@@ -428,6 +437,11 @@ namespace transport
         if(option_map.count(CPPTRANSPORT_SWITCH_INCLUDE_LONG))
           this->arg_cache.set_search_paths(
             option_map[CPPTRANSPORT_SWITCH_INCLUDE_LONG].as<std::vector<std::string> >());
+
+        // add model plugin search paths if any were specified
+        if(option_map.count(CPPTRANSPORT_SWITCH_PLUGIN_PATH))
+          this->arg_cache.set_plugin_paths(
+            option_map[CPPTRANSPORT_SWITCH_PLUGIN_PATH].as<std::vector<std::string> >());
         
         if(option_map.count(CPPTRANSPORT_SWITCH_NETWORK_MODE)) this->arg_cache.set_network_mode(true);
         if(option_map.count(CPPTRANSPORT_SWITCH_REJECT_FAILED)) this->arg_cache.set_commit_failed(false);
@@ -663,6 +677,152 @@ namespace transport
                 this->warn(msg.str());
               }
           }
+
+        // process prefetch depth, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_PREFETCH))
+          {
+            int depth = -1;
+            try
+              {
+                depth = option_map[CPPTRANSPORT_SWITCH_PREFETCH].as<int>();
+              }
+            catch(boost::exception& xe)
+              {
+              }
+
+            if(depth > 0)
+              {
+                this->arg_cache.set_prefetch_depth(static_cast<unsigned int>(depth));
+              }
+            else
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_EXPECTED_POSITIVE << " " << CPPTRANSPORT_SWITCH_PREFETCH;
+                this->err(msg.str());
+              }
+          }
+
+        // process group size, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_GROUP_SIZE))
+          {
+            int size = -1;
+            try
+              {
+                size = option_map[CPPTRANSPORT_SWITCH_GROUP_SIZE].as<int>();
+              }
+            catch(boost::exception& xe)
+              {
+              }
+
+            if(size > 0)
+              {
+                this->arg_cache.set_group_size(static_cast<unsigned int>(size));
+              }
+            else
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_EXPECTED_POSITIVE << " " << CPPTRANSPORT_SWITCH_GROUP_SIZE;
+                this->err(msg.str());
+              }
+          }
+
+        // process number of batch threads, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_BATCH_THREADS))
+          {
+            int threads = -1;
+            try
+              {
+                threads = option_map[CPPTRANSPORT_SWITCH_BATCH_THREADS].as<int>();
+              }
+            catch(boost::exception& xe)
+              {
+              }
+
+            if(threads > 0)
+              {
+                this->arg_cache.set_batch_threads(static_cast<unsigned int>(threads));
+              }
+            else
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_EXPECTED_POSITIVE << " " << CPPTRANSPORT_SWITCH_BATCH_THREADS;
+                this->err(msg.str());
+              }
+          }
+
+        if(option_map.count(CPPTRANSPORT_SWITCH_NO_FUSION)) this->arg_cache.set_postintegration_fusion(false);
+
+        // process container layout, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_LAYOUT))
+          {
+            if(!this->arg_cache.set_container_layout(option_map[CPPTRANSPORT_SWITCH_LAYOUT].as<std::string>()))
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_UNKNOWN_CONTAINER_LAYOUT << " '"
+                    << option_map[CPPTRANSPORT_SWITCH_LAYOUT].as<std::string>() << "'";
+                this->warn(msg.str());
+              }
+          }
+
+        // process storage codec, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_CODEC))
+          {
+            if(!this->arg_cache.set_storage_codec(option_map[CPPTRANSPORT_SWITCH_CODEC].as<std::string>()))
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_UNKNOWN_STORAGE_CODEC << " '"
+                    << option_map[CPPTRANSPORT_SWITCH_CODEC].as<std::string>() << "'";
+                this->warn(msg.str());
+              }
+          }
+
+        // process autotuning target, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_AUTOTUNE))
+          {
+            double target = -1.0;
+            try
+              {
+                target = option_map[CPPTRANSPORT_SWITCH_AUTOTUNE].as<double>();
+              }
+            catch(boost::exception& xe)
+              {
+              }
+
+            if(target > 0.0)
+              {
+                this->arg_cache.set_autotune(target);
+              }
+            else
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_EXPECTED_POSITIVE << " " << CPPTRANSPORT_SWITCH_AUTOTUNE;
+                this->err(msg.str());
+              }
+          }
+
+        // process autotuning sample size, if provided
+        if(option_map.count(CPPTRANSPORT_SWITCH_TUNE_SAMPLE))
+          {
+            int size = -1;
+            try
+              {
+                size = option_map[CPPTRANSPORT_SWITCH_TUNE_SAMPLE].as<int>();
+              }
+            catch(boost::exception& xe)
+              {
+              }
+
+            if(size > 0)
+              {
+                this->arg_cache.set_autotune_sample(static_cast<unsigned int>(size));
+              }
+            else
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_EXPECTED_POSITIVE << " " << CPPTRANSPORT_SWITCH_TUNE_SAMPLE;
+                this->err(msg.str());
+              }
+          }
       }
     
     
@@ -76,6 +76,10 @@ namespace transport
         //! Return MPI rank of this process
         unsigned int get_rank(void) const { return(static_cast<unsigned int>(this->world.rank())); }
 
+        //! Return MPI rank of the process which schedules our work; this is the master,
+        //! unless workers have been arranged into groups
+        unsigned int controller_rank(void) const { return(this->topology.controller_rank(this->get_rank())); }
+
 
         // SLAVE JOB HANDLING
 
@@ -182,6 +186,9 @@ namespace transport
         //! Argument cache
         argument_cache& arg_cache;
 
+        //! arrangement of workers into groups
+        worker_topology topology;
+
 
         // MODEL FINDER REFERENCE
         model_manager<number>& finder;
@@ -43,6 +43,7 @@ namespace transport
         world(w),
         local_env(le),
         arg_cache(ac),
+        topology(static_cast<unsigned int>(w.size()), CPPTRANSPORT_DEFAULT_GROUP_SIZE),
         finder(f),
         data_mgr(data_manager_factory<number>(le, ac)),
         err(error_handler(le, ac)),
@@ -162,6 +163,9 @@ namespace transport
             // changes in the batcher/pipe capacities and the checkpoint interval will be visible to
             // the data manager, because it has a reference to the arg_cache member
             this->arg_cache = payload.get_argument_cache();
+
+            // the group size is now known, so work out which process schedules our work
+            this->topology = worker_topology(static_cast<unsigned int>(this->world.size()), this->arg_cache.get_group_size());
           }
         catch (runtime_exception& xe)
           {
@@ -190,7 +194,7 @@ namespace transport
         MPI::slave_information_payload payload(m->get_backend_type(), m->get_backend_memory(), m->get_backend_priority());
 
         // send worker identification payload, then wait until it has been received
-        boost::mpi::request resp_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_IDENTIFICATION, payload);
+        boost::mpi::request resp_msg = this->world.isend(this->controller_rank(), MPI::WORKER_IDENTIFICATION, payload);
         resp_msg.wait();
       }
 
@@ -205,7 +209,7 @@ namespace transport
         MPI::slave_information_payload payload(worker_type::cpu, 0, 1);
 
         // send worker identification payload, then wait until it has been received
-        boost::mpi::request resp_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_IDENTIFICATION, payload);
+        boost::mpi::request resp_msg = this->world.isend(this->controller_rank(), MPI::WORKER_IDENTIFICATION, payload);
         resp_msg.wait();
       }
 
@@ -219,11 +223,27 @@ namespace transport
         // ensure that a valid repository object has been constructed
         if(!this->repo) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_REPO_NOT_SET);
 
+        // participate in the master's broadcast of the task snapshot; this is collective, so must happen
+        // before anything which could throw
+        task_snapshot snapshot;
+        boost::mpi::broadcast(this->world, snapshot, MPI::RANK_MASTER);
+
+        // group leaders relay scheduling traffic for their group, but do no work themselves
+        if(this->topology.is_leader(this->get_rank()))
+          {
+            group_leader leader(this->world, this->topology, this->arg_cache.get_prefetch_depth(), payload.get_logdir_path());
+            leader.relay<MPI::finished_integration_payload>(MPI::FINISHED_INTEGRATION, MPI::INTEGRATION_FAIL);
+            return;
+          }
+
         // extract our task from the database
         // much of this is boiler-plate which is similar to master_process_task()
         // TODO: it would be nice to make this sharing more explicit, so the code isn't just duplicated
         try
           {
+            // prime the repository caches from the snapshot, so the query below does not touch the repository
+            this->repo->install_snapshot(snapshot);
+
             // query a task record with the name we're looking for from the database
             std::unique_ptr< task_record<number> > record = this->repo->query_task(payload.get_task_name());
 
@@ -351,7 +371,7 @@ namespace transport
           {
             // wait for messages from scheduler, tracking idle time
             timers.idle();
-            boost::mpi::status stat = this->world.probe(MPI::RANK_MASTER);
+            boost::mpi::status stat = this->world.probe(this->controller_rank());
 
             timers.busy();
             switch(stat.tag())
@@ -363,7 +383,7 @@ namespace transport
 
                     MPI::work_acknowledgment_payload ack_payload;
                     ack_payload.set_timestamp();
-                    boost::mpi::request ack_msg = this->world.isend(MPI::RANK_MASTER, MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
+                    boost::mpi::request ack_msg = this->world.isend(this->controller_rank(), MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
                     ack_msg.wait();
 
                     const std::list<unsigned int>& work_items = assignment_payload.get_items();
@@ -417,7 +437,7 @@ namespace transport
                                        this->busyidle_timers.get_load_average(payload.get_group_name())};
 
                     boost::mpi::request finish_msg =
-                      this->world.isend(MPI::RANK_MASTER, success ? MPI::FINISHED_INTEGRATION : MPI::INTEGRATION_FAIL, outgoing_payload);
+                      this->world.isend(this->controller_rank(), success ? MPI::FINISHED_INTEGRATION : MPI::INTEGRATION_FAIL, outgoing_payload);
                     finish_msg.wait();
 
                     break;
@@ -437,7 +457,7 @@ namespace transport
                     BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal) << "-- Worker sending WORKER_CLOSE_DOWN to master | close down at " << boost::posix_time::to_simple_string(now);
                     
                     MPI::performance_data_payload close_payload(this->busyidle_timers.get_load_average(payload.get_group_name()));
-                    boost::mpi::request close_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_CLOSE_DOWN, close_payload);
+                    boost::mpi::request close_msg = this->world.isend(this->controller_rank(), MPI::WORKER_CLOSE_DOWN, close_payload);
                     close_msg.wait();
 
                     break;
@@ -463,6 +483,14 @@ namespace transport
         // ensure that a valid repository object has been constructed
         if(!this->repo) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_REPO_NOT_SET);
 
+        // group leaders relay scheduling traffic for their group, but do no work themselves
+        if(this->topology.is_leader(this->get_rank()))
+          {
+            group_leader leader(this->world, this->topology, this->arg_cache.get_prefetch_depth(), payload.get_logdir_path());
+            leader.relay<MPI::finished_derived_payload>(MPI::FINISHED_DERIVED_CONTENT, MPI::DERIVED_CONTENT_FAIL);
+            return;
+          }
+
         // extract our task from the database
         // much of this is boiler-plate which is similar to master_process_task()
         // TODO: it would be nice to make this sharing more explicit, so the code isn't just duplicated
@@ -554,7 +582,7 @@ namespace transport
           {
             // wait for messages from scheduler, tracking idle time
             timers.idle();
-            boost::mpi::status stat = this->world.probe(MPI::RANK_MASTER);
+            boost::mpi::status stat = this->world.probe(this->controller_rank());
 
             timers.busy();
             switch(stat.tag())
@@ -566,7 +594,7 @@ namespace transport
 
                     MPI::work_acknowledgment_payload ack_payload;
                     ack_payload.set_timestamp();
-                    boost::mpi::request ack_msg = this->world.isend(MPI::RANK_MASTER, MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
+                    boost::mpi::request ack_msg = this->world.isend(this->controller_rank(), MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
                     ack_msg.wait();
 
                     const std::list<unsigned int>& work_items = assignment_payload.get_items();
@@ -670,7 +698,7 @@ namespace transport
                                      pipe->get_data_cache_evictions(), this->busyidle_timers.get_load_average(payload.get_group_name())};
 
                     boost::mpi::request finish_msg =
-                      this->world.isend(MPI::RANK_MASTER, success ? MPI::FINISHED_DERIVED_CONTENT : MPI::DERIVED_CONTENT_FAIL, finish_payload);
+                      this->world.isend(this->controller_rank(), success ? MPI::FINISHED_DERIVED_CONTENT : MPI::DERIVED_CONTENT_FAIL, finish_payload);
                     finish_msg.wait();
 
                     break;
@@ -690,7 +718,7 @@ namespace transport
                     BOOST_LOG_SEV(pipe->get_log(), datapipe<number>::log_severity_level::normal) << "-- Worker sending WORKER_CLOSE_DOWN to master | close down at " << boost::posix_time::to_simple_string(now);
     
                     MPI::performance_data_payload close_payload(this->busyidle_timers.get_load_average(payload.get_group_name()));
-                    boost::mpi::request close_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_CLOSE_DOWN, close_payload);
+                    boost::mpi::request close_msg = this->world.isend(this->controller_rank(), MPI::WORKER_CLOSE_DOWN, close_payload);
                     close_msg.wait();
 
                     break;
@@ -717,6 +745,14 @@ namespace transport
         // ensure that a valid repository object has been constructed
         if(!this->repo) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_REPO_NOT_SET);
 
+        // group leaders relay scheduling traffic for their group, but do no work themselves
+        if(this->topology.is_leader(this->get_rank()))
+          {
+            group_leader leader(this->world, this->topology, this->arg_cache.get_prefetch_depth(), payload.get_logdir_path());
+            leader.relay<MPI::finished_postintegration_payload>(MPI::FINISHED_POSTINTEGRATION, MPI::POSTINTEGRATION_FAIL);
+            return;
+          }
+
         // extract our task from the database
         try
           {
@@ -810,8 +846,8 @@ namespace transport
             // construct batcher to hold postintegration output
             zeta_twopf_batcher<number> batcher = this->data_mgr->create_temp_zeta_twopf_container(z2pf, payload.get_tempdir_path(), payload.get_logdir_path(), this->get_rank(), m, std::move(dispatcher));
 
-            // is this 2pf task paired?
-            if(z2pf->is_paired())
+            // is this 2pf task paired? The master decides, because it may also fuse an unpaired task with its parent
+            if(payload.is_paired())
               {
                 // also need a callback for the paired integrator
                 std::unique_ptr< slave_container_dispatch<number> > i_dispatcher = std::make_unique< slave_container_dispatch<number> >(*this, MPI::INTEGRATION_DATA_READY, std::string("INTEGRATION_DATA_READY"));
@@ -860,7 +896,8 @@ namespace transport
             // construct batcher to hold output
             zeta_threepf_batcher<number> batcher = this->data_mgr->create_temp_zeta_threepf_container(z3pf, payload.get_tempdir_path(), payload.get_logdir_path(), this->get_rank(), m, std::move(p_dispatcher));
 
-            if(z3pf->is_paired())
+            // is this 3pf task paired? The master decides, because it may also fuse an unpaired task with its parent
+            if(payload.is_paired())
               {
                 // also need a callback for the paired integrator
                 std::unique_ptr< slave_container_dispatch<number> > i_dispatcher = std::make_unique< slave_container_dispatch<number> >(*this, MPI::INTEGRATION_DATA_READY, std::string("INTEGRATION_DATA_READY"));
@@ -963,7 +1000,7 @@ namespace transport
           {
             // wait for messages from scheduler, tracking idle time
             timers.idle();
-            boost::mpi::status stat = this->world.probe(MPI::RANK_MASTER);
+            boost::mpi::status stat = this->world.probe(this->controller_rank());
 
             timers.busy();
             switch(stat.tag())
@@ -975,7 +1012,7 @@ namespace transport
 
                     MPI::work_acknowledgment_payload ack_payload;
                     ack_payload.set_timestamp();
-                    boost::mpi::request ack_msg = this->world.isend(MPI::RANK_MASTER, MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
+                    boost::mpi::request ack_msg = this->world.isend(this->controller_rank(), MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
                     ack_msg.wait();
 
                     const std::list<unsigned int>& work_items = assignment_payload.get_items();
@@ -1039,7 +1076,7 @@ namespace transport
                                        pipe->get_data_cache_evictions(), this->busyidle_timers.get_load_average(payload.get_group_name())};
 
                     boost::mpi::request finish_msg =
-                      this->world.isend(MPI::RANK_MASTER, success ? MPI::FINISHED_POSTINTEGRATION : MPI::POSTINTEGRATION_FAIL, outgoing_payload);
+                      this->world.isend(this->controller_rank(), success ? MPI::FINISHED_POSTINTEGRATION : MPI::POSTINTEGRATION_FAIL, outgoing_payload);
                     finish_msg.wait();
 
                     break;
@@ -1059,7 +1096,7 @@ namespace transport
                     BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal) << "-- Worker sending WORKER_CLOSE_DOWN to master | close down at " << boost::posix_time::to_simple_string(now);
     
                     MPI::performance_data_payload close_payload(this->busyidle_timers.get_load_average(payload.get_group_name()));
-                    boost::mpi::request close_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_CLOSE_DOWN, close_payload);
+                    boost::mpi::request close_msg = this->world.isend(this->controller_rank(), MPI::WORKER_CLOSE_DOWN, close_payload);
                     close_msg.wait();
 
                     break;
@@ -1087,7 +1124,7 @@ namespace transport
         MPI::data_ready_payload payload(batcher.get_container_path());
 
         // advise master process that data is available in the named container
-        boost::mpi::request push_msg = this->world.isend(MPI::RANK_MASTER, message, payload);
+        boost::mpi::request push_msg = this->world.isend(this->controller_rank(), message, payload);
         push_msg.wait();
       }
 
@@ -1112,7 +1149,7 @@ namespace transport
         if(boost::filesystem::exists(product_filename))
           {
             MPI::content_ready_payload payload(product->get_name(), used_groups);
-            boost::mpi::request ready_msg = this->world.isend(MPI::RANK_MASTER, MPI::DERIVED_CONTENT_READY, payload);
+            boost::mpi::request ready_msg = this->world.isend(this->controller_rank(), MPI::DERIVED_CONTENT_READY, payload);
             ready_msg.wait();
           }
         else
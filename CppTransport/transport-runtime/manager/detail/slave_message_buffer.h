@@ -102,7 +102,7 @@ namespace transport
       };
 
 
-    void slave_message_buffer::push_back(std::string m)
+    inline void slave_message_buffer::push_back(std::string m)
       {
         std::ostringstream msg;
         msg << m;
@@ -124,7 +124,7 @@ namespace transport
       }
 
 
-    slave_message_buffer::~slave_message_buffer()
+    inline slave_message_buffer::~slave_message_buffer()
       {
         // send requests synchronously so they appear in the correct order
         for(const std::string& message : this->messages)
@@ -166,14 +166,14 @@ namespace transport
       };
 
 
-    slave_message_context::slave_message_context(slave_message_buffer& b, std::string ctx)
+    inline slave_message_context::slave_message_context(slave_message_buffer& b, std::string ctx)
       : buffer(b)
       {
         buffer.push_context(ctx);
       }
 
 
-    slave_message_context::~slave_message_context()
+    inline slave_message_context::~slave_message_context()
       {
         this->buffer.pop_context();
       }
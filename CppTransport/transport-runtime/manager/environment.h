@@ -32,8 +32,15 @@
 #include <string>
 #include <cstdlib>
 
+#include <cerrno>
+
 #include <sys/ioctl.h>
+#include <sys/wait.h>
 #include <pwd.h>
+#include <spawn.h>
+
+// environ is not declared by any standard header on all platforms
+extern char** environ;
 
 #include "transport-runtime/defaults.h"
 #include "transport-runtime/utilities/finder.h"
@@ -103,8 +110,20 @@ namespace transport
         //! returns exit code provided by system()
         int execute_python(const boost::filesystem::path& script);
 
+        //! execute a Python script; safe to call from several threads at once, provided has_python()
+        //! has been called beforehand so that lazy detection does not race.
+        //! Returns an exit status in the same form as execute_python()
+        int execute_python_concurrent(const boost::filesystem::path& script) const;
+
       protected:
 
+        //! build shell command which runs a Python script, discarding its output
+        std::string python_command(const boost::filesystem::path& script) const;
+
+        //! run a shell command as a child process and wait for it; unlike std::system() this does not alter
+        //! process-wide signal dispositions, so it can be called concurrently from several threads
+        static int spawn_shell(const std::string& command);
+
         //! detect Python installation details
         void detect_python();
 
@@ -279,7 +298,7 @@ namespace transport
       };
 
 
-    local_environment::local_environment()
+    inline local_environment::local_environment()
       : python_cached(false),
         python_available(false),
         matplotlib_cached(false),
@@ -314,7 +333,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_userid()
+    inline void local_environment::detect_userid()
       {
         struct passwd* pw;
         uid_t uid;
@@ -326,7 +345,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_home()
+    inline void local_environment::detect_home()
       {
         // TODO: Platform introspection
         // detect home directory
@@ -340,7 +359,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_terminal_type()
+    inline void local_environment::detect_terminal_type()
       {
         // TODO: Platform introspection
         // determine if terminal supports colour output
@@ -364,7 +383,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_graphviz()
+    inline void local_environment::detect_graphviz()
       {
         // TODO: platform introspection
         auto dot = this->find.find(CPPTRANSPORT_DOT_EXECUTABLE);
@@ -381,7 +400,7 @@ namespace transport
       }
     
     
-    void local_environment::detect_sendmail()
+    inline void local_environment::detect_sendmail()
       {
         // TODO: platform introspection
         auto sendmail = this->find.find(CPPTRANSPORT_SENDMAIL_EXECUTABLE);
@@ -398,7 +417,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_python()
+    inline void local_environment::detect_python()
       {
         // TODO: Platform introspection
         auto python = this->find.find(CPPTRANSPORT_PYTHON_EXECUTABLE);
@@ -417,7 +436,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_matplotlib()
+    inline void local_environment::detect_matplotlib()
       {
         if(!this->python_available)
           {
@@ -435,7 +454,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_matplotlib_base()
+    inline void local_environment::detect_matplotlib_base()
       {
         // get name of temporary file
         boost::filesystem::path temp_mpl = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
@@ -448,7 +467,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_matplotlib_needs_backend()
+    inline void local_environment::detect_matplotlib_needs_backend()
       {
         // get name of temporary file
         boost::filesystem::path temp_mpl = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
@@ -462,7 +481,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_matplotlib_stylesheets()
+    inline void local_environment::detect_matplotlib_stylesheets()
       {
         // get name of second temporary file
         boost::filesystem::path temp_sheets = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
@@ -476,7 +495,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_matplotlib_has_tick_labels()
+    inline void local_environment::detect_matplotlib_has_tick_labels()
       {
         // get name of third temporary file
         boost::filesystem::path temp_ticks = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
@@ -494,7 +513,7 @@ namespace transport
       }
 
 
-    void local_environment::detect_seaborn()
+    inline void local_environment::detect_seaborn()
       {
         if(!this->python_available)
           {
@@ -538,25 +557,60 @@ namespace transport
       }
 
 
-    int local_environment::execute_python(const boost::filesystem::path& script)
+    inline int local_environment::execute_python(const boost::filesystem::path& script)
       {
         // python detection is lazy; we don't look for it until we need it
         if(!this->python_cached) this->detect_python();
         
         if(!this->python_available) return EXIT_FAILURE;
-        
+
+        return std::system(this->python_command(script).c_str());
+      }
+
+
+    inline int local_environment::execute_python_concurrent(const boost::filesystem::path& script) const
+      {
+        // detection mutates state, so it must already have happened
+        if(!this->python_cached || !this->python_available) return EXIT_FAILURE;
+
+        return spawn_shell(this->python_command(script));
+      }
+
+
+    inline std::string local_environment::python_command(const boost::filesystem::path& script) const
+      {
         std::ostringstream command;
 
         // source user's .profile script if it exists
         auto src_cmd = source_profile();
         if(src_cmd) command << *src_cmd;
-        
+
         command << this->python_location.string() << " \"" << script.string() << "\" > /dev/null 2>&1";
-        return std::system(command.str().c_str());
+        return command.str();
+      }
+
+
+    inline int local_environment::spawn_shell(const std::string& command)
+      {
+        std::string shell = "/bin/sh";
+        std::string flag = "-c";
+        std::string cmd = command;
+        char* argv[] = { &shell[0], &flag[0], &cmd[0], nullptr };
+
+        pid_t pid;
+        if(::posix_spawn(&pid, shell.c_str(), nullptr, nullptr, argv, environ) != 0) return EXIT_FAILURE;
+
+        int status = 0;
+        while(::waitpid(pid, &status, 0) < 0)
+          {
+            if(errno != EINTR) return EXIT_FAILURE;
+          }
+
+        return status;
       }
 
 
-    int local_environment::execute_dot(const boost::filesystem::path& script, const boost::filesystem::path& output, const std::string& format)
+    inline int local_environment::execute_dot(const boost::filesystem::path& script, const boost::filesystem::path& output, const std::string& format)
       {
         if(!this->dot_available) return EXIT_FAILURE;
 
@@ -571,7 +625,7 @@ namespace transport
       }
     
     
-    int local_environment::execute_sendmail(const std::string& body, const std::string& to)
+    inline int local_environment::execute_sendmail(const std::string& body, const std::string& to)
       {
         if(!this->sendmail_available) return EXIT_FAILURE;
 
@@ -592,7 +646,7 @@ namespace transport
       }
 
 
-    boost::optional<boost::filesystem::path> local_environment::config_file_path() const
+    inline boost::optional<boost::filesystem::path> local_environment::config_file_path() const
       {
         if(!this->home) return boost::optional<boost::filesystem::path>();
 
@@ -602,7 +656,7 @@ namespace transport
       }
     
     
-    std::unique_ptr<finder> local_environment::make_resource_finder(boost::filesystem::path tail) const
+    inline std::unique_ptr<finder> local_environment::make_resource_finder(boost::filesystem::path tail) const
       {
         auto f = std::make_unique<finder>();
         
@@ -612,7 +666,7 @@ namespace transport
       }
 
 
-    unsigned int local_environment::detect_terminal_width(unsigned int default_width) const
+    inline unsigned int local_environment::detect_terminal_width(unsigned int default_width) const
       {
         // TODO: Platform introspection
         
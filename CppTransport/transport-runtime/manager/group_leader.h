@@ -0,0 +1,494 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_GROUP_LEADER_H
+#define CPPTRANSPORT_GROUP_LEADER_H
+
+
+#include <vector>
+#include <list>
+#include <deque>
+#include <map>
+#include <sstream>
+#include <algorithm>
+
+#include "transport-runtime/manager/mpi_operations.h"
+#include "transport-runtime/manager/worker_scheduler.h"
+#include "transport-runtime/manager/worker_topology.h"
+
+#include "transport-runtime/repository/writers/generic_writer.h"
+
+#include "transport-runtime/defaults.h"
+#include "transport-runtime/messages.h"
+#include "transport-runtime/exceptions.h"
+
+#include "boost/mpi.hpp"
+#include "boost/filesystem/operations.hpp"
+#include "boost/date_time/posix_time/posix_time.hpp"
+
+
+namespace transport
+  {
+
+    namespace group_leader_impl
+      {
+
+        //! record for a block of work assigned to the group by the master
+        template <typename FinishedPayload>
+        class group_block
+          {
+
+          public:
+
+            //! number of work items not yet reported complete by members of the group
+            unsigned int remaining;
+
+            //! has a completion report been merged into this block?
+            bool reported;
+
+            //! did any member report failure?
+            bool failed;
+
+            //! merged completion reports
+            FinishedPayload payload;
+
+          };
+
+
+        //! outstanding assignment issued to a member of the group
+        class member_assignment
+          {
+
+          public:
+
+            //! block from which the items were drawn
+            unsigned int block;
+
+            //! number of work items in the assignment
+            unsigned int items;
+
+          };
+
+      }   // namespace group_leader_impl
+
+
+    //! group_leader relays scheduling traffic between the master and a group of workers.
+    //! It receives blocks of work from the master and schedules them over its group using a local
+    //! worker_scheduler. Container notifications from the group are forwarded to the master, and the
+    //! completion reports for each block are merged and returned as a single report, so the master sees
+    //! the group as one worker
+    class group_leader
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor sets up a log file in the given directory
+        group_leader(boost::mpi::communicator& w, const worker_topology& t, unsigned int lookahead,
+                     const boost::filesystem::path& logdir);
+
+        //! disable copying
+        group_leader(const group_leader&) = delete;
+
+        //! destructor removes log sink
+        ~group_leader();
+
+
+        // INTERFACE
+
+      public:
+
+        //! relay scheduling traffic for one task until the group has closed down;
+        //! FinishedPayload is the payload carried by messages with finished_tag and fail_tag
+        template <typename FinishedPayload>
+        void relay(unsigned int finished_tag, unsigned int fail_tag);
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! collect identification data from the group, then identify the group to the master
+        void identify_group();
+
+        //! issue assignments to members with free slots, drawing from the current block
+        void assign_work(std::vector< std::deque<group_leader_impl::member_assignment> >& member_work, unsigned int block);
+
+        //! report completed blocks to the master, oldest first
+        template <typename FinishedPayload>
+        void report_blocks(std::map< unsigned int, group_leader_impl::group_block<FinishedPayload> >& blocks,
+                           unsigned int finished_tag, unsigned int fail_tag);
+
+        //! receive a message from a member and forward it unchanged to the master
+        template <typename Payload>
+        void forward(const boost::mpi::status& stat);
+
+        //! convert an MPI rank to a member number
+        unsigned int member_number(unsigned int rank) const;
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! BOOST::MPI world communicator
+        boost::mpi::communicator& world;
+
+        //! MPI ranks of the members of this group
+        std::vector<unsigned int> members;
+
+        //! scheduler for work items within this group
+        worker_scheduler scheduler;
+
+
+        // LOGGING
+
+        //! logger source
+        base_writer::logger log_source;
+
+        //! logger sink
+        boost::shared_ptr<base_writer::sink_t> log_sink;
+
+      };
+
+
+    inline group_leader::group_leader(boost::mpi::communicator& w, const worker_topology& t, unsigned int lookahead,
+                               const boost::filesystem::path& logdir)
+      : world(w),
+        members(t.get_members(static_cast<unsigned int>(w.rank()))),
+        scheduler(static_cast<unsigned int>(members.size())),
+        log_source(boost::log::keywords::channel = "leader")
+      {
+        this->scheduler.reset(static_cast<unsigned int>(this->members.size()));
+        this->scheduler.set_lookahead(lookahead);
+
+        // set up logging, using the same naming convention as worker logs
+        std::ostringstream log_file;
+        log_file << CPPTRANSPORT_LOG_FILENAME_A << w.rank() << CPPTRANSPORT_LOG_FILENAME_B;
+        boost::filesystem::path log_path = logdir / log_file.str();
+
+        boost::shared_ptr<boost::log::sinks::text_file_backend> backend =
+          boost::make_shared<boost::log::sinks::text_file_backend>(
+            boost::log::keywords::file_name = log_path.string(),
+            boost::log::keywords::open_mode = std::ios::app
+          );
+        backend->auto_flush(true);
+
+        this->log_sink = boost::make_shared<base_writer::sink_t>(backend);
+        this->log_sink->set_formatter(
+          boost::log::expressions::stream
+            << boost::log::expressions::format_date_time<boost::posix_time::ptime>("TimeStamp", "%Y-%m-%d %H:%M:%S")
+            << " | "
+            << boost::log::expressions::attr< base_writer::log_severity_level, base_writer_severity_tag >("Severity")
+            << " | "
+            << boost::log::expressions::smessage
+        );
+        this->log_sink->set_filter(
+          boost::log::expressions::attr< std::string >("Channel") == "leader"
+        );
+
+        boost::log::core::get()->add_sink(this->log_sink);
+        boost::log::add_common_attributes();
+
+        BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal)
+          << "** Group leader for " << this->members.size() << " worker" << (this->members.size() != 1 ? std::string{"s"} : std::string{});
+      }
+
+
+    inline group_leader::~group_leader()
+      {
+        if(this->log_sink) boost::log::core::get()->remove_sink(this->log_sink);
+      }
+
+
+    inline unsigned int group_leader::member_number(unsigned int rank) const
+      {
+        auto t = std::find(this->members.begin(), this->members.end(), rank);
+        if(t == this->members.end()) throw runtime_exception(exception_type::MPI_ERROR, CPPTRANSPORT_GROUP_NOT_MEMBER);
+
+        return static_cast<unsigned int>(std::distance(this->members.begin(), t));
+      }
+
+
+    inline void group_leader::identify_group()
+      {
+        // the group is presented to the master as a single worker; it counts as a GPU if any member is,
+        // and advertises the combined capacity of its members
+        worker_type type = worker_type::cpu;
+        unsigned int capacity = 0;
+        unsigned int priority = 0;
+
+        while(!this->scheduler.is_ready())
+          {
+            boost::mpi::status stat = this->world.probe();
+
+            if(stat.tag() == MPI::WORKER_IDENTIFICATION)
+              {
+                MPI::slave_information_payload payload;
+                this->world.recv(stat.source(), MPI::WORKER_IDENTIFICATION, payload);
+                this->scheduler.initialize_worker(this->log_source, this->member_number(stat.source()), payload);
+
+                if(payload.get_type() == worker_type::gpu) type = worker_type::gpu;
+                capacity += payload.get_capacity();
+                priority = std::max(priority, payload.get_priority());
+              }
+            else
+              {
+                BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::error)
+                  << "!! Received unexpected MPI message " << stat.tag() << " from rank " << stat.source() << " during identification; discarding";
+                this->world.recv(stat.source(), stat.tag());
+              }
+          }
+
+        this->scheduler.complete_queue_setup();
+
+        MPI::slave_information_payload payload(type, capacity, priority);
+        boost::mpi::request id_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_IDENTIFICATION, payload);
+        id_msg.wait();
+      }
+
+
+    inline void group_leader::assign_work(std::vector< std::deque<group_leader_impl::member_assignment> >& member_work, unsigned int block)
+      {
+        std::list<work_assignment> work = this->scheduler.assign_work(this->log_source);
+
+        std::vector<boost::mpi::request> msg_status;
+        msg_status.reserve(work.size());
+
+        for(const work_assignment& assgn : work)
+          {
+            MPI::work_assignment_payload payload(assgn.get_items());
+            msg_status.push_back(this->world.isend(this->members[assgn.get_worker()], MPI::NEW_WORK_ASSIGNMENT, payload));
+
+            this->scheduler.mark_assigned(assgn);
+            member_work[assgn.get_worker()].push_back(
+              group_leader_impl::member_assignment{ block, static_cast<unsigned int>(assgn.get_items().size()) });
+
+            BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal)
+              << "++ Assigned " << assgn.get_items().size() << " work item" << (assgn.get_items().size() == 1 ? std::string{} : std::string{"s"})
+              << " to MPI rank " << this->members[assgn.get_worker()];
+          }
+
+        boost::mpi::wait_all(msg_status.begin(), msg_status.end());
+      }
+
+
+    template <typename Payload>
+    void group_leader::forward(const boost::mpi::status& stat)
+      {
+        Payload payload;
+        this->world.recv(stat.source(), stat.tag(), payload);
+
+        boost::mpi::request fwd_msg = this->world.isend(MPI::RANK_MASTER, stat.tag(), payload);
+        fwd_msg.wait();
+      }
+
+
+    template <typename FinishedPayload>
+    void group_leader::report_blocks(std::map< unsigned int, group_leader_impl::group_block<FinishedPayload> >& blocks,
+                                     unsigned int finished_tag, unsigned int fail_tag)
+      {
+        // the master retires assignments in the order they were issued, so blocks are reported in order
+        // even if a later block completes first
+        while(!blocks.empty() && blocks.begin()->second.remaining == 0)
+          {
+            group_leader_impl::group_block<FinishedPayload>& block = blocks.begin()->second;
+
+            // the master schedules the group as if it were a single worker, so divide the time
+            // spent by the group between its members to give the group's throughput
+            block.payload.share_wallclock_time(static_cast<unsigned int>(this->members.size()));
+
+            boost::mpi::request finish_msg = this->world.isend(MPI::RANK_MASTER, block.failed ? fail_tag : finished_tag, block.payload);
+            finish_msg.wait();
+
+            BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal)
+              << "++ Reported completion of block " << blocks.begin()->first << " to master";
+
+            blocks.erase(blocks.begin());
+          }
+      }
+
+
+    template <typename FinishedPayload>
+    void group_leader::relay(unsigned int finished_tag, unsigned int fail_tag)
+      {
+        this->identify_group();
+
+        // blocks received from the master but not yet reported complete, keyed by order of receipt
+        std::map< unsigned int, group_leader_impl::group_block<FinishedPayload> > blocks;
+        unsigned int next_block = 0;
+
+        // blocks waiting to be released into the local scheduler; a block is released only when the previous one
+        // has been fully assigned, so every member assignment draws from a single block
+        std::deque< std::pair< unsigned int, std::list<unsigned int> > > pending;
+        unsigned int current_block = 0;
+
+        // outstanding assignments for each member, oldest first
+        std::vector< std::deque<group_leader_impl::member_assignment> > member_work(this->members.size());
+
+        bool end_of_work = false;
+        bool group_notified = false;
+        unsigned int closed = 0;
+        double total_load = 0.0;
+
+        while(closed < this->members.size())
+          {
+            if(this->scheduler.is_finished() && !pending.empty())
+              {
+                current_block = pending.front().first;
+                this->scheduler.enqueue(pending.front().second);
+                pending.pop_front();
+              }
+
+            if(this->scheduler.assignable()) this->assign_work(member_work, current_block);
+
+            // pass end-of-work on to the group once every block has been reported to the master
+            if(end_of_work && !group_notified && blocks.empty())
+              {
+                std::vector<boost::mpi::request> requests(this->members.size());
+                for(unsigned int i = 0; i < this->members.size(); ++i)
+                  {
+                    requests[i] = this->world.isend(this->members[i], MPI::END_OF_WORK);
+                  }
+                boost::mpi::wait_all(requests.begin(), requests.end());
+                group_notified = true;
+              }
+
+            boost::mpi::status stat = this->world.probe();
+
+            switch(stat.tag())
+              {
+                case MPI::NEW_WORK_ASSIGNMENT:
+                  {
+                    MPI::work_assignment_payload payload;
+                    this->world.recv(stat.source(), MPI::NEW_WORK_ASSIGNMENT, payload);
+
+                    MPI::work_acknowledgment_payload ack_payload;
+                    ack_payload.set_timestamp();
+                    boost::mpi::request ack_msg = this->world.isend(MPI::RANK_MASTER, MPI::NEW_WORK_ACKNOWLEDGMENT, ack_payload);
+                    ack_msg.wait();
+
+                    group_leader_impl::group_block<FinishedPayload>& block = blocks[next_block];
+                    block.remaining = static_cast<unsigned int>(payload.get_items().size());
+                    block.reported = false;
+                    block.failed = false;
+
+                    BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal)
+                      << "++ Received block " << next_block << " of " << block.remaining << " work item" << (block.remaining == 1 ? std::string{} : std::string{"s"}) << " from master";
+
+                    pending.emplace_back(next_block, payload.get_items());
+                    ++next_block;
+                    break;
+                  }
+
+                case MPI::NEW_WORK_ACKNOWLEDGMENT:
+                  {
+                    MPI::work_acknowledgment_payload payload;
+                    this->world.recv(stat.source(), MPI::NEW_WORK_ACKNOWLEDGMENT, payload);
+                    BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal)
+                      << "++ Rank " << stat.source() << " advising receipt of work assignment at time " << boost::posix_time::to_simple_string(payload.get_timestamp());
+                    break;
+                  }
+
+                case MPI::INTEGRATION_DATA_READY:
+                case MPI::POSTINTEGRATION_DATA_READY:
+                  {
+                    this->forward<MPI::data_ready_payload>(stat);
+                    break;
+                  }
+
+                case MPI::DERIVED_CONTENT_READY:
+                  {
+                    this->forward<MPI::content_ready_payload>(stat);
+                    break;
+                  }
+
+                case MPI::END_OF_WORK:
+                  {
+                    this->world.recv(stat.source(), MPI::END_OF_WORK);
+                    end_of_work = true;
+                    BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal) << "++ Notified of end-of-work by master";
+                    break;
+                  }
+
+                case MPI::WORKER_CLOSE_DOWN:
+                  {
+                    MPI::performance_data_payload payload;
+                    this->world.recv(stat.source(), MPI::WORKER_CLOSE_DOWN, payload);
+                    this->scheduler.mark_inactive(this->member_number(stat.source()));
+
+                    total_load += payload.get_load_average();
+                    ++closed;
+                    break;
+                  }
+
+                default:
+                  {
+                    if(stat.tag() == finished_tag || stat.tag() == fail_tag)
+                      {
+                        FinishedPayload payload;
+                        this->world.recv(stat.source(), stat.tag(), payload);
+
+                        unsigned int member = this->member_number(stat.source());
+                        this->scheduler.mark_unassigned(member, payload.get_wallclock_time(), payload.get_items_processed());
+
+                        if(member_work[member].empty()) throw runtime_exception(exception_type::MPI_ERROR, CPPTRANSPORT_GROUP_NO_ASSIGNMENT);
+                        group_leader_impl::member_assignment assignment = member_work[member].front();
+                        member_work[member].pop_front();
+
+                        group_leader_impl::group_block<FinishedPayload>& block = blocks[assignment.block];
+                        if(block.reported) block.payload.merge(payload);
+                        else               block.payload = payload;
+
+                        block.reported = true;
+                        block.failed = block.failed || stat.tag() == fail_tag;
+                        block.remaining -= std::min(block.remaining, assignment.items);
+
+                        this->report_blocks(blocks, finished_tag, fail_tag);
+                      }
+                    else
+                      {
+                        BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::warning)
+                          << "!! Received unexpected MPI message " << stat.tag() << " from rank " << stat.source() << "; discarding";
+                        this->world.recv(stat.source(), stat.tag());
+                      }
+                    break;
+                  }
+              }
+          }
+
+        // pass a summary of the group's load to the master
+        MPI::performance_data_payload close_payload(this->members.empty() ? 0.0 : total_load / this->members.size());
+        boost::mpi::request close_msg = this->world.isend(MPI::RANK_MASTER, MPI::WORKER_CLOSE_DOWN, close_payload);
+        close_msg.wait();
+
+        BOOST_LOG_SEV(this->log_source, base_writer::log_severity_level::normal) << "++ Group closed down";
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_GROUP_LEADER_H
@@ -34,6 +34,7 @@
 #include "transport-runtime/manager/detail/master_controller_core.h"
 #include "transport-runtime/manager/detail/master_controller_switches.h"
 #include "transport-runtime/manager/detail/master_controller_integration.h"
+#include "transport-runtime/manager/detail/master_controller_autotune.h"
 #include "transport-runtime/manager/detail/master_controller_postintegration.h"
 #include "transport-runtime/manager/detail/master_controller_output.h"
 
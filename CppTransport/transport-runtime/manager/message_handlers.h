@@ -166,7 +166,7 @@ namespace transport
       };
 
 
-    void error_handler::operator()(const std::string& msg) const
+    inline void error_handler::operator()(const std::string& msg) const
       {
         bool colour = this->env.has_colour_terminal_support() && this->args.get_colour_output();
 
@@ -176,7 +176,7 @@ namespace transport
       }
 
 
-    void warning_handler::operator()(const std::string& msg) const
+    inline void warning_handler::operator()(const std::string& msg) const
       {
         bool colour = this->env.has_colour_terminal_support() && this->args.get_colour_output();
 
@@ -187,7 +187,7 @@ namespace transport
       }
 
 
-    void message_handler::operator()(const std::string& msg, highlight mode) const
+    inline void message_handler::operator()(const std::string& msg, highlight mode) const
       {
         bool colour = this->env.has_colour_terminal_support() && this->args.get_colour_output();
 
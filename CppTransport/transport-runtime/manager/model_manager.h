@@ -31,6 +31,8 @@
 #include <assert.h>
 #include <iostream>
 #include <list>
+#include <set>
+#include <map>
 
 #include <functional>
 #include <algorithm>
@@ -44,11 +46,14 @@
 #include "transport-runtime/manager/message_handlers.h"
 
 #include "transport-runtime/utilities/formatter.h"
+#include "transport-runtime/utilities/finder.h"
 
 // forward-declare model class if needed
 #include "transport-runtime/models/model_forward_declare.h"
+#include "transport-runtime/models/model_plugin.h"
 
 #include "transport-runtime/version.h"
+#include "transport-runtime/defaults.h"
 #include "transport-runtime/exceptions.h"
 #include "transport-runtime/messages.h"
 
@@ -224,8 +229,22 @@ namespace transport
 
       public:
 
-        //! Search for a model by uid and minimum revision number
-        model<number>* operator()(const std::string& uid, unsigned int min_revision) const;
+        //! Search for a model by uid and minimum revision number.
+        //! If no registered model matches, attempt to load a model plugin for this uid from the plugin search paths
+        model<number>* operator()(const std::string& uid, unsigned int min_revision);
+
+
+        // INTERFACE -- MODEL PLUGINS
+
+      protected:
+
+        //! search for a plugin providing the model with the given uid, and register its model if found;
+        //! returns true if a model was registered
+        bool load_plugin(const std::string& uid);
+
+        //! build finder for the plugin search paths: those given on the command line, followed by
+        //! those in the CPPTRANSPORT_PLUGIN_PATH environment variable
+        finder plugin_finder() const;
 
 
         // INTERFACE -- WRITE DETAILS TO STREAM
@@ -244,6 +263,12 @@ namespace transport
         //! database of registered models
         model_db models;
 
+        //! uids for which a plugin search has already been made, to avoid repeating failed searches
+        std::set< std::string > plugin_searches;
+
+        //! locations of plugins from which models have been loaded, indexed by uid
+        std::map< std::string, boost::filesystem::path > plugin_sources;
+
 
         // ENVIRONMENTAL POLICIES
 
@@ -257,10 +282,16 @@ namespace transport
 
 
     template <typename number>
-    model<number>* model_manager<number>::operator()(const std::string& uid, unsigned int min_revision) const
+    model<number>* model_manager<number>::operator()(const std::string& uid, unsigned int min_revision)
       {
         typename model_db::const_iterator t = std::find_if(this->models.begin(), this->models.end(), ModelInstanceComparator<number>(uid, min_revision));
 
+        // models are loaded from plugins lazily, so that each process loads only the models it actually uses
+        if(t == this->models.end() && this->load_plugin(uid))
+          {
+            t = std::find_if(this->models.begin(), this->models.end(), ModelInstanceComparator<number>(uid, min_revision));
+          }
+
         if(t == this->models.end())
           {
             std::ostringstream msg;
@@ -323,6 +354,86 @@ namespace transport
       }
 
 
+    template <typename number>
+    finder model_manager<number>::plugin_finder() const
+      {
+        finder f;
+
+        f.add(this->arg_cache.get_plugin_paths());
+        f.add_environment_variable(CPPTRANSPORT_PLUGIN_PATH_ENV);
+
+        return f;
+      }
+
+
+    template <typename number>
+    bool model_manager<number>::load_plugin(const std::string& uid)
+      {
+        // search only once for each uid
+        if(!this->plugin_searches.insert(uid).second) return false;
+
+        boost::optional< boost::filesystem::path > path = this->plugin_finder().find(uid + CPPTRANSPORT_PLUGIN_EXTENSION);
+        if(!path) return false;
+
+        // opening the library throws if it cannot be loaded, or does not export the plugin interface;
+        // a missing or malformed plugin should not be silently ignored, because the user has evidently
+        // tried to supply one
+        std::shared_ptr<model_plugin> plugin = std::make_shared<model_plugin>(*path);
+
+        if(plugin->get_api() != CPPTRANSPORT_RUNTIME_API_VERSION)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_API_A << " '" << path->string() << "' " << CPPTRANSPORT_PLUGIN_API_B << " "
+                << format_version(plugin->get_api()) << " " << CPPTRANSPORT_PLUGIN_API_C << " " << format_version(CPPTRANSPORT_RUNTIME_API_VERSION);
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        if(!plugin->template provides_number_type<number>())
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_API_A << " '" << path->string() << "' " << CPPTRANSPORT_PLUGIN_NUMBER_TYPE;
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        // the model object crosses the library boundary, so the plugin must have been compiled by the same
+        // toolchain against the same runtime installation; the API version alone does not guarantee this
+        if(plugin->get_abi_hash() != model_plugin_abi_hash())
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_API_A << " '" << path->string() << "' " << CPPTRANSPORT_PLUGIN_ABI_A << " "
+                << plugin->get_abi_hash() << ", " << CPPTRANSPORT_PLUGIN_ABI_B << " " << model_plugin_abi_hash() << ")";
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        if(plugin->get_uid() != uid)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_API_A << " '" << path->string() << "' " << CPPTRANSPORT_PLUGIN_UID_A << " '"
+                << plugin->get_uid() << "' " << CPPTRANSPORT_PLUGIN_UID_B << " '" << uid << "'";
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        // the number type has been checked above, so the model constructed by the plugin is a model<number>
+        model<number>* raw = static_cast< model<number>* >(plugin->create(this->env, this->arg_cache));
+
+        if(raw == nullptr)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_API_A << " '" << path->string() << "' " << CPPTRANSPORT_PLUGIN_CREATE_FAIL;
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        // the model must be destroyed by the plugin that created it, and the library must remain open until then;
+        // the deleter captures the plugin handle, which closes the library when the last reference is released
+        std::shared_ptr< model<number> > m(raw, [plugin](model<number>* p) { plugin->destroy(p); });
+
+        this->register_model(m);
+        this->plugin_sources[uid] = *path;
+
+        return true;
+      }
+
+
     template <typename number>
     void model_manager<number>::write_models(std::ostream& stream) const
       {
@@ -336,6 +447,12 @@ namespace transport
             stream << c << ". " << mdl->get_name() << " [license=" << mdl->get_license() << ", revision=" << mdl->get_revision() << "]" << '\n';
             stream << "   backend = " << mdl->get_backend() << " [bg=" << mdl->get_back_stepper() << ", pert=" << mdl->get_pert_stepper() << "]" << '\n';
             stream << "   UID = " << rec.get_uid() << " | built using CppTransport " << format_version(mdl->get_translator_version()) << '\n';
+
+            auto t = this->plugin_sources.find(rec.get_uid());
+            if(t != this->plugin_sources.end())
+              {
+                stream << "   " << CPPTRANSPORT_PLUGIN_LOADED << " " << t->second.string() << '\n';
+              }
           }
       }
 
@@ -27,6 +27,8 @@
 #ifndef CPPTRANSPORT_MPI_OPERATIONS_H
 #define CPPTRANSPORT_MPI_OPERATIONS_H
 
+#include <algorithm>
+
 #include "boost/mpi.hpp"
 #include "boost/serialization/string.hpp"
 #include "boost/serialization/list.hpp"
@@ -473,6 +475,29 @@ namespace transport
 		            //! Get timestamp
 		            boost::posix_time::ptime        get_timestamp()            const { return this->timestamp; }
 
+                //! Merge the report for another assignment into this one; used by group leaders
+                //! to summarize the work of their group for the master
+                void merge(const finished_integration_payload& obj)
+                  {
+                    this->integration_time += obj.integration_time;
+                    this->max_integration_time = std::max(this->max_integration_time, obj.max_integration_time);
+                    this->min_integration_time = std::min(this->min_integration_time, obj.min_integration_time);
+                    this->batching_time += obj.batching_time;
+                    this->max_batching_time = std::max(this->max_batching_time, obj.max_batching_time);
+                    this->min_batching_time = std::min(this->min_batching_time, obj.min_batching_time);
+                    this->wallclock_time += obj.wallclock_time;
+                    this->num_success += obj.num_success;
+                    this->num_failures += obj.num_failures;
+                    this->num_refinements += obj.num_refinements;
+                    this->failed_serials.insert(obj.failed_serials.begin(), obj.failed_serials.end());
+                    this->load_average = std::max(this->load_average, obj.load_average);
+                    this->timestamp = std::max(this->timestamp, obj.timestamp);
+                  }
+
+                //! Divide wallclock time between n workers which shared the work, so the master sees
+                //! the throughput of the whole group
+                void share_wallclock_time(unsigned int n) { if(n > 0) this->wallclock_time /= n; }
+
               private:
 
                 //! Total integration time
@@ -779,6 +804,45 @@ namespace transport
 				        //! Get timestamp
 				        boost::posix_time::ptime       get_timestamp()                 const { return(this->timestamp); }
 
+                //! Merge the report for another assignment into this one; used by group leaders
+                //! to summarize the work of their group for the master
+                void merge(const finished_derived_payload& obj)
+                  {
+                    this->database_time += obj.database_time;
+                    this->cpu_time += obj.cpu_time;
+                    this->items_processed += obj.items_processed;
+                    this->processing_time += obj.processing_time;
+                    this->max_processing_time = std::max(this->max_processing_time, obj.max_processing_time);
+                    this->min_processing_time = std::min(this->min_processing_time, obj.min_processing_time);
+                    this->time_config_hits += obj.time_config_hits;
+                    this->time_config_unloads += obj.time_config_unloads;
+                    this->twopf_kconfig_hits += obj.twopf_kconfig_hits;
+                    this->twopf_kconfig_unloads += obj.twopf_kconfig_unloads;
+                    this->threepf_kconfig_hits += obj.threepf_kconfig_hits;
+                    this->threepf_kconfig_unloads += obj.threepf_kconfig_unloads;
+                    this->stats_hits += obj.stats_hits;
+                    this->stats_unloads += obj.stats_unloads;
+                    this->data_hits += obj.data_hits;
+                    this->data_unloads += obj.data_unloads;
+                    this->time_config_evictions += obj.time_config_evictions;
+                    this->twopf_kconfig_evictions += obj.twopf_kconfig_evictions;
+                    this->threepf_kconfig_evictions += obj.threepf_kconfig_evictions;
+                    this->stats_evictions += obj.stats_evictions;
+                    this->data_evictions += obj.data_evictions;
+                    this->load_average = std::max(this->load_average, obj.load_average);
+                    this->timestamp = std::max(this->timestamp, obj.timestamp);
+
+                    for(const std::string& group : obj.content_groups)
+                      {
+                        if(std::find(this->content_groups.begin(), this->content_groups.end(), group) == this->content_groups.end())
+                          this->content_groups.push_back(group);
+                      }
+                  }
+
+                //! Divide CPU time between n workers which shared the work, so the master sees
+                //! the throughput of the whole group
+                void share_wallclock_time(unsigned int n) { if(n > 0) this->cpu_time /= n; }
+
 
 		          private:
 
@@ -907,7 +971,8 @@ namespace transport
                     tempdir(tmp_d.string()),
                     logdir(log_d.string()),
                     tags(std::move(tg)),
-                    workgroup_number(0)
+                    workgroup_number(0),
+                    paired(false)
                   {
                   }
 
@@ -926,7 +991,8 @@ namespace transport
                     tags(std::move(tg)),
                     paired_tempdir(i_tmp_d.string()),
                     paired_logdir(i_log_d.string()),
-                    workgroup_number(wg)
+                    workgroup_number(wg),
+                    paired(true)
                   {
                   }
 
@@ -951,6 +1017,10 @@ namespace transport
                 //! Get workgroup number for paired integration
                 unsigned int                  get_paired_workgroup_number() const { return(this->workgroup_number); }
 
+                //! Should the postintegration be paired with its parent integration?
+                //! Set for tasks which are paired in the repository, and for tasks fused with their parent in the job queue
+                bool                          is_paired()                   const { return(this->paired); }
+
                 //! Get tags specified on the command line, used to narrow-down the list of content groups
                 const std::list<std::string>& get_tags()                    const { return(this->tags); }
 
@@ -980,6 +1050,9 @@ namespace transport
                 //! Workgroup number for paired integration (if using)
                 unsigned int workgroup_number;
 
+                //! Pair with parent integration?
+                bool paired;
+
                 // enable boost::serialization support, and hence automated packing for transmission over MPI
                 friend class boost::serialization::access;
 
@@ -994,6 +1067,7 @@ namespace transport
                     ar & paired_tempdir;
                     ar & paired_logdir;
                     ar & workgroup_number;
+                    ar & paired;
                   }
 
               };
@@ -1117,6 +1191,45 @@ namespace transport
 		            //! Get timestamp
 		            boost::posix_time::ptime       get_timestamp()                 const { return(this->timestamp); }
 
+                //! Merge the report for another assignment into this one; used by group leaders
+                //! to summarize the work of their group for the master
+                void merge(const finished_postintegration_payload& obj)
+                  {
+                    this->database_time += obj.database_time;
+                    this->cpu_time += obj.cpu_time;
+                    this->items_processed += obj.items_processed;
+                    this->processing_time += obj.processing_time;
+                    this->max_processing_time = std::max(this->max_processing_time, obj.max_processing_time);
+                    this->min_processing_time = std::min(this->min_processing_time, obj.min_processing_time);
+                    this->time_config_hits += obj.time_config_hits;
+                    this->time_config_unloads += obj.time_config_unloads;
+                    this->twopf_kconfig_hits += obj.twopf_kconfig_hits;
+                    this->twopf_kconfig_unloads += obj.twopf_kconfig_unloads;
+                    this->threepf_kconfig_hits += obj.threepf_kconfig_hits;
+                    this->threepf_kconfig_unloads += obj.threepf_kconfig_unloads;
+                    this->stats_hits += obj.stats_hits;
+                    this->stats_unloads += obj.stats_unloads;
+                    this->data_hits += obj.data_hits;
+                    this->data_unloads += obj.data_unloads;
+                    this->time_config_evictions += obj.time_config_evictions;
+                    this->twopf_kconfig_evictions += obj.twopf_kconfig_evictions;
+                    this->threepf_kconfig_evictions += obj.threepf_kconfig_evictions;
+                    this->stats_evictions += obj.stats_evictions;
+                    this->data_evictions += obj.data_evictions;
+                    this->load_average = std::max(this->load_average, obj.load_average);
+                    this->timestamp = std::max(this->timestamp, obj.timestamp);
+
+                    for(const std::string& group : obj.content_groups)
+                      {
+                        if(std::find(this->content_groups.begin(), this->content_groups.end(), group) == this->content_groups.end())
+                          this->content_groups.push_back(group);
+                      }
+                  }
+
+                //! Divide processing time between n workers which shared the work, so the master sees
+                //! the throughput of the whole group
+                void share_wallclock_time(unsigned int n) { if(n > 0) this->processing_time /= n; }
+
 
               private:
 
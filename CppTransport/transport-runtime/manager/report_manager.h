@@ -110,7 +110,7 @@ namespace transport
           };
     
     
-        report_alert::report_alert(std::string m)
+        inline report_alert::report_alert(std::string m)
           : msg(m),
             count(1),
             created(boost::posix_time::second_clock::universal_time()),
@@ -119,7 +119,7 @@ namespace transport
           }
     
     
-        void report_alert::operator++()
+        inline void report_alert::operator++()
           {
             ++this->count;
             this->last_update = boost::posix_time::second_clock::universal_time();
@@ -310,7 +310,7 @@ namespace transport
       };
     
     
-    void report_manager::new_task(std::string name, unsigned int n, unsigned int n_max)
+    inline void report_manager::new_task(std::string name, unsigned int n, unsigned int n_max)
       {
         this->task_name = std::move(name);
         
@@ -340,7 +340,7 @@ namespace transport
       }
     
     
-    void report_manager::end_task()
+    inline void report_manager::end_task()
       {
         // issue email version if required
         if(this->arg_cache.email_end())
@@ -374,7 +374,7 @@ namespace transport
       }
     
     
-    void report_manager::issue_short_report()
+    inline void report_manager::issue_short_report()
       {
         // write to terminal
         if(!this->arg_cache.get_verbose()) return;
@@ -463,7 +463,7 @@ namespace transport
       }
     
     
-    bool report_manager::statistics_report(std::ostream& stream, reporting::key_value::print_options options, bool title)
+    inline bool report_manager::statistics_report(std::ostream& stream, reporting::key_value::print_options options, bool title)
       {
         if(title) stream << CPPTRANSPORT_REPORT_STATISTICS << '\n' << '\n';
 
@@ -487,7 +487,7 @@ namespace transport
       }
     
     
-    bool report_manager::resources_report(std::ostream& stream, reporting::key_value::print_options options, bool title)
+    inline bool report_manager::resources_report(std::ostream& stream, reporting::key_value::print_options options, bool title)
       {
         if(title) stream << CPPTRANSPORT_REPORT_RESOURCES << '\n' << '\n';
 
@@ -554,7 +554,7 @@ namespace transport
       }
     
     
-    bool report_manager::alerts_report(std::ostream& stream, bool title)
+    inline bool report_manager::alerts_report(std::ostream& stream, bool title)
       {
         if(this->alerts.empty()) return false;
         
@@ -654,7 +654,7 @@ namespace transport
       }
     
     
-    bool report_manager::check_report_policy()
+    inline bool report_manager::check_report_policy()
       {
         // if no work items left and we have not issued a final report, then issue one
         bool final_report_override = false;
@@ -694,7 +694,7 @@ namespace transport
       }
     
     
-    void report_manager::announce(const std::string& msg)
+    inline void report_manager::announce(const std::string& msg)
       {
         std::ostringstream tagged_msg;
         tagged_msg << CPPTRANSPORT_TASK_MANAGER_LABEL << " " << msg;
@@ -703,7 +703,7 @@ namespace transport
       }
     
     
-    void report_manager::summary_report(unsigned int tasks_complete, const load_data& data)
+    inline void report_manager::summary_report(unsigned int tasks_complete, const load_data& data)
       {
         std::ostringstream msg;
         msg << CPPTRANSPORT_PROCESSED_TASKS_A << " " << tasks_complete << " ";
@@ -735,7 +735,7 @@ namespace transport
       }
     
     
-    void report_manager::add_alert(const std::string& msg)
+    inline void report_manager::add_alert(const std::string& msg)
       {
         alert_db::iterator t = this->alert_data.find(msg);
         
@@ -757,7 +757,7 @@ namespace transport
       }
     
     
-    void report_manager::flush_alerts()
+    inline void report_manager::flush_alerts()
       {
         this->alert_data.clear();
         this->alerts.clear();
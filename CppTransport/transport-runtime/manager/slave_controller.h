@@ -40,6 +40,8 @@
 #include "transport-runtime/tasks/output_tasks.h"
 
 #include "transport-runtime/manager/mpi_operations.h"
+#include "transport-runtime/manager/worker_topology.h"
+#include "transport-runtime/manager/group_leader.h"
 
 #include "transport-runtime/repository/json_repository.h"
 #include "transport-runtime/data/data_manager.h"
@@ -184,7 +184,7 @@ namespace transport
 			};
 
 
-    std::string Gantt_bar::format(unsigned int unique_id, double y, Gantt_environment& env) const
+    inline std::string Gantt_bar::format(unsigned int unique_id, double y, Gantt_environment& env) const
 	    {
         std::ostringstream begin_label;
         std::ostringstream end_label;
@@ -240,7 +240,7 @@ namespace transport
 			};
 
 
-		std::string Gantt_milestone::format(unsigned int unique_id, double y, Gantt_environment& env) const
+		inline std::string Gantt_milestone::format(unsigned int unique_id, double y, Gantt_environment& env) const
 			{
 		    std::ostringstream time_label;
 		    std::ostringstream insn;
@@ -322,14 +322,14 @@ namespace transport
 			};
 
 
-		work_event::work_event()
+		inline work_event::work_event()
 			: timestamp(boost::posix_time::second_clock::local_time()),
 				id(0)
 			{
 			}
 
 
-		work_event::work_event(boost::posix_time::ptime& t, unsigned int i)
+		inline work_event::work_event(boost::posix_time::ptime& t, unsigned int i)
 			: timestamp(t),
 				id(i)
 			{
@@ -395,21 +395,21 @@ namespace transport
 			};
 
 
-		master_work_event::master_work_event(typename master_work_event::event_type t)
+		inline master_work_event::master_work_event(typename master_work_event::event_type t)
 			: work_event(),
 			  type(t)
 			{
 			}
 
 
-		master_work_event::master_work_event(typename master_work_event::event_type t, boost::posix_time::ptime ts, unsigned int id)
+		inline master_work_event::master_work_event(typename master_work_event::event_type t, boost::posix_time::ptime ts, unsigned int id)
 			: work_event(ts, id),
 				type(t)
 			{
 			}
 
 
-    void master_work_event::as_JSON(Json::Value& writer) const
+    inline void master_work_event::as_JSON(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_JOURNAL_JSON_TYPE]      = std::string(CPPTRANSPORT_JOURNAL_JSON_MASTER_EVENT);
         writer[CPPTRANSPORT_JOURNAL_JSON_TIMESTAMP] = boost::posix_time::to_simple_string(this->get_timestamp());
@@ -566,7 +566,7 @@ namespace transport
 			}
 
 
-		slave_work_event::slave_work_event(unsigned int w, typename slave_work_event::event_type t)
+		inline slave_work_event::slave_work_event(unsigned int w, typename slave_work_event::event_type t)
 			: work_event(),
 				type(t),
 				worker_number(w)
@@ -574,7 +574,7 @@ namespace transport
 			}
 
 
-    slave_work_event::slave_work_event(unsigned int w, typename slave_work_event::event_type t, boost::posix_time::ptime ts, unsigned int id)
+    inline slave_work_event::slave_work_event(unsigned int w, typename slave_work_event::event_type t, boost::posix_time::ptime ts, unsigned int id)
 	    : work_event(ts, id),
 	      type(t),
 	      worker_number(w)
@@ -582,7 +582,7 @@ namespace transport
 	    }
 
 
-    void slave_work_event::as_JSON(Json::Value& writer) const
+    inline void slave_work_event::as_JSON(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_JOURNAL_JSON_TYPE]          = std::string(CPPTRANSPORT_JOURNAL_JSON_SLAVE_EVENT);
         writer[CPPTRANSPORT_JOURNAL_JSON_TIMESTAMP]     = boost::posix_time::to_simple_string(this->get_timestamp());
@@ -758,19 +758,19 @@ namespace transport
       };
 
 
-		work_journal::work_journal(unsigned int N)
+		inline work_journal::work_journal(unsigned int N)
 			: N_workers(N)
 			{
 			}
 
 
-		void work_journal::add_entry(const work_event& w)
+		inline void work_journal::add_entry(const work_event& w)
 			{
 				this->journal.push_back(std::shared_ptr<work_event>(w.clone()));
 			}
 
 
-		void work_journal::bin_bars(std::list<std::list<Gantt_bar> >& list)
+		inline void work_journal::bin_bars(std::list<std::list<Gantt_bar> >& list)
 			{
 		    list.clear();
 
@@ -794,7 +794,7 @@ namespace transport
 			}
 
 
-		void work_journal::bin_master_bars(std::list<std::list<Gantt_bar> >& list)
+		inline void work_journal::bin_master_bars(std::list<std::list<Gantt_bar> >& list)
 			{
 				// strip out master duration-bracketing events and sort them in order
 		    master_event_journal master_events;
@@ -856,7 +856,7 @@ namespace transport
 			}
 
 
-		void work_journal::bin_slave_bars(std::list<std::list<Gantt_bar> >& list)
+		inline void work_journal::bin_slave_bars(std::list<std::list<Gantt_bar> >& list)
 			{
 				// strip out events for each worker
 		    slave_event_journal worker_events;
@@ -952,7 +952,7 @@ namespace transport
 			}
 
 
-    void work_journal::bin_milestones(std::list<std::list<Gantt_milestone> >& list)
+    inline void work_journal::bin_milestones(std::list<std::list<Gantt_milestone> >& list)
 	    {
         list.clear();
 
@@ -961,7 +961,7 @@ namespace transport
 	    }
 
 
-		void work_journal::bin_master_milestones(std::list< std::list<Gantt_milestone> >& list)
+		inline void work_journal::bin_master_milestones(std::list< std::list<Gantt_milestone> >& list)
 			{
 				// strip out milestones from master list
 		    master_event_journal master_events;
@@ -992,7 +992,7 @@ namespace transport
 			}
 
 
-		void work_journal::bin_slave_milestones(std::list< std::list<Gantt_milestone> >& list)
+		inline void work_journal::bin_slave_milestones(std::list< std::list<Gantt_milestone> >& list)
 			{
 				// strip out events for each worker
 		    slave_event_journal worker_events;
@@ -1045,7 +1045,7 @@ namespace transport
 			}
 
 
-		void work_journal::make_gantt_chart(const std::string& filename, local_environment& local_env, argument_cache& args)
+		inline void work_journal::make_gantt_chart(const std::string& filename, local_environment& local_env, argument_cache& args)
 			{
 		    std::list< std::list<Gantt_bar> > bars_list;
 		    this->bin_bars(bars_list);
@@ -1214,7 +1214,7 @@ namespace transport
 			}
 
 
-    void work_journal::make_journal(const std::string& filename, local_environment& env, argument_cache& args)
+    inline void work_journal::make_journal(const std::string& filename, local_environment& env, argument_cache& args)
       {
         Json::Value entries(Json::arrayValue);
 
@@ -1321,7 +1321,7 @@ namespace transport
 	    };
 
 
-    journal_instrument::journal_instrument(work_journal& j, master_work_event::event_type b, master_work_event::event_type e, unsigned int i, unsigned int m)
+    inline journal_instrument::journal_instrument(work_journal& j, master_work_event::event_type b, master_work_event::event_type e, unsigned int i, unsigned int m)
 	    : journal(j),
 	      begin_label(b),
 	      end_label(e),
@@ -1334,7 +1334,7 @@ namespace transport
 	    }
 
 
-		journal_instrument::~journal_instrument()
+		inline journal_instrument::~journal_instrument()
 			{
 				if(!this->stopped) this->stop_time = boost::posix_time::second_clock::local_time();
 
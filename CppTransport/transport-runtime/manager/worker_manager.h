@@ -256,7 +256,7 @@ namespace transport
       };
     
     
-    void worker_manager::new_task(const std::string& task)
+    inline void worker_manager::new_task(const std::string& task)
       {
         // create new vector of appropriate size
         std::unique_ptr< std::vector<worker_management_data> > data_group = std::make_unique< std::vector<worker_management_data> >(this->number_workers);
@@ -273,7 +273,7 @@ namespace transport
       }
     
     
-    void worker_manager::update_contact_time(unsigned int worker, boost::posix_time::ptime time)
+    inline void worker_manager::update_contact_time(unsigned int worker, boost::posix_time::ptime time)
       {
         if(this->current_data == this->worker_data.end()) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_WORKER_MANAGER_NO_ACTIVE_TASK);
 
@@ -284,7 +284,7 @@ namespace transport
       }
     
     
-    void worker_manager::update_load_average(unsigned int worker, double load)
+    inline void worker_manager::update_load_average(unsigned int worker, double load)
       {
         if(this->current_data == this->worker_data.end()) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_WORKER_MANAGER_NO_ACTIVE_TASK);
     
@@ -295,7 +295,7 @@ namespace transport
       }
     
     
-    const worker_management_data& worker_manager::operator[](unsigned int worker) const
+    inline const worker_management_data& worker_manager::operator[](unsigned int worker) const
       {
         if(this->current_data == this->worker_data.end()) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_WORKER_MANAGER_NO_ACTIVE_TASK);
     
@@ -306,7 +306,7 @@ namespace transport
       }
     
     
-    load_data worker_manager::compute_load_data()
+    inline load_data worker_manager::compute_load_data()
       {
         if(this->current_data == this->worker_data.end()) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_WORKER_MANAGER_NO_ACTIVE_TASK);
     
@@ -30,6 +30,7 @@
 
 #include <vector>
 #include <list>
+#include <deque>
 #include <functional>
 #include <algorithm>
 #include <cmath>
@@ -42,6 +43,7 @@
 #include "transport-runtime/reporting/key_value.h"
 #include "transport-runtime/utilities/formatter.h"
 
+#include "transport-runtime/defaults.h"
 #include "transport-runtime/exceptions.h"
 #include "transport-runtime/messages.h"
 
@@ -113,7 +115,7 @@ namespace transport
             capacity(0),
             priority(0),
             initialized(false),
-            assigned(false),
+            in_flight_items(0),
             active(true),
             items(0),
             time(0)
@@ -162,15 +164,29 @@ namespace transport
       public:
     
         //! is this worker currently assigned?
-        bool is_assigned() const { return(this->assigned); }
+        bool is_assigned() const { return(!this->assignments.empty()); }
+
+        //! get number of assignments issued to this worker but not yet reported complete;
+        //! assignments beyond the first are held in the worker's MPI receive queue
+        unsigned int get_outstanding_assignments() const { return static_cast<unsigned int>(this->assignments.size()); }
+
+        //! get number of work items issued to this worker but not yet reported complete
+        unsigned int get_in_flight_items() const { return(this->in_flight_items); }
     
         //! is this worker currently active?
         bool is_active() const { return(this->active); }
         
       private:
     
-        //! set assignment status
-        void mark_assigned(bool status) { this->assigned = status; }
+        //! push a new assignment of n work items
+        void push_assignment(unsigned int n) { this->assignments.push_back(n); this->in_flight_items += n; }
+
+        //! pop the oldest outstanding assignment; workers process assignments in the order they are issued
+        void pop_assignment()
+          {
+            this->in_flight_items -= this->assignments.front();
+            this->assignments.pop_front();
+          }
     
         //! set active states
         void mark_active(bool status) { this->active = status; }
@@ -222,8 +238,11 @@ namespace transport
         //! received initialization data from this worker?
         bool initialized;
     
-        //! is this worker currently assigned?
-        bool assigned;
+        //! sizes of assignments issued to this worker but not yet reported complete, oldest first
+        std::deque<unsigned int> assignments;
+
+        //! total number of work items held in outstanding assignments
+        unsigned int in_flight_items;
     
         //! is this worker currently active?
         bool active;
@@ -250,6 +269,8 @@ namespace transport
             waiting_for_setup(0),
 		        state_size(0),
 		        unassigned(0),
+		        open_slots(0),
+		        lookahead(CPPTRANSPORT_DEFAULT_SCHEDULING_LOOKAHEAD),
 		        active(0),
 		        has_cpus(false),
 		        has_gpus(false),
@@ -277,7 +298,7 @@ namespace transport
 
 		    //! reset scheduler and all scheduling data; prepare for new scheduling
 		    //! task with the given number of workers
-		    void reset();
+		    void reset(unsigned int nw);
 
 		    //! initialization complete and ready to proceed with scheduling?
 		    bool is_ready() const { return(this->waiting_for_setup == 0); }
@@ -290,6 +311,13 @@ namespace transport
 		    //! set current state size; used when assigning work to GPUs
 		    void set_state_size(unsigned int size) { this->state_size = size; }
 
+		    //! set number of assignments which may be outstanding on each CPU worker;
+		    //! a depth of 1 disables prefetching. Should be set before workers are initialized
+		    void set_lookahead(unsigned int depth) { this->lookahead = std::max(depth, static_cast<unsigned int>(1)); }
+
+		    //! get number of assignments which may be outstanding on each CPU worker
+		    unsigned int get_lookahead() const { return(this->lookahead); }
+
 
 		    // INTERFACE -- MANAGE WORK QUEUE
 
@@ -318,6 +346,10 @@ namespace transport
         //! build a work queue using specified serial numbers (used when seeding tasks)
         void prepare_queue(const std::set<unsigned int>& list);
 
+        //! append a block of work items to the queue; used by group leaders, which receive their
+        //! work from the master in blocks rather than building a queue for the whole task
+        void enqueue(const std::list<unsigned int>& items);
+
 		    //! current queue exhausted? ie., finished all current work?
 		    bool is_finished() const { return this->queue.empty(); }
 
@@ -437,7 +469,7 @@ namespace transport
 		    // WORKER POOL
         
         //! Number of workers in the pool
-        const unsigned int number_workers;
+        unsigned int number_workers;
 
         //! Information about workers
         std::vector<worker_scheduling_data> worker_data;
@@ -448,6 +480,13 @@ namespace transport
 		    //! Number of workers currently unassigned
 		    unsigned int unassigned;
 
+		    //! Number of assignments which could still be issued before every worker reaches its lookahead depth
+		    unsigned int open_slots;
+
+		    //! Number of assignments which may be outstanding on each worker; used only by the CPU strategy,
+		    //! where prefetched assignments hide the round-trip to the master between units of work
+		    unsigned int lookahead;
+
 		    //! Number of workers currently active
 		    unsigned int active;
 
@@ -515,13 +554,16 @@ namespace transport
 	    };
 
 
-		void worker_scheduler::reset()
+		inline void worker_scheduler::reset(unsigned int nw)
 			{
+				this->number_workers = nw;
+
 				this->worker_data.clear();
 				this->worker_data.resize(this->number_workers);
 
 				this->waiting_for_setup = this->number_workers;
 				this->unassigned = 0;
+				this->open_slots = 0;
 				this->active = 0;
 
 				this->has_cpus = false;
@@ -580,6 +622,7 @@ namespace transport
 		        BOOST_LOG_SEV(log, base_writer::log_severity_level::normal) << msg.str();
 
 				    ++this->unassigned;
+				    this->open_slots += this->lookahead;
 				    ++this->active;
 			    }
 		    else
@@ -681,7 +724,7 @@ namespace transport
       }
 
 
-    void worker_scheduler::prepare_queue(const std::set<unsigned int>& list)
+    inline void worker_scheduler::prepare_queue(const std::set<unsigned int>& list)
       {
         // copy serial numbers from list into temporary vector
         std::vector<unsigned int> temp;
@@ -697,7 +740,22 @@ namespace transport
       }
 
 
-		void worker_scheduler::complete_queue_setup()
+    inline void worker_scheduler::enqueue(const std::list<unsigned int>& items)
+      {
+        std::copy(items.begin(), items.end(), std::back_inserter(this->queue));
+
+        // a block is already sized by the master's scheduler, so allow it to be split evenly between
+        // our workers rather than capping allocations relative to a whole-task queue
+        if(!this->worker_data.empty())
+          {
+            this->max_work_allocation =
+              std::max(static_cast<unsigned int>(this->queue.size() / this->worker_data.size()),
+                       static_cast<unsigned int>(1));
+          }
+      }
+
+
+		inline void worker_scheduler::complete_queue_setup()
 			{
 				// set maximum work allocation to force multiple scheduling adjustments during
 				// the lifetime of the task.
@@ -717,26 +775,38 @@ namespace transport
 			}
 
 
-		bool worker_scheduler::assignable() const
+		inline bool worker_scheduler::assignable() const
 			{
+				if(this->queue.empty()) return false;
+
+				// for CPU-only pools, workers may hold up to 'lookahead' assignments, so we can issue
+				// new work whenever some worker has a free slot
+				if(this->has_cpus && !this->has_gpus) return(this->open_slots > 0);
+
 				// are there unassigned workers and work items left for them to process?
-				return(!this->queue.empty() && this->unassigned > 0);
+				return(this->unassigned > 0);
 			}
 
 
-		void worker_scheduler::mark_assigned(const work_assignment& assignment)
+		inline void worker_scheduler::mark_assigned(const work_assignment& assignment)
 			{
-				// check that there are unassigned workers
-				if(this->unassigned == 0)
+        if(assignment.get_worker() >= this->worker_data.size())
+          throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_SCHEDULING_INDEX_OUT_OF_RANGE);
+
+        worker_scheduling_data& wkr = this->worker_data[assignment.get_worker()];
+
+				// check that there are free slots
+				if(this->open_slots == 0)
           throw runtime_exception(exception_type::SCHEDULING_ERROR, CPPTRANSPORT_SCHEDULING_NO_UNASSIGNED);
 
-				// if this worker is already assigned, then an error must have occurred
-				if(this->worker_data[assignment.get_worker()].is_assigned())
+				// if this worker already holds its full lookahead of assignments, then an error must have occurred
+				if(wkr.get_outstanding_assignments() >= this->lookahead)
           throw runtime_exception(exception_type::SCHEDULING_ERROR, CPPTRANSPORT_SCHEDULING_ALREADY_ASSIGNED);
 
 				// mark this worker as assigned
-				this->worker_data[assignment.get_worker()].mark_assigned(true);
-				--this->unassigned;
+				if(!wkr.is_assigned()) --this->unassigned;
+				wkr.push_assignment(static_cast<unsigned int>(assignment.get_items().size()));
+				--this->open_slots;
 
 				// remove assigned work items from the queue
         for(const unsigned int& item : assignment.get_items())
@@ -760,7 +830,7 @@ namespace transport
 			}
 
 
-		void worker_scheduler::mark_unassigned(unsigned int worker, boost::timer::nanosecond_type time, unsigned int items)
+		inline void worker_scheduler::mark_unassigned(unsigned int worker, boost::timer::nanosecond_type time, unsigned int items)
 			{
         if(worker >= this->worker_data.size())
           throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_SCHEDULING_INDEX_OUT_OF_RANGE);
@@ -770,8 +840,9 @@ namespace transport
           throw runtime_exception(exception_type::SCHEDULING_ERROR, CPPTRANSPORT_SCHEDULING_NOT_ALREADY_ASSIGNED);
 
 				this->worker_data[worker].update_timing_data(time, items);
-				this->worker_data[worker].mark_assigned(false);
-				++this->unassigned;
+				this->worker_data[worker].pop_assignment();
+				if(!this->worker_data[worker].is_assigned()) ++this->unassigned;
+				++this->open_slots;
 
 				this->work_items_completed += items;
 		    if(this->work_items_in_flight >= items)
@@ -791,7 +862,7 @@ namespace transport
 			}
 
 
-		void worker_scheduler::mark_inactive(unsigned int worker)
+		inline void worker_scheduler::mark_inactive(unsigned int worker)
 			{
         if(worker >= this->worker_data.size())
           throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_SCHEDULING_INDEX_OUT_OF_RANGE);
@@ -803,12 +874,16 @@ namespace transport
 				this->worker_data[worker].mark_active(false);
 				--this->active;
 
+				// an inactive worker can accept no further assignments
+				unsigned int slots = this->lookahead - std::min(this->lookahead, this->worker_data[worker].get_outstanding_assignments());
+				this->open_slots -= std::min(this->open_slots, slots);
+
 				if(this->active == 0 && this->work_items_in_flight > 0)
           throw runtime_exception(exception_type::SCHEDULING_ERROR, CPPTRANSPORT_SCHEDULING_UNDER_INFLIGHT);
 			}
     
     
-    const worker_scheduling_data& worker_scheduler::operator[](unsigned int worker) const
+    inline const worker_scheduling_data& worker_scheduler::operator[](unsigned int worker) const
       {
         if(worker >= this->worker_data.size())
           throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_SCHEDULING_INDEX_OUT_OF_RANGE);
@@ -817,7 +892,7 @@ namespace transport
       }
 
 
-		void worker_scheduler::report_aggregation(boost::timer::nanosecond_type time)
+		inline void worker_scheduler::report_aggregation(boost::timer::nanosecond_type time)
 			{
 				this->total_aggregation_time += time;
 				++this->number_aggregations;
@@ -844,7 +919,7 @@ namespace transport
 			}
     
     
-    double worker_scheduler::query_completion() const
+    inline double worker_scheduler::query_completion() const
       {
         size_t total_items = this->queue.size() + this->work_items_in_flight + this->work_items_completed;
         
@@ -852,7 +927,7 @@ namespace transport
       }
     
     
-    void worker_scheduler::update_estimated_completion()
+    inline void worker_scheduler::update_estimated_completion()
       {
         // estimate remaining duration of the task
         auto total_wallclock_time = this->timer.elapsed().wall;
@@ -881,7 +956,7 @@ namespace transport
       }
     
     
-    std::list<work_assignment> worker_scheduler::assign_work(base_writer::logger& log)
+    inline std::list<work_assignment> worker_scheduler::assign_work(base_writer::logger& log)
 			{
 		    // generate a work assignment
 
@@ -902,7 +977,7 @@ namespace transport
 			}
 
 
-		std::list<work_assignment> worker_scheduler::assign_work_cpu_only_strategy(base_writer::logger& log)
+		inline std::list<work_assignment> worker_scheduler::assign_work_cpu_only_strategy(base_writer::logger& log)
 			{
 				// schedule work for a CPU only pool
 				// the strategy is to avoid cores becoming idle because they have run out of work
@@ -912,17 +987,23 @@ namespace transport
 		    // but we won't be amending it within this function
 		    std::list< std::vector<worker_scheduling_data>::iterator > workers;
 
-        // build list of iterators to workers requiring assignments
+        // build list of iterators to workers requiring assignments; a worker which is busy but has fewer
+        // than 'lookahead' outstanding assignments is given a prefetched assignment, which waits in its
+        // MPI receive queue so that it can begin new work without waiting for a round-trip to the master
 		    for(auto t = this->worker_data.begin(); t != this->worker_data.end(); ++t)
 			    {
-		        if(!t->is_assigned()) workers.push_back(t);
+		        if(t->is_active() && t->get_outstanding_assignments() < this->lookahead) workers.push_back(t);
 			    }
 
-				// sort into ascending order of mean time per item
+				// sort into ascending order of outstanding assignments, so idle workers are served first,
+				// and then into ascending order of mean time per item
 				struct MeanTimeComparator
 					{
 						bool operator()(const std::vector<worker_scheduling_data>::iterator& A, const std::vector<worker_scheduling_data>::iterator& B)
 							{
+								if(A->get_outstanding_assignments() != B->get_outstanding_assignments())
+                  return(A->get_outstanding_assignments() < B->get_outstanding_assignments());
+
 								if(A->get_total_time() == 0) return(true);
 								if(B->get_total_time() == 0) return(false);
 
@@ -996,6 +1077,11 @@ namespace transport
                 // 2 - the maximum allocation taking into account current queue size and number of workers needing new jobs
 								unsigned int num_work_items = std::min(unit_of_work, max_allocation_per_worker);
 
+                // items already issued to this worker but not yet completed count against its allocation,
+                // so a busy worker's pipeline is topped up rather than filled afresh
+                unsigned int in_flight = wkr->get_in_flight_items();
+                num_work_items = num_work_items > in_flight ? num_work_items - in_flight : 1;
+
 #ifdef CPPTRANSPORT_DEBUG_SCHEDULER
 								BOOST_LOG_SEV(log, generic_writer::normal)
 								  << "%% Worker " << (*t)->get_number()+1 << " mean time-per-item = " << format_time(time_per_item)
@@ -1017,7 +1103,7 @@ namespace transport
 			}
 
 
-		std::list<work_assignment> worker_scheduler::assign_work_gpu_only_strategy(base_writer::logger& log)
+		inline std::list<work_assignment> worker_scheduler::assign_work_gpu_only_strategy(base_writer::logger& log)
 			{
 				// currently we schedule work just by breaking it up between all workers
 				// TODO: in future, this should be replaced by a more intelligent scheduler
@@ -1064,7 +1150,7 @@ namespace transport
 			}
 
 
-    std::list<work_assignment> worker_scheduler::assign_work_mixed_strategy(base_writer::logger& log)
+    inline std::list<work_assignment> worker_scheduler::assign_work_mixed_strategy(base_writer::logger& log)
 	    {
 				throw runtime_exception(exception_type::RUNTIME_ERROR, "Mixed CPU/GPU scheduling is not yet implemented");
 	    }
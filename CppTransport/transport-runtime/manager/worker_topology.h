@@ -0,0 +1,172 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_WORKER_TOPOLOGY_H
+#define CPPTRANSPORT_WORKER_TOPOLOGY_H
+
+
+#include <vector>
+#include <algorithm>
+
+#include "transport-runtime/manager/mpi_operations.h"
+
+
+namespace transport
+  {
+
+    //! worker_topology describes how worker processes are arranged beneath the master.
+    //! In the flat topology every worker reports directly to the master.
+    //! In the two-level topology, workers are divided into consecutive blocks of ranks; the first rank in each
+    //! block is a group leader which schedules work for the rest of its block, and only group leaders
+    //! exchange scheduling messages with the master
+    class worker_topology
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! construct a topology for a communicator of size ws, with gs workers per group leader;
+        //! gs=0 selects the flat topology
+        worker_topology(unsigned int ws, unsigned int gs);
+
+        //! destructor is default
+        ~worker_topology() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! is this a two-level topology?
+        bool is_hierarchical() const { return(this->groups > 0); }
+
+        //! get number of processes which report directly to the master -- group leaders, or all workers
+        unsigned int get_number_peers() const { return(this->is_hierarchical() ? this->groups : this->world_size-1); }
+
+        //! get MPI rank of the n-th process reporting directly to the master
+        unsigned int peer_rank(unsigned int n) const;
+
+        //! get peer number corresponding to an MPI rank; members of a group map to their group leader
+        unsigned int peer_number(unsigned int rank) const;
+
+        //! is the given rank a group leader?
+        bool is_leader(unsigned int rank) const;
+
+        //! get MPI rank of the process which schedules work for the given rank
+        unsigned int controller_rank(unsigned int rank) const;
+
+        //! get MPI ranks of the workers scheduled by the given group leader
+        std::vector<unsigned int> get_members(unsigned int leader) const;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! get group number for a worker rank
+        unsigned int group_number(unsigned int rank) const
+          { return std::min((rank-1) / this->stride, this->groups-1); }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! size of MPI communicator, including the master
+        unsigned int world_size;
+
+        //! number of ranks in a group, including its leader
+        unsigned int stride;
+
+        //! number of groups; zero for the flat topology
+        unsigned int groups;
+
+      };
+
+
+    inline worker_topology::worker_topology(unsigned int ws, unsigned int gs)
+      : world_size(ws),
+        stride(gs+1),
+        groups(0)
+      {
+        // a group needs at least one member besides its leader
+        unsigned int workers = ws > 0 ? ws-1 : 0;
+        if(gs > 0 && workers >= 2)
+          {
+            // any ranks left over after dividing into whole groups are absorbed by the last group
+            this->groups = std::max(workers / this->stride, static_cast<unsigned int>(1));
+          }
+      }
+
+
+    inline unsigned int worker_topology::peer_rank(unsigned int n) const
+      {
+        return(this->is_hierarchical() ? 1 + n*this->stride : n+1);
+      }
+
+
+    inline unsigned int worker_topology::peer_number(unsigned int rank) const
+      {
+        return(this->is_hierarchical() ? this->group_number(rank) : rank-1);
+      }
+
+
+    inline bool worker_topology::is_leader(unsigned int rank) const
+      {
+        if(!this->is_hierarchical() || rank == MPI::RANK_MASTER) return false;
+
+        return(rank == this->peer_rank(this->group_number(rank)));
+      }
+
+
+    inline unsigned int worker_topology::controller_rank(unsigned int rank) const
+      {
+        if(!this->is_hierarchical() || rank == MPI::RANK_MASTER || this->is_leader(rank)) return MPI::RANK_MASTER;
+
+        return this->peer_rank(this->group_number(rank));
+      }
+
+
+    inline std::vector<unsigned int> worker_topology::get_members(unsigned int leader) const
+      {
+        std::vector<unsigned int> members;
+        if(!this->is_leader(leader)) return members;
+
+        unsigned int group = this->group_number(leader);
+        unsigned int last = (group == this->groups-1) ? this->world_size-1 : leader + this->stride-1;
+
+        for(unsigned int r = leader+1; r <= last; ++r)
+          {
+            members.push_back(r);
+          }
+
+        return members;
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_WORKER_TOPOLOGY_H
@@ -0,0 +1,172 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_IMPLICIT_SYSTEM_H
+#define CPPTRANSPORT_IMPLICIT_SYSTEM_H
+
+
+#include "Eigen/Core"
+#include "Eigen/LU"
+
+
+namespace transport
+  {
+
+    // W-method steppers (see rosenbrock_w.h) solve a linear system (I - gamma h J) y = r at each stage,
+    // where J may be any approximation to the Jacobian of the system.
+    // The transport equations act on each index of the 2pf and 3pf with the same matrix u2, so on these
+    // blocks J is a Kronecker sum u2 (+) u2 or u2(k1) (+) u2(k2) (+) u2(k3). We replace I - gamma h J on
+    // each block by the approximate factorization (I - gamma h u2) (x) (I - gamma h u2) (x) ..., which
+    // differs from it at O(h^2). This can be inverted by applying a (2N)x(2N) LU factorization along each
+    // index in turn, at a cost O((2N)^3) for the 2pf and O((2N)^4) for the 3pf instead of the
+    // O((2N)^6) and O((2N)^9) needed to factorize the Jacobian of the full state
+
+    //! LU factorization of I - gamma h U for a single index, where U is a square matrix
+    template <typename number>
+    class W_factor
+      {
+
+      public:
+
+        //! matrix type used to hold U and its factorization
+        using matrix_type = Eigen::Matrix<number, Eigen::Dynamic, Eigen::Dynamic>;
+
+        //! vector type used as workspace
+        using vector_type = Eigen::Matrix<number, Eigen::Dynamic, 1>;
+
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor sets the dimension of U
+        W_factor(unsigned int n)
+          : dim(n),
+            U(matrix_type::Zero(n, n)),
+            line(n),
+            soln(n)
+          {
+          }
+
+        //! destructor is default
+        ~W_factor() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get dimension
+        unsigned int size() const { return this->dim; }
+
+        //! access element of U; the new value takes effect at the next call to factorize()
+        number& operator()(unsigned int i, unsigned int j) { return this->U(i, j); }
+
+        //! factorize I - gamma_h U
+        void factorize(number gamma_h)
+          {
+            this->lu.compute(matrix_type::Identity(this->dim, this->dim) - gamma_h * this->U);
+          }
+
+        //! solve in place along the line of a flattened state which starts at 'start' and has stride 'stride'
+        template <typename State>
+        void solve(State& v, unsigned int start, unsigned int stride)
+          {
+            for(unsigned int i = 0; i < this->dim; ++i) this->line(i) = v[start + i*stride];
+            this->soln = this->lu.solve(this->line);
+            for(unsigned int i = 0; i < this->dim; ++i) v[start + i*stride] = this->soln(i);
+          }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! dimension of U
+        unsigned int dim;
+
+        //! matrix U
+        matrix_type U;
+
+        //! LU factorization of I - gamma_h U
+        Eigen::PartialPivLU<matrix_type> lu;
+
+        //! workspace
+        vector_type line;
+        vector_type soln;
+
+      };
+
+
+    //! solve in place on a vector block of a flattened state, beginning at 'start'
+    template <typename number, typename State>
+    void W_solve_vector(W_factor<number>& a, State& y, unsigned int start)
+      {
+        a.solve(y, start, 1);
+      }
+
+
+    //! solve in place on a rank-2 block of a flattened state, beginning at 'start' and stored in
+    //! row-major order, using the factorization a (x) b
+    template <typename number, typename State>
+    void W_solve_matrix(W_factor<number>& a, W_factor<number>& b, State& y, unsigned int start)
+      {
+        const unsigned int na = a.size();
+        const unsigned int nb = b.size();
+
+        for(unsigned int j = 0; j < nb; ++j) a.solve(y, start + j, nb);
+        for(unsigned int i = 0; i < na; ++i) b.solve(y, start + i*nb, 1);
+      }
+
+
+    //! solve in place on a rank-3 block of a flattened state, beginning at 'start' and stored in
+    //! row-major order, using the factorization a (x) b (x) c
+    template <typename number, typename State>
+    void W_solve_tensor(W_factor<number>& a, W_factor<number>& b, W_factor<number>& c, State& y, unsigned int start)
+      {
+        const unsigned int na = a.size();
+        const unsigned int nb = b.size();
+        const unsigned int nc = c.size();
+
+        for(unsigned int j = 0; j < nb; ++j)
+          {
+            for(unsigned int k = 0; k < nc; ++k) a.solve(y, start + j*nc + k, nb*nc);
+          }
+
+        for(unsigned int i = 0; i < na; ++i)
+          {
+            for(unsigned int k = 0; k < nc; ++k) b.solve(y, start + i*nb*nc + k, nc);
+          }
+
+        for(unsigned int i = 0; i < na; ++i)
+          {
+            for(unsigned int j = 0; j < nb; ++j) c.solve(y, start + i*nb*nc + j*nc, 1);
+          }
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_IMPLICIT_SYSTEM_H
@@ -0,0 +1,189 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_KERNEL_VARIANT_H
+#define CPPTRANSPORT_KERNEL_VARIANT_H
+
+
+#include <string>
+#include <sstream>
+#include <limits>
+#include <algorithm>
+
+#include "transport-runtime/messages.h"
+#include "transport-runtime/defaults.h"
+#include "transport-runtime/exceptions.h"
+
+#include "transport-runtime/utilities/formatter.h"
+
+#include "boost/optional.hpp"
+#include "boost/timer/timer.hpp"
+
+
+namespace transport
+  {
+
+    //! identify which variant of its integration kernels a model is using.
+    //! Models translated with --dual-unroll carry both an unrolled and a rolled variant of each kernel,
+    //! and choose between them by calibration; otherwise the single variant is 'fixed' by the translator
+    enum class kernel_variant
+      {
+        fixed,
+        unrolled,
+        rolled
+      };
+
+
+    inline std::string to_string(kernel_variant v)
+      {
+        switch(v)
+          {
+            case kernel_variant::fixed:
+              {
+                return std::string(CPPTRANSPORT_KERNEL_VARIANT_FIXED);
+              }
+
+            case kernel_variant::unrolled:
+              {
+                return std::string(CPPTRANSPORT_KERNEL_VARIANT_UNROLLED);
+              }
+
+            case kernel_variant::rolled:
+              {
+                return std::string(CPPTRANSPORT_KERNEL_VARIANT_ROLLED);
+              }
+          }
+
+        throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_KERNEL_VARIANT_UNKNOWN);
+      }
+
+
+    //! describe the kernel variants selected for the twopf and threepf integrations, for provenance;
+    //! either may be empty if no integration of that type has yet been calibrated
+    inline std::string describe_kernel_variants(const boost::optional<kernel_variant>& twopf, const boost::optional<kernel_variant>& threepf)
+      {
+        std::ostringstream out;
+
+        out << CPPTRANSPORT_KERNEL_TWOPF << "=" << (twopf ? to_string(*twopf) : std::string(CPPTRANSPORT_KERNEL_UNCALIBRATED)) << ", "
+            << CPPTRANSPORT_KERNEL_THREEPF << "=" << (threepf ? to_string(*threepf) : std::string(CPPTRANSPORT_KERNEL_UNCALIBRATED));
+
+        return out.str();
+      }
+
+
+    //! outcome of calibrating a pair of kernel variants
+    class kernel_calibration
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        kernel_calibration(boost::timer::nanosecond_type u, boost::timer::nanosecond_type r)
+          : unrolled_time(u),
+            rolled_time(r)
+          {
+          }
+
+        //! destructor is default
+        ~kernel_calibration() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get faster variant; ties go to the unrolled variant
+        kernel_variant get_variant() const { return(this->rolled_time < this->unrolled_time ? kernel_variant::rolled : kernel_variant::unrolled); }
+
+        //! get best trial time for the unrolled variant
+        boost::timer::nanosecond_type get_unrolled_time() const { return(this->unrolled_time); }
+
+        //! get best trial time for the rolled variant
+        boost::timer::nanosecond_type get_rolled_time() const { return(this->rolled_time); }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! best trial time for the unrolled variant
+        boost::timer::nanosecond_type unrolled_time;
+
+        //! best trial time for the rolled variant
+        boost::timer::nanosecond_type rolled_time;
+
+      };
+
+
+    template <typename Stream>
+    Stream& operator<<(Stream& out, const kernel_calibration& obj)
+      {
+        out << CPPTRANSPORT_KERNEL_CALIBRATION << ": "
+            << CPPTRANSPORT_KERNEL_VARIANT_UNROLLED << " = " << format_time(obj.get_unrolled_time()) << ", "
+            << CPPTRANSPORT_KERNEL_VARIANT_ROLLED << " = " << format_time(obj.get_rolled_time()) << "; "
+            << CPPTRANSPORT_KERNEL_SELECTED << " " << to_string(obj.get_variant());
+
+        return out;
+      }
+
+
+    //! time repeated evaluations of an unrolled and a rolled kernel.
+    //! Trials alternate between the variants so that drifts in clock speed affect both equally, and the
+    //! fastest trial of each is kept so that interruptions by the operating system are discounted
+    template <typename UnrolledKernel, typename RolledKernel>
+    kernel_calibration calibrate_kernel_variants(UnrolledKernel unrolled, RolledKernel rolled,
+                                                 unsigned int evaluations=CPPTRANSPORT_DEFAULT_KERNEL_CALIBRATION_EVALUATIONS,
+                                                 unsigned int trials=CPPTRANSPORT_DEFAULT_KERNEL_CALIBRATION_TRIALS)
+      {
+        // bring both variants into the instruction cache before timing either
+        unrolled();
+        rolled();
+
+        boost::timer::nanosecond_type unrolled_time = std::numeric_limits<boost::timer::nanosecond_type>::max();
+        boost::timer::nanosecond_type rolled_time = std::numeric_limits<boost::timer::nanosecond_type>::max();
+
+        for(unsigned int i = 0; i < trials; ++i)
+          {
+            boost::timer::cpu_timer unrolled_timer;
+            for(unsigned int j = 0; j < evaluations; ++j) unrolled();
+            unrolled_timer.stop();
+            unrolled_time = std::min(unrolled_time, unrolled_timer.elapsed().wall);
+
+            boost::timer::cpu_timer rolled_timer;
+            for(unsigned int j = 0; j < evaluations; ++j) rolled();
+            rolled_timer.stop();
+            rolled_time = std::min(rolled_time, rolled_timer.elapsed().wall);
+          }
+
+        return kernel_calibration(unrolled_time, rolled_time);
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_KERNEL_VARIANT_H
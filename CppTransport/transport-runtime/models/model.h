@@ -30,6 +30,9 @@
 #include <vector>
 #include <functional>
 #include <memory>
+#include <thread>
+#include <exception>
+#include <algorithm>
 
 #include <math.h>
 
@@ -54,6 +57,8 @@
 #include "transport-runtime/reporting/key_value.h"
 
 #include "transport-runtime/models/advisory_classes.h"
+#include "transport-runtime/models/stepper_candidate.h"
+#include "transport-runtime/models/kernel_variant.h"
 
 #include "boost/log/core.hpp"
 #include "boost/log/trivial.hpp"
@@ -207,6 +212,10 @@ namespace transport
         //! Return (abs, rel) tolerance of stepper used to do perturbation evolution
         virtual std::pair<double, double> get_pert_tol() const = 0;
 
+        //! Return description of the integration kernel variants in use; models translated with
+        //! --dual-unroll report the variants selected by calibration
+        virtual std::string get_kernel_variant() const { return(to_string(kernel_variant::fixed)); }
+
         //! Return number of fields belonging to the model implemented by this object
         virtual unsigned int get_N_fields() const = 0;
 
@@ -338,6 +347,62 @@ namespace transport
         virtual void sorted_mass_spectrum(const twopf_db_task<number>* __task, const flattened_tensor<number>& __fields, double __N, bool __norm, flattened_tensor<number>& __M, flattened_tensor<number>& __E) = 0;
 
 
+        // BATCHED EVALUATION
+
+        // these evaluate u2, u3 and the mass spectrum over a complete background history in a single call.
+        // The history is supplied in struct-of-arrays form, so history[i][j] is component i of the background
+        // at time sample N[j]; this is the layout in which the datapipe returns background data.
+        // Results are returned in the same layout, with the time sample as the final index
+
+      public:
+
+        //! compute u2 for each wavenumber in k; on exit u2[n][c][j] is the flattened component c of u2
+        //! at time sample j, for the nth wavenumber
+        void u2_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                      const std::vector<double>& N, const std::vector<double>& k,
+                      std::vector< std::vector< std::vector<number> > >& u2);
+
+        //! compute u3 for each wavenumber triple (k1[n], k2[n], k3[n]); on exit u3[n][c][j] is the flattened
+        //! component c of u3 at time sample j, for the nth triple
+        void u3_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                      const std::vector<double>& N, const std::vector<double>& k1, const std::vector<double>& k2,
+                      const std::vector<double>& k3, std::vector< std::vector< std::vector<number> > >& u3);
+
+        //! compute the sorted mass spectrum, normalized to the Hubble rate^2 if desired; on exit E[i][j] is the
+        //! ith eigenvalue at time sample j
+        void sorted_mass_spectrum_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                        const std::vector<double>& N, bool norm, std::vector< std::vector<number> >& E);
+
+      protected:
+
+        //! evaluate u2 for time samples in the range [begin, end); output arrays have already been sized.
+        //! The default implementation evaluates u2() sample-by-sample
+        virtual void u2_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                     const std::vector<double>& N, const std::vector<double>& k,
+                                     std::vector< std::vector< std::vector<number> > >& u2, unsigned int begin, unsigned int end);
+
+        //! evaluate u3 for time samples in the range [begin, end); output arrays have already been sized.
+        //! The default implementation evaluates u3() sample-by-sample
+        virtual void u3_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                     const std::vector<double>& N, const std::vector<double>& k1, const std::vector<double>& k2,
+                                     const std::vector<double>& k3, std::vector< std::vector< std::vector<number> > >& u3,
+                                     unsigned int begin, unsigned int end);
+
+        //! evaluate the sorted mass spectrum for time samples in the range [begin, end); output arrays have already been sized.
+        //! The default implementation evaluates sorted_mass_spectrum() sample-by-sample
+        virtual void sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                                       const std::vector<double>& N, bool norm, std::vector< std::vector<number> >& E,
+                                                       unsigned int begin, unsigned int end);
+
+        //! can batch kernels for disjoint ranges of time samples run concurrently?
+        //! The default kernels share the workspace used by u2(), u3() and sorted_mass_spectrum(), so they cannot
+        virtual bool batch_concurrent() const { return(false); }
+
+        //! divide the time samples [0, samples) between the number of threads requested in the argument cache,
+        //! and apply a kernel to each range
+        void dispatch_batch(unsigned int samples, std::function<void(unsigned int, unsigned int)> kernel);
+
+
         // BACKEND
 
       public:
@@ -371,6 +436,12 @@ namespace transport
         virtual void backend_process_queue(work_queue<threepf_kconfig_record>& work, const threepf_task<number>* tk,
                                            threepf_batcher<number>& batcher, bool silent = false) = 0;
 
+        // integrate a single twopf configuration using a stepper selected at runtime, for benchmarking;
+        // on return, samples holds the state vector at each time sample.
+        // returns false if the backend does not support runtime stepper selection
+        virtual bool backend_autotune(const twopf_kconfig_record& kconfig, const twopf_db_task<number>* tk, const stepper_candidate& stepper,
+                                      std::vector< std::vector<number> >& samples) { return(false); }
+
         // return size of state vectors
         virtual unsigned int backend_twopf_state_size(void) const = 0;
         virtual unsigned int backend_threepf_state_size(void) const = 0;
@@ -464,6 +535,178 @@ namespace transport
       }
 
 
+    // BATCHED EVALUATION
+
+
+    template <typename number>
+    void model<number>::u2_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                 const std::vector<double>& N, const std::vector<double>& k,
+                                 std::vector< std::vector< std::vector<number> > >& u2)
+      {
+        unsigned int samples = static_cast<unsigned int>(N.size());
+        unsigned int size = 2*this->get_N_fields() * 2*this->get_N_fields();
+
+        u2.assign(k.size(), std::vector< std::vector<number> >(size, std::vector<number>(samples)));
+
+        this->dispatch_batch(samples, [&](unsigned int begin, unsigned int end) -> void
+          {
+            this->u2_batch_kernel(task, history, N, k, u2, begin, end);
+          });
+      }
+
+
+    template <typename number>
+    void model<number>::u3_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                 const std::vector<double>& N, const std::vector<double>& k1, const std::vector<double>& k2,
+                                 const std::vector<double>& k3, std::vector< std::vector< std::vector<number> > >& u3)
+      {
+        assert(k1.size() == k2.size());
+        assert(k1.size() == k3.size());
+
+        unsigned int samples = static_cast<unsigned int>(N.size());
+        unsigned int size = 2*this->get_N_fields() * 2*this->get_N_fields() * 2*this->get_N_fields();
+
+        u3.assign(k1.size(), std::vector< std::vector<number> >(size, std::vector<number>(samples)));
+
+        this->dispatch_batch(samples, [&](unsigned int begin, unsigned int end) -> void
+          {
+            this->u3_batch_kernel(task, history, N, k1, k2, k3, u3, begin, end);
+          });
+      }
+
+
+    template <typename number>
+    void model<number>::sorted_mass_spectrum_batch(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                                   const std::vector<double>& N, bool norm, std::vector< std::vector<number> >& E)
+      {
+        unsigned int samples = static_cast<unsigned int>(N.size());
+
+        E.assign(this->get_N_fields(), std::vector<number>(samples));
+
+        this->dispatch_batch(samples, [&](unsigned int begin, unsigned int end) -> void
+          {
+            this->sorted_mass_spectrum_batch_kernel(task, history, N, norm, E, begin, end);
+          });
+      }
+
+
+    template <typename number>
+    void model<number>::u2_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                        const std::vector<double>& N, const std::vector<double>& k,
+                                        std::vector< std::vector< std::vector<number> > >& u2, unsigned int begin, unsigned int end)
+      {
+        flattened_tensor<number> state(history.size());
+        flattened_tensor<number> u2_tensor(2*this->get_N_fields() * 2*this->get_N_fields());
+
+        for(unsigned int j = begin; j < end; ++j)
+          {
+            for(unsigned int i = 0; i < state.size(); ++i) state[i] = history[i][j];
+
+            for(unsigned int n = 0; n < k.size(); ++n)
+              {
+                this->u2(task, state, k[n], N[j], u2_tensor);
+                for(unsigned int c = 0; c < u2_tensor.size(); ++c) u2[n][c][j] = u2_tensor[c];
+              }
+          }
+      }
+
+
+    template <typename number>
+    void model<number>::u3_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                        const std::vector<double>& N, const std::vector<double>& k1, const std::vector<double>& k2,
+                                        const std::vector<double>& k3, std::vector< std::vector< std::vector<number> > >& u3,
+                                        unsigned int begin, unsigned int end)
+      {
+        flattened_tensor<number> state(history.size());
+        flattened_tensor<number> u3_tensor(2*this->get_N_fields() * 2*this->get_N_fields() * 2*this->get_N_fields());
+
+        for(unsigned int j = begin; j < end; ++j)
+          {
+            for(unsigned int i = 0; i < state.size(); ++i) state[i] = history[i][j];
+
+            for(unsigned int n = 0; n < k1.size(); ++n)
+              {
+                this->u3(task, state, k1[n], k2[n], k3[n], N[j], u3_tensor);
+                for(unsigned int c = 0; c < u3_tensor.size(); ++c) u3[n][c][j] = u3_tensor[c];
+              }
+          }
+      }
+
+
+    template <typename number>
+    void model<number>::sorted_mass_spectrum_batch_kernel(const twopf_db_task<number>* task, const std::vector< std::vector<number> >& history,
+                                                          const std::vector<double>& N, bool norm, std::vector< std::vector<number> >& E,
+                                                          unsigned int begin, unsigned int end)
+      {
+        flattened_tensor<number> state(history.size());
+        flattened_tensor<number> M_tensor(2*this->get_N_fields() * 2*this->get_N_fields());
+        flattened_tensor<number> E_tensor(this->get_N_fields());
+
+        for(unsigned int j = begin; j < end; ++j)
+          {
+            for(unsigned int i = 0; i < state.size(); ++i) state[i] = history[i][j];
+
+            this->sorted_mass_spectrum(task, state, N[j], norm, M_tensor, E_tensor);
+            for(unsigned int i = 0; i < E_tensor.size(); ++i) E[i][j] = E_tensor[i];
+          }
+      }
+
+
+    template <typename number>
+    void model<number>::dispatch_batch(unsigned int samples, std::function<void(unsigned int, unsigned int)> kernel)
+      {
+        unsigned int threads = 1;
+
+        if(this->batch_concurrent())
+          {
+            // use no more threads than were requested, and give each thread a worthwhile number of samples
+            unsigned int useful = (samples + CPPTRANSPORT_DEFAULT_BATCH_GRAIN - 1) / CPPTRANSPORT_DEFAULT_BATCH_GRAIN;
+            threads = std::max(1U, std::min(this->args.get_batch_threads(), useful));
+          }
+
+        if(threads == 1)
+          {
+            kernel(0, samples);
+            return;
+          }
+
+        unsigned int chunk = (samples + threads - 1) / threads;
+
+        // exceptions cannot propagate out of a std::thread, so capture them and rethrow on this thread
+        std::vector<std::exception_ptr> errors(threads);
+        std::vector<std::thread> pool;
+        pool.reserve(threads);
+
+        for(unsigned int t = 0; t < threads; ++t)
+          {
+            unsigned int begin = std::min(samples, t*chunk);
+            unsigned int end = std::min(samples, begin + chunk);
+
+            pool.emplace_back([&kernel, &errors, t, begin, end]() -> void
+              {
+                try
+                  {
+                    kernel(begin, end);
+                  }
+                catch(...)
+                  {
+                    errors[t] = std::current_exception();
+                  }
+              });
+          }
+
+        for(std::thread& t : pool)
+          {
+            t.join();
+          }
+
+        for(const std::exception_ptr& e : errors)
+          {
+            if(e) std::rethrow_exception(e);
+          }
+      }
+
+
     // INITIAL CONDITIONS HANDLING
 
 
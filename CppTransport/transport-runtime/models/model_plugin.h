@@ -0,0 +1,285 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+
+#ifndef CPPTRANSPORT_MODEL_PLUGIN_H
+#define CPPTRANSPORT_MODEL_PLUGIN_H
+
+
+#include <string>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <typeinfo>
+
+#include <dlfcn.h>
+
+#include "transport-runtime/version.h"
+#include "transport-runtime/defaults.h"
+#include "transport-runtime/exceptions.h"
+#include "transport-runtime/messages.h"
+#include "transport-runtime/build_data.h"
+
+#include "transport-runtime/manager/environment.h"
+#include "transport-runtime/manager/argument_cache.h"
+
+#include "boost/filesystem/operations.hpp"
+#include "boost/version.hpp"
+
+
+// A model plugin is a shared library containing a single translated model, built with default_number_type.
+// It exports a small C-linkage interface, defined by CPPTRANSPORT_DEFINE_MODEL_PLUGIN, which allows the
+// model_manager to load it on demand and construct the model without the model being linked into the executable.
+// Plugin files are named by the model's unique identifier, so the model_manager can locate the plugin
+// for a uid without opening every library on its search path.
+// Because the model object crosses the library boundary, the plugin must also agree with the loading
+// executable on compiler, standard library ABI and runtime installation; it exports a hash of these
+// which the model_manager compares against its own before constructing anything.
+
+//! define the C-linkage entry points for a model plugin; Model should be the fully-qualified
+//! name of the model class and UID its unique identifier
+#define CPPTRANSPORT_DEFINE_MODEL_PLUGIN(Model, UID)                                                          \
+  extern "C" const char* cpptransport_plugin_uid() { return(UID); }                                          \
+  extern "C" unsigned int cpptransport_plugin_api() { return(transport::CPPTRANSPORT_RUNTIME_API_VERSION); } \
+  extern "C" const char* cpptransport_plugin_number_type() { return(typeid(transport::default_number_type).name()); } \
+  extern "C" const char* cpptransport_plugin_abi()                                                            \
+    { static const std::string h = transport::model_plugin_abi_hash(); return(h.c_str()); }                   \
+  extern "C" void* cpptransport_plugin_create(transport::local_environment* e, transport::argument_cache* c)  \
+    { return(static_cast< transport::model<transport::default_number_type>* >(new Model(*e, *c))); }          \
+  extern "C" void cpptransport_plugin_destroy(void* m)                                                        \
+    { delete static_cast< transport::model<transport::default_number_type>* >(m); }
+
+
+namespace transport
+  {
+
+    // names of the entry points exported by a model plugin
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_UID         = "cpptransport_plugin_uid";
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_API         = "cpptransport_plugin_api";
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_NUMBER_TYPE = "cpptransport_plugin_number_type";
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_ABI         = "cpptransport_plugin_abi";
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_CREATE      = "cpptransport_plugin_create";
+    constexpr auto CPPTRANSPORT_PLUGIN_SYMBOL_DESTROY     = "cpptransport_plugin_destroy";
+
+
+    //! build a description of everything that must match between a plugin and the executable which loads it:
+    //! runtime API, number type, compiler and standard library ABI, Boost version, and the runtime installation
+    inline std::string model_plugin_abi_signature()
+      {
+        std::ostringstream sig;
+
+        sig << CPPTRANSPORT_RUNTIME_API_VERSION
+            << "|" << typeid(default_number_type).name() << ":" << sizeof(default_number_type)
+            << "|" << __VERSION__
+            << "|" << __cplusplus
+#ifdef _GLIBCXX_USE_CXX11_ABI
+            << "|cxx11abi=" << _GLIBCXX_USE_CXX11_ABI
+#endif
+            << "|boost=" << BOOST_LIB_VERSION
+#ifdef CPPTRANSPORT_INSTRUMENT
+            << "|instrument"
+#endif
+            << "|" << build_data::config_timestamp;
+
+        return(sig.str());
+      }
+
+
+    //! hash the ABI signature (64-bit FNV-1a) into a short string which can be exported through a C interface
+    inline std::string model_plugin_abi_hash()
+      {
+        std::uint64_t h = 14695981039346656037ULL;
+
+        for(unsigned char c : model_plugin_abi_signature())
+          {
+            h ^= c;
+            h *= 1099511628211ULL;
+          }
+
+        std::ostringstream out;
+        out << std::hex << std::setw(16) << std::setfill('0') << h;
+        return(out.str());
+      }
+
+
+    //! model_plugin holds an open handle to a model plugin; the library is closed when the
+    //! model_plugin is destroyed, so it should outlive any model objects it has constructed
+    class model_plugin
+      {
+
+        // TYPES
+
+      protected:
+
+        typedef const char* (*uid_function)();
+        typedef unsigned int (*api_function)();
+        typedef const char* (*number_type_function)();
+        typedef const char* (*abi_function)();
+        typedef void* (*create_function)(local_environment*, argument_cache*);
+        typedef void (*destroy_function)(void*);
+
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor opens the library and resolves its entry points; throws a runtime_exception
+        //! if the library cannot be opened or does not export the plugin interface
+        model_plugin(const boost::filesystem::path& p);
+
+        //! destructor closes the library
+        ~model_plugin();
+
+        // a plugin handle cannot be copied
+        model_plugin(const model_plugin&) = delete;
+        model_plugin& operator=(const model_plugin&) = delete;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get path to library
+        const boost::filesystem::path& get_path() const { return(this->path); }
+
+        //! get uid of the model provided by this plugin
+        std::string get_uid() const { return(std::string(this->uid())); }
+
+        //! get runtime API version against which this plugin was built
+        unsigned int get_api() const { return(this->api()); }
+
+        //! get hash of the build environment used to compile this plugin; see model_plugin_abi_hash()
+        std::string get_abi_hash() const { return(std::string(this->abi())); }
+
+        //! determine whether this plugin was built for the number type 'number'
+        template <typename number>
+        bool provides_number_type() const { return(std::string(this->number_type()) == typeid(number).name()); }
+
+        //! construct an instance of the model; the result points to a model<default_number_type>
+        //! and must be released using destroy()
+        void* create(local_environment& e, argument_cache& c) const { return(this->create_model(&e, &c)); }
+
+        //! release an instance of the model constructed by create()
+        void destroy(void* m) const { this->destroy_model(m); }
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! resolve a symbol in the library, throwing if it is missing
+        template <typename FunctionType>
+        FunctionType resolve(const char* symbol);
+
+
+        // INTERNAL DATA
+
+      protected:
+
+        //! path to library
+        const boost::filesystem::path path;
+
+        //! handle returned by dlopen()
+        void* handle;
+
+        //! entry points
+        uid_function uid;
+        api_function api;
+        number_type_function number_type;
+        abi_function abi;
+        create_function create_model;
+        destroy_function destroy_model;
+
+      };
+
+
+    inline model_plugin::model_plugin(const boost::filesystem::path& p)
+      : path(p),
+        handle(nullptr),
+        uid(nullptr),
+        api(nullptr),
+        number_type(nullptr),
+        abi(nullptr),
+        create_model(nullptr),
+        destroy_model(nullptr)
+      {
+        // resolve all symbols immediately, so that a mismatched plugin fails here rather than on first use;
+        // keep the plugin's symbols local so that different plugins cannot interfere with each other
+        this->handle = dlopen(p.string().c_str(), RTLD_NOW | RTLD_LOCAL);
+
+        if(this->handle == nullptr)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_OPEN_FAIL << " '" << p.string() << "': " << dlerror();
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        try
+          {
+            this->uid = this->resolve<uid_function>(CPPTRANSPORT_PLUGIN_SYMBOL_UID);
+            this->api = this->resolve<api_function>(CPPTRANSPORT_PLUGIN_SYMBOL_API);
+            this->number_type = this->resolve<number_type_function>(CPPTRANSPORT_PLUGIN_SYMBOL_NUMBER_TYPE);
+            this->abi = this->resolve<abi_function>(CPPTRANSPORT_PLUGIN_SYMBOL_ABI);
+            this->create_model = this->resolve<create_function>(CPPTRANSPORT_PLUGIN_SYMBOL_CREATE);
+            this->destroy_model = this->resolve<destroy_function>(CPPTRANSPORT_PLUGIN_SYMBOL_DESTROY);
+          }
+        catch(runtime_exception& xe)
+          {
+            dlclose(this->handle);
+            throw;
+          }
+      }
+
+
+    inline model_plugin::~model_plugin()
+      {
+        if(this->handle != nullptr) dlclose(this->handle);
+      }
+
+
+    template <typename FunctionType>
+    FunctionType model_plugin::resolve(const char* symbol)
+      {
+        // clear any outstanding error condition
+        dlerror();
+
+        void* sym = dlsym(this->handle, symbol);
+
+        if(sym == nullptr)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_PLUGIN_SYMBOL_MISSING << " '" << symbol << "' " << CPPTRANSPORT_PLUGIN_IN << " '" << this->path.string() << "'";
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+        return(reinterpret_cast<FunctionType>(sym));
+      }
+
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_MODEL_PLUGIN_H
@@ -0,0 +1,590 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_NUMERIC_GEOMETRY_H
+#define CPPTRANSPORT_NUMERIC_GEOMETRY_H
+
+
+#include <vector>
+
+#include "transport-runtime/utilities/taylor_jet.h"
+
+#include "Eigen/Core"
+#include "Eigen/LU"
+
+
+namespace transport
+  {
+
+    // Models translated with --numeric-curvature do not carry symbolic expressions for the connexion or
+    // curvature. Instead, the metric is evaluated on Taylor jets, giving its components together with their
+    // partial derivatives up to order Order, and numeric_geometry builds the inverse metric, connexion and
+    // Riemann tensor from these by dense linear algebra.
+    //
+    // Conventions match the symbolic objects built by the translator (curvature_classes.cpp):
+    //   Gamma_{ajk} = (G_aj,k + G_ak,j - G_jk,a)/2             -- connexion of the first kind
+    //   Gamma^i_jk  = G^{ia} Gamma_{ajk}
+    //   R_ijkl      = (G_il,jk + G_jk,il - G_ik,jl - G_jl,ik)/2 + Gamma_{ajk} Gamma^a_il - Gamma_{ajl} Gamma^a_ik
+    // and the contractions with the momenta p^a are those of the covariant_Riemann caches.
+    // Costs are O(N^4) for the connexion and its derivatives, and O(N^5) for the curvature, independent of
+    // the complexity of the metric.
+    //
+    // All output arrays use the FIELDS_FLATTEN layout, so that (a,b,c) is stored at N*N*a + N*b + c.
+
+    template <typename number, unsigned int N, unsigned int Order>
+    class numeric_geometry
+      {
+
+        static_assert(Order >= 1, "numeric_geometry requires at least first derivatives of the metric");
+
+      public:
+
+        //! type of the jets carrying the metric components
+        using jet_type = ad::taylor_jet<number, N, Order>;
+
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor accepts the N*N components of the metric in row-major order, and builds the
+        //! inverse metric and connexion; quantities which need second derivatives are built on demand
+        numeric_geometry(const jet_type* G_);
+
+        //! destructor is default
+        ~numeric_geometry() = default;
+
+
+        // INTERFACE -- METRIC AND CONNEXION
+
+      public:
+
+        //! write inverse metric G^{ab}
+        void inverse_metric(number* Ginv_out) const;
+
+        //! write connexion Gamma^a_bc
+        void connexion(number* Gamma_out) const;
+
+
+        // INTERFACE -- COVARIANT DERIVATIVES OF THE POTENTIAL
+
+      public:
+
+        //! write V;ab given a jet for the potential carrying at least second derivatives
+        template <unsigned int VOrder>
+        void covariant_ddV(const ad::taylor_jet<number, N, VOrder>& V, number* ddV) const;
+
+        //! write V;abc = (V;ab);c given a jet for the potential carrying third derivatives;
+        //! requires second derivatives of the metric
+        template <unsigned int VOrder>
+        void covariant_dddV(const ad::taylor_jet<number, N, VOrder>& V, number* dddV);
+
+
+        // INTERFACE -- CURVATURE CONTRACTIONS
+
+      public:
+
+        //! write A2_ij = R_(i|lm|j) p^l p^m; requires second derivatives of the metric
+        void Riemann_A2(const number* p, number* A2);
+
+        //! write B3_ijk = R_k(ij)l p^l; requires second derivatives of the metric
+        void Riemann_B3(const number* p, number* B3);
+
+        //! write A3_ijk = (R_l(ij|m|;k)) p^l p^m, symmetrized over (i,j,k); requires third derivatives of the metric
+        void Riemann_A3(const number* p, number* A3);
+
+
+        // INTERNAL API
+
+      protected:
+
+        static constexpr unsigned int idx(unsigned int a, unsigned int b)                                 { return N*a + b; }
+        static constexpr unsigned int idx(unsigned int a, unsigned int b, unsigned int c)                 { return N*N*a + N*b + c; }
+        static constexpr unsigned int idx(unsigned int a, unsigned int b, unsigned int c, unsigned int d) { return N*N*N*a + N*N*b + N*c + d; }
+
+        //! partial derivative G_ab,c
+        number dG(unsigned int a, unsigned int b, unsigned int c) const                                 { return this->G[idx(a,b)].derivative(c); }
+
+        //! partial derivative G_ab,cd
+        number ddG(unsigned int a, unsigned int b, unsigned int c, unsigned int d) const                { return this->G[idx(a,b)].derivative(c,d); }
+
+        //! partial derivative G_ab,cde
+        number dddG(unsigned int a, unsigned int b, unsigned int c, unsigned int d, unsigned int e) const { return this->G[idx(a,b)].derivative(c,d,e); }
+
+        //! build derivatives of the inverse metric and the connexion
+        void build_derivatives();
+
+        //! build the Riemann tensor
+        void build_Riemann();
+
+
+        // INTERNAL DATA
+
+      protected:
+
+        //! metric jets
+        const jet_type* G;
+
+        //! inverse metric G^{ab}
+        std::vector<number> Ginv;
+
+        //! connexion of the first kind Gamma_{ajk}
+        std::vector<number> Gamma1;
+
+        //! connexion Gamma^i_jk
+        std::vector<number> Gamma;
+
+        //! derivatives of the inverse metric G^{ab},k, stored at idx(a,b,k); built on demand
+        std::vector<number> dGinv;
+
+        //! derivatives of the connexion of the first kind Gamma_{ajk},e, stored at idx(a,j,k,e); built on demand
+        std::vector<number> dGamma1;
+
+        //! derivatives of the connexion Gamma^i_jk,e, stored at idx(i,j,k,e); built on demand
+        std::vector<number> dGamma;
+
+        //! Riemann tensor R_ijkl with all indices lowered; built on demand
+        std::vector<number> R;
+
+      };
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    numeric_geometry<number, N, Order>::numeric_geometry(const jet_type* G_)
+      : G(G_),
+        Ginv(N*N),
+        Gamma1(N*N*N),
+        Gamma(N*N*N)
+      {
+        using matrix_type = Eigen::Matrix<number, N, N, Eigen::RowMajor>;
+
+        matrix_type Gval;
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int b = 0; b < N; ++b)
+              {
+                Gval(a,b) = this->G[idx(a,b)].value();
+              }
+          }
+
+        Eigen::Map<matrix_type> Ginv_matrix(this->Ginv.data());
+        Ginv_matrix = Gval.partialPivLu().inverse();
+
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int k = 0; k <= j; ++k)
+                  {
+                    const number g = (this->dG(a,j,k) + this->dG(a,k,j) - this->dG(j,k,a)) / 2;
+                    this->Gamma1[idx(a,j,k)] = this->Gamma1[idx(a,k,j)] = g;
+                  }
+              }
+          }
+
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int k = 0; k <= j; ++k)
+                  {
+                    number g(0);
+                    for(unsigned int a = 0; a < N; ++a)
+                      {
+                        g += this->Ginv[idx(i,a)] * this->Gamma1[idx(a,j,k)];
+                      }
+                    this->Gamma[idx(i,j,k)] = this->Gamma[idx(i,k,j)] = g;
+                  }
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::inverse_metric(number* Ginv_out) const
+      {
+        std::copy(this->Ginv.cbegin(), this->Ginv.cend(), Ginv_out);
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::connexion(number* Gamma_out) const
+      {
+        std::copy(this->Gamma.cbegin(), this->Gamma.cend(), Gamma_out);
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::build_derivatives()
+      {
+        static_assert(Order >= 2, "numeric_geometry: second derivatives of the metric are required");
+
+        if(!this->dGamma.empty()) return;
+
+        // G^{ab},k = -G^{ac} G_cd,k G^{db}; form M^b_ck = G_cd,k G^{db} first so the cost is O(N^4)
+        std::vector<number> M(N*N*N);
+        for(unsigned int c = 0; c < N; ++c)
+          {
+            for(unsigned int b = 0; b < N; ++b)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    number m(0);
+                    for(unsigned int d = 0; d < N; ++d)
+                      {
+                        m += this->dG(c,d,k) * this->Ginv[idx(d,b)];
+                      }
+                    M[idx(c,b,k)] = m;
+                  }
+              }
+          }
+
+        this->dGinv.assign(N*N*N, number(0));
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int b = 0; b < N; ++b)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    number d(0);
+                    for(unsigned int c = 0; c < N; ++c)
+                      {
+                        d -= this->Ginv[idx(a,c)] * M[idx(c,b,k)];
+                      }
+                    this->dGinv[idx(a,b,k)] = d;
+                  }
+              }
+          }
+
+        this->dGamma1.assign(N*N*N*N, number(0));
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int k = 0; k <= j; ++k)
+                  {
+                    for(unsigned int e = 0; e < N; ++e)
+                      {
+                        const number g = (this->ddG(a,j,k,e) + this->ddG(a,k,j,e) - this->ddG(j,k,a,e)) / 2;
+                        this->dGamma1[idx(a,j,k,e)] = this->dGamma1[idx(a,k,j,e)] = g;
+                      }
+                  }
+              }
+          }
+
+        // Gamma^i_jk,e = G^{ia},e Gamma_{ajk} + G^{ia} Gamma_{ajk},e
+        this->dGamma.assign(N*N*N*N, number(0));
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int k = 0; k <= j; ++k)
+                  {
+                    for(unsigned int e = 0; e < N; ++e)
+                      {
+                        number g(0);
+                        for(unsigned int a = 0; a < N; ++a)
+                          {
+                            g += this->dGinv[idx(i,a,e)] * this->Gamma1[idx(a,j,k)] + this->Ginv[idx(i,a)] * this->dGamma1[idx(a,j,k,e)];
+                          }
+                        this->dGamma[idx(i,j,k,e)] = this->dGamma[idx(i,k,j,e)] = g;
+                      }
+                  }
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::build_Riemann()
+      {
+        static_assert(Order >= 2, "numeric_geometry: second derivatives of the metric are required");
+
+        if(!this->R.empty()) return;
+
+        this->R.assign(N*N*N*N, number(0));
+
+        // use the pair symmetries R_ijkl = -R_jikl = -R_ijlk, computing only i > j and k > l
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j < i; ++j)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    for(unsigned int l = 0; l < k; ++l)
+                      {
+                        number r = (this->ddG(i,l,j,k) + this->ddG(j,k,i,l) - this->ddG(i,k,j,l) - this->ddG(j,l,i,k)) / 2;
+
+                        for(unsigned int a = 0; a < N; ++a)
+                          {
+                            r += this->Gamma1[idx(a,j,k)] * this->Gamma[idx(a,i,l)] - this->Gamma1[idx(a,j,l)] * this->Gamma[idx(a,i,k)];
+                          }
+
+                        this->R[idx(i,j,k,l)] = r;
+                        this->R[idx(j,i,k,l)] = -r;
+                        this->R[idx(i,j,l,k)] = -r;
+                        this->R[idx(j,i,l,k)] = r;
+                      }
+                  }
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    template <unsigned int VOrder>
+    void numeric_geometry<number, N, Order>::covariant_ddV(const ad::taylor_jet<number, N, VOrder>& V, number* ddV) const
+      {
+        static_assert(VOrder >= 2, "numeric_geometry: covariant_ddV requires second derivatives of the potential");
+
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j <= i; ++j)
+              {
+                number d = V.derivative(i,j);
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    d -= this->Gamma[idx(k,i,j)] * V.derivative(k);
+                  }
+                ddV[idx(i,j)] = ddV[idx(j,i)] = d;
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    template <unsigned int VOrder>
+    void numeric_geometry<number, N, Order>::covariant_dddV(const ad::taylor_jet<number, N, VOrder>& V, number* dddV)
+      {
+        static_assert(VOrder >= 3, "numeric_geometry: covariant_dddV requires third derivatives of the potential");
+
+        this->build_derivatives();
+
+        std::vector<number> ddV(N*N);
+        this->covariant_ddV(V, ddV.data());
+
+        // V;ijk = (V;ij),k - Gamma^l_ik V;lj - Gamma^l_jk V;il, where
+        // (V;ij),k = V,ijk - Gamma^l_ij,k V,l - Gamma^l_ij V,lk
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j <= i; ++j)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    number d = V.derivative(i,j,k);
+                    for(unsigned int l = 0; l < N; ++l)
+                      {
+                        d -= this->dGamma[idx(l,i,j,k)] * V.derivative(l) + this->Gamma[idx(l,i,j)] * V.derivative(l,k);
+                        d -= this->Gamma[idx(l,i,k)] * ddV[idx(l,j)] + this->Gamma[idx(l,j,k)] * ddV[idx(i,l)];
+                      }
+                    dddV[idx(i,j,k)] = dddV[idx(j,i,k)] = d;
+                  }
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::Riemann_A2(const number* p, number* A2)
+      {
+        this->build_Riemann();
+
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j <= i; ++j)
+              {
+                number a(0);
+                for(unsigned int l = 0; l < N; ++l)
+                  {
+                    for(unsigned int m = 0; m < N; ++m)
+                      {
+                        a += (this->R[idx(l,i,j,m)] + this->R[idx(l,j,i,m)]) * p[l] * p[m];
+                      }
+                  }
+                A2[idx(i,j)] = A2[idx(j,i)] = a / 2;
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::Riemann_B3(const number* p, number* B3)
+      {
+        this->build_Riemann();
+
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j <= i; ++j)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    number b(0);
+                    for(unsigned int l = 0; l < N; ++l)
+                      {
+                        b += (this->R[idx(k,i,j,l)] + this->R[idx(k,j,i,l)]) * p[l];
+                      }
+                    B3[idx(i,j,k)] = B3[idx(j,i,k)] = b / 2;
+                  }
+              }
+          }
+      }
+
+
+    template <typename number, unsigned int N, unsigned int Order>
+    void numeric_geometry<number, N, Order>::Riemann_A3(const number* p, number* A3)
+      {
+        static_assert(Order >= 3, "numeric_geometry: Riemann_A3 requires third derivatives of the metric");
+
+        this->build_derivatives();
+        this->build_Riemann();
+
+        // D_kij = R_lijm;k p^l p^m, where
+        //   R_lijm;k = R_lijm,k - Gamma^n_kl R_nijm - Gamma^n_ki R_lnjm - Gamma^n_kj R_linm - Gamma^n_km R_lijn.
+        // Contracting with the momenta before summing over n keeps the cost at O(N^5)
+
+        // q^n_k = Gamma^n_kl p^l, r_ai = Gamma_{aim} p^m, s^a = Gamma^a_lm p^l p^m
+        std::vector<number> q(N*N, number(0));
+        std::vector<number> r(N*N, number(0));
+        std::vector<number> s(N, number(0));
+
+        // dq^a_jk = Gamma^a_lj,k p^l, dr_aik = Gamma_{aim},k p^m, ds^a_k = Gamma^a_lm,k p^l p^m
+        std::vector<number> dq(N*N*N, number(0));
+        std::vector<number> dr(N*N*N, number(0));
+        std::vector<number> ds(N*N, number(0));
+
+        for(unsigned int a = 0; a < N; ++a)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int l = 0; l < N; ++l)
+                  {
+                    q[idx(a,j)] += this->Gamma[idx(a,j,l)] * p[l];
+                    r[idx(a,j)] += this->Gamma1[idx(a,j,l)] * p[l];
+
+                    for(unsigned int k = 0; k < N; ++k)
+                      {
+                        dq[idx(a,j,k)] += this->dGamma[idx(a,l,j,k)] * p[l];
+                        dr[idx(a,j,k)] += this->dGamma1[idx(a,j,l,k)] * p[l];
+                      }
+                  }
+
+                s[a] += q[idx(a,j)] * p[j];
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    ds[idx(a,k)] += dq[idx(a,j,k)] * p[j];
+                  }
+              }
+          }
+
+        // U_nij = R_nijm p^m, W_ijn = p^l R_lijn, P_ij = R_lijm p^l p^m
+        std::vector<number> U(N*N*N, number(0));
+        std::vector<number> W(N*N*N, number(0));
+        std::vector<number> P(N*N, number(0));
+
+        for(unsigned int n = 0; n < N; ++n)
+          {
+            for(unsigned int i = 0; i < N; ++i)
+              {
+                for(unsigned int j = 0; j < N; ++j)
+                  {
+                    for(unsigned int m = 0; m < N; ++m)
+                      {
+                        U[idx(n,i,j)] += this->R[idx(n,i,j,m)] * p[m];
+                        W[idx(i,j,n)] += p[m] * this->R[idx(m,i,j,n)];
+                      }
+                  }
+              }
+          }
+
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int n = 0; n < N; ++n)
+                  {
+                    P[idx(i,j)] += p[n] * U[idx(n,i,j)];
+                  }
+              }
+          }
+
+        std::vector<number> D(N*N*N);
+
+        for(unsigned int k = 0; k < N; ++k)
+          {
+            for(unsigned int i = 0; i < N; ++i)
+              {
+                for(unsigned int j = 0; j < N; ++j)
+                  {
+                    // partial derivative R_lijm,k p^l p^m; the metric part is
+                    // (G_lm,ijk + G_ij,lmk - G_lj,imk - G_im,ljk)/2 p^l p^m
+                    number d(0);
+                    for(unsigned int l = 0; l < N; ++l)
+                      {
+                        for(unsigned int m = 0; m < N; ++m)
+                          {
+                            d += (this->dddG(l,m,i,j,k) + this->dddG(i,j,l,m,k) - this->dddG(l,j,i,m,k) - this->dddG(i,m,l,j,k)) * p[l] * p[m];
+                          }
+                      }
+                    d /= 2;
+
+                    // connexion part is (Gamma_{aij} Gamma^a_lm - Gamma_{aim} Gamma^a_lj),k p^l p^m
+                    for(unsigned int a = 0; a < N; ++a)
+                      {
+                        d += this->dGamma1[idx(a,i,j,k)] * s[a] + this->Gamma1[idx(a,i,j)] * ds[idx(a,k)];
+                        d -= dr[idx(a,i,k)] * q[idx(a,j)] + r[idx(a,i)] * dq[idx(a,j,k)];
+                      }
+
+                    // connexion terms of the covariant derivative
+                    for(unsigned int n = 0; n < N; ++n)
+                      {
+                        d -= q[idx(n,k)] * U[idx(n,i,j)];
+                        d -= this->Gamma[idx(n,k,i)] * P[idx(n,j)];
+                        d -= this->Gamma[idx(n,k,j)] * P[idx(i,n)];
+                        d -= q[idx(n,k)] * W[idx(i,j,n)];
+                      }
+
+                    D[idx(k,i,j)] = d;
+                  }
+              }
+          }
+
+        // symmetrize over the three free indices
+        for(unsigned int i = 0; i < N; ++i)
+          {
+            for(unsigned int j = 0; j < N; ++j)
+              {
+                for(unsigned int k = 0; k < N; ++k)
+                  {
+                    A3[idx(i,j,k)] = (D[idx(k,i,j)] + D[idx(j,i,k)] + D[idx(k,j,i)]
+                                      + D[idx(i,j,k)] + D[idx(j,k,i)] + D[idx(i,k,j)]) / 6;
+                  }
+              }
+          }
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_NUMERIC_GEOMETRY_H
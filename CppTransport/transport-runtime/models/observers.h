@@ -45,6 +45,7 @@
 #include "transport-runtime/scheduler/work_queue.h"
 
 #include "transport-runtime/utilities/formatter.h"
+#include "transport-runtime/utilities/hot_path_instrument.h"
 
 #include <boost/timer/timer.hpp>
 
@@ -66,7 +67,8 @@ namespace transport
         //! Create a stepping observer object
         stepping_observer(const time_config_database& t, unsigned int p)
           : time_db(t),
-            precision(p)
+            precision(p),
+            observed(0)
           {
             current_step = time_db.record_begin();
           }
@@ -77,7 +79,10 @@ namespace transport
       public:
 
         //! Advance time-step counter
-        void step() { this->current_step++; }
+        void step() { this->current_step++; this->observed++; }
+
+        //! Query number of time steps observed so far
+        unsigned int get_observed() const { return(this->observed); }
 
         //! Query whether the current time step should be stored
         bool store_time_step() const { return(this->current_step->is_stored()); }
@@ -102,9 +107,72 @@ namespace transport
         //! Numerical precision to be used when logging
         unsigned int precision;
 
+        //! Number of time steps observed so far
+        unsigned int observed;
+
+      };
+
+
+    //! A checkpoint agent records each sample observed during an integration, and periodically writes
+    //! the history into the batcher's current container, replacing the previous checkpoint.
+    //! If the integration is interrupted, the samples allow it to be resumed from the most recent checkpoint
+    template <typename number>
+    class checkpoint_agent
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor captures batcher, k-configuration serial number, refinement level and initial step size
+        checkpoint_agent(integration_batcher<number>& b, unsigned int s, unsigned int r, double st)
+          : batcher(b),
+            item(s, r, st)
+          {
+          }
+
+        //! destructor is default
+        ~checkpoint_agent() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! record a sample, and write a checkpoint if one is due;
+        //! samples are not retained unless checkpointing is enabled
+        template <typename State>
+        void record(unsigned int position, double t, const State& x);
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! batcher
+        integration_batcher<number>& batcher;
+
+        //! samples recorded so far
+        typename integration_items<number>::checkpoint_item item;
+
       };
 
 
+    template <typename number>
+    template <typename State>
+    void checkpoint_agent<number>::record(unsigned int position, double t, const State& x)
+      {
+        if(!this->batcher.is_checkpointing()) return;
+
+        std::vector<number> state(x.size());
+        for(unsigned int i = 0; i < x.size(); ++i) state[i] = x[i];
+
+        this->item.samples.emplace_back(position, t, std::move(state));
+
+        if(this->batcher.is_checkpoint_due()) this->batcher.write_checkpoint(this->item);
+      }
+
+
     //! A timing observer is a more sophisticated type of observer; it keeps track
     //! of how long is spent during the integration (and the batching process)
     template <typename number>
@@ -140,6 +208,30 @@ namespace transport
         boost::timer::nanosecond_type get_batching_time() const { return(this->batching_timer.elapsed().wall); }
 
 
+        // HOT-PATH INSTRUMENTATION
+
+      public:
+
+        //! Attach a hot-path profile, which will record the latency of each batching step
+        void attach_profile(hot_path::integration_profile& p) { this->profile = &p; }
+
+        //! Get summary of the hot-path profile, if one is attached
+        hot_path::profile_summary get_profile_summary() const { return(this->profile != nullptr ? this->profile->summarize() : hot_path::profile_summary()); }
+
+
+        // CHECKPOINTING
+
+      public:
+
+        //! Attach a checkpoint agent, which will record each observed sample
+        void attach_checkpoint(checkpoint_agent<number>& c) { this->checkpointer = &c; }
+
+        //! Pass the most recently observed sample to the checkpoint agent, if one is attached;
+        //! should be called after the sample has been pushed
+        template <typename State>
+        void checkpoint(const State& x, double t) { if(this->checkpointer != nullptr) this->checkpointer->record(this->get_observed(), t, x); }
+
+
         // INTERNAL DATA
 
       private:
@@ -164,6 +256,18 @@ namespace transport
         //! Timer for batching
         boost::timer::cpu_timer       batching_timer;
 
+        //! Hot-path profile, if attached
+        hot_path::integration_profile* profile;
+
+        //! Checkpoint agent, if attached
+        checkpoint_agent<number>*     checkpointer;
+
+        //! Clock reading at start of current batching step, if profiling
+        hot_path::tick_type           batching_start;
+
+        //! Integration time of current batching step, if profiling
+        double                        batching_t;
+
       };
 
 
@@ -172,7 +276,11 @@ namespace transport
       : stepping_observer<number>(t,p),
         output_interval(t_int),
         silent(s),
-        first_output(true)
+        first_output(true),
+        profile(nullptr),
+        checkpointer(nullptr),
+        batching_start(0),
+        batching_t(0.0)
       {
         batching_timer.stop();
         // leave the integration timer running, so it also records start-up time associated with the integration,
@@ -186,6 +294,12 @@ namespace transport
     template <typename Level>
     void timing_observer<number>::start_batching(double t, boost::log::sources::severity_logger<Level>& logger, Level lev)
 	    {
+        if(this->profile != nullptr)
+          {
+            this->batching_start = this->profile->begin_observation();
+            this->batching_t = t;
+          }
+
         this->integration_timer.stop();
         this->batching_timer.resume();
 
@@ -231,6 +345,8 @@ namespace transport
       {
         this->batching_timer.stop();
         this->integration_timer.resume();
+
+        if(this->profile != nullptr) this->profile->end_observation(this->batching_start, this->batching_t);
       }
 
 
@@ -353,7 +469,8 @@ namespace transport
     void twopf_singleconfig_batch_observer<number>::stop_timers(size_t steps, unsigned int refinement)
       {
         this->timing_observer<number>::stop_timers(steps, refinement);
-        this->batcher.report_integration_success(this->get_integration_time(), this->get_batching_time(), this->k_config->serial, steps, refinement);
+        this->batcher.report_integration_success(this->get_integration_time(), this->get_batching_time(), this->k_config->serial, steps, refinement,
+                                                 this->get_profile_summary());
 
         std::ostringstream init_time;
         init_time << std::scientific << std::setprecision(this->precision) << this->t_initial;
@@ -580,7 +697,8 @@ namespace transport
     void threepf_singleconfig_batch_observer<number>::stop_timers(size_t steps, unsigned int refinement)
       {
         this->timing_observer<number>::stop_timers(steps, refinement);
-        this->batcher.report_integration_success(this->get_integration_time(), this->get_batching_time(), this->k_config->serial, steps, refinement);
+        this->batcher.report_integration_success(this->get_integration_time(), this->get_batching_time(), this->k_config->serial, steps, refinement,
+                                                 this->get_profile_summary());
 
         std::ostringstream init_time;
         init_time << std::scientific << std::setprecision(this->precision) << this->t_initial;
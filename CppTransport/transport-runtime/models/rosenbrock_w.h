@@ -0,0 +1,169 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_ROSENBROCK_W_H
+#define CPPTRANSPORT_ROSENBROCK_W_H
+
+
+#include <cmath>
+#include <algorithm>
+
+#include "boost/numeric/odeint.hpp"
+
+
+namespace transport
+  {
+
+    //! Two-stage, second-order Rosenbrock W-method ('ROS2'; Verwer, Spee, Blom & Hundsdorfer,
+    //! SIAM J. Sci. Comput. 20 (1999) 1456), packaged as an odeint-v2 controlled stepper.
+    //! A W-method keeps its order for any approximation to the Jacobian, so the system need only supply
+    //! a cheap approximate factorization of I - gamma h J. It does this through two methods in addition
+    //! to the usual right-hand side:
+    //!   prepare_W(x, t, gamma_h) -- factorize the approximation to I - gamma_h J at (x, t)
+    //!   solve_W(r, y)            -- solve (I - gamma_h J) y = r using the factorization
+    //! Step size control uses the difference between the ROS2 solution and the embedded first-order solution
+    template <typename State, typename Value = double, typename Time = Value>
+    class rosenbrock_w2
+      {
+
+      public:
+
+        using state_type = State;
+        using deriv_type = State;
+        using value_type = Value;
+        using time_type = Time;
+        using stepper_category = boost::numeric::odeint::controlled_stepper_tag;
+
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor captures absolute and relative error tolerances
+        rosenbrock_w2(value_type ae, value_type re)
+          : abs_err(ae),
+            rel_err(re)
+          {
+          }
+
+        //! destructor is default
+        ~rosenbrock_w2() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! attempt a step of size dt from (x, t); on success x, t are advanced. In either case dt is
+        //! replaced by the proposed size of the next step
+        template <typename System>
+        boost::numeric::odeint::controlled_step_result try_step(System& system, state_type& x, time_type& t, time_type& dt)
+          {
+            // gamma = 1 + 1/sqrt(2) gives L-stability when J is exact
+            const value_type gamma = 1.0 + 1.0/std::sqrt(2.0);
+
+            constexpr value_type safety = 0.9;
+            constexpr value_type min_factor = 0.2;
+            constexpr value_type max_factor = 5.0;
+
+            this->resize(x);
+            const size_t n = x.size();
+
+            system.prepare_W(x, t, static_cast<value_type>(gamma*dt));
+
+            // W k1 = f(t, x)
+            system(x, this->f, t);
+            system.solve_W(this->f, this->k1);
+
+            // W k2 = f(t + dt, x + dt k1) - 2 k1
+            for(size_t i = 0; i < n; ++i) this->y[i] = x[i] + dt*this->k1[i];
+            system(this->y, this->f, t + dt);
+            for(size_t i = 0; i < n; ++i) this->f[i] -= 2.0*this->k1[i];
+            system.solve_W(this->f, this->k2);
+
+            // the embedded first-order solution is x + dt k1, so the local error estimate is dt (k1 + k2)/2
+            value_type err = 0.0;
+            for(size_t i = 0; i < n; ++i)
+              {
+                this->y[i] = x[i] + 1.5*dt*this->k1[i] + 0.5*dt*this->k2[i];
+
+                const value_type scale = this->abs_err + this->rel_err * std::max(std::abs(x[i]), std::abs(this->y[i]));
+                err = std::max(err, static_cast<value_type>(std::abs(0.5*dt*(this->k1[i] + this->k2[i])) / scale));
+              }
+
+            if(!std::isfinite(err) || err > 1.0)
+              {
+                const value_type factor = std::isfinite(err) ? std::max(min_factor, safety/std::sqrt(err)) : min_factor;
+                dt *= factor;
+                return boost::numeric::odeint::fail;
+              }
+
+            for(size_t i = 0; i < n; ++i) x[i] = this->y[i];
+            t += dt;
+
+            const value_type factor = err > 0.0 ? std::min(max_factor, safety/std::sqrt(err)) : max_factor;
+            dt *= factor;
+
+            return boost::numeric::odeint::success;
+          }
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! size workspace to match the state
+        void resize(const state_type& x)
+          {
+            if(this->y.size() != x.size())
+              {
+                this->f = x;
+                this->k1 = x;
+                this->k2 = x;
+                this->y = x;
+              }
+          }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! error tolerances
+        value_type abs_err;
+        value_type rel_err;
+
+        //! workspace
+        state_type f;
+        state_type k1;
+        state_type k2;
+        state_type y;
+
+      };
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_ROSENBROCK_W_H
@@ -0,0 +1,111 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_STEPPER_CANDIDATE_H
+#define CPPTRANSPORT_STEPPER_CANDIDATE_H
+
+
+#include <string>
+#include <vector>
+#include <utility>
+
+
+namespace transport
+  {
+
+    //! stepper_candidate identifies an odeint stepper, and its tolerances, which can be selected at runtime.
+    //! Generated models normally use the stepper fixed in the model description; candidates are used when
+    //! benchmarking alternatives
+    class stepper_candidate
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! constructor
+        stepper_candidate(std::string n, double a, double r)
+          : name(std::move(n)),
+            abs_err(a),
+            rel_err(r)
+          {
+          }
+
+        //! destructor is default
+        ~stepper_candidate() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get stepper name, using the same names as the model description
+        const std::string& get_name() const { return(this->name); }
+
+        //! get absolute tolerance
+        double get_abs_err() const { return(this->abs_err); }
+
+        //! get relative tolerance
+        double get_rel_err() const { return(this->rel_err); }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! stepper name
+        std::string name;
+
+        //! absolute tolerance
+        double abs_err;
+
+        //! relative tolerance
+        double rel_err;
+
+      };
+
+
+    //! names of steppers which can be selected at runtime.
+    //! Implicit steppers are excluded because they need a different state type and a Jacobian
+    inline const std::vector<std::string>& runtime_steppers()
+      {
+        static const std::vector<std::string> names =
+          {
+            "runge_kutta_dopri5",
+            "runge_kutta_cash_karp45",
+            "runge_kutta_fehlberg78",
+            "bulirsch_stoer",
+            "bulirsch_stoer_dense_out",
+            "adams_bashforth_moulton"
+          };
+
+        return names;
+      }
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_STEPPER_CANDIDATE_H
@@ -0,0 +1,104 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_STEPPER_FACTORY_H
+#define CPPTRANSPORT_STEPPER_FACTORY_H
+
+
+#include <string>
+#include <sstream>
+
+#include "transport-runtime/models/stepper_candidate.h"
+
+#include "transport-runtime/exceptions.h"
+#include "transport-runtime/messages.h"
+
+#include "boost/numeric/odeint.hpp"
+
+
+namespace transport
+  {
+
+    namespace stepper_factory
+      {
+
+        //! integrate a system over a sequence of times using a stepper chosen at runtime.
+        //! Steppers are constructed exactly as the translator constructs them for $MAKE_PERT_STEPPER,
+        //! so a candidate which performs well here will perform in the same way once written into a model description
+        template <typename State, typename Value, typename Algebra, typename Operations,
+                  typename System, typename TimeIterator, typename Observer>
+        size_t integrate_times(const stepper_candidate& s, System system, State& x,
+                               TimeIterator begin, TimeIterator end, Value dt, Observer obs)
+          {
+            namespace odeint = boost::numeric::odeint;
+
+            const std::string& name = s.get_name();
+            const Value abs_err = static_cast<Value>(s.get_abs_err());
+            const Value rel_err = static_cast<Value>(s.get_rel_err());
+
+            if(name == "runge_kutta_dopri5")
+              {
+                return odeint::integrate_times(odeint::make_dense_output< odeint::runge_kutta_dopri5< State, Value, State, Value, Algebra, Operations > >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+            else if(name == "runge_kutta_cash_karp45")
+              {
+                // the model description names this stepper by its order pair 4(5); odeint's class is runge_kutta_cash_karp54
+                return odeint::integrate_times(odeint::make_controlled< odeint::runge_kutta_cash_karp54< State, Value, State, Value, Algebra, Operations > >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+            else if(name == "runge_kutta_fehlberg78")
+              {
+                return odeint::integrate_times(odeint::make_controlled< odeint::runge_kutta_fehlberg78< State, Value, State, Value, Algebra, Operations > >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+            else if(name == "bulirsch_stoer")
+              {
+                return odeint::integrate_times(odeint::bulirsch_stoer< State, Value, State, Value, Algebra, Operations >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+            else if(name == "bulirsch_stoer_dense_out")
+              {
+                return odeint::integrate_times(odeint::bulirsch_stoer_dense_out< State, Value, State, Value, Algebra, Operations >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+            else if(name == "adams_bashforth_moulton")
+              {
+                return odeint::integrate_times(odeint::make_controlled< odeint::adaptive_adams_bashforth_moulton< 5, State, Value, State, Value, Algebra, Operations > >(abs_err, rel_err),
+                                               system, x, begin, end, dt, obs);
+              }
+
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_AUTOTUNE_UNKNOWN_STEPPER << " '" << name << "'";
+            throw runtime_exception(exception_type::RUNTIME_ERROR, msg.str());
+          }
+
+      }   // namespace stepper_factory
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_STEPPER_FACTORY_H
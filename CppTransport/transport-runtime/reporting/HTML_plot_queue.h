@@ -0,0 +1,422 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_REPORTING_HTML_PLOT_QUEUE_H
+#define CPPTRANSPORT_REPORTING_HTML_PLOT_QUEUE_H
+
+
+#include <vector>
+#include <list>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+
+#include "transport-runtime/reporting/HTML_writer.h"
+
+#include "transport-runtime/manager/environment.h"
+#include "transport-runtime/defaults.h"
+
+#include "boost/filesystem/operations.hpp"
+#include "boost/date_time/posix_time/posix_time.hpp"
+
+
+namespace transport
+  {
+
+    namespace reporting
+      {
+
+        //! HTML_deferred is a placeholder for content which depends on the outcome of a plot.
+        //! It is shared between the document tree and the plot queue, and is resolved once the
+        //! queue has run, before the document is written
+        class HTML_deferred: public HTML_element
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor
+            HTML_deferred()
+              : succeeded(false)
+              {
+              }
+
+            //! destructor is default
+            virtual ~HTML_deferred() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! add an element to be written if the plot is generated successfully
+            HTML_deferred& add_success(const HTML_element& element) { this->on_success.emplace_back(element.clone()); return(*this); }
+
+            //! add an element to be written if the plot could not be generated
+            HTML_deferred& add_failure(const HTML_element& element) { this->on_failure.emplace_back(element.clone()); return(*this); }
+
+            //! record outcome of plot
+            void resolve(bool s) { this->succeeded = s; }
+
+
+            // INTERFACE -- from HTML_element
+
+          public:
+
+            //! write self to stream
+            void write(std::ostream& out, const std::string& indent, HTML_mode mode) const override final;
+
+            //! clone self
+            HTML_deferred* clone() const override final { return new HTML_deferred(static_cast<const HTML_deferred&>(*this)); }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! did the plot succeed?
+            bool succeeded;
+
+            //! content to write on success
+            std::list< std::shared_ptr<HTML_element> > on_success;
+
+            //! content to write on failure
+            std::list< std::shared_ptr<HTML_element> > on_failure;
+
+          };
+
+
+        inline void HTML_deferred::write(std::ostream& out, const std::string& indent, HTML_mode mode) const
+          {
+            for(const std::shared_ptr<HTML_element>& element : (this->succeeded ? this->on_success : this->on_failure))
+              {
+                element->write(out, indent, mode);
+              }
+          }
+
+
+        //! HTML_plot_queue collects Matplotlib scripts during report generation and runs them together
+        //! on a pool of threads.
+        //! Generated images are kept in a persistent cache keyed by a hash of the owning record's name,
+        //! its last-edit time and the content of the script, so plots for unchanged records are
+        //! copied from the cache rather than regenerated.
+        //! The cache is pruned to CPPTRANSPORT_DEFAULT_HTML_PLOT_CACHE_SIZE bytes after each run,
+        //! discarding the least recently used images first
+        class HTML_plot_queue
+          {
+
+          protected:
+
+            //! a queued plot
+            class plot_job
+              {
+
+              public:
+
+                //! name of record which owns the plot
+                std::string owner;
+
+                //! last-edit time of owning record
+                boost::posix_time::ptime last_edit;
+
+                //! location of script
+                boost::filesystem::path script;
+
+                //! location of image produced by script
+                boost::filesystem::path image;
+
+                //! placeholder to be resolved with the outcome
+                std::shared_ptr<HTML_deferred> target;
+
+              };
+
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor accepts location of persistent cache; caching is disabled if the path is empty
+            //! or the directory cannot be created
+            HTML_plot_queue(local_environment& e, boost::filesystem::path c);
+
+            //! destructor is default
+            ~HTML_plot_queue() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! queue a script for execution; returns placeholder element to be inserted in the document
+            std::shared_ptr<HTML_deferred> enqueue(const std::string& owner, const boost::posix_time::ptime& last_edit,
+                                                   const boost::filesystem::path& script, const boost::filesystem::path& image);
+
+            //! execute all queued scripts and resolve their placeholders
+            void run();
+
+
+            // INTERNAL API
+
+          protected:
+
+            //! process a single job; returns true if an image was produced
+            bool process(const plot_job& job);
+
+            //! compute cache key for a job
+            std::string make_key(const plot_job& job) const;
+
+            //! remove least recently used images until the cache fits within its size limit
+            void prune_cache();
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! reference to local environment, used to execute Python
+            local_environment& env;
+
+            //! location of persistent cache, or empty if caching is disabled
+            boost::filesystem::path cache;
+
+            //! queued jobs
+            std::vector<plot_job> jobs;
+
+          };
+
+
+        inline HTML_plot_queue::HTML_plot_queue(local_environment& e, boost::filesystem::path c)
+          : env(e),
+            cache(std::move(c))
+          {
+            if(this->cache.empty()) return;
+
+            try
+              {
+                boost::filesystem::create_directories(this->cache);
+              }
+            catch(boost::filesystem::filesystem_error& xe)
+              {
+                // the cache is an optimization only, so failure to create it is not an error
+                this->cache.clear();
+              }
+          }
+
+
+        inline std::shared_ptr<HTML_deferred> HTML_plot_queue::enqueue(const std::string& owner, const boost::posix_time::ptime& last_edit,
+                                                                const boost::filesystem::path& script, const boost::filesystem::path& image)
+          {
+            std::shared_ptr<HTML_deferred> target = std::make_shared<HTML_deferred>();
+            this->jobs.push_back(plot_job{ owner, last_edit, script, image, target });
+            return target;
+          }
+
+
+        inline void HTML_plot_queue::run()
+          {
+            if(this->jobs.empty()) return;
+
+            // Python detection is lazy, so ensure it has happened before any threads are started
+            this->env.has_python();
+
+            std::vector<char> outcome(this->jobs.size(), 0);
+            std::atomic<std::size_t> next(0);
+
+            auto worker = [&]() -> void
+              {
+                std::size_t i;
+                while((i = next++) < this->jobs.size())
+                  {
+                    outcome[i] = this->process(this->jobs[i]) ? 1 : 0;
+                  }
+              };
+
+            unsigned int pool_size = std::max(std::min(std::thread::hardware_concurrency(), static_cast<unsigned int>(this->jobs.size())), 1U);
+
+            std::vector<std::thread> pool;
+            pool.reserve(pool_size-1);
+            for(unsigned int i = 1; i < pool_size; ++i)
+              {
+                pool.emplace_back(worker);
+              }
+            worker();
+
+            for(std::thread& t : pool)
+              {
+                t.join();
+              }
+
+            for(std::size_t i = 0; i < this->jobs.size(); ++i)
+              {
+                this->jobs[i].target->resolve(outcome[i] != 0);
+              }
+
+            this->jobs.clear();
+
+            this->prune_cache();
+          }
+
+
+        inline bool HTML_plot_queue::process(const plot_job& job)
+          {
+            boost::filesystem::path cached;
+            if(!this->cache.empty())
+              {
+                cached = this->cache / (this->make_key(job) + job.image.extension().string());
+
+                boost::system::error_code ec;
+                if(boost::filesystem::exists(cached, ec))
+                  {
+                    boost::filesystem::remove(job.image, ec);
+                    boost::filesystem::copy_file(cached, job.image, ec);
+                    if(!ec)
+                      {
+                        // refresh the modification time, which prune_cache() uses to judge recent use
+                        boost::filesystem::last_write_time(cached, std::time(nullptr), ec);
+                        boost::filesystem::remove(job.script, ec);
+                        return true;
+                      }
+                  }
+              }
+
+            // the number of interpreters running at once is bounded by the size of the thread pool
+            bool success = this->env.execute_python_concurrent(job.script) == 0;
+
+            boost::system::error_code ec;
+            if(success)
+              {
+                boost::filesystem::remove(job.script, ec);
+
+                // deposit a copy in the cache; this is best-effort, so errors are ignored.
+                // The copy is renamed into place so that a concurrent report never sees a partial file
+                if(!cached.empty())
+                  {
+                    boost::filesystem::path temp = cached;
+                    temp += "-" + boost::filesystem::unique_path().string();
+
+                    boost::filesystem::copy_file(job.image, temp, ec);
+                    if(!ec) boost::filesystem::rename(temp, cached, ec);
+                    if(ec) boost::filesystem::remove(temp, ec);
+                  }
+              }
+            else
+              {
+                if(boost::filesystem::exists(job.image, ec)) boost::filesystem::remove(job.image, ec);
+              }
+
+            return success;
+          }
+
+
+        inline void HTML_plot_queue::prune_cache()
+          {
+            if(this->cache.empty()) return;
+
+            // the cache is an optimization only, so errors are ignored
+            boost::system::error_code ec;
+
+            std::vector< std::pair<std::time_t, boost::filesystem::path> > entries;
+            std::uintmax_t total = 0;
+
+            for(boost::filesystem::directory_iterator t(this->cache, ec); !ec && t != boost::filesystem::directory_iterator(); t.increment(ec))
+              {
+                if(!boost::filesystem::is_regular_file(t->path(), ec)) continue;
+
+                std::uintmax_t size = boost::filesystem::file_size(t->path(), ec);
+                if(ec) continue;
+                std::time_t time = boost::filesystem::last_write_time(t->path(), ec);
+                if(ec) continue;
+
+                total += size;
+                entries.emplace_back(time, t->path());
+              }
+
+            if(total <= CPPTRANSPORT_DEFAULT_HTML_PLOT_CACHE_SIZE) return;
+
+            std::sort(entries.begin(), entries.end(),
+                      [](const std::pair<std::time_t, boost::filesystem::path>& a, const std::pair<std::time_t, boost::filesystem::path>& b) -> bool
+                        { return(a.first < b.first); });
+
+            for(const auto& entry : entries)
+              {
+                if(total <= CPPTRANSPORT_DEFAULT_HTML_PLOT_CACHE_SIZE) break;
+
+                std::uintmax_t size = boost::filesystem::file_size(entry.second, ec);
+                if(ec) continue;
+
+                boost::filesystem::remove(entry.second, ec);
+                if(!ec) total -= size;
+              }
+          }
+
+
+        inline std::string HTML_plot_queue::make_key(const plot_job& job) const
+          {
+            std::ifstream in(job.script.string(), std::ios::in | std::ios::binary);
+            std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+            // the script embeds the absolute location of its output, which changes between reports,
+            // so remove it before hashing
+            const std::string image = job.image.string();
+            for(std::string::size_type pos = content.find(image); pos != std::string::npos; pos = content.find(image, pos))
+              {
+                content.erase(pos, image.length());
+              }
+
+            // 64-bit FNV-1a hash; this must be stable between runs, so std::hash is not suitable
+            std::uint64_t hash = 14695981039346656037ULL;
+            auto mix = [&](const std::string& s) -> void
+              {
+                for(unsigned char c : s)
+                  {
+                    hash ^= c;
+                    hash *= 1099511628211ULL;
+                  }
+                hash ^= 0xff;     // separator between fields
+                hash *= 1099511628211ULL;
+              };
+
+            mix(job.owner);
+            mix(boost::posix_time::to_iso_string(job.last_edit));
+            mix(content);
+
+            std::ostringstream key;
+            key << std::hex << std::setw(16) << std::setfill('0') << hash;
+            return key.str();
+          }
+
+      }   // namespace reporting
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_REPORTING_HTML_PLOT_QUEUE_H
@@ -27,6 +27,9 @@
 #define CPPTRANSPORT_REPORTING_HTML_REPORT_H
 
 
+#include <algorithm>
+#include <vector>
+
 #include "transport-runtime/repository/repository.h"
 #include "transport-runtime/data/data_manager.h"
 #include "transport-runtime/derived-products/derived_product_type.h"
@@ -171,6 +174,9 @@ namespace transport
             void write_integration_analysis(HTML_report_bundle<number>& bundle,
                                             const content_group_record<integration_payload> rec, HTML_node& parent);
 
+            //! write summary of hot-path instrumentation, if any configurations were instrumented
+            void write_hot_path_profile(timing_db& timing_data, HTML_node& parent);
+
             //! produce bar chart showing number of configurations processed per worker
             template <typename number>
             void write_worker_chart(HTML_report_bundle<number>& bundle, const content_group_record<integration_payload> rec,
@@ -576,7 +582,7 @@ namespace transport
           };
 
 
-        void HTML_report::set_root(boost::filesystem::path p)
+        inline void HTML_report::set_root(boost::filesystem::path p)
           {
             // check whether root path is absolute, and if not make it relative to current working directory
             if(!p.is_absolute())
@@ -701,6 +707,10 @@ namespace transport
             body.add_attribute("class", "container-fluid");
             this->generate_report_body(bundle, body);
 
+            // run all Matplotlib scripts queued while generating the body; these execute in parallel,
+            // and resolve the placeholders left in the document
+            bundle.render_plots();
+
             // emplace the report body inside the bundle
             bundle.emplace_HTML_body(body);
           }
@@ -824,7 +834,7 @@ namespace transport
           }
 
 
-        HTML_node HTML_report::make_menu_tab(std::string pane, std::string name)
+        inline HTML_node HTML_report::make_menu_tab(std::string pane, std::string name)
           {
             HTML_node tab("li");
             HTML_node anchor("a", name);
@@ -883,7 +893,7 @@ namespace transport
           }
 
 
-        void HTML_report::make_data_element(std::string l, std::string v, HTML_node& parent)
+        inline void HTML_report::make_data_element(std::string l, std::string v, HTML_node& parent)
           {
             HTML_node label("dt", l);
 
@@ -903,7 +913,7 @@ namespace transport
           }
 
 
-        void HTML_report::make_list_item_label(std::string label, HTML_node& parent)
+        inline void HTML_report::make_list_item_label(std::string label, HTML_node& parent)
           {
             HTML_node panel("div");
             panel.add_attribute("class", "panel panel-primary");
@@ -919,7 +929,7 @@ namespace transport
           }
 
 
-        void HTML_report::make_badged_text(std::string text, unsigned int number, HTML_node& parent)
+        inline void HTML_report::make_badged_text(std::string text, unsigned int number, HTML_node& parent)
           {
             HTML_string text_label(text);
 
@@ -1542,7 +1552,7 @@ namespace transport
           }
 
 
-        void HTML_report::aria_close_button(HTML_node& parent)
+        inline void HTML_report::aria_close_button(HTML_node& parent)
           {
             HTML_node button("button");
             button.add_attribute("class", "close").add_attribute("data-dismiss", "modal");
@@ -2958,7 +2968,7 @@ namespace transport
           }
 
 
-        void HTML_report::write_SQL_block(const std::string& SQL, HTML_node& parent)
+        inline void HTML_report::write_SQL_block(const std::string& SQL, HTML_node& parent)
           {
             HTML_node pre("pre");
 
@@ -2970,7 +2980,7 @@ namespace transport
           }
 
 
-        void HTML_report::write_SQL_panel(std::string title, const std::string& SQL, HTML_node& parent)
+        inline void HTML_report::write_SQL_panel(std::string title, const std::string& SQL, HTML_node& parent)
           {
             HTML_node t("h6", title);
             t.add_attribute("class", "topskip-small");
@@ -3001,7 +3011,7 @@ namespace transport
           }
 
 
-        void HTML_report::derived_line_title(std::string title, HTML_node& parent)
+        inline void HTML_report::derived_line_title(std::string title, HTML_node& parent)
           {
             HTML_node t("h4", title);
             parent.add_element(t);
@@ -3511,13 +3521,14 @@ namespace transport
             HTML_node pert_tol_label("th", "Tolerances");
             pert_tol_label.add_attribute("data-toggle", "tooltip").add_attribute("data-container", "body");
             pert_tol_label.add_attribute("data-placement", "top").add_attribute("title", "atol, rtol");
+            HTML_node kernels_label("th", "Kernels");
             HTML_node configurations_label("th", "Configurations");
             HTML_node os_name_label("th", "Operating system");
             HTML_node CPU_brand_label("th", "CPU");
 
             head_row.add_element(identifier_label).add_element(hostname_label).add_element(backend_label);
             head_row.add_element(backg_step_label).add_element(backg_tol_label);
-            head_row.add_element(pert_step_label).add_element(pert_tol_label);
+            head_row.add_element(pert_step_label).add_element(pert_tol_label).add_element(kernels_label);
 
             // cache timing data if it is available
             // (used later to compute how many configurations were processed by each worker)
@@ -3560,11 +3571,13 @@ namespace transport
                 std::pair<double, double> ptol = info.get_pert_tol();
                 HTML_node pert_tol("td", format_number(ptol.first, this->misc_precision) + ", " + format_number(ptol.second, this->misc_precision));
 
+                HTML_node kernels("td", info.get_kernel_variant());
+
                 HTML_node os_name("td", info.get_os_name());
 
                 table_row.add_element(identifier).add_element(hostname).add_element(backend);
                 table_row.add_element(backg_step).add_element(backg_tol);
-                table_row.add_element(pert_step).add_element(pert_tol);
+                table_row.add_element(pert_step).add_element(pert_tol).add_element(kernels);
 
                 if(has_statistics)
                   {
@@ -3601,7 +3614,7 @@ namespace transport
           }
 
 
-        HTML_report::count_list HTML_report::count_configurations_per_worker(timing_db& data)
+        inline HTML_report::count_list HTML_report::count_configurations_per_worker(timing_db& data)
           {
             count_list list;
 
@@ -3680,6 +3693,9 @@ namespace transport
             chart_row.add_element(col1).add_element(col2);
             panel_body.add_element(chart_row);
 
+            // hot-path instrumentation is present only if the model was built with CPPTRANSPORT_INSTRUMENT
+            this->write_hot_path_profile(timing_data, panel_body);
+
             // ADD CONTENT FOR TASKS OF A SPECIFIC TYPE
 
             // get record for owning task
@@ -3714,6 +3730,102 @@ namespace transport
           }
 
 
+        inline void HTML_report::write_hot_path_profile(timing_db& timing_data, HTML_node& parent)
+          {
+            std::vector<double> setup;
+            std::vector<double> u_tensor;
+            std::vector<double> transport;
+            std::vector<double> rhs_median;
+            std::vector<double> rhs_p99;
+            std::vector<double> step_median;
+            std::vector<double> observer_median;
+            std::vector<double> observer_p99;
+
+            for(const timing_db::value_type& item : timing_data)
+              {
+                const hot_path::profile_summary& pf = item.second->get_profile();
+                if(!pf.available) continue;
+
+                setup.push_back(pf.setup);
+                u_tensor.push_back(pf.u_tensor);
+                transport.push_back(pf.transport);
+                rhs_median.push_back(pf.rhs_median);
+                rhs_p99.push_back(pf.rhs_p99);
+                step_median.push_back(pf.step_median);
+                observer_median.push_back(pf.observer_median);
+                observer_p99.push_back(pf.observer_p99);
+              }
+
+            if(setup.empty()) return;
+
+            // report the median and worst case over all instrumented configurations;
+            // per-configuration values are already medians or means over sampled RHS evaluations
+            auto median = [](std::vector<double> v) -> double
+              {
+                auto mid = v.begin() + v.size()/2;
+                std::nth_element(v.begin(), mid, v.end());
+                return *mid;
+              };
+
+            auto worst = [](const std::vector<double>& v) -> double
+              {
+                return *std::max_element(v.begin(), v.end());
+              };
+
+            auto as_time = [](double t) -> std::string
+              {
+                return format_time(static_cast<boost::timer::nanosecond_type>(t));
+              };
+
+            HTML_node heading("h4", "Hot-path profile");
+            heading.add_attribute("class", "topskip");
+
+            HTML_node table_wrapper("div");
+            table_wrapper.add_attribute("class", "table-responsive");
+
+            HTML_node table("table");
+            table.add_attribute("class", "table table-striped table-condensed");
+
+            HTML_node head("thead");
+            HTML_node head_row("tr");
+
+            HTML_node quantity_label("th", "Quantity");
+            HTML_node median_label("th", "Median configuration");
+            median_label.add_attribute("data-toggle", "tooltip").add_attribute("data-container", "body");
+            median_label.add_attribute("data-placement", "top").add_attribute("title", "Median over " + boost::lexical_cast<std::string>(setup.size()) + " instrumented configurations");
+            HTML_node worst_label("th", "Worst configuration");
+
+            head_row.add_element(quantity_label).add_element(median_label).add_element(worst_label);
+            head.add_element(head_row);
+
+            HTML_node body("tbody");
+
+            auto make_row = [&](std::string label, std::string med, std::string wst) -> void
+              {
+                HTML_node row("tr");
+                HTML_node label_cell("td", label);
+                HTML_node median_cell("td", med);
+                HTML_node worst_cell("td", wst);
+                row.add_element(label_cell).add_element(median_cell).add_element(worst_cell);
+                body.add_element(row);
+              };
+
+            make_row("RHS setup (mean)", as_time(median(setup)), as_time(worst(setup)));
+            make_row("RHS u-tensors (mean)", as_time(median(u_tensor)), as_time(worst(u_tensor)));
+            make_row("RHS transport equations (mean)", as_time(median(transport)), as_time(worst(transport)));
+            make_row("RHS evaluation (median)", as_time(median(rhs_median)), as_time(worst(rhs_median)));
+            make_row("RHS evaluation (99th percentile)", as_time(median(rhs_p99)), as_time(worst(rhs_p99)));
+            make_row("Observer (median)", as_time(median(observer_median)), as_time(worst(observer_median)));
+            make_row("Observer (99th percentile)", as_time(median(observer_p99)), as_time(worst(observer_p99)));
+            make_row("Advance per RHS evaluation (median)", format_number(median(step_median)) + " e-folds",
+                     format_number(*std::min_element(step_median.begin(), step_median.end())) + " e-folds");
+
+            table.add_element(head).add_element(body);
+            table_wrapper.add_element(table);
+            parent.add_element(heading).add_element(table_wrapper);
+          }
+
+
         template <typename number>
         void HTML_report::write_worker_chart(HTML_report_bundle<number>& bundle, const content_group_record<integration_payload> rec,
                                              HTML_node& parent, count_list& counts)
@@ -3785,27 +3897,22 @@ namespace transport
 
             out.close();
 
-            local_environment& env = bundle.get_environment();
-            bool success = env.execute_python(script_path) == 0;
+            // script is executed later, together with all other plots in the report
+            std::shared_ptr<HTML_deferred> placeholder = bundle.enqueue_plot(rec.get_name(), rec.get_last_edit_time(), script_path, image_path);
 
-            if(success)
-              {
-                boost::filesystem::remove(script_path);
-                HTML_node chart("img", false);
-                chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", "report-chart");
-                chart.add_attribute("class", "report-chart");
-                chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", "Worker activity");
-                chart.add_attribute("data-content", "Shows the number of configurations processed by each worker");
-                parent.add_element(chart);
-              }
-            else
-              {
-                if(boost::filesystem::exists(image_path)) boost::filesystem::remove(image_path);
-                HTML_node no_chart("div", "Could not generate configurations-per-worker chart");
-                no_chart.add_attribute("class", "label label-danger");
-                HTML_node br("br", false);
-                parent.add_element(no_chart).add_element(br);
-              }
+            HTML_node chart("img", false);
+            chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", "report-chart");
+            chart.add_attribute("class", "report-chart");
+            chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", "Worker activity");
+            chart.add_attribute("data-content", "Shows the number of configurations processed by each worker");
+            placeholder->add_success(chart);
+
+            HTML_node no_chart("div", "Could not generate configurations-per-worker chart");
+            no_chart.add_attribute("class", "label label-danger");
+            HTML_node br("br", false);
+            placeholder->add_failure(no_chart).add_failure(br);
+
+            parent.add_element(std::static_pointer_cast<HTML_element>(placeholder));
           }
 
 
@@ -3851,26 +3958,21 @@ namespace transport
 
             out.close();
 
-            local_environment& env = bundle.get_environment();
-            bool success = env.execute_python(script_path) == 0;
+            // script is executed later, together with all other plots in the report
+            std::shared_ptr<HTML_deferred> placeholder = bundle.enqueue_plot(rec.get_name(), rec.get_last_edit_time(), script_path, image_path);
 
-            if(success)
-              {
-                boost::filesystem::remove(script_path);
-                HTML_node chart("img", false);
-                chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", "report-chart");
-                chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", "Timing distribution");
-                chart.add_attribute("data-content", "Shows the distribution of integration times in this content group");
-                parent.add_element(chart);
-              }
-            else
-              {
-                if(boost::filesystem::exists(image_path)) boost::filesystem::remove(image_path);
-                HTML_node no_chart("div", "Could not generate timing histogram");
-                no_chart.add_attribute("class", "label label-danger");
-                HTML_node br("br", false);
-                parent.add_element(no_chart).add_element(br);
-              }
+            HTML_node chart("img", false);
+            chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", "report-chart");
+            chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", "Timing distribution");
+            chart.add_attribute("data-content", "Shows the distribution of integration times in this content group");
+            placeholder->add_success(chart);
+
+            HTML_node no_chart("div", "Could not generate timing histogram");
+            no_chart.add_attribute("class", "label label-danger");
+            HTML_node br("br", false);
+            placeholder->add_failure(no_chart).add_failure(br);
+
+            parent.add_element(std::static_pointer_cast<HTML_element>(placeholder));
           }
 
 
@@ -4021,29 +4123,24 @@ namespace transport
 
             out.close();
 
-            local_environment& env = bundle.get_environment();
-            bool success = env.execute_python(script_path) == 0;
+            // script is executed later, together with all other plots in the report
+            std::shared_ptr<HTML_deferred> placeholder = bundle.enqueue_plot(rec.get_name(), rec.get_last_edit_time(), script_path, image_path);
 
-            if(success)
+            HTML_node chart("img", false);
+            chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", css_class);
+            if(!popover_title.empty() && !popover_text.empty())
               {
-                boost::filesystem::remove(script_path);
-                HTML_node chart("img", false);
-                chart.add_attribute("src", relative_image_loc.string()).add_attribute("class", css_class);
-                if(!popover_title.empty() && !popover_text.empty())
-                  {
-                    chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", popover_title);
-                    chart.add_attribute("data-content", popover_text);
-                  }
-                parent.add_element(chart);
-              }
-            else
-              {
-                if(boost::filesystem::exists(image_path)) boost::filesystem::remove(image_path);
-                HTML_node no_chart("div", "Could not generate chart");
-                no_chart.add_attribute("class", "label label-danger");
-                HTML_node br("br", false);
-                parent.add_element(no_chart).add_element(br);
+                chart.add_attribute("data-toggle", "popover").add_attribute("data-placement", "top").add_attribute("title", popover_title);
+                chart.add_attribute("data-content", popover_text);
               }
+            placeholder->add_success(chart);
+
+            HTML_node no_chart("div", "Could not generate chart");
+            no_chart.add_attribute("class", "label label-danger");
+            HTML_node br("br", false);
+            placeholder->add_failure(no_chart).add_failure(br);
+
+            parent.add_element(std::static_pointer_cast<HTML_element>(placeholder));
           }
 
 
@@ -4527,7 +4624,7 @@ namespace transport
           }
 
 
-        std::string HTML_report::compose_tag_list(const std::list<std::string>& tags, HTML_node& parent)
+        inline std::string HTML_report::compose_tag_list(const std::list<std::string>& tags, HTML_node& parent)
           {
             std::ostringstream out;
 
@@ -4876,7 +4973,7 @@ namespace transport
           }
 
 
-        void HTML_report::write_notes_collapsible(const std::list<note>& notes, const std::string& tag, HTML_node& parent)
+        inline void HTML_report::write_notes_collapsible(const std::list<note>& notes, const std::string& tag, HTML_node& parent)
           {
             if(notes.empty()) return;
 
@@ -4951,7 +5048,7 @@ namespace transport
           }
 
 
-        void HTML_report::write_activity_collapsible(const std::list<metadata_history>& activity, const std::string& tag, HTML_node& parent)
+        inline void HTML_report::write_activity_collapsible(const std::list<metadata_history>& activity, const std::string& tag, HTML_node& parent)
           {
             if(activity.empty()) return;
 
@@ -4985,7 +5082,7 @@ namespace transport
           }
 
 
-        std::string HTML_report::make_button_tag()
+        inline std::string HTML_report::make_button_tag()
           {
             std::ostringstream tag;
             tag << CPPTRANSPORT_DEFAULT_HTML_BUTTON_TAG_PREFIX << this->button_id++;
@@ -34,6 +34,7 @@
 
 #include "transport-runtime/reporting/HTML_writer.h"
 #include "transport-runtime/reporting/JavaScript_writer.h"
+#include "transport-runtime/reporting/HTML_plot_queue.h"
 
 #include "transport-runtime/manager/environment.h"
 #include "transport-runtime/manager/argument_cache.h"
@@ -62,6 +63,10 @@ namespace transport
         constexpr auto CPPTRANSPORT_HTML_FONTS_DIR = "fonts";
         constexpr auto CPPTRANSPORT_HTML_ASSET_DIR = "assets";
 
+        //! persistent plot cache lives in the repository rather than the report directory,
+        //! so that it survives between reports
+        constexpr auto CPPTRANSPORT_HTML_PLOT_CACHE_DIR = ".cache/HTML";
+
         template <typename number>
         class HTML_report_bundle
           {
@@ -117,6 +122,20 @@ namespace transport
             void emplace_modal(HTML_element& modal) { this->HTML->add_modal(modal); }
 
 
+            // PLOTS
+
+          public:
+
+            //! queue a Matplotlib script for execution; the returned placeholder should be inserted into the
+            //! document, and is resolved to its success or failure content when render_plots() is called
+            std::shared_ptr<HTML_deferred> enqueue_plot(const std::string& owner, const boost::posix_time::ptime& last_edit,
+                                                        const boost::filesystem::path& script, const boost::filesystem::path& image)
+              { return this->plots.enqueue(owner, last_edit, script, image); }
+
+            //! execute all queued plots
+            void render_plots() { this->plots.run(); }
+
+
             // WRITE JAVASCRIPT CONTENT
 
           public:
@@ -252,6 +271,9 @@ namespace transport
             //! asset finder
             std::unique_ptr<finder> asset_find;
 
+            //! queue of pending plots
+            HTML_plot_queue plots;
+
           };
 
 
@@ -265,7 +287,8 @@ namespace transport
             arg_cache(c),
             cache(rep),
             root(r),
-            asset_find(env.make_resource_finder(CPPTRANSPORT_HTML_RESOURCE_DIRECTORY))
+            asset_find(env.make_resource_finder(CPPTRANSPORT_HTML_RESOURCE_DIRECTORY)),
+            plots(e, rep.get_root_path() / CPPTRANSPORT_HTML_PLOT_CACHE_DIR)
           {
             // create root directory if it does not already exist, taking care to catch any exceptions which occur
             try
@@ -130,7 +130,7 @@ namespace transport
           };
 
 
-        void HTML_string::write(std::ostream& out, const std::string& indent, HTML_mode mode) const
+        inline void HTML_string::write(std::ostream& out, const std::string& indent, HTML_mode mode) const
           {
             if(mode == HTML_mode::debug) out << indent;
             if(this->is_bold) out << "<b>";
@@ -227,7 +227,7 @@ namespace transport
           };
 
 
-        HTML_node& HTML_node::add_attribute(std::string name, std::string value)
+        inline HTML_node& HTML_node::add_attribute(std::string name, std::string value)
           {
             // insertion will have no effect if an existing attribute with the same name exists;
             // in that case, the earliest provided attribute is used
@@ -237,21 +237,21 @@ namespace transport
           }
 
 
-        HTML_node& HTML_node::add_element(const HTML_element& element)
+        inline HTML_node& HTML_node::add_element(const HTML_element& element)
           {
             this->content.emplace_back(element.clone());
             return(*this);
           }
 
 
-        HTML_node& HTML_node::add_element(std::shared_ptr<HTML_element> element)
+        inline HTML_node& HTML_node::add_element(std::shared_ptr<HTML_element> element)
           {
             this->content.push_back(element);
             return(*this);
           }
 
 
-        void HTML_node::write(std::ostream& out, const std::string& indent, HTML_mode mode) const
+        inline void HTML_node::write(std::ostream& out, const std::string& indent, HTML_mode mode) const
           {
             // write opening tag with attributes if present
             if(mode == HTML_mode::debug) out << indent;
@@ -358,7 +358,7 @@ namespace transport
           };
 
 
-        HTML_writer::HTML_writer(boost::filesystem::path p, std::string t)
+        inline HTML_writer::HTML_writer(boost::filesystem::path p, std::string t)
           : output_file(p),
             title(std::move(t))
           {
@@ -373,7 +373,7 @@ namespace transport
           }
 
 
-        HTML_writer::~HTML_writer()
+        inline HTML_writer::~HTML_writer()
           {
             // write header declaring this to be HTML5 content
             this->out << "<!DOCTYPE html>" << '\n';
@@ -393,7 +393,7 @@ namespace transport
           }
 
 
-        void HTML_writer::write_header(const std::string& indent)
+        inline void HTML_writer::write_header(const std::string& indent)
           {
             HTML_node head("head");
 
@@ -408,7 +408,7 @@ namespace transport
           }
 
 
-        void HTML_writer::write_body(const std::string& indent)
+        inline void HTML_writer::write_body(const std::string& indent)
           {
             HTML_node body("body");
             body.add_attribute("role", "document");
@@ -454,25 +454,25 @@ namespace transport
           }
 
 
-        void HTML_writer::add_body(HTML_element& root)
+        inline void HTML_writer::add_body(HTML_element& root)
           {
             this->body_element.reset(root.clone());
           }
 
 
-        void HTML_writer::add_stylesheet(boost::filesystem::path p)
+        inline void HTML_writer::add_stylesheet(boost::filesystem::path p)
           {
             this->stylesheets.emplace_back(std::move(p));
           }
 
 
-        void HTML_writer::add_JavaScript(boost::filesystem::path p)
+        inline void HTML_writer::add_JavaScript(boost::filesystem::path p)
           {
             this->scripts.emplace_back(std::move(p));
           }
 
 
-        void HTML_writer::add_modal(HTML_element& modal)
+        inline void HTML_writer::add_modal(HTML_element& modal)
           {
             this->modals.emplace_back(modal.clone());
           }
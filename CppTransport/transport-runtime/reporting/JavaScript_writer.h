@@ -79,7 +79,7 @@ namespace transport
           };
 
 
-        JavaScript_writer::JavaScript_writer(boost::filesystem::path p)
+        inline JavaScript_writer::JavaScript_writer(boost::filesystem::path p)
           : output_file(p)
           {
             out.open(output_file.string(), std::ios::out | std::ios::trunc);
@@ -93,13 +93,13 @@ namespace transport
           }
 
 
-        JavaScript_writer::~JavaScript_writer()
+        inline JavaScript_writer::~JavaScript_writer()
           {
             this->out.close();
           }
 
 
-        void JavaScript_writer::write(std::string line)
+        inline void JavaScript_writer::write(std::string line)
           {
             this->out << line << '\n';
           }
@@ -1250,7 +1250,7 @@ namespace transport
           }
 
 
-        void command_line::report_record_generic(const repository_record& rec)
+        inline void command_line::report_record_generic(const repository_record& rec)
           {
             key_value kv(this->env, this->arg_cache);
 
@@ -1309,7 +1309,7 @@ namespace transport
           }
 
 
-        std::string command_line::compose_tag_list(const std::list<std::string>& tag_list)
+        inline std::string command_line::compose_tag_list(const std::list<std::string>& tag_list)
           {
             // compose tags into a single string
             std::ostringstream composed_list;
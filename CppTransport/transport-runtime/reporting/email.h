@@ -126,42 +126,42 @@ namespace transport
           };
     
     
-        email::email(local_environment& e, argument_cache& a)
+        inline email::email(local_environment& e, argument_cache& a)
           : local_env(e),
             arg_cache(a)
           {
           }
     
     
-        email& email::add_to(std::string to)
+        inline email& email::add_to(std::string to)
           {
             this->to.emplace_back(std::move(to));
             return *this;
           }
     
     
-        email& email::set_to(std::list<std::string> to)
+        inline email& email::set_to(std::list<std::string> to)
           {
             this->to = std::move(to);
             return *this;
           }
     
     
-        email& email::set_subject(std::string subject)
+        inline email& email::set_subject(std::string subject)
           {
             this->subject = std::move(subject);
             return *this;
           }
     
     
-        email& email::set_body(std::string body)
+        inline email& email::set_body(std::string body)
           {
             this->body = std::move(body);
             return *this;
           }
     
     
-        bool email::send() const
+        inline bool email::send() const
           {
             if(!this->local_env.has_sendmail()) return false;
 
@@ -183,7 +183,7 @@ namespace transport
           }
     
     
-        std::string email::compose_body() const
+        inline std::string email::compose_body() const
           {
             std::ostringstream body_text;
             
@@ -206,7 +206,7 @@ namespace transport
           }
     
     
-        std::string email::build_recipient_list() const
+        inline std::string email::build_recipient_list() const
           {
             std::ostringstream to_text;
             unsigned int count = 0;
@@ -221,7 +221,7 @@ namespace transport
           }
         
         
-        std::string email::compose_to() const
+        inline std::string email::compose_to() const
           {
             std::ostringstream to_text;
             unsigned int count = 0;
@@ -236,7 +236,7 @@ namespace transport
           }
     
     
-        std::string email::compose_subject() const
+        inline std::string email::compose_subject() const
           {
             std::ostringstream subject_text;
             subject_text << "[" << CPPTRANSPORT_NAME << "] " << this->subject;
@@ -141,7 +141,7 @@ namespace transport
           };
 
 
-        void key_value::write(std::ostream& out, print_options opts)
+        inline void key_value::write(std::ostream& out, print_options opts)
           {
             unsigned int columns_per_batch = 1;
             unsigned int column_width = 0;
@@ -210,7 +210,7 @@ namespace transport
           }
 
 
-        std::pair<unsigned int, unsigned int> key_value::compute_columns(print_options opts)
+        inline std::pair<unsigned int, unsigned int> key_value::compute_columns(print_options opts)
           {
             size_t width =
               (opts == print_options::fixed_width ? this->fix_width
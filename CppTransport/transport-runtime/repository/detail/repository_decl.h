@@ -253,6 +253,19 @@ namespace transport
         virtual std::unique_ptr< content_group_record<output_payload> > query_output_content(const std::string& name, transaction_manager& mgr) = 0;
 
 
+        // SNAPSHOTS
+
+      public:
+
+        //! Build a self-contained snapshot of an integration task, its package record and its
+        //! k-configuration database, suitable for broadcast to worker processes
+        virtual task_snapshot snapshot_integration_task(const std::string& name) = 0;
+
+        //! Install a snapshot in the read-only record caches, so that subsequent queries for the task
+        //! and its package are served without reference to the physical database
+        virtual void install_snapshot(const task_snapshot& snapshot) = 0;
+
+
         // ENUMERATE DATABASE RECORDS
 
       public:
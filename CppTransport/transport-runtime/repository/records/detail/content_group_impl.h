@@ -299,7 +299,7 @@ namespace transport
       }
 
 
-    precomputed_products::precomputed_products(Json::Value& reader)
+    inline precomputed_products::precomputed_products(Json::Value& reader)
       {
         zeta_twopf   = reader[CPPTRANSPORT_NODE_PRECOMPUTED_ROOT][CPPTRANSPORT_NODE_PRECOMPUTED_ZETA_TWOPF].asBool();
         zeta_threepf = reader[CPPTRANSPORT_NODE_PRECOMPUTED_ROOT][CPPTRANSPORT_NODE_PRECOMPUTED_ZETA_THREEPF].asBool();
@@ -311,7 +311,7 @@ namespace transport
       }
 
 
-    void precomputed_products::serialize(Json::Value& writer) const
+    inline void precomputed_products::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_PRECOMPUTED_ROOT][CPPTRANSPORT_NODE_PRECOMPUTED_ZETA_TWOPF]   = this->zeta_twopf;
         writer[CPPTRANSPORT_NODE_PRECOMPUTED_ROOT][CPPTRANSPORT_NODE_PRECOMPUTED_ZETA_THREEPF] = this->zeta_threepf;
@@ -336,7 +336,7 @@ namespace transport
       }
 
 
-    integration_payload::integration_payload(Json::Value& reader)
+    inline integration_payload::integration_payload(Json::Value& reader)
       : metadata(reader)
       {
         container          = reader[CPPTRANSPORT_NODE_PAYLOAD_INTEGRATION_DATABASE].asString();
@@ -359,7 +359,7 @@ namespace transport
       }
 
 
-    void integration_payload::serialize(Json::Value& writer) const
+    inline void integration_payload::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_PAYLOAD_INTEGRATION_DATABASE]   = this->container.string();
         writer[CPPTRANSPORT_NODE_PAYLOAD_INTEGRATION_FAILED]     = this->fail;
@@ -390,7 +390,7 @@ namespace transport
       }
 
 
-    postintegration_payload::postintegration_payload(Json::Value& reader)
+    inline postintegration_payload::postintegration_payload(Json::Value& reader)
       : metadata(reader),
         precomputed(reader)
       {
@@ -412,7 +412,7 @@ namespace transport
       }
 
 
-    void postintegration_payload::serialize(Json::Value& writer) const
+    inline void postintegration_payload::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_PAYLOAD_POSTINTEGRATION_DATABASE]     = this->container.string();
         writer[CPPTRANSPORT_NODE_PAYLOAD_POSTINTEGRATION_FAILED]       = this->fail;
@@ -444,7 +444,7 @@ namespace transport
       }
 
 
-    output_payload::output_payload(Json::Value& reader)
+    inline output_payload::output_payload(Json::Value& reader)
       : metadata(reader)
       {
         fail = reader[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_FAILED].asBool();
@@ -467,7 +467,7 @@ namespace transport
       }
 
 
-    void output_payload::serialize(Json::Value& writer) const
+    inline void output_payload::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_FAILED] = this->fail;
 
@@ -505,7 +505,7 @@ namespace transport
       }
 
 
-    derived_content::derived_content(Json::Value& reader)
+    inline derived_content::derived_content(Json::Value& reader)
       {
         parent_product = reader[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_PRODUCT_NAME].asString();
         filename = reader[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_FILENAME].asString();
@@ -539,7 +539,7 @@ namespace transport
       }
 
 
-    void derived_content::serialize(Json::Value& writer) const
+    inline void derived_content::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_PRODUCT_NAME] = this->parent_product;
         writer[CPPTRANSPORT_NODE_PAYLOAD_CONTENT_FILENAME]     = this->filename.string();
@@ -67,7 +67,7 @@ namespace transport
     // OUTPUT METADATA
 
 
-    output_metadata::output_metadata(Json::Value& reader)
+    inline output_metadata::output_metadata(Json::Value& reader)
       {
         work_time                 = reader[CPPTRANSPORT_NODE_OUTPUTDATA_GROUP][CPPTRANSPORT_NODE_OUTPUTDATA_TOTAL_WALLCLOCK_TIME].asLargestInt();
         db_time                   = reader[CPPTRANSPORT_NODE_OUTPUTDATA_GROUP][CPPTRANSPORT_NODE_OUTPUTDATA_TOTAL_DB_TIME].asLargestInt();
@@ -90,7 +90,7 @@ namespace transport
       }
 
 
-    void output_metadata::serialize(Json::Value& writer) const
+    inline void output_metadata::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_OUTPUTDATA_GROUP][CPPTRANSPORT_NODE_OUTPUTDATA_TOTAL_WALLCLOCK_TIME]    = static_cast<Json::LargestInt>(this->work_time);
         writer[CPPTRANSPORT_NODE_OUTPUTDATA_GROUP][CPPTRANSPORT_NODE_OUTPUTDATA_TOTAL_DB_TIME]           = static_cast<Json::LargestInt>(this->db_time);
@@ -116,7 +116,7 @@ namespace transport
     // INTEGRATION METADATA
 
 
-    integration_metadata::integration_metadata(Json::Value& reader)
+    inline integration_metadata::integration_metadata(Json::Value& reader)
       {
         total_wallclock_time        = reader[CPPTRANSPORT_NODE_TIMINGDATA_GROUP][CPPTRANSPORT_NODE_TIMINGDATA_TOTAL_WALLCLOCK_TIME].asLargestInt();
         total_aggregation_time      = reader[CPPTRANSPORT_NODE_TIMINGDATA_GROUP][CPPTRANSPORT_NODE_TIMINGDATA_TOTAL_AGG_TIME].asLargestInt();
@@ -132,7 +132,7 @@ namespace transport
       }
 
 
-    void integration_metadata::serialize(Json::Value& writer) const
+    inline void integration_metadata::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_TIMINGDATA_GROUP][CPPTRANSPORT_NODE_TIMINGDATA_TOTAL_WALLCLOCK_TIME]  = static_cast<Json::LargestInt>(this->total_wallclock_time);
         writer[CPPTRANSPORT_NODE_TIMINGDATA_GROUP][CPPTRANSPORT_NODE_TIMINGDATA_TOTAL_AGG_TIME]        = static_cast<Json::LargestInt>(this->total_aggregation_time);
@@ -55,7 +55,7 @@ namespace transport
     // METADATA HISTORY METHODS
 
 
-    metadata_history::metadata_history(std::string u, history_actions a, std::string i)
+    inline metadata_history::metadata_history(std::string u, history_actions a, std::string i)
       : user_id(std::move(u)),
         action(a),
         info(std::move(i)),
@@ -64,7 +64,7 @@ namespace transport
       }
 
 
-    metadata_history::metadata_history(Json::Value& reader)
+    inline metadata_history::metadata_history(Json::Value& reader)
       {
         this->user_id = reader[CPPTRANSPORT_NODE_HISTORY_USERID].asString();
         this->info = reader[CPPTRANSPORT_NODE_HISTORY_INFO].asString();
@@ -92,7 +92,7 @@ namespace transport
       }
 
 
-    void metadata_history::serialize(Json::Value& writer) const
+    inline void metadata_history::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_HISTORY_USERID] = this->user_id;
         writer[CPPTRANSPORT_NODE_HISTORY_INFO] = this->info;
@@ -157,7 +157,7 @@ namespace transport
       }
 
 
-    std::string metadata_history::to_string() const
+    inline std::string metadata_history::to_string() const
       {
         std::string time = boost::posix_time::to_simple_string(this->timestamp);
         std::ostringstream msg;
@@ -226,7 +226,7 @@ namespace transport
     // REPOSITORY METADATA METHODS
 
 
-    record_metadata::record_metadata(std::string u)
+    inline record_metadata::record_metadata(std::string u)
       : creation_time(boost::posix_time::second_clock::universal_time()),
         last_edit_time(boost::posix_time::second_clock::universal_time()),    // don't initialize from creation_time; order of initialization depends on order of *declaration* in class, and that might change
         runtime_api(CPPTRANSPORT_RUNTIME_API_VERSION)
@@ -235,7 +235,7 @@ namespace transport
       }
 
 
-    record_metadata::record_metadata(Json::Value& reader)
+    inline record_metadata::record_metadata(Json::Value& reader)
       {
         std::string ctime_str = reader[CPPTRANSPORT_NODE_METADATA_GROUP][CPPTRANSPORT_NODE_METADATA_CREATED].asString();
         this->creation_time = boost::posix_time::from_iso_string(ctime_str);
@@ -255,7 +255,7 @@ namespace transport
       }
 
 
-    void record_metadata::serialize(Json::Value& writer) const
+    inline void record_metadata::serialize(Json::Value& writer) const
       {
         Json::Value metadata(Json::objectValue);
 
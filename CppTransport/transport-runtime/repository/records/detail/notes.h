@@ -98,7 +98,7 @@ namespace transport
       };
 
 
-    note::note(std::string u, std::string n)
+    inline note::note(std::string u, std::string n)
       : uid(std::move(u)),
         text(std::move(n)),
         timestamp(boost::posix_time::second_clock::universal_time())
@@ -106,7 +106,7 @@ namespace transport
       }
 
 
-    note::note(Json::Value& reader)
+    inline note::note(Json::Value& reader)
       : uid(reader[CPPTRANSPORT_NODE_NOTE_UID].asString()),
         text(reader[CPPTRANSPORT_NODE_NOTE_NOTE].asString())
       {
@@ -115,7 +115,7 @@ namespace transport
       }
 
 
-    void note::serialize(Json::Value& writer) const
+    inline void note::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_NOTE_UID] = this->uid;
         writer[CPPTRANSPORT_NODE_NOTE_NOTE] = this->text;
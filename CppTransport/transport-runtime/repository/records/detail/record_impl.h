@@ -49,7 +49,7 @@ namespace transport
     // GENERIC REPOSITORY RECORD
 
 
-    repository_record::repository_record(repository_record::handler_package pkg)
+    inline repository_record::repository_record(repository_record::handler_package pkg)
       : metadata(pkg.env.get_userid()),
         handlers(std::move(pkg))
       {
@@ -57,7 +57,7 @@ namespace transport
       }
 
 
-    repository_record::repository_record(const std::string& nm, repository_record::handler_package pkg)
+    inline repository_record::repository_record(const std::string& nm, repository_record::handler_package pkg)
       : name(nm),
         metadata(pkg.env.get_userid()),
         handlers(std::move(pkg))
@@ -65,7 +65,7 @@ namespace transport
       }
 
 
-    repository_record::repository_record(Json::Value& reader, repository_record::handler_package pkg)
+    inline repository_record::repository_record(Json::Value& reader, repository_record::handler_package pkg)
       : metadata(reader),
         handlers(std::move(pkg))
       {
@@ -73,14 +73,14 @@ namespace transport
       }
 
 
-    void repository_record::serialize(Json::Value& writer) const
+    inline void repository_record::serialize(Json::Value& writer) const
       {
         writer[CPPTRANSPORT_NODE_RECORD_NAME] = this->name;
         this->metadata.serialize(writer);
       }
 
 
-    void repository_record::commit()
+    inline void repository_record::commit()
       {
         if(this->handlers.mgr)
           {
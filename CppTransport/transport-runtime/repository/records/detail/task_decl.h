@@ -120,6 +120,11 @@ namespace transport
         integration_task_record(Json::Value& reader, const boost::filesystem::path& repo_root, bool network_mode,
                                 package_finder<number>& f, repository_record::handler_package& pkg);
 
+        //! deserialization constructor using an already-open k-configuration database,
+        //! eg. one attached from a task snapshot
+        integration_task_record(Json::Value& reader, sqlite3* kconfig_handle,
+                                package_finder<number>& f, repository_record::handler_package& pkg);
+
         //! destructor is default
         virtual ~integration_task_record() = default;
 
@@ -152,6 +157,17 @@ namespace transport
         void write_kconfig_database(const boost::filesystem::path& db_path, bool network_mode) const;
 
 
+        // DESERIALIZATION HELPERS
+
+      protected:
+
+        //! deserialize task type and database location
+        void deserialize_task_type(Json::Value& reader);
+
+        //! deserialize task from an open k-configuration database
+        void deserialize_task(Json::Value& reader, sqlite3* handle, package_finder<number>& f);
+
+
         // ADMINISTRATION
 
       public:
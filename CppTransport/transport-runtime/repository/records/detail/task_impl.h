@@ -145,20 +145,7 @@ namespace transport
                                                              package_finder<number>& f, repository_record::handler_package& pkg)
       : task_record<number>(reader, pkg)
       {
-        // deserialize location of database
-        kconfig_db = reader[CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_KCONFIG_DATABASE].asString();
-
-        // deserialize task type
-        std::string task_type = reader[CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_TYPE].asString();
-
-        if(task_type == CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_TWOPF)        type = integration_task_type::twopf;
-        else if(task_type == CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_THREEPF) type = integration_task_type::threepf;
-        else
-          {
-            std::ostringstream msg;
-            msg << CPPTRANSPORT_REPO_FAIL_INTEGRATION_TASK_TYPE << " '" << task_type << "'";
-            throw runtime_exception(exception_type::SERIALIZATION_ERROR, msg.str());
-          }
+        this->deserialize_task_type(reader);
 
         // ingest k-configuration database: first find absolute path to container
         boost::filesystem::path abs_database = repo_root / kconfig_db;
@@ -176,10 +163,49 @@ namespace transport
         sqlite3_operations::consistency_pragmas(handle);
 
         // ingest task data
-        tk = integration_task_helper::deserialize<number>(this->name, reader, handle, f);
+        this->deserialize_task(reader, handle, f);
 
         // close handle
         sqlite3_close(handle);
+      }
+
+
+    template <typename number>
+    integration_task_record<number>::integration_task_record(Json::Value& reader, sqlite3* kconfig_handle,
+                                                             package_finder<number>& f, repository_record::handler_package& pkg)
+      : task_record<number>(reader, pkg)
+      {
+        assert(kconfig_handle != nullptr);
+
+        this->deserialize_task_type(reader);
+        this->deserialize_task(reader, kconfig_handle, f);
+      }
+
+
+    template <typename number>
+    void integration_task_record<number>::deserialize_task_type(Json::Value& reader)
+      {
+        // deserialize location of database
+        kconfig_db = reader[CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_KCONFIG_DATABASE].asString();
+
+        // deserialize task type
+        std::string task_type = reader[CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_TYPE].asString();
+
+        if(task_type == CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_TWOPF)        type = integration_task_type::twopf;
+        else if(task_type == CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_THREEPF) type = integration_task_type::threepf;
+        else
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_REPO_FAIL_INTEGRATION_TASK_TYPE << " '" << task_type << "'";
+            throw runtime_exception(exception_type::SERIALIZATION_ERROR, msg.str());
+          }
+      }
+
+
+    template <typename number>
+    void integration_task_record<number>::deserialize_task(Json::Value& reader, sqlite3* handle, package_finder<number>& f)
+      {
+        tk = integration_task_helper::deserialize<number>(this->name, reader, handle, f);
 
         assert(tk != nullptr);
         if(tk == nullptr) throw runtime_exception(exception_type::SERIALIZATION_ERROR, CPPTRANSPORT_REPO_TASK_DESERIALIZE_FAIL);
@@ -234,6 +260,18 @@ namespace transport
         // should be quick, since the kconfig database isn't expected to be very large
         sqlite3_operations::exec(handle, "VACUUM;");
         sqlite3_close(handle);
+
+        // write a binary image alongside the database; this can be memory-mapped when the task is next read,
+        // avoiding the cost of stepping through every row of a large database
+        configuration_database::kconfig_image_builder image;
+        this->tk->write_kconfig_database(image);
+
+        // if the database cannot be stamped then no image is written, and readers fall back to SQLite
+        configuration_database::kconfig_database_stamp stamp;
+        if(configuration_database::stamp_kconfig_database(db_path, stamp))
+          {
+            image.write(db_path.string() + configuration_database::CPPTRANSPORT_KCONFIG_IMAGE_EXTENSION, stamp);
+          }
       }
 
 
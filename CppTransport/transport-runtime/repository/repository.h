@@ -84,6 +84,7 @@
 
 // DECLARE INFLIGHT CONTENT RECORDS
 #include "transport-runtime/repository/inflight.h"
+#include "transport-runtime/repository/task_snapshot.h"
 
 // DECLARE WRITER HANDLERS
 #include "transport-runtime/repository/detail/writer_repo_decl.h"
@@ -190,7 +190,7 @@ namespace transport
       };
 
 
-    void repository_vertex_map::write(std::ostream& out)
+    inline void repository_vertex_map::write(std::ostream& out)
       {
         if(name_map)
           {
@@ -205,7 +205,7 @@ namespace transport
       }
 
 
-    void repository_vertex_map::insert(const std::string& name, graph_type& graph, repository_vertex_type type)
+    inline void repository_vertex_map::insert(const std::string& name, graph_type& graph, repository_vertex_type type)
       {
         // search for a vertex with this name
         name_to_vertex_map::const_iterator t = this->name_map->find(name);
@@ -224,7 +224,7 @@ namespace transport
       }
 
 
-    const graph_type::vertex_descriptor& repository_vertex_map::operator[](const std::string& vertex_name) const
+    inline const graph_type::vertex_descriptor& repository_vertex_map::operator[](const std::string& vertex_name) const
       {
         name_to_vertex_map::const_iterator t = this->name_map->find(vertex_name);
         if(t == this->name_map->end())
@@ -239,7 +239,7 @@ namespace transport
       }
 
 
-    const std::string& repository_vertex_map::operator[](const graph_type::vertex_descriptor& vertex) const
+    inline const std::string& repository_vertex_map::operator[](const graph_type::vertex_descriptor& vertex) const
       {
         vertex_to_name_map::const_iterator t = this->vertex_map->find(vertex);
         if(t == this->vertex_map->end())
@@ -254,7 +254,7 @@ namespace transport
       }
 
 
-    unsigned int repository_vertex_map::get_index(const graph_type::vertex_descriptor& vertex) const
+    inline unsigned int repository_vertex_map::get_index(const graph_type::vertex_descriptor& vertex) const
       {
         vertex_to_name_map::const_iterator t = this->vertex_map->find(vertex);
         if(t == this->vertex_map->end())
@@ -269,7 +269,7 @@ namespace transport
       }
 
 
-    repository_vertex_type repository_vertex_map::get_type(const graph_type::vertex_descriptor& vertex) const
+    inline repository_vertex_type repository_vertex_map::get_type(const graph_type::vertex_descriptor& vertex) const
       {
         vertex_to_name_map::const_iterator t = this->vertex_map->find(vertex);
         if(t == this->vertex_map->end())
@@ -413,7 +413,7 @@ namespace transport
     using namespace repository_dependency_graph_impl;
 
 
-    void repository_dependency_graph::write_graphviz(boost::filesystem::path& file) const
+    inline void repository_dependency_graph::write_graphviz(boost::filesystem::path& file) const
       {
         std::ofstream out(file.string(), std::ios::out | std::ios::trunc);
 
@@ -426,7 +426,7 @@ namespace transport
       }
 
 
-    std::unique_ptr< std::list<std::string> > repository_dependency_graph::compute_topological_order() const
+    inline std::unique_ptr< std::list<std::string> > repository_dependency_graph::compute_topological_order() const
       {
         std::unique_ptr< std::list<std::string> > objects = std::make_unique< std::list<std::string> >();
 
@@ -635,19 +635,19 @@ namespace transport
       };
 
 
-    repository_distance_matrix::matrix_type::value_type repository_distance_matrix::operator[](const graph_type::vertex_descriptor& vertex)
+    inline repository_distance_matrix::matrix_type::value_type repository_distance_matrix::operator[](const graph_type::vertex_descriptor& vertex)
       {
         return this->D[vertex];
       }
 
 
-    const repository_distance_matrix::matrix_type::value_type repository_distance_matrix::operator[](const graph_type::vertex_descriptor& vertex) const
+    inline const repository_distance_matrix::matrix_type::value_type repository_distance_matrix::operator[](const graph_type::vertex_descriptor& vertex) const
       {
         return this->D[vertex];
       }
 
 
-    std::unique_ptr< std::set<std::string> > repository_distance_matrix::find_dependent_objects(const std::string& name) const
+    inline std::unique_ptr< std::set<std::string> > repository_distance_matrix::find_dependent_objects(const std::string& name) const
       {
         std::unique_ptr< std::set<std::string> > objects = std::make_unique< std::set<std::string> >();
 
@@ -676,7 +676,7 @@ namespace transport
       }
 
 
-    std::unique_ptr< std::set<std::string> > repository_distance_matrix::find_dependencies(const std::string& name) const
+    inline std::unique_ptr< std::set<std::string> > repository_distance_matrix::find_dependencies(const std::string& name) const
       {
         std::unique_ptr< std::set<std::string> > objects = std::make_unique< std::set<std::string> >();
 
@@ -81,7 +81,7 @@ namespace transport
           };
         
         
-        void NotifyGadget::operator()()
+        inline void NotifyGadget::operator()()
           {
             if(!notify)
               {
@@ -0,0 +1,129 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_TASK_SNAPSHOT_H
+#define CPPTRANSPORT_TASK_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "boost/serialization/access.hpp"
+#include "boost/serialization/string.hpp"
+#include "boost/serialization/vector.hpp"
+
+namespace transport
+  {
+
+    //! task_snapshot is a self-contained copy of everything needed to reconstruct an integration task record:
+    //! the serialized task and package records, and the raw bytes of the task's k-configuration database.
+    //! It is built once by the master process and broadcast to workers, which install it in their
+    //! repository caches rather than each deserializing the same records from a shared filesystem
+    class task_snapshot
+      {
+
+        // CONSTRUCTOR, DESTRUCTOR
+
+      public:
+
+        //! default constructor (used for receiving snapshots)
+        task_snapshot() = default;
+
+        //! value constructor
+        task_snapshot(std::string tn, std::string td, std::string pn, std::string pd, std::vector<char> kdb)
+          : task_name(std::move(tn)),
+            task_document(std::move(td)),
+            package_name(std::move(pn)),
+            package_document(std::move(pd)),
+            kconfig_database(std::move(kdb))
+          {
+          }
+
+        //! destructor is default
+        ~task_snapshot() = default;
+
+
+        // INTERFACE
+
+      public:
+
+        //! get task name
+        const std::string& get_task_name() const { return this->task_name; }
+
+        //! get serialized task record
+        const std::string& get_task_document() const { return this->task_document; }
+
+        //! get package name
+        const std::string& get_package_name() const { return this->package_name; }
+
+        //! get serialized package record
+        const std::string& get_package_document() const { return this->package_document; }
+
+        //! get k-configuration database image
+        const std::vector<char>& get_kconfig_database() const { return this->kconfig_database; }
+
+        //! is this snapshot populated?
+        bool empty() const { return this->task_name.empty(); }
+
+
+        // INTERNAL DATA
+
+      private:
+
+        //! name of task
+        std::string task_name;
+
+        //! JSON document for task record
+        std::string task_document;
+
+        //! name of package used by the task
+        std::string package_name;
+
+        //! JSON document for package record
+        std::string package_document;
+
+        //! image of the SQLite k-configuration database
+        std::vector<char> kconfig_database;
+
+        // enable boost::serialization support, and hence automated packing for transmission over MPI
+        friend class boost::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int version)
+          {
+            ar & task_name;
+            ar & task_document;
+            ar & package_name;
+            ar & package_document;
+            ar & kconfig_database;
+          }
+
+      };
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_TASK_SNAPSHOT_H
@@ -113,7 +113,7 @@ namespace transport
 
 
         constexpr boost::timer::nanosecond_type second = 1E9;
-        std::string format(const boost::optional<aggregation_table_data>& v, boost::timer::nanosecond_type normalization=second)
+        inline std::string format(const boost::optional<aggregation_table_data>& v, boost::timer::nanosecond_type normalization=second)
           {
             if(v)
               {
@@ -126,7 +126,7 @@ namespace transport
           }
 
 
-        std::string format(const boost::optional<boost::timer::nanosecond_type>& v, boost::timer::nanosecond_type normalization=second)
+        inline std::string format(const boost::optional<boost::timer::nanosecond_type>& v, boost::timer::nanosecond_type normalization=second)
           {
             if(v)
               {
@@ -140,7 +140,7 @@ namespace transport
 
 
         constexpr boost::uintmax_t megabyte = 1024*1024;
-        std::string format(const boost::optional<boost::uintmax_t>& v, boost::uintmax_t normalization=megabyte)
+        inline std::string format(const boost::optional<boost::uintmax_t>& v, boost::uintmax_t normalization=megabyte)
           {
             if(v)
               {
@@ -153,7 +153,7 @@ namespace transport
           }
 
 
-        std::string format(size_t rows, const boost::optional<boost::timer::nanosecond_type>& time, boost::timer::nanosecond_type normalization=second)
+        inline std::string format(size_t rows, const boost::optional<boost::timer::nanosecond_type>& time, boost::timer::nanosecond_type normalization=second)
           {
             if(time)
               {
@@ -232,7 +232,7 @@ namespace transport
       };
 
 
-    aggregation_profile_record::aggregation_profile_record(const boost::filesystem::path& c, const boost::filesystem::path& t)
+    inline aggregation_profile_record::aggregation_profile_record(const boost::filesystem::path& c, const boost::filesystem::path& t)
       : timestamp(boost::posix_time::second_clock::local_time()),   // timestamp using local time for compatibility with report_manager
         container_path(c),
         temporary_path(t)
@@ -248,14 +248,14 @@ namespace transport
       }
 
 
-    void aggregation_profile_record::stop()
+    inline void aggregation_profile_record::stop()
       {
         this->timer.stop();
         this->total_time = this->timer.elapsed().wall;
       }
 
 
-    void aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void aggregation_profile_record::write_row(std::ofstream& out) const
       {
         out << aggregation_profiler_impl::format(this->container_size)            // will be formatted in Mb
             << "," << aggregation_profiler_impl::format(this->temporary_size)     // will be formatted in Mb
@@ -291,7 +291,7 @@ namespace transport
       };
 
 
-    void twopf_aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void twopf_aggregation_profile_record::write_row(std::ofstream& out) const
       {
         this->aggregation_profile_record::write_row(out);
         out << "," << aggregation_profiler_impl::format(this->backg)
@@ -304,7 +304,7 @@ namespace transport
       }
 
 
-    size_t twopf_aggregation_profile_record::get_rows() const
+    inline size_t twopf_aggregation_profile_record::get_rows() const
       {
         size_t rows = 0;
         if(this->backg) rows += this->backg->rows;
@@ -345,7 +345,7 @@ namespace transport
       };
 
 
-    void threepf_aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void threepf_aggregation_profile_record::write_row(std::ofstream& out) const
       {
         this->aggregation_profile_record::write_row(out);
         out << "," << aggregation_profiler_impl::format(this->backg)
@@ -362,7 +362,7 @@ namespace transport
       }
 
 
-    size_t threepf_aggregation_profile_record::get_rows() const
+    inline size_t threepf_aggregation_profile_record::get_rows() const
       {
         size_t rows = 0;
         if(this->backg) rows += this->backg->rows;
@@ -399,7 +399,7 @@ namespace transport
       };
 
 
-    void zeta_twopf_aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void zeta_twopf_aggregation_profile_record::write_row(std::ofstream& out) const
       {
         this->aggregation_profile_record::write_row(out);
         out << "," << aggregation_profiler_impl::format(this->twopf)
@@ -408,7 +408,7 @@ namespace transport
       }
 
 
-    size_t zeta_twopf_aggregation_profile_record::get_rows() const
+    inline size_t zeta_twopf_aggregation_profile_record::get_rows() const
       {
         size_t rows = 0;
         if(this->twopf) rows += this->twopf->rows;
@@ -441,7 +441,7 @@ namespace transport
       };
 
 
-    void zeta_threepf_aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void zeta_threepf_aggregation_profile_record::write_row(std::ofstream& out) const
       {
         this->aggregation_profile_record::write_row(out);
         out << "," << aggregation_profiler_impl::format(this->twopf)
@@ -454,7 +454,7 @@ namespace transport
       }
 
 
-    size_t zeta_threepf_aggregation_profile_record::get_rows() const
+    inline size_t zeta_threepf_aggregation_profile_record::get_rows() const
       {
         size_t rows = 0;
         if(this->twopf) rows += this->twopf->rows;
@@ -486,7 +486,7 @@ namespace transport
       };
 
 
-    void fNL_aggregation_profile_record::write_row(std::ofstream& out) const
+    inline void fNL_aggregation_profile_record::write_row(std::ofstream& out) const
       {
         this->aggregation_profile_record::write_row(out);
         out << "," << aggregation_profiler_impl::format(this->fNL)
@@ -494,7 +494,7 @@ namespace transport
       }
 
 
-    size_t fNL_aggregation_profile_record::get_rows() const
+    inline size_t fNL_aggregation_profile_record::get_rows() const
       {
         size_t rows = 0;
         if(this->fNL) rows += this->fNL->rows;
@@ -600,14 +600,14 @@ namespace transport
       };
 
 
-    aggregation_profiler& aggregation_profiler::add_record(std::unique_ptr< aggregation_profile_record > r)
+    inline aggregation_profiler& aggregation_profiler::add_record(std::unique_ptr< aggregation_profile_record > r)
       {
         this->events.push_back(std::move(r));
         return *this;
       }
 
 
-    void aggregation_profiler::write_to_csv(const boost::filesystem::path& root) const
+    inline void aggregation_profiler::write_to_csv(const boost::filesystem::path& root) const
       {
         boost::filesystem::path folder = root / this->group_name;
         if(!boost::filesystem::exists(folder)) boost::filesystem::create_directories(folder);
@@ -98,7 +98,7 @@ namespace transport
     
     
     // overload << to push log_severity_level to stream
-    std::ostream& operator<<(std::ostream& stream, base_writer::log_severity_level level)
+    inline std::ostream& operator<<(std::ostream& stream, base_writer::log_severity_level level)
       {
         static const std::map< base_writer::log_severity_level, std::string > stringize_map =
           {
@@ -117,8 +117,8 @@ namespace transport
     
     // overload << to push log_severity_level to Boost.Log log
     struct base_writer_severity_tag;
-    boost::log::formatting_ostream& operator<<(boost::log::formatting_ostream& stream,
-                                               const boost::log::to_log_manip<base_writer::log_severity_level, base_writer_severity_tag> manip)
+    inline boost::log::formatting_ostream& operator<<(boost::log::formatting_ostream& stream,
+                                                      const boost::log::to_log_manip<base_writer::log_severity_level, base_writer_severity_tag> manip)
       {
         static const std::map< base_writer::log_severity_level, std::string > stringize_map =
           {
@@ -313,7 +313,7 @@ namespace transport
     // GENERIC WRITER METHODS
 
 
-    generic_writer::generic_writer(const std::string& n, const generic_writer::metadata_group& m,
+    inline generic_writer::generic_writer(const std::string& n, const generic_writer::metadata_group& m,
                                    const generic_writer::paths_group& p, unsigned int w)
 	    : generic_metadata(m),
 	      paths(p),
@@ -414,7 +414,7 @@ namespace transport
 	    }
 
 
-    generic_writer::~generic_writer()
+    inline generic_writer::~generic_writer()
 	    {
         // remove logging objects
         boost::shared_ptr<boost::log::core> core = boost::log::core::get();
@@ -63,13 +63,13 @@ namespace transport
     // specialize for the basic data types; if more complex types are used,
     // separate specializations will need to be provided
     template <>
-    std::string data_type_name<float>() { return std::string{"float"}; }
+    inline std::string data_type_name<float>() { return std::string{"float"}; }
 
     template <>
-    std::string data_type_name<double>() { return std::string{"double"}; }
+    inline std::string data_type_name<double>() { return std::string{"double"}; }
 
     template <>
-    std::string data_type_name<long double>() { return std::string{"long double"}; }
+    inline std::string data_type_name<long double>() { return std::string{"long double"}; }
 
     
 
@@ -184,14 +184,14 @@ namespace transport
       };
 
 
-    void context::add_device(std::string name, unsigned int mem_size, enum device::memory_type type, unsigned int weight)
+    inline void context::add_device(std::string name, unsigned int mem_size, enum device::memory_type type, unsigned int weight)
       {
         this->devices.emplace_back(name, mem_size, *this, type, weight);
         this->total_weight += weight;
       }
 
 
-    const context::device& context::get_device(unsigned int d) const
+    inline const context::device& context::get_device(unsigned int d) const
       {
         assert(d < this->devices.size());
 
@@ -201,7 +201,7 @@ namespace transport
       }
 
 
-    double context::fractional_weight(unsigned int d) const
+    inline double context::fractional_weight(unsigned int d) const
       {
         assert(d < this->devices.size());
 
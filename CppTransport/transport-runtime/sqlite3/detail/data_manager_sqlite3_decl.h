@@ -35,6 +35,7 @@ namespace transport
 
     constexpr auto CPPTRANSPORT_TEMPORARY_CONTAINER_STEM = "worker";
     constexpr auto CPPTRANSPORT_TEMPORARY_CONTAINER_XTN = ".sqlite";
+    constexpr auto CPPTRANSPORT_CHECKPOINT_STORE_LEAF = "checkpoints.sqlite";
 
 
     // forward declare container replacement functions
@@ -132,6 +133,23 @@ namespace transport
         //! Close a paired integration_writer and postintegration_writer set
         virtual void close_writer(integration_writer<number>& i_writer, postintegration_writer<number>& p_writer) override;
 
+
+        // RECOVERY -- implements a 'data_manager' interface
+
+      public:
+
+        //! Aggregate temporary containers left by an interrupted integration, and move their checkpoints into the principal container
+        virtual void recover_temporary_containers(integration_writer<number>& writer) override;
+
+      protected:
+
+        //! Hand checkpoints held in a seed container to the workers of a seeded integration, by writing those
+        //! which belong to serial numbers in 'missing' into a checkpoint store in the writer's temporary directory
+        void seed_checkpoints(integration_writer<number>& writer, const boost::filesystem::path& seed_container, const std::set<unsigned int>& missing);
+
+        //! Load any checkpoint store from a temporary directory into a newly-created batcher
+        void load_checkpoints(integration_batcher<number>& batcher, const boost::filesystem::path& tempdir);
+
       protected:
 
         //! Internal method to close the SQLite container associated with a handle
@@ -479,6 +497,20 @@ namespace transport
         virtual void pull_tensor_twopf_time_sample(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
                                                    unsigned int k_serial, std::vector<number>& sample) override;
 
+        //! Pull time samples for every twopf component sharing a database page with component 'id'
+        virtual void pull_twopf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                          unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                          twopf_type type) override;
+
+        //! Pull time samples for every threepf component sharing a database page with component 'id'
+        virtual void pull_threepf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                            unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                            threepf_type type) override;
+
+        //! Pull time samples for every tensor twopf component sharing a database page with component 'id'
+        virtual void pull_tensor_twopf_time_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                                 unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id) override;
+
         //! Pull a sample of the zeta twopf at fixed k-configuration from a datapipe
         virtual void pull_zeta_twopf_time_sample(datapipe<number>* pipe, const derived_data::SQL_query& query,
                                                  unsigned int k_serial, std::vector<number>& sample) override;
@@ -516,6 +548,20 @@ namespace transport
         virtual void pull_tensor_twopf_kconfig_sample(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
                                                       unsigned int t_serial, std::vector<number>& sample) override;
 
+        //! Pull kconfig samples for every twopf component sharing a database page with component 'id'
+        virtual void pull_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                             unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                             twopf_type type) override;
+
+        //! Pull kconfig samples for every threepf component sharing a database page with component 'id'
+        virtual void pull_threepf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                               unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+                                               threepf_type type) override;
+
+        //! Pull kconfig samples for every tensor twopf component sharing a database page with component 'id'
+        virtual void pull_tensor_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id, const derived_data::SQL_query& query,
+                                                    unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id) override;
+
         //! Pull a kconfig sample of the zeta twopf at fixed time from a datapipe
         virtual void pull_zeta_twopf_kconfig_sample(datapipe<number>* pipe, const derived_data::SQL_query& query,
                                                     unsigned int t_serial, std::vector<number>& sample) override;
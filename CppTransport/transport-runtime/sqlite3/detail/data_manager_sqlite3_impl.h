@@ -410,6 +410,154 @@ namespace transport
       }
 
 
+    template <typename number>
+    void data_manager_sqlite3<number>::recover_temporary_containers(integration_writer<number>& writer)
+      {
+        boost::filesystem::path tempdir = writer.get_abs_tempdir_path();
+        if(!boost::filesystem::exists(tempdir) || !boost::filesystem::is_directory(tempdir)) return;
+
+        // Temporary containers left behind by the interrupted integration either hold flushed data which was dispatched
+        // (or was about to be) but not yet aggregated, or belong to a batcher which was still accumulating data.
+        // Flushes happen only between configurations, so the latter hold nothing except checkpoints of in-flight configurations.
+        // All of them are aggregated; configurations which were in flight remain missing and are reported as such by the
+        // integrity check, but their checkpoints are kept in the principal container so that workers can resume them
+        // when the content group is used as a seed.
+        // Checkpoints are read first from any store inherited from a seed, then from the temporary containers,
+        // so that the most recent checkpoint for each configuration wins
+        std::map< unsigned int, typename integration_items<number>::checkpoint_item > checkpoints;
+        std::list< boost::filesystem::path > leftovers;
+
+        boost::filesystem::path store = tempdir / CPPTRANSPORT_CHECKPOINT_STORE_LEAF;
+        if(boost::filesystem::exists(store)) leftovers.push_back(store);
+
+        for(boost::filesystem::directory_iterator t(tempdir); t != boost::filesystem::directory_iterator(); ++t)
+          {
+            const boost::filesystem::path& ctr = t->path();
+            if(boost::filesystem::is_regular_file(ctr)
+               && ctr.extension() == CPPTRANSPORT_TEMPORARY_CONTAINER_XTN
+               && ctr.filename().string().find(CPPTRANSPORT_TEMPORARY_CONTAINER_STEM) == 0)
+              {
+                leftovers.push_back(ctr);
+              }
+          }
+
+        unsigned int containers = 0;
+        unsigned int aggregated = 0;
+        for(const boost::filesystem::path& ctr : leftovers)
+          {
+            sqlite3* db = nullptr;
+            if(sqlite3_open_v2(ctr.string().c_str(), &db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK)
+              {
+                try
+                  {
+                    for(typename integration_items<number>::checkpoint_item& item : sqlite3_operations::read_checkpoints<number>(db))
+                      {
+                        unsigned int serial = item.serial;
+                        checkpoints.erase(serial);
+                        checkpoints.emplace(serial, std::move(item));
+                      }
+                  }
+                catch(runtime_exception& xe)
+                  {
+                    BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::warning)
+                      << "!! Could not read checkpoints from temporary container '" << ctr.filename().string() << "': " << xe.what();
+                  }
+              }
+            if(db != nullptr) sqlite3_close(db);
+
+            if(ctr == store) continue;
+            ++containers;
+
+            // the container may already have been aggregated if the master was interrupted before it could be removed;
+            // in that case aggregation fails, and the container is left in place for inspection
+            try
+              {
+                if(writer.aggregate(ctr))
+                  {
+                    boost::filesystem::remove(ctr);
+                    ++aggregated;
+                  }
+              }
+            catch(runtime_exception& xe)
+              {
+                BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::warning)
+                  << "!! Could not aggregate temporary container '" << ctr.filename().string() << "': " << xe.what();
+              }
+          }
+
+        BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
+          << "++ Aggregated " << aggregated << " of " << containers << " temporary containers left by interrupted integration";
+
+        if(checkpoints.empty()) return;
+
+        sqlite3* db = nullptr;
+        writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
+
+        transaction_manager mgr = this->transaction_factory(writer);
+        sqlite3_operations::create_checkpoint_table(mgr, db);
+        for(const auto& item : checkpoints)
+          {
+            sqlite3_operations::write_checkpoint_row<number>(db, item.second);
+          }
+        mgr.commit();
+
+        BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
+          << "++ Retained checkpoints for " << checkpoints.size() << " in-flight configurations; these will be resumed when the content group is used as a seed";
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::seed_checkpoints(integration_writer<number>& writer, const boost::filesystem::path& seed_container,
+                                                        const std::set<unsigned int>& missing)
+      {
+        std::list< typename integration_items<number>::checkpoint_item > checkpoints;
+
+        sqlite3* db = nullptr;
+        if(sqlite3_open_v2(seed_container.string().c_str(), &db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK)
+          {
+            checkpoints = sqlite3_operations::read_checkpoints<number>(db);
+          }
+        if(db != nullptr) sqlite3_close(db);
+
+        // only configurations which are to be recomputed are of interest
+        checkpoints.remove_if([&](const typename integration_items<number>::checkpoint_item& item) -> bool { return missing.count(item.serial) == 0; });
+        if(checkpoints.empty()) return;
+
+        boost::filesystem::path tempdir = writer.get_abs_tempdir_path();
+        if(!boost::filesystem::exists(tempdir)) boost::filesystem::create_directories(tempdir);
+
+        sqlite3* store = this->make_temp_container(tempdir / CPPTRANSPORT_CHECKPOINT_STORE_LEAF);
+
+        transaction_manager mgr = this->transaction_factory(store, this->generate_lockfile_path(tempdir, 0));
+        sqlite3_operations::create_checkpoint_table(mgr, store);
+        for(const typename integration_items<number>::checkpoint_item& item : checkpoints)
+          {
+            sqlite3_operations::write_checkpoint_row<number>(store, item);
+          }
+        mgr.commit();
+
+        sqlite3_close(store);
+
+        BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
+          << "** Seed holds checkpoints for " << checkpoints.size() << " interrupted configurations; these will be resumed by workers";
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::load_checkpoints(integration_batcher<number>& batcher, const boost::filesystem::path& tempdir)
+      {
+        boost::filesystem::path store = tempdir / CPPTRANSPORT_CHECKPOINT_STORE_LEAF;
+        if(!boost::filesystem::exists(store)) return;
+
+        sqlite3* db = nullptr;
+        if(sqlite3_open_v2(store.string().c_str(), &db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK)
+          {
+            batcher.set_resume_checkpoints(sqlite3_operations::read_checkpoints<number>(db));
+          }
+        if(db != nullptr) sqlite3_close(db);
+      }
+
+
     template <typename number>
     template <typename WriterObject>
     void data_manager_sqlite3<number>::close_writer_handle(WriterObject& writer)
@@ -609,6 +757,9 @@ namespace transport
 
         mgr.commit();
 
+        // pass on checkpoints for any configurations which were in flight when the seed was interrupted
+        this->seed_checkpoints(writer, seed_container_path, seed.get_payload().get_failed_serials());
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Seeding complete in time " << format_time(timer.elapsed().wall);
@@ -650,6 +801,9 @@ namespace transport
 
         mgr.commit();
 
+        // pass on checkpoints for any configurations which were in flight when the seed was interrupted
+        this->seed_checkpoints(writer, seed_container_path, seed.get_payload().get_failed_serials());
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Seeding complete in time " << format_time(timer.elapsed().wall);
@@ -787,6 +941,8 @@ namespace transport
         writers.backg        = std::bind(&sqlite3_operations::write_coordinate_output<number, typename integration_items<number>::backg_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
         writers.twopf        = std::bind(&sqlite3_operations::write_paged_output<number, integration_batcher<number>, typename integration_items<number>::twopf_re_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
         writers.tensor_twopf = std::bind(&sqlite3_operations::write_paged_output<number, integration_batcher<number>, typename integration_items<number>::tensor_twopf_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+        writers.checkpoint      = std::bind(&sqlite3_operations::write_checkpoint<number>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+        writers.drop_checkpoint = std::bind(&sqlite3_operations::drop_checkpoint<number>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
 
         // set up a replacement function
         std::unique_ptr< sqlite3_container_replace_twopf<number> > replacer = std::make_unique< sqlite3_container_replace_twopf<number> >(*this, tempdir, worker, m, tk->get_collect_initial_conditions());
@@ -796,6 +952,9 @@ namespace transport
 
         BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal) << "** Created new temporary twopf container " << container;
 
+        // pick up checkpoints for any configurations which were interrupted in an earlier integration
+        this->load_checkpoints(batcher, tempdir);
+
         // add this database to our list of open connections
         this->open_containers.push_back(db);
 
@@ -807,6 +966,7 @@ namespace transport
     void data_manager_sqlite3<number>::make_temp_twopf_tables(transaction_manager& mgr, sqlite3* db, unsigned int Nfields, bool statistics, bool ics)
       {
         sqlite3_operations::create_worker_info_table(mgr, db, sqlite3_operations::foreign_keys_type::no_foreign_keys);
+        sqlite3_operations::create_checkpoint_table(mgr, db);
         if(statistics) sqlite3_operations::create_stats_table(mgr, db, sqlite3_operations::foreign_keys_type::no_foreign_keys,
                                                               sqlite3_operations::kconfiguration_type::twopf_configs);
         if(ics) sqlite3_operations::create_ics_table<number, typename integration_items<number>::ics_item>(mgr, db, Nfields,
@@ -848,6 +1008,8 @@ namespace transport
         writers.tensor_twopf     = std::bind(&sqlite3_operations::write_paged_output<number, integration_batcher<number>, typename integration_items<number>::tensor_twopf_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
         writers.threepf_momentum = std::bind(&sqlite3_operations::write_paged_output<number, integration_batcher<number>, typename integration_items<number>::threepf_momentum_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
         writers.threepf_Nderiv   = std::bind(&sqlite3_operations::write_paged_output<number, integration_batcher<number>, typename integration_items<number>::threepf_Nderiv_item>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+        writers.checkpoint       = std::bind(&sqlite3_operations::write_checkpoint<number>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+        writers.drop_checkpoint  = std::bind(&sqlite3_operations::drop_checkpoint<number>, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
 
         // set up a replacement function
         std::unique_ptr< sqlite3_container_replace_threepf<number> > replacer = std::make_unique< sqlite3_container_replace_threepf<number> >(*this, tempdir, worker, m, tk->get_collect_initial_conditions());
@@ -856,6 +1018,9 @@ namespace transport
         threepf_batcher<number> batcher(this->get_batcher_capacity(), this->get_checkpoint_interval(), m, tk, container, logdir, writers, std::move(dispatcher), std::move(replacer), db, worker, group);
         BOOST_LOG_SEV(batcher.get_log(), generic_batcher::log_severity_level::normal) << "** Created new temporary threepf container " << container;
 
+        // pick up checkpoints for any configurations which were interrupted in an earlier integration
+        this->load_checkpoints(batcher, tempdir);
+
         // add this database to our list of open connections
         this->open_containers.push_back(db);
 
@@ -867,6 +1032,7 @@ namespace transport
     void data_manager_sqlite3<number>::make_temp_threepf_tables(transaction_manager& mgr, sqlite3* db, unsigned int Nfields, bool statistics, bool ics)
       {
         sqlite3_operations::create_worker_info_table(mgr, db, sqlite3_operations::foreign_keys_type::no_foreign_keys);
+        sqlite3_operations::create_checkpoint_table(mgr, db);
         if(statistics) sqlite3_operations::create_stats_table(mgr, db, sqlite3_operations::foreign_keys_type::no_foreign_keys,
                                                               sqlite3_operations::kconfiguration_type::threepf_configs);
         if(ics)
@@ -1803,7 +1969,7 @@ namespace transport
         sqlite3* db = nullptr;
         writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
 
-        sqlite3_operations::finalize_twopf_writer(mgr, db);
+        sqlite3_operations::finalize_twopf_writer(mgr, db, this->get_container_layout(), this->get_storage_codec());
 
         mgr.commit();
 
@@ -1813,6 +1979,9 @@ namespace transport
         // (the journal mode can only be changed outside a transaction, so we have to do this after mgr.commit())
         sqlite3_operations::force_truncate_journal(db);
 
+        // encoding replaces value tables, so recover the space they occupied
+        if(this->get_storage_codec() != storage_codec::none) sqlite3_operations::vacuum(db);
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Finalization complete in time " << format_time(timer.elapsed().wall);
@@ -1833,7 +2002,7 @@ namespace transport
         sqlite3* db = nullptr;
         writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
 
-        sqlite3_operations::finalize_threepf_writer(mgr, db);
+        sqlite3_operations::finalize_threepf_writer(mgr, db, this->get_container_layout(), this->get_storage_codec());
 
         mgr.commit();
 
@@ -1843,6 +2012,9 @@ namespace transport
         // (the journal mode can only be changed outside a transaction, so we have to do this after mgr.commit())
         sqlite3_operations::force_truncate_journal(db);
 
+        // encoding replaces value tables, so recover the space they occupied
+        if(this->get_storage_codec() != storage_codec::none) sqlite3_operations::vacuum(db);
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Finalization complete in time " << format_time(timer.elapsed().wall);
@@ -1863,7 +2035,7 @@ namespace transport
         sqlite3* db = nullptr;
         writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
 
-        sqlite3_operations::finalize_zeta_twopf_writer(mgr, db);
+        sqlite3_operations::finalize_zeta_twopf_writer(mgr, db, this->get_container_layout(), this->get_storage_codec());
 
         mgr.commit();
 
@@ -1873,6 +2045,9 @@ namespace transport
         // (the journal mode can only be changed outside a transaction, so we have to do this after mgr.commit())
         sqlite3_operations::force_truncate_journal(db);
 
+        // encoding replaces value tables, so recover the space they occupied
+        if(this->get_storage_codec() != storage_codec::none) sqlite3_operations::vacuum(db);
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Finalization complete in time " << format_time(timer.elapsed().wall);
@@ -1893,7 +2068,7 @@ namespace transport
         sqlite3* db = nullptr;
         writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
 
-        sqlite3_operations::finalize_zeta_threepf_writer(mgr, db);
+        sqlite3_operations::finalize_zeta_threepf_writer(mgr, db, this->get_container_layout(), this->get_storage_codec());
 
         mgr.commit();
 
@@ -1903,6 +2078,9 @@ namespace transport
         // (the journal mode can only be changed outside a transaction, so we have to do this after mgr.commit())
         sqlite3_operations::force_truncate_journal(db);
 
+        // encoding replaces value tables, so recover the space they occupied
+        if(this->get_storage_codec() != storage_codec::none) sqlite3_operations::vacuum(db);
+
         timer.stop();
         BOOST_LOG_SEV(writer.get_log(), base_writer::log_severity_level::notification)
           << "** Finalization complete in time " << format_time(timer.elapsed().wall);
@@ -1923,7 +2101,7 @@ namespace transport
         sqlite3* db = nullptr;
         writer.get_data_manager_handle(&db); // throws an exception if handle is unset, so the return value is guaranteed not to be nullptr
 
-        sqlite3_operations::finalize_fNL_writer(mgr, db);
+        sqlite3_operations::finalize_fNL_writer(mgr, db, this->get_container_layout(), this->get_storage_codec());
 
         mgr.commit();
 
@@ -2089,6 +2267,82 @@ namespace transport
       }
 
 
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_twopf_time_page(datapipe<number>* pipe, unsigned int id,
+                                                            const derived_data::SQL_query& query,
+                                                            unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id, twopf_type type)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        switch(type)
+          {
+            case twopf_type::real:
+              {
+                sqlite3_operations::pull_paged_time_page<number, typename integration_items<number>::twopf_re_item>(db, id, query, k_serial, sample, first_id,
+                                                                                                                    pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+
+            case twopf_type::imag:
+              {
+                sqlite3_operations::pull_paged_time_page<number, typename integration_items<number>::twopf_im_item>(db, id, query, k_serial, sample, first_id,
+                                                                                                                    pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+          }
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_threepf_time_page(datapipe<number>* pipe, unsigned int id,
+                                                              const derived_data::SQL_query& query,
+                                                              unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id, threepf_type type)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        switch(type)
+          {
+            case threepf_type::momentum:
+              {
+                sqlite3_operations::pull_paged_time_page<number, typename integration_items<number>::threepf_momentum_item>(db, id, query, k_serial, sample, first_id,
+                                                                                                                            pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+
+            case threepf_type::Nderiv:
+              {
+                sqlite3_operations::pull_paged_time_page<number, typename integration_items<number>::threepf_Nderiv_item>(db, id, query, k_serial, sample, first_id,
+                                                                                                                          pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+          }
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_tensor_twopf_time_page(datapipe<number>* pipe, unsigned int id,
+                                                                   const derived_data::SQL_query& query,
+                                                                   unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        sqlite3_operations::pull_paged_time_page<number, typename integration_items<number>::tensor_twopf_item>(db, id, query, k_serial, sample, first_id,
+                                                                                                                pipe->get_worker_number(), pipe->get_N_fields());
+      }
+
+
     template <typename number>
     void data_manager_sqlite3<number>::pull_zeta_twopf_time_sample(datapipe<number>* pipe, const derived_data::SQL_query& query,
                                                                    unsigned int k_serial, std::vector<number>& sample)
@@ -2252,6 +2506,82 @@ namespace transport
       }
 
 
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id,
+                                                               const derived_data::SQL_query& query,
+                                                               unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id, twopf_type type)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        switch(type)
+          {
+            case twopf_type::real:
+              {
+                sqlite3_operations::pull_paged_kconfig_page<number, typename integration_items<number>::twopf_re_item>(db, id, query, t_serial, sample, first_id,
+                                                                                                                       pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+
+            case twopf_type::imag:
+              {
+                sqlite3_operations::pull_paged_kconfig_page<number, typename integration_items<number>::twopf_im_item>(db, id, query, t_serial, sample, first_id,
+                                                                                                                       pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+          }
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_threepf_kconfig_page(datapipe<number>* pipe, unsigned int id,
+                                                                 const derived_data::SQL_query& query,
+                                                                 unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id, threepf_type type)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        switch(type)
+          {
+            case threepf_type::momentum:
+              {
+                sqlite3_operations::pull_paged_kconfig_page<number, typename integration_items<number>::threepf_momentum_item>(db, id, query, t_serial, sample, first_id,
+                                                                                                                               pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+
+            case threepf_type::Nderiv:
+              {
+                sqlite3_operations::pull_paged_kconfig_page<number, typename integration_items<number>::threepf_Nderiv_item>(db, id, query, t_serial, sample, first_id,
+                                                                                                                             pipe->get_worker_number(), pipe->get_N_fields());
+                break;
+              }
+          }
+      }
+
+
+    template <typename number>
+    void data_manager_sqlite3<number>::pull_tensor_twopf_kconfig_page(datapipe<number>* pipe, unsigned int id,
+                                                                      const derived_data::SQL_query& query,
+                                                                      unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id)
+      {
+        assert(pipe != nullptr);
+        if(pipe == nullptr) throw runtime_exception(exception_type::RUNTIME_ERROR, CPPTRANSPORT_DATAMGR_NULL_DATAPIPE);
+
+        sqlite3* db = nullptr;
+        pipe->get_manager_handle(&db);    // throws an exception if the handle is unset, so safe to proceed; we can't get nullptr back
+
+        sqlite3_operations::pull_paged_kconfig_page<number, typename integration_items<number>::tensor_twopf_item>(db, id, query, t_serial, sample, first_id,
+                                                                                                                   pipe->get_worker_number(), pipe->get_N_fields());
+      }
+
+
     template <typename number>
     void data_manager_sqlite3<number>::pull_zeta_twopf_kconfig_sample(datapipe<number>* pipe, const derived_data::SQL_query& query,
                                                                       unsigned int t_serial, std::vector<number>& sample)
@@ -258,6 +258,17 @@ namespace transport
         std::unique_ptr< content_group_record<Payload> > query_content_group(const std::string& name, boost::optional<transaction_manager&> mgr);
 
 
+        // SNAPSHOTS -- implements a 'repository' interface
+
+      public:
+
+        //! Build a self-contained snapshot of an integration task
+        virtual task_snapshot snapshot_integration_task(const std::string& name) override;
+
+        //! Install a snapshot in the read-only record caches
+        virtual void install_snapshot(const task_snapshot& snapshot) override;
+
+
         // ENUMERATE DATABASE RECORDS
 
       public:
@@ -446,11 +457,17 @@ namespace transport
         template <typename Payload>
         std::unique_ptr< content_group_record<Payload> > content_group_record_factory(Json::Value& reader, boost::optional<transaction_manager&> mgr);
 
+        //! Create an integration task record from a JSON value and an open k-configuration database
+        std::unique_ptr< integration_task_record<number> > integration_task_record_factory(Json::Value& reader, sqlite3* kconfig_handle);
+
 
         // UTILITY FUNCTIONS
 
       protected:
 
+        //! Read the raw contents of a file belonging to the repository, for inclusion in a snapshot
+        std::vector<char> read_snapshot_file(const boost::filesystem::path& path, const std::string& task_name);
+
         //! Check whether a package already exists in the database. Throws an exception if so.
         void check_package_duplicate(const std::string& name);
 
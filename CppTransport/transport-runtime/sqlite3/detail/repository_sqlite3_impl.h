@@ -397,8 +397,10 @@ namespace transport
           {
             record.write_kconfig_database(abs_temporary, this->args.get_network_mode());
 
-            // if this succeeded, add this record to the transaction journal
+            // if this succeeded, add this record and its binary image to the transaction journal
             mgr.journal_deposit(abs_temporary, abs_database);
+            mgr.journal_deposit(abs_temporary.string() + configuration_database::CPPTRANSPORT_KCONFIG_IMAGE_EXTENSION,
+                                abs_database.string() + configuration_database::CPPTRANSPORT_KCONFIG_IMAGE_EXTENSION);
           }
       }
 
@@ -486,6 +488,21 @@ namespace transport
       }
 
 
+    template <typename number>
+    std::unique_ptr< integration_task_record<number> > repository_sqlite3<number>::integration_task_record_factory(Json::Value& reader, sqlite3* kconfig_handle)
+      {
+        find_function finder = std::bind(&sqlite3_operations::find_integration_task, std::placeholders::_1, std::placeholders::_2, CPPTRANSPORT_REPO_TASK_MISSING);
+
+        // records built from a snapshot are always read-only
+        repository_record::handler_package pkg(
+          std::bind(&repository_sqlite3<number>::commit_integration_replace, this, std::placeholders::_1,
+                    std::placeholders::_2, finder),
+          this->env, boost::optional<transaction_manager&>());
+
+        return std::make_unique< integration_task_record<number> >(reader, kconfig_handle, this->pkg_finder, pkg);
+      }
+
+
     template <typename number>
     std::unique_ptr< output_task_record<number> > repository_sqlite3<number>::output_task_record_factory(const output_task<number>& tk, transaction_manager& mgr)
       {
@@ -1235,6 +1252,90 @@ namespace transport
       }
 
 
+    // SNAPSHOTS
+
+
+    template <typename number>
+    task_snapshot repository_sqlite3<number>::snapshot_integration_task(const std::string& name)
+      {
+        // read the task record as raw text, so it can be shipped exactly as stored
+        boost::filesystem::path task_file = sqlite3_operations::find_integration_task(this->db, name, CPPTRANSPORT_REPO_TASK_MISSING);
+        std::vector<char> task_bytes = this->read_snapshot_file(task_file, name);
+        std::string task_document(task_bytes.begin(), task_bytes.end());
+
+        Json::Value task_root;
+        std::istringstream task_in(task_document);
+        task_in >> task_root;
+
+        // read the package record on which the task depends
+        std::string pkg_name = task_root[CPPTRANSPORT_NODE_PACKAGE_NAME].asString();
+        boost::filesystem::path pkg_file = sqlite3_operations::find_package(this->db, pkg_name, CPPTRANSPORT_REPO_PACKAGE_MISSING);
+        std::vector<char> pkg_bytes = this->read_snapshot_file(pkg_file, name);
+
+        // read the k-configuration database image
+        boost::filesystem::path kconfig_file = task_root[CPPTRANSPORT_NODE_RECORD_INTEGRATION_TASK_KCONFIG_DATABASE].asString();
+        std::vector<char> kconfig_bytes = this->read_snapshot_file(kconfig_file, name);
+
+        return task_snapshot(name, std::move(task_document), pkg_name, std::string(pkg_bytes.begin(), pkg_bytes.end()), std::move(kconfig_bytes));
+      }
+
+
+    template <typename number>
+    void repository_sqlite3<number>::install_snapshot(const task_snapshot& snapshot)
+      {
+        if(snapshot.empty()) return;
+
+        // the read-only caches are flushed at every transaction boundary, so an installed snapshot would be lost
+        if(this->transactions > 0) throw runtime_exception(exception_type::REPOSITORY_ERROR, CPPTRANSPORT_REPO_SNAPSHOT_TRANSACTION);
+
+        // if the k-configuration database can't be attached from memory, leave the caches alone;
+        // query_task() will then fall back to reading the physical database
+        sqlite3* handle = sqlite3_operations::open_database_image(snapshot.get_kconfig_database());
+        if(handle == nullptr) return;
+
+        try
+          {
+            // install the package record first, so the package finder used while deserializing
+            // the task is served from the cache
+            Json::Value pkg_root;
+            std::istringstream pkg_in(snapshot.get_package_document());
+            pkg_in >> pkg_root;
+
+            this->pkg_cache[snapshot.get_package_name()] = this->package_record_factory(pkg_root, boost::optional<transaction_manager&>());
+
+            Json::Value task_root;
+            std::istringstream task_in(snapshot.get_task_document());
+            task_in >> task_root;
+
+            this->task_cache[snapshot.get_task_name()] = this->integration_task_record_factory(task_root, handle);
+          }
+        catch(...)
+          {
+            sqlite3_close(handle);
+            throw;
+          }
+
+        sqlite3_close(handle);
+      }
+
+
+    template <typename number>
+    std::vector<char> repository_sqlite3<number>::read_snapshot_file(const boost::filesystem::path& path, const std::string& task_name)
+      {
+        boost::filesystem::path abs_path = this->get_root_path() / path;
+
+        std::ifstream in(abs_path.string().c_str(), std::ios_base::in | std::ios_base::binary);
+        if(!in)
+          {
+            std::ostringstream msg;
+            msg << CPPTRANSPORT_REPO_SNAPSHOT_READ_FAIL << " '" << task_name << "' (" << path.string() << ")";
+            throw runtime_exception(exception_type::REPOSITORY_ERROR, msg.str());
+          }
+
+        return std::vector<char>((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+      }
+
+
     // Enumerate package records
     template <typename number>
     typename package_db<number>::type repository_sqlite3<number>::enumerate_packages()
@@ -1826,6 +1927,11 @@ namespace transport
 
             auto writer = this->get_integration_recovery_writer(*inflight.second, data_mgr, *rec, worker);
 
+            // aggregate any temporary containers the interrupted integration left behind, and retain checkpoints
+            // for configurations which were in flight; these are still reported missing by the integrity check,
+            // but are resumed by workers rather than recomputed from scratch when the content group is used as a seed
+            data_mgr.recover_temporary_containers(*writer);
+
             // metadata for the writer are likely to be inconsistent
             // try to recover correct metadata directly from the container
             this->recover_integration_metadata(data_mgr, *writer);
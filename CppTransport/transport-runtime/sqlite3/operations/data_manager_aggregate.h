@@ -30,6 +30,7 @@
 
 #include "transport-runtime/sqlite3/operations/data_manager_common.h"
 #include "transport-runtime/sqlite3/operations/data_traits.h"
+#include "transport-runtime/sqlite3/operations/data_manager_codec.h"
 
 #include "transport-runtime/repository/writers/aggregation_profiler.h"
 
@@ -103,7 +104,7 @@ namespace transport
           };
 
 
-        attach_manager::attach_manager(sqlite3* db, const boost::filesystem::path& p, boost::optional< aggregation_profile_record& > rec)
+        inline attach_manager::attach_manager(sqlite3* db, const boost::filesystem::path& p, boost::optional< aggregation_profile_record& > rec)
           : handle(db),
             path(p),
             attached(false),
@@ -126,14 +127,14 @@ namespace transport
           }
 
 
-        attach_manager::~attach_manager()
+        inline attach_manager::~attach_manager()
           {
             if(!this->attached || this->committed) return;
             this->detach("ROLLBACK");
           }
 
 
-        void attach_manager::commit()
+        inline void attach_manager::commit()
           {
             if(this->attached && !this->committed)
               {
@@ -143,7 +144,7 @@ namespace transport
           }
 
 
-        void attach_manager::detach(std::string cmd)
+        inline void attach_manager::detach(std::string cmd)
           {
             boost::timer::cpu_timer timer;
             std::ostringstream detach_stmt;
@@ -183,12 +184,111 @@ namespace transport
           }
 
 
+        // Expand an encoded value table from an attached container into rows of the corresponding value table.
+        // Only finalized containers hold encoded tables, so this is needed when seeding, not when aggregating
+        // from a temporary container; returns the number of rows inserted
+        inline size_t expand_encoded_table(sqlite3* db, const std::string& table_name, const std::string& error_msg)
+          {
+            std::ostringstream read_stmt;
+            read_stmt << "SELECT kserial, page, block FROM " << CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME << "." << codec_impl::encoded_table(table_name) << ";";
+
+            sqlite3_stmt* read;
+            check_stmt(db, sqlite3_prepare_v2(db, read_stmt.str().c_str(), read_stmt.str().length()+1, &read, nullptr), error_msg);
+
+            sqlite3_stmt* insert = nullptr;
+            size_t insert_cols = 0;
+            size_t rows = 0;
+
+            codec_impl::value_block block;
+
+            int status;
+            while((status = sqlite3_step(read)) == SQLITE_ROW)
+              {
+                sqlite3_int64 kserial = sqlite3_column_int64(read, 0);
+                int page = sqlite3_column_int(read, 1);
+
+                const unsigned char* data = static_cast<const unsigned char*>(sqlite3_column_blob(read, 2));
+                size_t size = static_cast<size_t>(sqlite3_column_bytes(read, 2));
+
+                if(!codec_impl::decode_block(data, size, block, 0, codec_impl::all_columns))
+                  {
+                    if(insert != nullptr) sqlite3_finalize(insert);
+                    sqlite3_finalize(read);
+
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_CODEC_CORRUPT << " '" << table_name << "' (kserial=" << kserial << ", page=" << page << ")";
+                    throw runtime_exception(exception_type::DATA_CONTAINER_ERROR, msg.str());
+                  }
+
+                // column order matches create_paged_table(): unique_id, tserial, kserial, page, ele0, ele1, ...
+                if(insert == nullptr || insert_cols != block.columns.size())
+                  {
+                    if(insert != nullptr) sqlite3_finalize(insert);
+
+                    std::ostringstream insert_stmt;
+                    insert_stmt << "INSERT INTO " << table_name << " VALUES (?, ?, ?, ?";
+                    for(size_t c = 0; c < block.columns.size(); ++c)
+                      {
+                        insert_stmt << ", ?";
+                      }
+                    insert_stmt << ");";
+
+                    check_stmt(db, sqlite3_prepare_v2(db, insert_stmt.str().c_str(), insert_stmt.str().length()+1, &insert, nullptr), error_msg);
+                    insert_cols = block.columns.size();
+                  }
+
+                for(size_t i = 0; i < block.size(); ++i)
+                  {
+                    check_stmt(db, sqlite3_bind_int64(insert, 1, block.unique_id[i]), error_msg);
+                    check_stmt(db, sqlite3_bind_int64(insert, 2, block.tserial[i]), error_msg);
+                    check_stmt(db, sqlite3_bind_int64(insert, 3, kserial), error_msg);
+                    check_stmt(db, sqlite3_bind_int(insert, 4, page), error_msg);
+
+                    for(size_t c = 0; c < block.columns.size(); ++c)
+                      {
+                        int index = static_cast<int>(c) + 5;
+                        if(block.present[c]) check_stmt(db, sqlite3_bind_double(insert, index, block.columns[c][i]), error_msg);
+                        else                 check_stmt(db, sqlite3_bind_null(insert, index), error_msg);
+                      }
+
+                    check_stmt(db, sqlite3_step(insert), error_msg, SQLITE_DONE);
+                    check_stmt(db, sqlite3_clear_bindings(insert), error_msg);
+                    check_stmt(db, sqlite3_reset(insert), error_msg);
+                    ++rows;
+                  }
+              }
+
+            if(insert != nullptr) check_stmt(db, sqlite3_finalize(insert), error_msg);
+
+            if(status != SQLITE_DONE)
+              {
+                std::ostringstream msg;
+                msg << error_msg << sqlite3_errmsg(db) << ") [status=" << status << "]";
+                sqlite3_finalize(read);
+                throw runtime_exception(exception_type::DATA_CONTAINER_ERROR, msg.str());
+              }
+
+            check_stmt(db, sqlite3_finalize(read), error_msg);
+
+            return rows;
+          }
+
+
 		    template <typename number, typename WriterObject, typename ValueType>
 		    aggregation_table_data aggregate_table(attach_manager& mgr, WriterObject& writer)
 			    {
             boost::timer::cpu_timer timer;
             sqlite3* db = mgr.get_db_connexion();
 
+            // a seeding container may have been encoded when it was finalized
+            if(codec_impl::is_encoded(db, data_traits<number, ValueType>::sqlite_table(), CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME))
+              {
+                size_t rows = expand_encoded_table(db, data_traits<number, ValueType>::sqlite_table(), data_traits<number, ValueType>::copy_error_msg());
+
+                timer.stop();
+                return aggregation_table_data(timer.elapsed().wall, rows);
+              }
+
             std::ostringstream copy_stmt;
 				    copy_stmt
 				      << "INSERT INTO " << data_traits<number, ValueType>::sqlite_table()
@@ -253,10 +353,14 @@ namespace transport
             boost::timer::cpu_timer timer;
             sqlite3* db = mgr.get_db_connexion();
 
+            // a seed container may predate columns added to the worker table, so copy only the columns both tables hold;
+            // any others are left NULL
+            std::string columns = shared_columns(db, CPPTRANSPORT_SQLITE_WORKERS_TABLE, CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME);
+
             std::ostringstream copy_stmt;
             copy_stmt
-	            << "INSERT OR IGNORE INTO " << CPPTRANSPORT_SQLITE_WORKERS_TABLE
-	            << " SELECT * FROM " << CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME << "." << CPPTRANSPORT_SQLITE_WORKERS_TABLE << ";";
+	            << "INSERT OR IGNORE INTO " << CPPTRANSPORT_SQLITE_WORKERS_TABLE << " (" << columns << ")"
+	            << " SELECT " << columns << " FROM " << CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME << "." << CPPTRANSPORT_SQLITE_WORKERS_TABLE << ";";
 
             exec(db, copy_stmt.str(), CPPTRANSPORT_DATACTR_WORKERS_COPY);
 
@@ -272,10 +376,14 @@ namespace transport
             boost::timer::cpu_timer timer;
             sqlite3* db = mgr.get_db_connexion();
 
+            // a seed container may predate the hot-path instrumentation columns, so copy only the columns both tables hold;
+            // any others are left NULL, meaning 'not instrumented'
+            std::string columns = shared_columns(db, CPPTRANSPORT_SQLITE_STATS_TABLE, CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME);
+
             std::ostringstream copy_stmt;
             copy_stmt
-	            << "INSERT INTO " << CPPTRANSPORT_SQLITE_STATS_TABLE
-	            << " SELECT * FROM " << CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME << "." << CPPTRANSPORT_SQLITE_STATS_TABLE << ";";
+	            << "INSERT INTO " << CPPTRANSPORT_SQLITE_STATS_TABLE << " (" << columns << ")"
+	            << " SELECT " << columns << " FROM " << CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME << "." << CPPTRANSPORT_SQLITE_STATS_TABLE << ";";
 
             exec(db, copy_stmt.str(), CPPTRANSPORT_DATACTR_STATISTICS_COPY);
 
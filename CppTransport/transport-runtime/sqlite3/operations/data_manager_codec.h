@@ -0,0 +1,702 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_DATA_MANAGER_CODEC_H
+#define CPPTRANSPORT_DATA_MANAGER_CODEC_H
+
+
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+#include "transport-runtime/sqlite3/operations/data_manager_common.h"
+
+
+namespace transport
+  {
+
+    namespace sqlite3_operations
+      {
+
+        // Encoded value tables replace the rows of a paged value table with one block per (kserial, page).
+        // Each block holds the time series of every column in the page, ordered by tserial.
+        // Serial numbers and unique ids are stored as variable-length deltas, and each column is stored as
+        // an XOR-delta bit stream of its IEEE doubles: successive samples of a smooth correlation function share
+        // their sign, exponent and leading mantissa bits, so most XORs reduce to a short run of meaningful bits.
+        // Columns which do not compress are stored verbatim. The encoding is lossless
+        namespace codec_impl
+          {
+
+            //! format version written into the first byte of each block
+            constexpr unsigned char block_version = 1;
+
+            //! column flags; a column is stored verbatim if neither predictor makes it smaller
+            constexpr unsigned char column_null   = 0;    // NULL for every sample
+            constexpr unsigned char column_raw    = 1;    // verbatim IEEE doubles
+            constexpr unsigned char column_xor    = 2;    // XOR with the previous sample
+            constexpr unsigned char column_linear = 3;    // XOR with a linear extrapolation of the previous two samples
+
+            //! pass as num_cols to decode every column of a block
+            constexpr unsigned int all_columns = std::numeric_limits<unsigned int>::max();
+
+
+            //! a decoded block: the time series of every column in one page, for a single k-configuration
+            class value_block
+              {
+
+              public:
+
+                //! clear contents
+                void clear()
+                  {
+                    this->tserial.clear();
+                    this->unique_id.clear();
+                    this->present.clear();
+                    this->columns.clear();
+                  }
+
+                //! number of time samples
+                size_t size() const { return this->tserial.size(); }
+
+                //! time serial numbers, in ascending order
+                std::vector<sqlite3_int64> tserial;
+
+                //! unique ids of the original rows
+                std::vector<sqlite3_int64> unique_id;
+
+                //! present[c] is false if column c is NULL for every sample
+                std::vector<bool> present;
+
+                //! column values; columns which were not requested when decoding are left empty
+                std::vector< std::vector<double> > columns;
+
+              };
+
+
+            //! write a stream of bits, most significant first
+            class bit_writer
+              {
+
+              public:
+
+                bit_writer(std::string& b)
+                  : buf(b),
+                    cur(0),
+                    fill(0)
+                  {
+                  }
+
+                //! write the low n bits of v, 0 <= n <= 64
+                void write(std::uint64_t v, unsigned int n)
+                  {
+                    while(n > 0)
+                      {
+                        unsigned int space = 8 - this->fill;
+                        unsigned int take  = std::min(space, n);
+                        std::uint64_t chunk = (v >> (n - take)) & ((1U << take) - 1U);
+
+                        this->cur |= static_cast<unsigned char>(chunk << (space - take));
+                        this->fill += take;
+                        n -= take;
+
+                        if(this->fill == 8)
+                          {
+                            this->buf.push_back(static_cast<char>(this->cur));
+                            this->cur = 0;
+                            this->fill = 0;
+                          }
+                      }
+                  }
+
+                //! flush any partial byte
+                void flush()
+                  {
+                    if(this->fill > 0) this->buf.push_back(static_cast<char>(this->cur));
+                    this->cur = 0;
+                    this->fill = 0;
+                  }
+
+              private:
+
+                std::string& buf;
+
+                unsigned char cur;
+
+                unsigned int fill;
+
+              };
+
+
+            //! read a stream of bits written by bit_writer
+            class bit_reader
+              {
+
+              public:
+
+                bit_reader(const unsigned char* d, size_t s)
+                  : data(d),
+                    size(s),
+                    pos(0),
+                    used(0),
+                    overrun(false)
+                  {
+                  }
+
+                //! read n bits, 0 <= n <= 64
+                std::uint64_t read(unsigned int n)
+                  {
+                    std::uint64_t v = 0;
+                    while(n > 0)
+                      {
+                        if(this->pos >= this->size) { this->overrun = true; return 0; }
+
+                        unsigned int avail = 8 - this->used;
+                        unsigned int take  = std::min(avail, n);
+                        std::uint64_t chunk = (this->data[this->pos] >> (avail - take)) & ((1U << take) - 1U);
+
+                        v = (v << take) | chunk;
+                        this->used += take;
+                        n -= take;
+
+                        if(this->used == 8)
+                          {
+                            ++this->pos;
+                            this->used = 0;
+                          }
+                      }
+                    return v;
+                  }
+
+                //! did any read run past the end of the stream?
+                bool failed() const { return this->overrun; }
+
+              private:
+
+                const unsigned char* data;
+
+                size_t size;
+
+                size_t pos;
+
+                unsigned int used;
+
+                bool overrun;
+
+              };
+
+
+            inline void put_varint(std::string& out, std::uint64_t v)
+              {
+                while(v >= 0x80)
+                  {
+                    out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+                    v >>= 7;
+                  }
+                out.push_back(static_cast<char>(v));
+              }
+
+
+            inline bool get_varint(const unsigned char*& p, const unsigned char* end, std::uint64_t& v)
+              {
+                v = 0;
+                for(unsigned int shift = 0; shift < 64 && p < end; shift += 7)
+                  {
+                    unsigned char byte = *p++;
+                    v |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                    if((byte & 0x80) == 0) return true;
+                  }
+                return false;
+              }
+
+
+            inline std::uint64_t zigzag(std::int64_t v)   { return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(v >> 63); }
+            inline std::int64_t unzigzag(std::uint64_t v) { return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1); }
+
+
+            inline void put_serials(std::string& out, const std::vector<sqlite3_int64>& serials)
+              {
+                sqlite3_int64 prev = 0;
+                for(sqlite3_int64 s : serials)
+                  {
+                    put_varint(out, zigzag(s - prev));
+                    prev = s;
+                  }
+              }
+
+
+            inline bool get_serials(const unsigned char*& p, const unsigned char* end, size_t n, std::vector<sqlite3_int64>& serials)
+              {
+                serials.resize(n);
+
+                sqlite3_int64 prev = 0;
+                for(size_t i = 0; i < n; ++i)
+                  {
+                    std::uint64_t v;
+                    if(!get_varint(p, end, v)) return false;
+                    prev += unzigzag(v);
+                    serials[i] = prev;
+                  }
+                return true;
+              }
+
+
+            inline std::uint64_t to_bits(double d)
+              {
+                std::uint64_t b;
+                std::memcpy(&b, &d, sizeof(b));
+                return b;
+              }
+
+
+            inline double from_bits(std::uint64_t b)
+              {
+                double d;
+                std::memcpy(&d, &b, sizeof(d));
+                return d;
+              }
+
+
+            inline unsigned int leading_zeros(std::uint64_t x)
+              {
+                unsigned int n = 0;
+                for(std::uint64_t mask = std::uint64_t(1) << 63; mask != 0 && (x & mask) == 0; mask >>= 1) ++n;
+                return n;
+              }
+
+
+            inline unsigned int trailing_zeros(std::uint64_t x)
+              {
+                unsigned int n = 0;
+                for(; n < 64 && (x & 1) == 0; x >>= 1) ++n;
+                return n;
+              }
+
+
+            // predicted bit pattern for the next sample. Linear extrapolation is performed on the bit patterns
+            // rather than the values: for samples of equal sign and exponent the two are monotonically related,
+            // and integer arithmetic is reproducible on every platform, which floating-point arithmetic need not be
+            inline std::uint64_t predict(unsigned char mode, std::uint64_t prev1, std::uint64_t prev2, size_t i)
+              {
+                if(mode == column_linear && i >= 2) return 2*prev1 - prev2;
+                return prev1;
+              }
+
+
+            // encode a series as: the first value verbatim, then for each later value the XOR with its prediction.
+            // A zero XOR costs a single bit. Otherwise the meaningful bits are written either inside the window
+            // of leading and trailing zeros used by the previous value, or with a new window
+            inline void encode_series(const std::vector<double>& series, unsigned char mode, std::string& out)
+              {
+                if(series.empty()) return;
+
+                if(mode == column_raw)
+                  {
+                    for(double v : series)
+                      {
+                        std::uint64_t b = to_bits(v);
+                        for(unsigned int i = 0; i < 8; ++i) out.push_back(static_cast<char>((b >> (56 - 8*i)) & 0xff));
+                      }
+                    return;
+                  }
+
+                bit_writer writer(out);
+
+                std::uint64_t prev1 = to_bits(series.front());
+                std::uint64_t prev2 = prev1;
+                writer.write(prev1, 64);
+
+                bool window = false;
+                unsigned int lead = 0;
+                unsigned int trail = 0;
+
+                for(size_t i = 1; i < series.size(); ++i)
+                  {
+                    std::uint64_t cur = to_bits(series[i]);
+                    std::uint64_t x = cur ^ predict(mode, prev1, prev2, i);
+                    prev2 = prev1;
+                    prev1 = cur;
+
+                    if(x == 0)
+                      {
+                        writer.write(0, 1);
+                        continue;
+                      }
+
+                    writer.write(1, 1);
+
+                    unsigned int l = leading_zeros(x);
+                    unsigned int t = trailing_zeros(x);
+
+                    if(window && l >= lead && t >= trail)
+                      {
+                        writer.write(0, 1);
+                        writer.write(x >> trail, 64 - lead - trail);
+                      }
+                    else
+                      {
+                        window = true;
+                        lead = l;
+                        trail = t;
+
+                        unsigned int significant = 64 - lead - trail;    // 1 <= significant <= 64
+                        writer.write(1, 1);
+                        writer.write(lead, 6);
+                        writer.write(significant - 1, 6);
+                        writer.write(x >> trail, significant);
+                      }
+                  }
+
+                writer.flush();
+              }
+
+
+            inline bool decode_series(const unsigned char* data, size_t size, size_t n, unsigned char mode, std::vector<double>& series)
+              {
+                series.clear();
+                if(n == 0) return true;
+                series.reserve(n);
+
+                if(mode == column_raw)
+                  {
+                    if(size != 8*n) return false;
+                    for(size_t j = 0; j < n; ++j)
+                      {
+                        std::uint64_t b = 0;
+                        for(unsigned int i = 0; i < 8; ++i) b = (b << 8) | data[8*j + i];
+                        series.push_back(from_bits(b));
+                      }
+                    return true;
+                  }
+
+                bit_reader reader(data, size);
+
+                std::uint64_t prev1 = reader.read(64);
+                std::uint64_t prev2 = prev1;
+                series.push_back(from_bits(prev1));
+
+                unsigned int lead = 0;
+                unsigned int trail = 0;
+                bool window = false;
+
+                for(size_t i = 1; i < n && !reader.failed(); ++i)
+                  {
+                    std::uint64_t cur = predict(mode, prev1, prev2, i);
+
+                    if(reader.read(1) != 0)
+                      {
+                        if(reader.read(1) != 0)
+                          {
+                            lead = static_cast<unsigned int>(reader.read(6));
+                            unsigned int significant = static_cast<unsigned int>(reader.read(6)) + 1;
+                            if(lead + significant > 64) return false;
+                            trail = 64 - lead - significant;
+                            window = true;
+                          }
+                        else if(!window) return false;
+
+                        cur ^= reader.read(64 - lead - trail) << trail;
+                      }
+
+                    prev2 = prev1;
+                    prev1 = cur;
+                    series.push_back(from_bits(cur));
+                  }
+
+                return !reader.failed();
+              }
+
+
+            // encode a block; every column in 'block' must either be absent or hold one value per time sample
+            inline std::string encode_block(const value_block& block)
+              {
+                std::string out;
+
+                out.push_back(static_cast<char>(block_version));
+                put_varint(out, block.size());
+                put_varint(out, block.columns.size());
+
+                put_serials(out, block.tserial);
+                put_serials(out, block.unique_id);
+
+                std::string xor_column;
+                std::string linear_column;
+                std::string raw_column;
+                for(size_t c = 0; c < block.columns.size(); ++c)
+                  {
+                    if(!block.present[c])
+                      {
+                        out.push_back(static_cast<char>(column_null));
+                        continue;
+                      }
+
+                    // keep whichever predictor suits this column best
+                    xor_column.clear();
+                    linear_column.clear();
+                    encode_series(block.columns[c], column_xor, xor_column);
+                    encode_series(block.columns[c], column_linear, linear_column);
+
+                    unsigned char mode = linear_column.size() < xor_column.size() ? column_linear : column_xor;
+                    std::string* column = mode == column_linear ? &linear_column : &xor_column;
+
+                    if(column->size() >= 8*block.size())
+                      {
+                        raw_column.clear();
+                        encode_series(block.columns[c], column_raw, raw_column);
+                        mode = column_raw;
+                        column = &raw_column;
+                      }
+
+                    out.push_back(static_cast<char>(mode));
+                    put_varint(out, column->size());
+                    out.append(*column);
+                  }
+
+                return out;
+              }
+
+
+            // decode a block, expanding only the num_cols columns starting at first_col; the others are
+            // skipped without being decoded. Returns false if the block is damaged
+            inline bool decode_block(const unsigned char* data, size_t size, value_block& block,
+                                     unsigned int first_col, unsigned int num_cols)
+              {
+                block.clear();
+
+                const unsigned char* p   = data;
+                const unsigned char* end = data + size;
+
+                if(p >= end || *p++ != block_version) return false;
+
+                std::uint64_t rows;
+                std::uint64_t cols;
+                if(!get_varint(p, end, rows) || !get_varint(p, end, cols)) return false;
+
+                // every serial number occupies at least one byte, which bounds the row count of an intact block
+                if(rows > size) return false;
+
+                if(!get_serials(p, end, rows, block.tserial)) return false;
+                if(!get_serials(p, end, rows, block.unique_id)) return false;
+
+                block.present.assign(cols, false);
+                block.columns.resize(cols);
+
+                for(unsigned int c = 0; c < cols; ++c)
+                  {
+                    if(p >= end) return false;
+                    unsigned char flag = *p++;
+
+                    if(flag == column_null) continue;
+                    if(flag != column_raw && flag != column_xor && flag != column_linear) return false;
+
+                    std::uint64_t length;
+                    if(!get_varint(p, end, length) || length > static_cast<std::uint64_t>(end - p)) return false;
+
+                    block.present[c] = true;
+                    if(c >= first_col && c - first_col < num_cols)
+                      {
+                        if(!decode_series(p, length, rows, flag, block.columns[c])) return false;
+                      }
+
+                    p += length;
+                  }
+
+                return true;
+              }
+
+
+            //! name of the encoded table replacing a value table
+            inline std::string encoded_table(const std::string& table_name)
+              {
+                return table_name + CPPTRANSPORT_SQLITE_ENCODED_SUFFIX;
+              }
+
+
+            //! determine whether a value table has been replaced by an encoded table
+            inline bool is_encoded(sqlite3* db, const std::string& table_name, const std::string& schema="main")
+              {
+                assert(db != nullptr);
+
+                std::ostringstream query;
+                query << "SELECT COUNT(*) FROM " << schema << ".sqlite_master WHERE type='table' AND name='" << encoded_table(table_name) << "';";
+
+                sqlite3_stmt* stmt;
+                check_stmt(db, sqlite3_prepare_v2(db, query.str().c_str(), query.str().length()+1, &stmt, nullptr));
+
+                bool encoded = false;
+                int status = sqlite3_step(stmt);
+                if(status == SQLITE_ROW)
+                  {
+                    encoded = sqlite3_column_int(stmt, 0) > 0;
+                  }
+                else
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL << status << ": " << sqlite3_errmsg(db) << ")";
+                    sqlite3_finalize(stmt);
+                    throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                  }
+
+                check_stmt(db, sqlite3_finalize(stmt));
+
+                return encoded;
+              }
+
+
+            //! read the serial numbers returned by a query, in the order returned
+            inline std::vector<sqlite3_int64> pull_serials(sqlite3* db, const std::string& sql_query, const std::string& error_msg)
+              {
+                assert(db != nullptr);
+
+                sqlite3_stmt* stmt;
+                check_stmt(db, sqlite3_prepare_v2(db, sql_query.c_str(), sql_query.length()+1, &stmt, nullptr));
+
+                std::vector<sqlite3_int64> serials;
+                int status;
+                while((status = sqlite3_step(stmt)) != SQLITE_DONE)
+                  {
+                    if(status == SQLITE_ROW)
+                      {
+                        serials.push_back(sqlite3_column_int64(stmt, 0));
+                      }
+                    else
+                      {
+                        std::ostringstream msg;
+                        msg << error_msg << status << ": " << sqlite3_errmsg(db) << ")";
+                        sqlite3_finalize(stmt);
+                        throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                      }
+                  }
+
+                check_stmt(db, sqlite3_finalize(stmt));
+
+                return serials;
+              }
+
+
+            //! block_reader looks up encoded blocks by (kserial, page), reusing a single prepared statement
+            class block_reader
+              {
+
+                // CONSTRUCTOR, DESTRUCTOR
+
+              public:
+
+                //! constructor prepares lookup statement
+                block_reader(sqlite3* d, const std::string& t, const std::string& schema="main");
+
+                //! destructor finalizes statement
+                ~block_reader();
+
+
+                // INTERFACE
+
+              public:
+
+                //! read and decode the block for (kserial, page), expanding only the requested columns;
+                //! returns false if no block exists
+                bool read(sqlite3_int64 kserial, unsigned int page, value_block& block, unsigned int first_col, unsigned int num_cols);
+
+
+                // INTERNAL DATA
+
+              private:
+
+                //! database connexion
+                sqlite3* db;
+
+                //! name of value table
+                const std::string table_name;
+
+                //! lookup statement
+                sqlite3_stmt* stmt;
+
+              };
+
+
+            inline block_reader::block_reader(sqlite3* d, const std::string& t, const std::string& schema)
+              : db(d),
+                table_name(t),
+                stmt(nullptr)
+              {
+                assert(db != nullptr);
+
+                std::ostringstream query;
+                query << "SELECT block FROM " << schema << "." << encoded_table(table_name) << " WHERE kserial=@kserial AND page=@page;";
+
+                check_stmt(db, sqlite3_prepare_v2(db, query.str().c_str(), query.str().length()+1, &stmt, nullptr), CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL);
+              }
+
+
+            inline block_reader::~block_reader()
+              {
+                if(this->stmt != nullptr) sqlite3_finalize(this->stmt);
+              }
+
+
+            inline bool block_reader::read(sqlite3_int64 kserial, unsigned int page, value_block& block, unsigned int first_col, unsigned int num_cols)
+              {
+                check_stmt(this->db, sqlite3_reset(this->stmt), CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL);
+                check_stmt(this->db, sqlite3_bind_int64(this->stmt, 1, kserial), CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL);
+                check_stmt(this->db, sqlite3_bind_int(this->stmt, 2, page), CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL);
+
+                int status = sqlite3_step(this->stmt);
+                if(status == SQLITE_DONE)
+                  {
+                    block.clear();
+                    return false;
+                  }
+
+                if(status != SQLITE_ROW)
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_CODEC_READ_FAIL << status << ": " << sqlite3_errmsg(this->db) << ")";
+                    throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                  }
+
+                const unsigned char* data = static_cast<const unsigned char*>(sqlite3_column_blob(this->stmt, 0));
+                size_t size = static_cast<size_t>(sqlite3_column_bytes(this->stmt, 0));
+
+                if(!decode_block(data, size, block, first_col, num_cols))
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_CODEC_CORRUPT << " '" << this->table_name << "' (kserial=" << kserial << ", page=" << page << ")";
+                    throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                  }
+
+                return true;
+              }
+
+          }   // namespace codec_impl
+
+      }   // namespace sqlite3_operations
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_DATA_MANAGER_CODEC_H
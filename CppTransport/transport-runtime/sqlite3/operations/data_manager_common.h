@@ -73,6 +73,7 @@ namespace transport
         constexpr auto CPPTRANSPORT_SQLITE_STATS_TABLE                         = "integration_statistics";
         constexpr auto CPPTRANSPORT_SQLITE_ICS_TABLE                           = "horizon_exit_values";
         constexpr auto CPPTRANSPORT_SQLITE_KT_ICS_TABLE                        = "kt_horizon_exit_values";
+        constexpr auto CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE                    = "inflight_checkpoints";
         constexpr auto CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE              = "zeta_twopf";
         constexpr auto CPPTRANSPORT_SQLITE_ZETA_THREEPF_VALUE_TABLE            = "zeta_threepf";
         constexpr auto CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE              = "gauge_xfm1";
@@ -87,6 +88,9 @@ namespace transport
         constexpr auto CPPTRANSPORT_SQLITE_TEMP_FNL_TABLE                      = "fNL_update";
         constexpr auto CPPTRANSPORT_SQLITE_INSERT_FNL_TABLE                    = "fNL_insert";
 
+        constexpr auto CPPTRANSPORT_SQLITE_LAYOUT_TABLE                        = "container_layout";
+        constexpr auto CPPTRANSPORT_SQLITE_ENCODED_SUFFIX                      = "_encoded";
+
         constexpr auto CPPTRANSPORT_SQLITE_TEMPORARY_DBNAME                    = "tempdb";
 
         constexpr auto CPPTRANSPORT_SQLITE_TWOPF_RE_TIME_INDEX                 = "twopf_re_time";
@@ -133,6 +137,45 @@ namespace transport
         constexpr unsigned int max_columns = (CPPTRANSPORT_DEFAULT_SQLITE_MAX_VARIABLE_NUMBER < CPPTRANSPORT_DEFAULT_SQLITE_MAX_COLUMN ? CPPTRANSPORT_DEFAULT_SQLITE_MAX_VARIABLE_NUMBER : CPPTRANSPORT_DEFAULT_SQLITE_MAX_COLUMN) - CPPTRANSPORT_DEFAULT_SQLITE_COLUMN_OVERHEAD;
 
 
+        // columns of the statistics table holding hot-path instrumentation; must match the order in which
+        // they are declared by create_stats_table()
+        constexpr auto CPPTRANSPORT_SQLITE_STATS_PROFILE_COLUMNS = "rhs_evaluations, rhs_setup_time, rhs_u_tensor_time, rhs_transport_time, "
+                                                                   "rhs_median_time, rhs_p99_time, step_median, observer_median_time, observer_p99_time";
+
+
+        // build the select list for the hot-path instrumentation columns.
+        // Containers written before instrumentation was recorded lack these columns, so they are probed for;
+        // if absent they are read as NULL, which read_profile_summary() interprets as 'not instrumented'
+        inline std::string stats_profile_select(sqlite3* db)
+          {
+            if(has_column(db, CPPTRANSPORT_SQLITE_STATS_TABLE, "rhs_evaluations")) return CPPTRANSPORT_SQLITE_STATS_PROFILE_COLUMNS;
+            return "NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL";
+          }
+
+
+        // read a hot-path profile summary from consecutive columns of a result row, starting at column 'first';
+        // if the integration was not instrumented these columns will be NULL
+        inline hot_path::profile_summary read_profile_summary(sqlite3_stmt* stmt, int first)
+          {
+            hot_path::profile_summary profile;
+
+            if(sqlite3_column_type(stmt, first) == SQLITE_NULL) return profile;
+
+            profile.available       = true;
+            profile.evaluations     = static_cast<std::uint64_t>(sqlite3_column_int64(stmt, first));
+            profile.setup           = sqlite3_column_double(stmt, first+1);
+            profile.u_tensor        = sqlite3_column_double(stmt, first+2);
+            profile.transport       = sqlite3_column_double(stmt, first+3);
+            profile.rhs_median      = sqlite3_column_double(stmt, first+4);
+            profile.rhs_p99         = sqlite3_column_double(stmt, first+5);
+            profile.step_median     = sqlite3_column_double(stmt, first+6);
+            profile.observer_median = sqlite3_column_double(stmt, first+7);
+            profile.observer_p99    = sqlite3_column_double(stmt, first+8);
+
+            return profile;
+          }
+
+
         // construct the name of an fNL table
         inline std::string fNL_table_name(derived_data::bispectrum_template type)
           {
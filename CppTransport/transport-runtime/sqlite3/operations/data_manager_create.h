@@ -183,7 +183,7 @@ namespace transport
 
 
 		    // Create table documenting workers
-		    void create_worker_info_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
+		    inline void create_worker_info_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
 			    {
 		        std::ostringstream create_stmt;
 		        create_stmt
@@ -203,7 +203,8 @@ namespace transport
 			        << "os_release    TEXT, "
 			        << "architecture  TEXT, "
               << "cpu_brand     TEXT, "
-			        << "cpu_vendor_id TEXT";
+			        << "cpu_vendor_id TEXT, "
+              << "kernel_variant TEXT";
 
             // create composite primary key based on workgroup and worker ids.
             // composite keys are slow, but there will be few entries in this table so it's unlikely
@@ -217,7 +218,7 @@ namespace transport
 
 
 		    // Create table for statistics, if they are being collected
-		    void create_stats_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys, kconfiguration_type type= kconfiguration_type::twopf_configs)
+		    inline void create_stats_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys, kconfiguration_type type= kconfiguration_type::twopf_configs)
 			    {
 		        std::ostringstream create_stmt;
 		        create_stmt
@@ -228,7 +229,16 @@ namespace transport
 			        << "steps             INTEGER, "
 			        << "refinements       INTEGER, "
 			        << "workgroup         INTEGER, "
-			        << "worker            INTEGER";
+			        << "worker            INTEGER, "
+			        << "rhs_evaluations      INTEGER, "
+			        << "rhs_setup_time       DOUBLE, "
+			        << "rhs_u_tensor_time    DOUBLE, "
+			        << "rhs_transport_time   DOUBLE, "
+			        << "rhs_median_time      DOUBLE, "
+			        << "rhs_p99_time         DOUBLE, "
+			        << "step_median          DOUBLE, "
+			        << "observer_median_time DOUBLE, "
+			        << "observer_p99_time    DOUBLE";
 
 		        if(keys == foreign_keys_type::foreign_keys)
 			        {
@@ -257,6 +267,29 @@ namespace transport
 			    }
 
 
+        // Create table for checkpoints of in-flight configurations.
+        // Temporary containers hold a row for each configuration which is in flight; rows are removed once a configuration
+        // completes, so they persist only if a worker is interrupted part-way through an integration.
+        // Each row carries the complete observed history packed into BLOBs, and is replaced whenever a new checkpoint is taken.
+        // The same table is used to carry checkpoints through recovery and into a seeded integration, so it may already exist
+        inline void create_checkpoint_table(transaction_manager& mgr, sqlite3* db)
+          {
+            std::ostringstream create_stmt;
+            create_stmt
+              << "CREATE TABLE IF NOT EXISTS " << CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE << "("
+              << "kserial    INTEGER PRIMARY KEY, "
+              << "refinement INTEGER, "
+              << "step       DOUBLE, "
+              << "samples    INTEGER, "
+              << "positions  BLOB, "
+              << "times      BLOB, "
+              << "states     BLOB"
+              << ");";
+
+            exec(db, create_stmt.str());
+          }
+
+
 		    // Create table for initial conditions, if they are being collected
 				template <typename number, typename ValueType>
 		    void create_ics_table(transaction_manager& mgr, sqlite3* db, unsigned int Nfields,
@@ -386,7 +419,7 @@ namespace transport
 
 
 		    // Create table for zeta twopf values
-		    void create_zeta_twopf_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
+		    inline void create_zeta_twopf_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
 			    {
 		        std::ostringstream create_stmt;
 		        create_stmt
@@ -412,7 +445,7 @@ namespace transport
 
 
 		    // Create table for zeta threepf values
-		    void create_zeta_threepf_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
+		    inline void create_zeta_threepf_table(transaction_manager& mgr, sqlite3* db, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
 			    {
 		        std::ostringstream create_stmt;
 		        create_stmt
@@ -439,7 +472,7 @@ namespace transport
 
 
 		    // Create table for fNL values
-		    void create_fNL_table(transaction_manager& mgr, sqlite3* db, derived_data::bispectrum_template type, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
+		    inline void create_fNL_table(transaction_manager& mgr, sqlite3* db, derived_data::bispectrum_template type, foreign_keys_type keys=foreign_keys_type::no_foreign_keys)
 			    {
 		        std::ostringstream create_stmt;
 		        create_stmt
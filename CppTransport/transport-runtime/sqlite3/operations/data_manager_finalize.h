@@ -27,7 +27,13 @@
 #define CPPTRANSPORT_DATA_MANAGER_FINALIZE_H
 
 
+#include <vector>
+#include <algorithm>
+
 #include "transport-runtime/sqlite3/operations/data_manager_common.h"
+#include "transport-runtime/sqlite3/operations/data_manager_codec.h"
+
+#include "transport-runtime/manager/argument_cache.h"
 
 
 namespace transport
@@ -39,7 +45,95 @@ namespace transport
         namespace finalize_impl
           {
 
-            void create_tserial_index(transaction_manager& mgr, sqlite3* db, const std::string index_name, const std::string table_name)
+            //! list of (name, declared type) pairs describing the columns of a table, in declaration order
+            typedef std::vector< std::pair<std::string, std::string> > column_list;
+
+
+            inline column_list get_columns(sqlite3* db, const std::string& table_name)
+              {
+                assert(db != nullptr);
+
+                std::ostringstream query;
+                query << "PRAGMA table_info(" << table_name << ");";
+
+                sqlite3_stmt* stmt;
+                check_stmt(db, sqlite3_prepare_v2(db, query.str().c_str(), query.str().length()+1, &stmt, nullptr));
+
+                column_list columns;
+                int status;
+                while((status = sqlite3_step(stmt)) != SQLITE_DONE)
+                  {
+                    if(status == SQLITE_ROW)
+                      {
+                        const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+                        const char* type = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
+                        columns.emplace_back(std::string(name != nullptr ? name : ""), std::string(type != nullptr ? type : ""));
+                      }
+                    else
+                      {
+                        std::ostringstream msg;
+                        msg << CPPTRANSPORT_DATAMGR_LAYOUT_READ_FAIL << status << ": " << sqlite3_errmsg(db) << ") [" << __func__ << "]";
+                        sqlite3_finalize(stmt);
+                        throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                      }
+                  }
+
+                check_stmt(db, sqlite3_finalize(stmt));
+
+                return columns;
+              }
+
+
+            //! list of column names making up an index or primary key
+            typedef std::vector<std::string> key_list;
+
+
+            inline std::string join(const key_list& key, const std::string& separator=", ")
+              {
+                std::ostringstream out;
+                for(unsigned int i = 0; i < key.size(); ++i)
+                  {
+                    out << (i > 0 ? separator : "") << key[i];
+                  }
+                return out.str();
+              }
+
+
+            inline bool has_column(const column_list& columns, const std::string& name)
+              {
+                return std::find_if(columns.begin(), columns.end(),
+                                    [&](const column_list::value_type& c) -> bool { return c.first == name; }) != columns.end();
+              }
+
+
+            inline unsigned int count(sqlite3* db, const std::string& sql_query)
+              {
+                assert(db != nullptr);
+
+                sqlite3_stmt* stmt;
+                check_stmt(db, sqlite3_prepare_v2(db, sql_query.c_str(), sql_query.length()+1, &stmt, nullptr));
+
+                unsigned int result = 0;
+                int status = sqlite3_step(stmt);
+                if(status == SQLITE_ROW)
+                  {
+                    result = static_cast<unsigned int>(sqlite3_column_int(stmt, 0));
+                  }
+                else
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_LAYOUT_READ_FAIL << status << ": " << sqlite3_errmsg(db) << ") [" << __func__ << "]";
+                    sqlite3_finalize(stmt);
+                    throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                  }
+
+                check_stmt(db, sqlite3_finalize(stmt));
+
+                return result;
+              }
+
+
+            inline void create_tserial_index(transaction_manager& mgr, sqlite3* db, const std::string index_name, const std::string table_name)
               {
                 assert(db != nullptr);
 
@@ -49,7 +143,7 @@ namespace transport
               }
 
 
-            void create_kserial_index(transaction_manager& mgr, sqlite3* db, const std::string index_name, const std::string table_name)
+            inline void create_kserial_index(transaction_manager& mgr, sqlite3* db, const std::string index_name, const std::string table_name)
               {
                 assert(db != nullptr);
 
@@ -59,94 +153,358 @@ namespace transport
               }
 
 
-            void analyze(transaction_manager& mgr, sqlite3* db)
+            inline void create_composite_index(transaction_manager& mgr, sqlite3* db, const std::string index_name, const std::string table_name,
+                                        const key_list& key)
               {
                 assert(db != nullptr);
 
-                exec(db, "ANALYZE;");
+                std::ostringstream create_index_stmt;
+                create_index_stmt << "CREATE INDEX " << index_name << " ON " << table_name << "(" << join(key) << ");";
+                exec(db, create_index_stmt.str());
               }
 
-          }
 
+            // a table can be clustered on 'key' only if no part of the key is NULL, and no two rows share a key;
+            // neither should happen for a completed container, but we check rather than fail the finalization
+            inline bool can_cluster(sqlite3* db, const std::string& table_name, const key_list& key)
+              {
+                std::ostringstream null_query;
+                null_query << "SELECT COUNT(*) FROM " << table_name << " WHERE " << join(key, " IS NULL OR ") << " IS NULL;";
+                if(count(db, null_query.str()) > 0) return false;
 
-        void finalize_twopf_writer(transaction_manager& mgr, sqlite3* db)
-          {
-            assert(db != nullptr);
+                std::ostringstream duplicate_query;
+                duplicate_query << "SELECT COUNT(*) FROM (SELECT 1 FROM " << table_name << " GROUP BY " << join(key) << " HAVING COUNT(*) > 1);";
+                return count(db, duplicate_query.str()) == 0;
+              }
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_RE_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_RE_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
+            // rewrite a table as a WITHOUT ROWID table whose primary key is 'key', so that rows sharing
+            // a leading key prefix are stored contiguously.
+            // Column order is preserved so that 'SELECT *' against the table is unaffected, but any
+            // PRIMARY KEY or FOREIGN KEY constraints are dropped; the finalized container is read-only
+            inline void cluster_table(transaction_manager& mgr, sqlite3* db, const std::string& table_name, const column_list& columns,
+                               const key_list& key)
+              {
+                assert(db != nullptr);
 
-            finalize_impl::analyze(mgr, db);
-          }
+                std::string clustered_name = table_name + "_clustered";
+
+                key_list names;
+                std::ostringstream create_stmt;
+                create_stmt << "CREATE TABLE " << clustered_name << "(";
+                for(unsigned int i = 0; i < columns.size(); ++i)
+                  {
+                    create_stmt << (i > 0 ? ", " : "") << columns[i].first << " " << columns[i].second;
+                    names.push_back(columns[i].first);
+                  }
+                create_stmt << ", PRIMARY KEY(" << join(key) << ")) WITHOUT ROWID;";
+                exec(db, create_stmt.str());
+
+                std::ostringstream copy_stmt;
+                copy_stmt << "INSERT INTO " << clustered_name << "(" << join(names) << ")"
+                          << " SELECT " << join(names) << " FROM " << table_name
+                          << " ORDER BY " << join(key) << ";";
+                exec(db, copy_stmt.str());
+
+                std::ostringstream drop_stmt;
+                drop_stmt << "DROP TABLE " << table_name << ";";
+                exec(db, drop_stmt.str());
+
+                std::ostringstream rename_stmt;
+                rename_stmt << "ALTER TABLE " << clustered_name << " RENAME TO " << table_name << ";";
+                exec(db, rename_stmt.str());
+              }
 
 
-        void finalize_threepf_writer(transaction_manager& mgr, sqlite3* db)
-          {
-            assert(db != nullptr);
+            inline std::string layout_name(container_layout layout)
+              {
+                switch(layout)
+                  {
+                    case container_layout::indexed: return "indexed";
+                    case container_layout::composite: return "composite";
+                    case container_layout::clustered: return "clustered";
+                  }
+
+                return "unknown";
+              }
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_RE_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_RE_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_IM_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_IM_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_TWOPF_IM_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_IM_VALUE_TABLE);
+            // record the layout applied to a value table, so that it can be identified later
+            inline void record_layout(transaction_manager& mgr, sqlite3* db, const std::string& table_name, const std::string& layout)
+              {
+                assert(db != nullptr);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
+                std::ostringstream create_stmt;
+                create_stmt << "CREATE TABLE IF NOT EXISTS " << CPPTRANSPORT_SQLITE_LAYOUT_TABLE << "("
+                            << "value_table TEXT PRIMARY KEY, "
+                            << "layout      TEXT"
+                            << ");";
+                exec(db, create_stmt.str());
+
+                std::ostringstream insert_stmt;
+                insert_stmt << "INSERT OR REPLACE INTO " << CPPTRANSPORT_SQLITE_LAYOUT_TABLE << " VALUES ('"
+                            << table_name << "', '" << layout << "');";
+                exec(db, insert_stmt.str());
+              }
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_TIME_INDEX, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_K_INDEX, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_VALUE_TABLE);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_THREEPF_DERIV_TIME_INDEX, CPPTRANSPORT_SQLITE_THREEPF_DERIV_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_THREEPF_DERIV_K_INDEX, CPPTRANSPORT_SQLITE_THREEPF_DERIV_VALUE_TABLE);
+            // store a completed block in the encoded table
+            inline void write_block(sqlite3* db, sqlite3_stmt* stmt, sqlite3_int64 kserial, int page, const codec_impl::value_block& block)
+              {
+                std::string data = codec_impl::encode_block(block);
+
+                check_stmt(db, sqlite3_bind_int64(stmt, 1, kserial), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+                check_stmt(db, sqlite3_bind_int(stmt, 2, page), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+                check_stmt(db, sqlite3_bind_blob(stmt, 3, data.data(), static_cast<int>(data.size()), SQLITE_TRANSIENT), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+
+                check_stmt(db, sqlite3_step(stmt), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL, SQLITE_DONE);
+                check_stmt(db, sqlite3_clear_bindings(stmt), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+                check_stmt(db, sqlite3_reset(stmt), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+              }
+
+
+            // replace a paged value table by an encoded table holding one block per (kserial, page).
+            // A column must be either NULL throughout a block (the unused tail of a short final page) or hold
+            // a value for every sample; if not, the encoded table is discarded, the value table is left in place,
+            // and the return value is false
+            inline bool encode_value_table(transaction_manager& mgr, sqlite3* db, const std::string& table_name, const column_list& columns)
+              {
+                assert(db != nullptr);
+
+                key_list values;
+                for(const column_list::value_type& c : columns)
+                  {
+                    if(c.first.compare(0, 3, "ele") == 0) values.push_back(c.first);
+                  }
+
+                std::string encoded_name = codec_impl::encoded_table(table_name);
+
+                std::ostringstream create_stmt;
+                create_stmt << "CREATE TABLE " << encoded_name << "("
+                            << "kserial INTEGER, "
+                            << "page    INTEGER, "
+                            << "block   BLOB, "
+                            << "PRIMARY KEY(kserial, page)"
+                            << ");";
+                exec(db, create_stmt.str());
+
+                std::ostringstream insert_stmt;
+                insert_stmt << "INSERT INTO " << encoded_name << " VALUES (@kserial, @page, @block);";
+
+                std::ostringstream read_stmt;
+                read_stmt << "SELECT unique_id, tserial, kserial, page";
+                for(const std::string& v : values)
+                  {
+                    read_stmt << ", " << v;
+                  }
+                read_stmt << " FROM " << table_name << " ORDER BY kserial, page, tserial;";
+
+                sqlite3_stmt* insert;
+                check_stmt(db, sqlite3_prepare_v2(db, insert_stmt.str().c_str(), insert_stmt.str().length()+1, &insert, nullptr), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+
+                sqlite3_stmt* read;
+                check_stmt(db, sqlite3_prepare_v2(db, read_stmt.str().c_str(), read_stmt.str().length()+1, &read, nullptr), CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL);
+
+                codec_impl::value_block block;
+                std::vector<bool> has_null;
+                sqlite3_int64 kserial = 0;
+                int page = 0;
+                bool consistent = true;
+
+                auto flush = [&]() -> bool
+                  {
+                    if(block.size() == 0) return true;
+
+                    for(size_t c = 0; c < values.size(); ++c)
+                      {
+                        // a column with some values and some NULLs can't be represented
+                        if(block.present[c] && has_null[c]) return false;
+                        if(!block.present[c]) block.columns[c].clear();
+                      }
+
+                    write_block(db, insert, kserial, page, block);
+                    return true;
+                  };
+
+                int status = SQLITE_DONE;
+                while((status = sqlite3_step(read)) == SQLITE_ROW)
+                  {
+                    sqlite3_int64 k = sqlite3_column_int64(read, 2);
+                    int p = sqlite3_column_int(read, 3);
+
+                    if(block.size() == 0 || k != kserial || p != page)
+                      {
+                        if(!flush()) { consistent = false; break; }
+
+                        block.clear();
+                        block.present.assign(values.size(), false);
+                        block.columns.resize(values.size());
+                        has_null.assign(values.size(), false);
+                        kserial = k;
+                        page = p;
+                      }
+
+                    block.unique_id.push_back(sqlite3_column_int64(read, 0));
+                    block.tserial.push_back(sqlite3_column_int64(read, 1));
+
+                    for(size_t c = 0; c < values.size(); ++c)
+                      {
+                        int index = static_cast<int>(c) + 4;
+                        if(sqlite3_column_type(read, index) == SQLITE_NULL)
+                          {
+                            has_null[c] = true;
+                            block.columns[c].push_back(0.0);
+                          }
+                        else
+                          {
+                            block.present[c] = true;
+                            block.columns[c].push_back(sqlite3_column_double(read, index));
+                          }
+                      }
+                  }
+
+                if(consistent)
+                  {
+                    if(status != SQLITE_DONE)
+                      {
+                        std::ostringstream msg;
+                        msg << CPPTRANSPORT_DATAMGR_CODEC_WRITE_FAIL << status << ": " << sqlite3_errmsg(db) << ") [" << __func__ << "]";
+                        sqlite3_finalize(read);
+                        sqlite3_finalize(insert);
+                        throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                      }
+
+                    consistent = flush();
+                  }
+
+                check_stmt(db, sqlite3_finalize(read));
+                check_stmt(db, sqlite3_finalize(insert));
+
+                std::ostringstream drop_stmt;
+                drop_stmt << "DROP TABLE " << (consistent ? table_name : encoded_name) << ";";
+                exec(db, drop_stmt.str());
+
+                return consistent;
+              }
+
+
+            // index a value table according to the requested layout.
+            // Derived-content pulls filter on (kserial, page) and join on tserial, or filter on (tserial, page) and join
+            // on kserial; the composite and clustered layouts serve both access paths directly from an index,
+            // rather than scanning the rows matching a single serial number and sorting them
+            inline void index_value_table(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec,
+                                   const std::string time_index, const std::string k_index, const std::string table_name)
+              {
+                assert(db != nullptr);
+
+                column_list columns = get_columns(db, table_name);
+                bool paged = has_column(columns, "page");
+
+                key_list k_key    = paged ? key_list{ "kserial", "page", "tserial" } : key_list{ "kserial", "tserial" };
+                key_list time_key = paged ? key_list{ "tserial", "page", "kserial" } : key_list{ "tserial", "kserial" };
+
+                // encoded tables are looked up by their (kserial, page) primary key, so need no further indexing.
+                // Unpaged tables hold a single value per row and are left as they are
+                if(codec == storage_codec::xor_delta && paged && can_cluster(db, table_name, k_key)
+                   && encode_value_table(mgr, db, table_name, columns))
+                  {
+                    record_layout(mgr, db, table_name, "encoded");
+                    return;
+                  }
+
+                if(layout == container_layout::clustered && !can_cluster(db, table_name, k_key)) layout = container_layout::composite;
+
+                switch(layout)
+                  {
+                    case container_layout::indexed:
+                      {
+                        create_tserial_index(mgr, db, time_index, table_name);
+                        create_kserial_index(mgr, db, k_index, table_name);
+                        break;
+                      }
+
+                    case container_layout::composite:
+                      {
+                        create_composite_index(mgr, db, time_index, table_name, time_key);
+                        create_composite_index(mgr, db, k_index, table_name, k_key);
+                        break;
+                      }
+
+                    case container_layout::clustered:
+                      {
+                        // the primary key serves lookups by kserial, so only a secondary index on tserial is needed
+                        cluster_table(mgr, db, table_name, columns, k_key);
+                        create_composite_index(mgr, db, time_index, table_name, time_key);
+                        break;
+                      }
+                  }
+
+                record_layout(mgr, db, table_name, layout_name(layout));
+              }
+
+
+            inline void analyze(transaction_manager& mgr, sqlite3* db)
+              {
+                assert(db != nullptr);
+
+                exec(db, "ANALYZE;");
+              }
 
-            finalize_impl::analyze(mgr, db);
           }
 
 
-        void finalize_zeta_twopf_writer(transaction_manager& mgr, sqlite3* db)
+        inline void finalize_twopf_writer(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec)
           {
             assert(db != nullptr);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
-
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM1_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM1_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_TWOPF_RE_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
 
             finalize_impl::analyze(mgr, db);
           }
 
 
-        void finalize_zeta_threepf_writer(transaction_manager& mgr, sqlite3* db)
+        inline void finalize_threepf_writer(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec)
           {
             assert(db != nullptr);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_TWOPF_RE_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_RE_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_TWOPF_IM_TIME_INDEX, CPPTRANSPORT_SQLITE_TWOPF_IM_K_INDEX, CPPTRANSPORT_SQLITE_TWOPF_IM_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_TENSOR_TWOPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_TIME_INDEX, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_K_INDEX, CPPTRANSPORT_SQLITE_THREEPF_MOMENTUM_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_THREEPF_DERIV_TIME_INDEX, CPPTRANSPORT_SQLITE_THREEPF_DERIV_K_INDEX, CPPTRANSPORT_SQLITE_THREEPF_DERIV_VALUE_TABLE);
+
+            finalize_impl::analyze(mgr, db);
+          }
+
+
+        inline void finalize_zeta_twopf_writer(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec)
+          {
+            assert(db != nullptr);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_THREEPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_THREEPF_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_ZETA_THREEPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_THREEPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_ZETA_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_GAUGE_XFM1_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM1_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM1_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
+            finalize_impl::analyze(mgr, db);
+          }
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_VALUE_TABLE);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_VALUE_TABLE);
+        inline void finalize_zeta_threepf_writer(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec)
+          {
+            assert(db != nullptr);
 
-            finalize_impl::create_tserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_VALUE_TABLE);
-            finalize_impl::create_kserial_index(mgr, db, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_ZETA_TWOPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_TWOPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_ZETA_THREEPF_TIME_INDEX, CPPTRANSPORT_SQLITE_ZETA_THREEPF_K_INDEX, CPPTRANSPORT_SQLITE_ZETA_THREEPF_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_GAUGE_XFM1_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM1_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_123_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_213_VALUE_TABLE);
+            finalize_impl::index_value_table(mgr, db, layout, codec, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_TIME_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_K_INDEX, CPPTRANSPORT_SQLITE_GAUGE_XFM2_312_VALUE_TABLE);
 
             finalize_impl::analyze(mgr, db);
           }
 
 
-        void finalize_fNL_writer(transaction_manager& mgr, sqlite3* db)
+        inline void finalize_fNL_writer(transaction_manager& mgr, sqlite3* db, container_layout layout, storage_codec codec)
           {
             assert(db != nullptr);
 
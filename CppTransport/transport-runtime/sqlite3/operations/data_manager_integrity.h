@@ -41,7 +41,7 @@ namespace transport
         namespace integrity_detail
 	        {
 
-            std::set<unsigned int> get_serials(sqlite3* db, std::string sql_query)
+            inline std::set<unsigned int> get_serials(sqlite3* db, std::string sql_query)
 	            {
                 sqlite3_stmt* stmt;
                 check_stmt(db, sqlite3_prepare_v2(db, sql_query.c_str(), sql_query.length() + 1, &stmt, nullptr));
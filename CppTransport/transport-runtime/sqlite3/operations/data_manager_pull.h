@@ -30,6 +30,7 @@
 
 #include "transport-runtime/sqlite3/operations/data_manager_common.h"
 #include "transport-runtime/sqlite3/operations/data_traits.h"
+#include "transport-runtime/sqlite3/operations/data_manager_codec.h"
 #include "transport-runtime/derived-products/derived-content/SQL_query/SQL_query.h"
 
 
@@ -69,11 +70,120 @@ namespace transport
 				        check_stmt(db, sqlite3_finalize(stmt));
 					    }
 
+
+				    // read every column of a multi-column result set in a single pass; column c of each row is
+				    // appended to sample[c], so sample should be sized to the number of columns before calling
+				    template <typename TargetType>
+				    void pull_number_page(sqlite3* db, std::vector< std::vector<TargetType> >& sample, std::string sql_query, std::string error_msg)
+					    {
+				        sqlite3_stmt* stmt;
+				        check_stmt(db, sqlite3_prepare_v2(db, sql_query.c_str(), sql_query.length()+1, &stmt, nullptr));
+
+				        int status;
+				        while((status = sqlite3_step(stmt)) != SQLITE_DONE)
+					        {
+				            if(status == SQLITE_ROW)
+					            {
+				                for(unsigned int c = 0; c < sample.size(); ++c)
+					                {
+				                    sample[c].push_back(static_cast<TargetType>(sqlite3_column_double(stmt, c)));
+					                }
+					            }
+				            else
+					            {
+				                std::ostringstream msg;
+				                msg << error_msg << status << ": " << sqlite3_errmsg(db) << ")";
+				                sqlite3_finalize(stmt);
+				                throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+					            }
+					        }
+
+				        check_stmt(db, sqlite3_finalize(stmt));
+					    }
+
+
+				    // compute the extent of the page holding element 'id': on exit first_id is the first element stored in
+				    // the page, and the return value is the number of live columns it holds (the final page may be short)
+				    inline unsigned int page_extent(unsigned int id, unsigned int num_elements, unsigned int num_cols, unsigned int& page, unsigned int& first_id)
+					    {
+				        page     = id / num_cols;
+				        first_id = page * num_cols;
+				        return(std::min(num_cols, num_elements - first_id));
+					    }
+
+
+				    // pull columns [first_col, first_col+live) of a page from an encoded table, for a fixed k-configuration.
+				    // Samples are matched to the serial numbers returned by tquery, in the same way as the INNER JOIN
+				    // used for unencoded tables
+				    template <typename number>
+				    void pull_encoded_time_page(sqlite3* db, const std::string& table_name, const std::string& tquery,
+				                                unsigned int k_serial, unsigned int page, unsigned int first_col, unsigned int live,
+				                                std::vector< std::vector<number> >& sample)
+					    {
+				        std::ostringstream serial_stmt;
+				        serial_stmt << "SELECT _tsample.serial FROM (" << tquery << ") _tsample ORDER BY _tsample.serial;";
+				        std::vector<sqlite3_int64> serials = codec_impl::pull_serials(db, serial_stmt.str(), CPPTRANSPORT_DATAMGR_TIME_SERIAL_READ_FAIL);
+
+				        sample.clear();
+				        sample.resize(live);
+
+				        codec_impl::block_reader reader(db, table_name);
+				        codec_impl::value_block block;
+				        if(!reader.read(k_serial, page, block, first_col, live)) return;
+
+				        // both lists are in ascending order of tserial
+				        size_t j = 0;
+				        for(sqlite3_int64 serial : serials)
+					        {
+				            while(j < block.size() && block.tserial[j] < serial) ++j;
+				            if(j == block.size()) break;
+				            if(block.tserial[j] != serial) continue;
+
+				            for(unsigned int c = 0; c < live; ++c)
+					            {
+				                // NULL columns read as zero, as they would from an unencoded table
+				                sample[c].push_back(block.present[first_col+c] ? static_cast<number>(block.columns[first_col+c][j]) : number(0));
+					            }
+					        }
+					    }
+
+
+				    // pull columns [first_col, first_col+live) of a page from an encoded table, for a fixed time serial number.
+				    // Each k-configuration is stored in its own block, so this decodes one block per configuration
+				    template <typename number>
+				    void pull_encoded_kconfig_page(sqlite3* db, const std::string& table_name, const std::string& kquery,
+				                                   unsigned int t_serial, unsigned int page, unsigned int first_col, unsigned int live,
+				                                   std::vector< std::vector<number> >& sample)
+					    {
+				        std::ostringstream serial_stmt;
+				        serial_stmt << "SELECT _ksample.serial FROM (" << kquery << ") _ksample ORDER BY _ksample.serial;";
+				        std::vector<sqlite3_int64> serials = codec_impl::pull_serials(db, serial_stmt.str(), CPPTRANSPORT_DATAMGR_KCONFIG_SERIAL_READ_FAIL);
+
+				        sample.clear();
+				        sample.resize(live);
+
+				        codec_impl::block_reader reader(db, table_name);
+				        codec_impl::value_block block;
+				        for(sqlite3_int64 serial : serials)
+					        {
+				            if(!reader.read(serial, page, block, first_col, live)) continue;
+
+				            auto t = std::lower_bound(block.tserial.begin(), block.tserial.end(), static_cast<sqlite3_int64>(t_serial));
+				            if(t == block.tserial.end() || *t != static_cast<sqlite3_int64>(t_serial)) continue;
+
+				            size_t j = static_cast<size_t>(t - block.tserial.begin());
+				            for(unsigned int c = 0; c < live; ++c)
+					            {
+				                sample[c].push_back(block.present[first_col+c] ? static_cast<number>(block.columns[first_col+c][j]) : number(0));
+					            }
+					        }
+					    }
+
 			    }
 
 
         // Pull a set of time sample points, identified by their serial numbers
-        void pull_time_config_sample(sqlite3* db, const derived_data::SQL_time_query& query,
+        inline void pull_time_config_sample(sqlite3* db, const derived_data::SQL_time_query& query,
                                      std::vector<time_config>& sample, unsigned int worker)
           {
             assert(db != nullptr);
@@ -267,7 +377,7 @@ namespace transport
 
 
         // Pull k-configuration statistics data for a set of k-configuration serial numbers
-        void pull_k_statistics_sample(sqlite3* db, const derived_data::SQL_query& query,
+        inline void pull_k_statistics_sample(sqlite3* db, const derived_data::SQL_query& query,
                                       std::vector<kconfiguration_statistics>& data, unsigned int worker)
 	        {
             assert(db != nullptr);
@@ -291,7 +401,8 @@ namespace transport
 	            << " workers.backend AS backend,"
 	            << " workers.back_stepper AS back_stepper,"
 	            << " workers.pert_stepper AS pert_stepper,"
-	            << " workers.hostname AS hostname"
+	            << " workers.hostname AS hostname,"
+	            << " " << stats_profile_select(db)
 	            << " FROM (SELECT * FROM " << CPPTRANSPORT_SQLITE_STATS_TABLE
 	            << " INNER JOIN (" << query.make_query(policy, true) << ") tpf"
 	            << " ON " << CPPTRANSPORT_SQLITE_STATS_TABLE << ".kserial=tpf.serial) temp"
@@ -322,6 +433,7 @@ namespace transport
                     value.background_stepper   = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 8)),  static_cast<unsigned int>(sqlite3_column_bytes(stmt, 8)));
                     value.perturbation_stepper = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 9)),  static_cast<unsigned int>(sqlite3_column_bytes(stmt, 9)));
                     value.hostname             = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 10)), static_cast<unsigned int>(sqlite3_column_bytes(stmt, 10)));
+                    value.profile              = read_profile_summary(stmt, 11);
 
                     data.push_back(value);
 	                }
@@ -390,6 +502,14 @@ namespace transport
 
 		        std::string table_name = data_traits<number, ValueType>::sqlite_table();
 
+		        if(codec_impl::is_encoded(db, table_name))
+			        {
+		            std::vector< std::vector<number> > page_sample;
+		            pull_implementation::pull_encoded_time_page(db, table_name, tquery.make_query(policy, true), k_serial, page, col, 1, page_sample);
+		            sample.swap(page_sample.front());
+		            return;
+			        }
+
 				    // construct SQL query to pull relevant data
 		        std::stringstream select_stmt;
 		        select_stmt
@@ -427,6 +547,14 @@ namespace transport
 
             std::string table_name = data_traits<number, ValueType>::sqlite_table();
 
+            if(codec_impl::is_encoded(db, table_name))
+              {
+                std::vector< std::vector<number> > page_sample;
+                pull_implementation::pull_encoded_kconfig_page(db, table_name, kquery.make_query(policy, true), t_serial, page, col, 1, page_sample);
+                sample.swap(page_sample.front());
+                return;
+              }
+
             // construct SQL query to pull relevant data
             std::stringstream select_stmt;
             select_stmt
@@ -445,6 +573,106 @@ namespace transport
 	        }
 
 
+		    // Pull every component stored in the same page as element 'id', for a fixed k-configuration, using a single query.
+		    // On exit sample[i] holds the time series for element first_id+i
+		    template <typename number, typename ValueType>
+		    void pull_paged_time_page(sqlite3* db, unsigned int id, const derived_data::SQL_query& tquery,
+		                              unsigned int k_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+		                              unsigned int worker, unsigned int Nfields)
+			    {
+		        assert(db != nullptr);
+
+		        derived_data::SQL_policy policy(CPPTRANSPORT_SQLITE_TIME_SAMPLE_TABLE, "serial",
+		                                        CPPTRANSPORT_SQLITE_TWOPF_SAMPLE_TABLE, "serial",
+		                                        CPPTRANSPORT_SQLITE_THREEPF_SAMPLE_TABLE, "serial",
+		                                        "wavenumber1", "wavenumber2", "wavenumber3");
+
+		        unsigned int num_elements = data_traits<number, ValueType>::number_elements(Nfields);
+
+		        unsigned int num_cols = std::min(num_elements, max_columns);
+		        unsigned int page = 0;
+		        unsigned int live = pull_implementation::page_extent(id, num_elements, num_cols, page, first_id);
+
+		        std::string table_name = data_traits<number, ValueType>::sqlite_table();
+
+		        if(codec_impl::is_encoded(db, table_name))
+			        {
+		            pull_implementation::pull_encoded_time_page(db, table_name, tquery.make_query(policy, true), k_serial, page, 0, live, sample);
+		            return;
+			        }
+
+		        // construct SQL query to pull all live columns of the page
+		        std::stringstream select_stmt;
+		        select_stmt << "SELECT";
+		        for(unsigned int c = 0; c < live; ++c)
+			        {
+		            select_stmt << (c > 0 ? "," : "") << " _subsample.ele" << c;
+			        }
+		        select_stmt
+			        << " FROM"
+			        << " (SELECT * FROM " << table_name
+			        << " WHERE " << table_name << ".kserial=" << k_serial << " AND " << table_name << ".page=" << page
+			        << ") _subsample"
+			        << " INNER JOIN (" << tquery.make_query(policy, true) << ") _tsample"
+			        << " ON _subsample.tserial=_tsample.serial"
+			        << " ORDER BY _tsample.serial;";
+
+		        sample.clear();
+		        sample.resize(live);
+		        pull_implementation::pull_number_page(db, sample, select_stmt.str(), CPPTRANSPORT_DATAMGR_TIME_SERIAL_READ_FAIL);
+			    }
+
+
+		    // Pull every component stored in the same page as element 'id', for a fixed time serial number, using a single query.
+		    // On exit sample[i] holds the k-configuration series for element first_id+i
+		    template <typename number, typename ValueType>
+		    void pull_paged_kconfig_page(sqlite3* db, unsigned int id, const derived_data::SQL_query& kquery,
+		                                 unsigned int t_serial, std::vector< std::vector<number> >& sample, unsigned int& first_id,
+		                                 unsigned int worker, unsigned int Nfields)
+			    {
+		        assert(db != nullptr);
+
+		        derived_data::SQL_policy policy(CPPTRANSPORT_SQLITE_TIME_SAMPLE_TABLE, "serial",
+		                                        CPPTRANSPORT_SQLITE_TWOPF_SAMPLE_TABLE, "serial",
+		                                        CPPTRANSPORT_SQLITE_THREEPF_SAMPLE_TABLE, "serial",
+		                                        "wavenumber1", "wavenumber2", "wavenumber3");
+
+		        unsigned int num_elements = data_traits<number, ValueType>::number_elements(Nfields);
+
+		        unsigned int num_cols = std::min(num_elements, max_columns);
+		        unsigned int page = 0;
+		        unsigned int live = pull_implementation::page_extent(id, num_elements, num_cols, page, first_id);
+
+		        std::string table_name = data_traits<number, ValueType>::sqlite_table();
+
+		        if(codec_impl::is_encoded(db, table_name))
+			        {
+		            pull_implementation::pull_encoded_kconfig_page(db, table_name, kquery.make_query(policy, true), t_serial, page, 0, live, sample);
+		            return;
+			        }
+
+		        // construct SQL query to pull all live columns of the page
+		        std::stringstream select_stmt;
+		        select_stmt << "SELECT";
+		        for(unsigned int c = 0; c < live; ++c)
+			        {
+		            select_stmt << (c > 0 ? "," : "") << " _subsample.ele" << c;
+			        }
+		        select_stmt
+			        << " FROM"
+			        << " (SELECT * FROM " << table_name
+			        << " WHERE " << table_name << ".tserial=" << t_serial << " AND " << table_name << ".page=" << page
+			        << ") _subsample"
+			        << " INNER JOIN (" << kquery.make_query(policy, true) << ") _ksample"
+			        << " ON _subsample.kserial=_ksample.serial"
+			        << " ORDER BY _ksample.serial;";
+
+		        sample.clear();
+		        sample.resize(live);
+		        pull_implementation::pull_number_page(db, sample, select_stmt.str(), CPPTRANSPORT_DATAMGR_TIME_SERIAL_READ_FAIL);
+			    }
+
+
         template <typename number, typename ValueType>
         void pull_unpaged_time_sample(sqlite3* db, const derived_data::SQL_query& tquery,
                                       unsigned int k_serial, std::vector<number>& sample, unsigned int worker)
@@ -27,6 +27,9 @@
 #define CPPTRANSPORT_DATA_MANAGER_READ_H
 
 
+#include <list>
+#include <cstring>
+
 #include "transport-runtime/sqlite3/operations/data_manager_common.h"
 #include "transport-runtime/sqlite3/operations/data_traits.h"
 
@@ -38,10 +41,14 @@ namespace transport
       {
 
         // Read worker information table
-        worker_information_db read_worker_table(sqlite3* db)
+        inline worker_information_db read_worker_table(sqlite3* db)
           {
+            // containers written before kernel variants were recorded have no kernel_variant column; read it as NULL
+            bool has_kernel_variant = has_column(db, CPPTRANSPORT_SQLITE_WORKERS_TABLE, "kernel_variant");
+
             std::ostringstream read_stmt;
-            read_stmt << "SELECT workgroup, worker, backend, back_stepper, pert_stepper, back_abs_tol, back_rel_tol, pert_abs_tol, pert_rel_tol, hostname, os_name, os_version, os_release, architecture, cpu_brand, cpu_vendor_id FROM " << CPPTRANSPORT_SQLITE_WORKERS_TABLE << ";";
+            read_stmt << "SELECT workgroup, worker, backend, back_stepper, pert_stepper, back_abs_tol, back_rel_tol, pert_abs_tol, pert_rel_tol, hostname, os_name, os_version, os_release, architecture, cpu_brand, cpu_vendor_id, "
+                      << (has_kernel_variant ? "kernel_variant" : "NULL") << " FROM " << CPPTRANSPORT_SQLITE_WORKERS_TABLE << ";";
 
             sqlite3_stmt* stmt;
             check_stmt(db, sqlite3_prepare_v2(db, read_stmt.str().c_str(), read_stmt.str().length()+1, &stmt, nullptr));
@@ -70,6 +77,10 @@ namespace transport
                     std::string architecture = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 13)), static_cast<unsigned int>(sqlite3_column_bytes(stmt, 13)));
                     std::string cpu_brand    = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 14)), static_cast<unsigned int>(sqlite3_column_bytes(stmt, 14)));
                     std::string cpu_vendor   = std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 15)), static_cast<unsigned int>(sqlite3_column_bytes(stmt, 15)));
+
+                    // containers written before kernel variants were recorded used a single, fixed variant
+                    std::string kernel       = sqlite3_column_type(stmt, 16) == SQLITE_NULL ? std::string(CPPTRANSPORT_KERNEL_VARIANT_FIXED)
+                                                 : std::string(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 16)), static_cast<unsigned int>(sqlite3_column_bytes(stmt, 16)));
     
                     data.insert(
                       std::make_pair(
@@ -77,7 +88,7 @@ namespace transport
                         std::make_unique<worker_record>(workgroup, worker, backend, back_stepper, pert_stepper,
                                                         back_abs_tol, back_rel_tol, pert_abs_tol, pert_rel_tol,
                                                         hostname, os_name, os_version, os_release, architecture,
-                                                        cpu_brand, cpu_vendor)
+                                                        cpu_brand, cpu_vendor, kernel)
                       )
                     );
                   }
@@ -97,10 +108,11 @@ namespace transport
 
 
         // Read statistics table
-        timing_db read_statistics_table(sqlite3* db)
+        inline timing_db read_statistics_table(sqlite3* db)
           {
             std::ostringstream read_stmt;
-            read_stmt << "SELECT kserial, integration_time, batch_time, steps, refinements, workgroup, worker FROM " << CPPTRANSPORT_SQLITE_STATS_TABLE << ";";
+            read_stmt << "SELECT kserial, integration_time, batch_time, steps, refinements, workgroup, worker, "
+                      << stats_profile_select(db) << " FROM " << CPPTRANSPORT_SQLITE_STATS_TABLE << ";";
 
             sqlite3_stmt* stmt;
             check_stmt(db, sqlite3_prepare_v2(db, read_stmt.str().c_str(), read_stmt.str().length()+1, &stmt, nullptr));
@@ -125,7 +137,8 @@ namespace transport
 
                     data.insert(std::make_pair(serial,
                                                std::make_unique<timing_record>(serial, integration_time, batch_time,
-                                                                               steps, refinements, workgroup, worker)));
+                                                                               steps, refinements, workgroup, worker,
+                                                                               read_profile_summary(stmt, 7))));
                   }
                 else
                   {
@@ -142,6 +155,89 @@ namespace transport
           }
 
 
+        // Read checkpoints of in-flight configurations from a container, with the complete
+        // observed history of each configuration, in order.
+        // Containers without a checkpoint table yield an empty list
+        template <typename number>
+        std::list< typename integration_items<number>::checkpoint_item > read_checkpoints(sqlite3* db)
+          {
+            std::list< typename integration_items<number>::checkpoint_item > data;
+
+            std::ostringstream exists_stmt;
+            exists_stmt << "SELECT COUNT(*) FROM sqlite_master WHERE type='table' AND name='" << CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE << "';";
+
+            sqlite3_stmt* stmt;
+            check_stmt(db, sqlite3_prepare_v2(db, exists_stmt.str().c_str(), exists_stmt.str().length()+1, &stmt, nullptr));
+
+            int status = sqlite3_step(stmt);
+            bool has_table = status == SQLITE_ROW && sqlite3_column_int(stmt, 0) > 0;
+            check_stmt(db, sqlite3_finalize(stmt));
+
+            if(!has_table) return data;
+
+            std::ostringstream select_stmt;
+            select_stmt << "SELECT kserial, refinement, step, samples, positions, times, states FROM " << CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE << " ORDER BY kserial;";
+
+            check_stmt(db, sqlite3_prepare_v2(db, select_stmt.str().c_str(), select_stmt.str().length()+1, &stmt, nullptr));
+
+            while((status = sqlite3_step(stmt)) != SQLITE_DONE)
+              {
+                if(status == SQLITE_ROW)
+                  {
+                    unsigned int serial  = static_cast<unsigned int>(sqlite3_column_int(stmt, 0));
+                    unsigned int samples = static_cast<unsigned int>(sqlite3_column_int(stmt, 3));
+
+                    const void* positions_blob = sqlite3_column_blob(stmt, 4);
+                    size_t positions_bytes     = static_cast<size_t>(sqlite3_column_bytes(stmt, 4));
+                    const void* times_blob     = sqlite3_column_blob(stmt, 5);
+                    size_t times_bytes         = static_cast<size_t>(sqlite3_column_bytes(stmt, 5));
+                    const void* states_blob    = sqlite3_column_blob(stmt, 6);
+                    size_t states_bytes        = static_cast<size_t>(sqlite3_column_bytes(stmt, 6));
+
+                    // a row without samples gives nothing from which to resume
+                    if(samples == 0) continue;
+
+                    if(positions_bytes != samples*sizeof(unsigned int) || times_bytes != samples*sizeof(double)
+                       || states_bytes % (samples*sizeof(number)) != 0)
+                      {
+                        std::ostringstream msg;
+                        msg << CPPTRANSPORT_DATACTR_CHECKPOINT_STATE_SIZE << " " << serial;
+                        sqlite3_finalize(stmt);
+                        throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                      }
+
+                    std::vector<unsigned int> positions(samples);
+                    std::vector<double> times(samples);
+                    std::memcpy(positions.data(), positions_blob, positions_bytes);
+                    std::memcpy(times.data(), times_blob, times_bytes);
+
+                    const size_t state_size = states_bytes / (samples*sizeof(number));
+                    const number* states    = static_cast<const number*>(states_blob);
+
+                    data.emplace_back(serial, static_cast<unsigned int>(sqlite3_column_int(stmt, 1)), sqlite3_column_double(stmt, 2));
+                    typename integration_items<number>::checkpoint_item& item = data.back();
+
+                    item.samples.reserve(samples);
+                    for(unsigned int i = 0; i < samples; ++i)
+                      {
+                        item.samples.emplace_back(positions[i], times[i], std::vector<number>(states + i*state_size, states + (i+1)*state_size));
+                      }
+                  }
+                else
+                  {
+                    std::ostringstream msg;
+                    msg << CPPTRANSPORT_DATAMGR_CHECKPOINT_TABLE_READ_FAIL << status << ": " << sqlite3_errmsg(db) << ")";
+                    sqlite3_finalize(stmt);
+                    throw runtime_exception(exception_type::DATA_MANAGER_BACKEND_ERROR, msg.str());
+                  }
+              }
+
+            check_stmt(db, sqlite3_finalize(stmt));
+
+            return data;
+          }
+
+
       }
 
   }   // namespace transport
@@ -89,7 +89,7 @@ namespace transport
 				    const host_information& host = batcher->get_host_information();
 
 		        std::ostringstream insert_stmt;
-				    insert_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_WORKERS_TABLE << " VALUES (@workgroup, @worker, @backend, @back_stepper, @pert_stepper, @back_abs_tol, @back_rel_tol, @pert_abs_tol, @pert_rel_tol, @hostname, @os_name, @os_version, @os_release, @architecture, @cpu_brand, @cpu_vendor_id)";
+				    insert_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_WORKERS_TABLE << " VALUES (@workgroup, @worker, @backend, @back_stepper, @pert_stepper, @back_abs_tol, @back_rel_tol, @pert_abs_tol, @pert_rel_tol, @hostname, @os_name, @os_version, @os_release, @architecture, @cpu_brand, @cpu_vendor_id, @kernel_variant)";
 
 				    sqlite3_stmt* stmt;
 				    check_stmt(db, sqlite3_prepare_v2(db, insert_stmt.str().c_str(), insert_stmt.str().length()+1, &stmt, nullptr));
@@ -125,6 +125,10 @@ namespace transport
 		        check_stmt(db, sqlite3_bind_text(stmt, sqlite3_bind_parameter_index(stmt, "@architecture"), host.get_architecture().c_str(), host.get_architecture().length(), SQLITE_STATIC));
 		        check_stmt(db, sqlite3_bind_text(stmt, sqlite3_bind_parameter_index(stmt, "@cpu_vendor_id"), host.get_cpu_vendor_id().c_str(), host.get_cpu_vendor_id().length(), SQLITE_STATIC));
             
+            // kernel variant is captured when the host information is written, after any calibration has been performed
+            const std::string kernels = batcher->get_kernel_variant();
+            check_stmt(db, sqlite3_bind_text(stmt, sqlite3_bind_parameter_index(stmt, "@kernel_variant"), kernels.c_str(), kernels.length(), SQLITE_STATIC));
+            
             auto& cpu_brand = host.get_cpu_brand_string();
             if(cpu_brand)
               {
@@ -146,7 +150,9 @@ namespace transport
             batcher->get_manager_handle(&db);
 
             std::ostringstream insert_stmt;
-            insert_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_STATS_TABLE << " VALUES (@kserial, @integration_time, @batch_time, @steps, @refinements, @workgroup, @worker);";
+            insert_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_STATS_TABLE << " VALUES (@kserial, @integration_time, @batch_time, @steps, @refinements, @workgroup, @worker, "
+                        << "@rhs_evaluations, @rhs_setup_time, @rhs_u_tensor_time, @rhs_transport_time, @rhs_median_time, @rhs_p99_time, "
+                        << "@step_median, @observer_median_time, @observer_p99_time);";
 
             sqlite3_stmt* stmt;
             check_stmt(db, sqlite3_prepare_v2(db, insert_stmt.str().c_str(), insert_stmt.str().length()+1, &stmt, nullptr));
@@ -159,6 +165,16 @@ namespace transport
             const int workgroup_id = sqlite3_bind_parameter_index(stmt, "@workgroup");
             const int worker_id = sqlite3_bind_parameter_index(stmt, "@worker");
 
+            const int rhs_evaluations_id = sqlite3_bind_parameter_index(stmt, "@rhs_evaluations");
+            const int rhs_setup_time_id = sqlite3_bind_parameter_index(stmt, "@rhs_setup_time");
+            const int rhs_u_tensor_time_id = sqlite3_bind_parameter_index(stmt, "@rhs_u_tensor_time");
+            const int rhs_transport_time_id = sqlite3_bind_parameter_index(stmt, "@rhs_transport_time");
+            const int rhs_median_time_id = sqlite3_bind_parameter_index(stmt, "@rhs_median_time");
+            const int rhs_p99_time_id = sqlite3_bind_parameter_index(stmt, "@rhs_p99_time");
+            const int step_median_id = sqlite3_bind_parameter_index(stmt, "@step_median");
+            const int observer_median_time_id = sqlite3_bind_parameter_index(stmt, "@observer_median_time");
+            const int observer_p99_time_id = sqlite3_bind_parameter_index(stmt, "@observer_p99_time");
+
             // sort batch into ascending primary key order;
             // sorting is done in-place for performance
             std::sort(batch.begin(), batch.end(), data_manager_write_impl::StatisticsPrimaryKeyCompare<number>());
@@ -173,6 +189,21 @@ namespace transport
 		            check_stmt(db, sqlite3_bind_int(stmt, workgroup_id, batcher->get_worker_group()));
                 check_stmt(db, sqlite3_bind_int(stmt, worker_id, batcher->get_worker_number()));
 
+                // hot-path instrumentation columns are left NULL if the integration was not instrumented
+                const hot_path::profile_summary& profile = item->profile;
+                if(profile.available)
+                  {
+                    check_stmt(db, sqlite3_bind_int64(stmt, rhs_evaluations_id, static_cast<sqlite3_int64>(profile.evaluations)));
+                    check_stmt(db, sqlite3_bind_double(stmt, rhs_setup_time_id, profile.setup));
+                    check_stmt(db, sqlite3_bind_double(stmt, rhs_u_tensor_time_id, profile.u_tensor));
+                    check_stmt(db, sqlite3_bind_double(stmt, rhs_transport_time_id, profile.transport));
+                    check_stmt(db, sqlite3_bind_double(stmt, rhs_median_time_id, profile.rhs_median));
+                    check_stmt(db, sqlite3_bind_double(stmt, rhs_p99_time_id, profile.rhs_p99));
+                    check_stmt(db, sqlite3_bind_double(stmt, step_median_id, profile.step_median));
+                    check_stmt(db, sqlite3_bind_double(stmt, observer_median_time_id, profile.observer_median));
+                    check_stmt(db, sqlite3_bind_double(stmt, observer_p99_time_id, profile.observer_p99));
+                  }
+
                 check_stmt(db, sqlite3_step(stmt), CPPTRANSPORT_DATACTR_STATS_INSERT_FAIL, SQLITE_DONE);
 
                 check_stmt(db, sqlite3_clear_bindings(stmt));
@@ -183,6 +214,78 @@ namespace transport
           }
 
 
+        // Write checkpoint row for an in-flight configuration into a container which holds a checkpoint table.
+        // The row carries the complete observed history, and replaces any earlier checkpoint for the same configuration
+        template <typename number>
+        void write_checkpoint_row(sqlite3* db, const typename integration_items<number>::checkpoint_item& item)
+          {
+            if(item.samples.empty()) return;
+
+            // pack the history into contiguous arrays; states are stored as a raw image of the integrator's number type,
+            // which is only ever read back on the same platform, by a model compiled with the same number type
+            const size_t state_size = item.samples.front().state.size();
+
+            std::vector<unsigned int> positions;
+            std::vector<double> times;
+            std::vector<number> states;
+
+            positions.reserve(item.samples.size());
+            times.reserve(item.samples.size());
+            states.reserve(item.samples.size() * state_size);
+
+            for(const typename integration_items<number>::checkpoint_sample& sample : item.samples)
+              {
+                assert(sample.state.size() == state_size);
+                positions.push_back(sample.position);
+                times.push_back(sample.time);
+                states.insert(states.end(), sample.state.begin(), sample.state.end());
+              }
+
+            std::ostringstream insert_stmt;
+            insert_stmt << "INSERT OR REPLACE INTO " << CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE
+                        << " VALUES (@kserial, @refinement, @step, @samples, @positions, @times, @states);";
+
+            sqlite3_stmt* stmt;
+            check_stmt(db, sqlite3_prepare_v2(db, insert_stmt.str().c_str(), insert_stmt.str().length()+1, &stmt, nullptr));
+
+            check_stmt(db, sqlite3_bind_int(stmt, sqlite3_bind_parameter_index(stmt, "@kserial"), item.serial));
+            check_stmt(db, sqlite3_bind_int(stmt, sqlite3_bind_parameter_index(stmt, "@refinement"), item.refinement));
+            check_stmt(db, sqlite3_bind_double(stmt, sqlite3_bind_parameter_index(stmt, "@step"), item.step));
+            check_stmt(db, sqlite3_bind_int(stmt, sqlite3_bind_parameter_index(stmt, "@samples"), static_cast<int>(item.samples.size())));
+            check_stmt(db, sqlite3_bind_blob(stmt, sqlite3_bind_parameter_index(stmt, "@positions"), positions.data(), static_cast<int>(positions.size()*sizeof(unsigned int)), SQLITE_STATIC));
+            check_stmt(db, sqlite3_bind_blob(stmt, sqlite3_bind_parameter_index(stmt, "@times"), times.data(), static_cast<int>(times.size()*sizeof(double)), SQLITE_STATIC));
+            check_stmt(db, sqlite3_bind_blob(stmt, sqlite3_bind_parameter_index(stmt, "@states"), states.data(), static_cast<int>(states.size()*sizeof(number)), SQLITE_STATIC));
+
+            check_stmt(db, sqlite3_step(stmt), CPPTRANSPORT_DATACTR_CHECKPOINT_INSERT_FAIL, SQLITE_DONE);
+            check_stmt(db, sqlite3_finalize(stmt));
+          }
+
+
+        // Write checkpoint for an in-flight configuration into a batcher's current container
+        template <typename number>
+        void write_checkpoint(transaction_manager& mgr, integration_batcher<number>* batcher, const typename integration_items<number>::checkpoint_item& item)
+          {
+            sqlite3* db = nullptr;
+            batcher->get_manager_handle(&db);
+
+            write_checkpoint_row<number>(db, item);
+          }
+
+
+        // Remove checkpoint for a configuration which has completed or failed
+        template <typename number>
+        void drop_checkpoint(transaction_manager& mgr, integration_batcher<number>* batcher, unsigned int kserial)
+          {
+            sqlite3* db = nullptr;
+            batcher->get_manager_handle(&db);
+
+            std::ostringstream delete_stmt;
+            delete_stmt << "DELETE FROM " << CPPTRANSPORT_SQLITE_CHECKPOINT_TABLE << " WHERE kserial=" << kserial << ";";
+
+            exec(db, delete_stmt.str());
+          }
+
+
         template <typename number, typename ValueType>
         void write_coordinate_output(transaction_manager& mgr, integration_batcher<number>* batcher, std::vector< std::unique_ptr<ValueType> >& batch)
           {
@@ -37,31 +37,31 @@ namespace transport
 		namespace sqlite3_operations
 			{
 
-				std::string find_package(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_package(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_PACKAGE_TABLE, "name", "path", missing_msg);
 					}
 
 
-				std::string find_integration_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_integration_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_INTEGRATION_TASKS_TABLE, "name", "path", missing_msg);
 					}
 
 
-				std::string find_postintegration_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_postintegration_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_POSTINTEGRATION_TASKS_TABLE, "name", "path", missing_msg);
 					}
 
 
-				std::string find_output_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_output_task(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_OUTPUT_TASKS_TABLE, "name", "path", missing_msg);
 					}
 
 
-				std::string find_product(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_product(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_DERIVED_PRODUCTS_TABLE, "name", "path", missing_msg);
 					}
@@ -72,27 +72,27 @@ namespace transport
 
 
 				template <>
-				std::string find_group<integration_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
+				inline std::string find_group<integration_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 						return internal_find(db, name, CPPTRANSPORT_SQLITE_INTEGRATION_GROUPS_TABLE, "name", "path", missing_msg);
 					}
 
 
 		    template <>
-		    std::string find_group<postintegration_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
+		    inline std::string find_group<postintegration_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
 					{
 				    return internal_find(db, name, CPPTRANSPORT_SQLITE_POSTINTEGRATION_GROUPS_TABLE, "name", "path", missing_msg);
 					}
 
 
 		    template <>
-		    std::string find_group<output_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
+		    inline std::string find_group<output_payload>(sqlite3* db, const std::string& name, const std::string& missing_msg)
 			    {
 		        return internal_find(db, name, CPPTRANSPORT_SQLITE_OUTPUT_GROUPS_TABLE, "name", "path", missing_msg);
 			    }
 
 
-				void internal_enumerate_content_groups(sqlite3* db, const std::string& name, std::list<std::string>& groups, const std::string& table)
+				inline void internal_enumerate_content_groups(sqlite3* db, const std::string& name, std::list<std::string>& groups, const std::string& table)
 					{
 				    std::stringstream find_stmt;
 						find_stmt << "SELECT name FROM " << table;
@@ -132,27 +132,27 @@ namespace transport
 
 
 				template <>
-				void enumerate_content_groups<integration_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
+				inline void enumerate_content_groups<integration_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
 					{
 						internal_enumerate_content_groups(db, name, groups, CPPTRANSPORT_SQLITE_INTEGRATION_GROUPS_TABLE);
 					}
 
 
 		    template <>
-		    void enumerate_content_groups<postintegration_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
+		    inline void enumerate_content_groups<postintegration_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
 			    {
 		        internal_enumerate_content_groups(db, name, groups, CPPTRANSPORT_SQLITE_POSTINTEGRATION_GROUPS_TABLE);
 			    }
 
 
 		    template <>
-		    void enumerate_content_groups<output_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
+		    inline void enumerate_content_groups<output_payload>(sqlite3* db, std::list<std::string>& groups, const std::string& name)
 			    {
 		        internal_enumerate_content_groups(db, name, groups, CPPTRANSPORT_SQLITE_OUTPUT_GROUPS_TABLE);
 			    }
 
 
-        void internal_enumerate_records(sqlite3* db, std::list<std::string>& list, const std::string& table)
+        inline void internal_enumerate_records(sqlite3* db, std::list<std::string>& list, const std::string& table)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT name FROM " << table << ";";
@@ -181,13 +181,13 @@ namespace transport
           }
 
 
-        void enumerate_packages(sqlite3* db, std::list<std::string>& packages)
+        inline void enumerate_packages(sqlite3* db, std::list<std::string>& packages)
           {
             internal_enumerate_records(db, packages, CPPTRANSPORT_SQLITE_PACKAGE_TABLE);
           }
 
 
-        void enumerate_tasks(sqlite3* db, std::list<std::string>& integration, std::list<std::string>& postintegration, std::list<std::string>& output)
+        inline void enumerate_tasks(sqlite3* db, std::list<std::string>& integration, std::list<std::string>& postintegration, std::list<std::string>& output)
           {
             internal_enumerate_records(db, integration, CPPTRANSPORT_SQLITE_INTEGRATION_TASKS_TABLE);
             internal_enumerate_records(db, postintegration, CPPTRANSPORT_SQLITE_POSTINTEGRATION_TASKS_TABLE);
@@ -195,7 +195,7 @@ namespace transport
           }
 
 
-        void enumerate_derived_products(sqlite3* db, std::list<std::string>& derived_products)
+        inline void enumerate_derived_products(sqlite3* db, std::list<std::string>& derived_products)
           {
             internal_enumerate_records(db, derived_products, CPPTRANSPORT_SQLITE_DERIVED_PRODUCTS_TABLE);
           }
@@ -63,7 +63,7 @@ namespace transport
         constexpr auto CPPTRANSPORT_SQLITE_POSTINTEGRATION_WRITERS_TABLE = "postintegration_writers";
         constexpr auto CPPTRANSPORT_SQLITE_DERIVED_WRITERS_TABLE         = "output_writers";
 
-        unsigned int internal_count(sqlite3* db, const std::string& name, const std::string& table, const std::string& column)
+        inline unsigned int internal_count(sqlite3* db, const std::string& name, const std::string& table, const std::string& column)
           {
             std::stringstream select_stmt;
             select_stmt << "SELECT COUNT(*) FROM " << table << " WHERE " << table << "." << column << "='" << name << "'";
@@ -103,7 +103,7 @@ namespace transport
           }
 
 
-        std::string internal_find(sqlite3* db, const std::string& name, const std::string& table, const std::string& column, const std::string& target, const std::string& missing_msg)
+        inline std::string internal_find(sqlite3* db, const std::string& name, const std::string& table, const std::string& column, const std::string& target, const std::string& missing_msg)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT " << target << " FROM " << table << " WHERE " << table << "." << column << "='" << name << "'";
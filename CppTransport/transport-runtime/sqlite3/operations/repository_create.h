@@ -36,7 +36,7 @@ namespace transport
     namespace sqlite3_operations
       {
 
-        void create_repository_tables(sqlite3* db)
+        inline void create_repository_tables(sqlite3* db)
           {
             std::ostringstream packages_stmt;
             packages_stmt << "CREATE TABLE " << CPPTRANSPORT_SQLITE_PACKAGE_TABLE << "("
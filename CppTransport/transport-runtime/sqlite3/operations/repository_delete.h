@@ -36,7 +36,7 @@ namespace transport
     namespace sqlite3_operations
       {
 
-        void generic_delete_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task, const std::string table)
+        inline void generic_delete_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task, const std::string table)
           {
             unsigned int count = internal_count(db, name, table, "name");
             if(count != 1)
@@ -69,21 +69,21 @@ namespace transport
 
 
         template <>
-        void delete_group<integration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
+        inline void delete_group<integration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
           {
             generic_delete_group(mgr, db, name, task, CPPTRANSPORT_SQLITE_INTEGRATION_GROUPS_TABLE);
           }
 
 
         template <>
-        void delete_group<postintegration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
+        inline void delete_group<postintegration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
           {
             generic_delete_group(mgr, db, name, task, CPPTRANSPORT_SQLITE_POSTINTEGRATION_GROUPS_TABLE);
           }
 
 
         template <>
-        void delete_group<output_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
+        inline void delete_group<output_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task)
           {
             generic_delete_group(mgr, db, name, task, CPPTRANSPORT_SQLITE_OUTPUT_GROUPS_TABLE);
           }
@@ -36,7 +36,7 @@ namespace transport
     namespace sqlite3_operations
       {
 
-        std::string reserve_content_name(transaction_manager& mgr, sqlite3* db, const std::string& tk,
+        inline std::string reserve_content_name(transaction_manager& mgr, sqlite3* db, const std::string& tk,
                                          boost::filesystem::path& parent_path,
                                          const std::string& posix_time_string, const std::string& suffix,
                                          unsigned int num_cores)
@@ -86,7 +86,7 @@ namespace transport
           }
 
 
-        void deregister_content_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string writer_table)
+        inline void deregister_content_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string writer_table)
           {
             sqlite3_stmt* stmt;
 
@@ -114,7 +114,7 @@ namespace transport
           }
 
 
-        void advise_completion_time(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& time)
+        inline void advise_completion_time(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& time)
           {
             std::stringstream update_stmt;
             update_stmt << "UPDATE " << CPPTRANSPORT_SQLITE_RESERVED_CONTENT_NAMES_TABLE << " SET completion=@completion WHERE name=@name;";
@@ -132,7 +132,7 @@ namespace transport
           }
 
 
-        void enumerate_inflight_groups(sqlite3* db, inflight_db& groups)
+        inline void enumerate_inflight_groups(sqlite3* db, inflight_db& groups)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT name, task, path, posix_time, cores, completion FROM " << CPPTRANSPORT_SQLITE_RESERVED_CONTENT_NAMES_TABLE << ";";
@@ -173,7 +173,7 @@ namespace transport
           }
 
 
-        void register_integration_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
+        inline void register_integration_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
                                          const boost::filesystem::path& output_path, const boost::filesystem::path& sql_path,
                                          const boost::filesystem::path& logdir_path, const boost::filesystem::path& tempdir_path,
                                          unsigned int workgroup_number, bool is_seeded, const std::string& seed_group,
@@ -208,7 +208,7 @@ namespace transport
           }
 
 
-        void register_postintegration_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
+        inline void register_postintegration_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
                                              const boost::filesystem::path& output_path, const boost::filesystem::path& container,
                                              const boost::filesystem::path& logdir_path, const boost::filesystem::path& tempdir_path,
                                              bool is_paired, const std::string& parent_group,
@@ -242,7 +242,7 @@ namespace transport
           }
 
 
-        void register_derived_content_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
+        inline void register_derived_content_writer(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& task,
                                              const boost::filesystem::path& output_path, const boost::filesystem::path& logdir_path, const boost::filesystem::path& tempdir_path)
           {
             std::stringstream store_stmt;
@@ -264,7 +264,7 @@ namespace transport
           }
 
 
-        void enumerate_inflight_integrations(sqlite3* db, inflight_integration_db& groups)
+        inline void enumerate_inflight_integrations(sqlite3* db, inflight_integration_db& groups)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT content_group, task, output, container, logdir, tempdir, workgroup_number, seeded, seed_group, collect_stats, collect_ics FROM " << CPPTRANSPORT_SQLITE_INTEGRATION_WRITERS_TABLE << ";";
@@ -319,7 +319,7 @@ namespace transport
           }
 
 
-        void enumerate_inflight_postintegrations(sqlite3* db, inflight_postintegration_db& groups)
+        inline void enumerate_inflight_postintegrations(sqlite3* db, inflight_postintegration_db& groups)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT content_group, task, output, container, logdir, tempdir, paired, parent, seeded, seed_group FROM " << CPPTRANSPORT_SQLITE_POSTINTEGRATION_WRITERS_TABLE << ";";
@@ -374,7 +374,7 @@ namespace transport
           }
 
 
-        void enumerate_inflight_derived_content(sqlite3* db, inflight_derived_content_db& groups)
+        inline void enumerate_inflight_derived_content(sqlite3* db, inflight_derived_content_db& groups)
           {
             std::stringstream find_stmt;
             find_stmt << "SELECT content_group, task, output, logdir, tempdir FROM " << CPPTRANSPORT_SQLITE_DERIVED_WRITERS_TABLE << ";";
@@ -36,7 +36,7 @@ namespace transport
     namespace sqlite3_operations
       {
 
-        void store_package(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
+        inline void store_package(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
           {
             std::stringstream store_stmt;
             store_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_PACKAGE_TABLE << " VALUES (@name, @path)";
@@ -56,7 +56,7 @@ namespace transport
           }
 
 
-        void store_integration_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename, const std::string& pkg)
+        inline void store_integration_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename, const std::string& pkg)
           {
             std::ostringstream store_stmt;
             store_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_INTEGRATION_TASKS_TABLE << " VALUES (@name, @package, @path)";
@@ -77,7 +77,7 @@ namespace transport
           }
 
 
-        void store_postintegration_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename, const std::string& parent)
+        inline void store_postintegration_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename, const std::string& parent)
           {
             std::stringstream store_stmt;
             store_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_POSTINTEGRATION_TASKS_TABLE << " VALUES (@name, @parent, @path)";
@@ -98,7 +98,7 @@ namespace transport
           }
 
 
-        void store_output_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
+        inline void store_output_task(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
           {
             std::stringstream store_stmt;
             store_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_OUTPUT_TASKS_TABLE << " VALUES (@name, @path)";
@@ -118,7 +118,7 @@ namespace transport
           }
 
 
-        void store_product(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
+        inline void store_product(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename)
           {
             std::stringstream store_stmt;
             store_stmt << "INSERT INTO " << CPPTRANSPORT_SQLITE_DERIVED_PRODUCTS_TABLE << " VALUES (@name, @path)";
@@ -138,7 +138,7 @@ namespace transport
           }
 
 
-        void generic_store_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
+        inline void generic_store_group(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
                                  const std::string& task, const boost::posix_time::ptime& posix_time, const std::string table)
           {
             unsigned int count = internal_count(db, name, CPPTRANSPORT_SQLITE_RESERVED_CONTENT_NAMES_TABLE, "name");
@@ -177,7 +177,7 @@ namespace transport
 
 
         template <>
-        void store_group<integration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
+        inline void store_group<integration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
                                               const std::string& task, const boost::posix_time::ptime& posix_time)
           {
             generic_store_group(mgr, db, name, filename, task, posix_time, CPPTRANSPORT_SQLITE_INTEGRATION_GROUPS_TABLE);
@@ -185,7 +185,7 @@ namespace transport
 
 
         template <>
-        void store_group<postintegration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
+        inline void store_group<postintegration_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
                                                   const std::string& task, const boost::posix_time::ptime& posix_time)
           {
             generic_store_group(mgr, db, name, filename, task, posix_time, CPPTRANSPORT_SQLITE_POSTINTEGRATION_GROUPS_TABLE);
@@ -193,7 +193,7 @@ namespace transport
 
 
         template <>
-        void store_group<output_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
+        inline void store_group<output_payload>(transaction_manager& mgr, sqlite3* db, const std::string& name, const std::string& filename,
                                          const std::string& task, const boost::posix_time::ptime& posix_time)
           {
             generic_store_group(mgr, db, name, filename, task, posix_time, CPPTRANSPORT_SQLITE_OUTPUT_GROUPS_TABLE);
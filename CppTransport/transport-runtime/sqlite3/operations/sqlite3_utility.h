@@ -28,6 +28,11 @@
 #define CPPTRANSPORT_SQLITE3_UTILITY_H
 
 
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+
 #include "transport-runtime/messages.h"
 
 
@@ -180,6 +185,106 @@ namespace transport
           }
 
 
+        // rebuild the database file so that space released by dropped tables is returned to the filesystem.
+        // VACUUM can't run inside a transaction; failure is not an error, because the container remains valid
+        inline void vacuum(sqlite3* db)
+          {
+            assert(db != nullptr);
+
+            char* errmsg;
+            sqlite3_exec(db, "VACUUM;", nullptr, nullptr, &errmsg);
+          }
+
+
+        // list the columns of a table, in declaration order; 'schema' names an attached database if the table
+        // does not belong to the main database.
+        // Containers written by earlier releases may lack columns added since, so readers use this to probe for them
+        inline std::vector<std::string> table_columns(sqlite3* db, const std::string& table, const std::string& schema="")
+          {
+            assert(db != nullptr);
+
+            std::ostringstream query;
+            query << "PRAGMA ";
+            if(!schema.empty()) query << schema << ".";
+            query << "table_info(" << table << ");";
+
+            sqlite3_stmt* stmt;
+            check_stmt(db, sqlite3_prepare_v2(db, query.str().c_str(), query.str().length()+1, &stmt, nullptr));
+
+            std::vector<std::string> columns;
+            while(sqlite3_step(stmt) == SQLITE_ROW)
+              {
+                const char* name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
+                if(name != nullptr) columns.emplace_back(name);
+              }
+
+            check_stmt(db, sqlite3_finalize(stmt));
+
+            return columns;
+          }
+
+
+        // determine whether a table has a named column
+        inline bool has_column(sqlite3* db, const std::string& table, const std::string& column, const std::string& schema="")
+          {
+            std::vector<std::string> columns = table_columns(db, table, schema);
+            return std::find(columns.begin(), columns.end(), column) != columns.end();
+          }
+
+
+        // build a comma-separated list of the columns a table in the main database shares with the same table in an
+        // attached database, in main-database order; used to copy rows between containers written by different releases
+        inline std::string shared_columns(sqlite3* db, const std::string& table, const std::string& schema)
+          {
+            std::vector<std::string> ours = table_columns(db, table);
+            std::vector<std::string> theirs = table_columns(db, table, schema);
+
+            std::ostringstream list;
+            bool first = true;
+            for(const std::string& column : ours)
+              {
+                if(std::find(theirs.begin(), theirs.end(), column) == theirs.end()) continue;
+
+                if(!first) list << ", ";
+                list << column;
+                first = false;
+              }
+
+            return list.str();
+          }
+
+
+        // open a read-only in-memory database backed by a serialized image, eg. one received over MPI.
+        // The image must outlive the returned handle. Returns nullptr if the image could not be attached,
+        // or if this SQLite build does not support deserialization; callers should then fall back to
+        // reading the database from disk
+        inline sqlite3* open_database_image(const std::vector<char>& image)
+          {
+#if SQLITE_VERSION_NUMBER >= 3036000
+            if(image.empty()) return nullptr;
+
+            sqlite3* db = nullptr;
+            if(sqlite3_open_v2(":memory:", &db, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK)
+              {
+                if(db != nullptr) sqlite3_close(db);
+                return nullptr;
+              }
+
+            unsigned char* data = reinterpret_cast<unsigned char*>(const_cast<char*>(image.data()));
+            if(sqlite3_deserialize(db, "main", data, image.size(), image.size(), SQLITE_DESERIALIZE_READONLY) != SQLITE_OK)
+              {
+                sqlite3_close(db);
+                return nullptr;
+              }
+
+            sqlite3_extended_result_codes(db, 1);
+            return db;
+#else
+            return nullptr;
+#endif
+          }
+
+
 			}   // namespace sqlite3_operations
 
 	}   // namespace transport
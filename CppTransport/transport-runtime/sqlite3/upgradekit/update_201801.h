@@ -72,13 +72,13 @@ namespace transport
           };
     
     
-        void update_201801::integration_container(sqlite3* db, transaction_manager& mgr, upgradekit_impl::NotifyGadget& notify)
+        inline void update_201801::integration_container(sqlite3* db, transaction_manager& mgr, upgradekit_impl::NotifyGadget& notify)
           {
             this->update_worker_table(db, mgr, notify);
           }
     
     
-        void update_201801::update_worker_table(sqlite3* db, transaction_manager& mgr, upgradekit_impl::NotifyGadget& notify)
+        inline void update_201801::update_worker_table(sqlite3* db, transaction_manager& mgr, upgradekit_impl::NotifyGadget& notify)
           {
             // determine whether cpu_brand column is present
             bool present = false;
@@ -0,0 +1,495 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_KCONFIG_DATABASE_IMAGE_H
+#define CPPTRANSPORT_KCONFIG_DATABASE_IMAGE_H
+
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <algorithm>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "transport-runtime/tasks/task_configurations.h"
+
+#include "transport-runtime/messages.h"
+#include "transport-runtime/exceptions.h"
+
+#include "sqlite3.h"
+
+#include "boost/filesystem/operations.hpp"
+
+
+namespace transport
+  {
+
+    namespace configuration_database
+      {
+
+        //! extension appended to the path of an SQLite k-configuration database to locate its binary image
+        constexpr auto CPPTRANSPORT_KCONFIG_IMAGE_EXTENSION = ".image";
+
+        //! tag identifying a binary image, followed by a format version
+        constexpr char CPPTRANSPORT_KCONFIG_IMAGE_MAGIC[8] = { 'C', 'P', 'P', 'T', 'K', 'D', 'B', '\0' };
+        constexpr std::uint32_t CPPTRANSPORT_KCONFIG_IMAGE_VERSION = 2;
+
+
+        //! flags packed into the last column of each table
+        enum kconfig_image_flags : std::uint8_t
+          {
+            store_background = 1 << 0,
+            twopf_stored     = 1 << 1,
+            store_k1         = 1 << 2,
+            store_k2         = 1 << 3,
+            store_k3         = 1 << 4
+          };
+
+
+        //! fixed-size header at the start of an image
+        struct kconfig_image_header
+          {
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t twopf_count;
+            std::uint32_t threepf_count;
+            std::uint32_t reserved;
+            std::uint64_t sqlite_size;    // size of the companion SQLite database when the image was written
+            std::int64_t  sqlite_mtime;   // modification time of the companion database, in nanoseconds since the epoch
+          };
+
+
+        //! identifies the state of an SQLite k-configuration database, so that a stale image can be detected
+        struct kconfig_database_stamp
+          {
+            std::uint64_t size;
+            std::int64_t  mtime;
+          };
+
+
+        //! read size and modification time of the database at the given path; returns false if it cannot be read.
+        //! The modification time is taken at the finest resolution the platform records, so that a rewrite which
+        //! happens to leave the size unchanged is still noticed
+        inline bool stamp_kconfig_database(const boost::filesystem::path& path, kconfig_database_stamp& stamp)
+          {
+            struct stat st;
+            if(::stat(path.c_str(), &st) != 0) return(false);
+
+#ifdef __APPLE__
+            const struct timespec& t = st.st_mtimespec;
+#else
+            const struct timespec& t = st.st_mtim;
+#endif
+
+            stamp.size  = static_cast<std::uint64_t>(st.st_size);
+            stamp.mtime = static_cast<std::int64_t>(t.tv_sec)*1000000000 + static_cast<std::int64_t>(t.tv_nsec);
+            return(true);
+          }
+
+
+        //! byte offsets of each column within an image.
+        //! Columns are stored in serial-number order, struct-of-arrays, each aligned to 8 bytes
+        class kconfig_image_layout
+          {
+
+          public:
+
+            //! compute layout for given table sizes
+            kconfig_image_layout(std::uint32_t n2, std::uint32_t n3);
+
+            //! total size of the image in bytes
+            std::size_t size() const { return(this->end); }
+
+          public:
+
+            std::size_t twopf_serial;
+            std::size_t twopf_k_conventional;
+            std::size_t twopf_k_comoving;
+            std::size_t twopf_t_exit;
+            std::size_t twopf_t_massless;
+            std::size_t twopf_flags;
+
+            std::size_t threepf_serial;
+            std::size_t threepf_k1_serial;
+            std::size_t threepf_k2_serial;
+            std::size_t threepf_k3_serial;
+            std::size_t threepf_kt_conventional;
+            std::size_t threepf_kt_comoving;
+            std::size_t threepf_alpha;
+            std::size_t threepf_beta;
+            std::size_t threepf_t_exit;
+            std::size_t threepf_t_massless;
+            std::size_t threepf_flags;
+
+          private:
+
+            std::size_t end;
+
+          };
+
+
+        inline kconfig_image_layout::kconfig_image_layout(std::uint32_t n2, std::uint32_t n3)
+          {
+            std::size_t pos = sizeof(kconfig_image_header);
+
+            auto column = [&](std::size_t width, std::size_t count) -> std::size_t
+              {
+                std::size_t start = pos;
+                pos += width*count;
+                pos = (pos + 7) & ~static_cast<std::size_t>(7);
+                return start;
+              };
+
+            twopf_serial         = column(sizeof(std::uint32_t), n2);
+            twopf_k_conventional = column(sizeof(double), n2);
+            twopf_k_comoving     = column(sizeof(double), n2);
+            twopf_t_exit         = column(sizeof(double), n2);
+            twopf_t_massless     = column(sizeof(double), n2);
+            twopf_flags          = column(sizeof(std::uint8_t), n2);
+
+            threepf_serial          = column(sizeof(std::uint32_t), n3);
+            threepf_k1_serial       = column(sizeof(std::uint32_t), n3);
+            threepf_k2_serial       = column(sizeof(std::uint32_t), n3);
+            threepf_k3_serial       = column(sizeof(std::uint32_t), n3);
+            threepf_kt_conventional = column(sizeof(double), n3);
+            threepf_kt_comoving     = column(sizeof(double), n3);
+            threepf_alpha           = column(sizeof(double), n3);
+            threepf_beta            = column(sizeof(double), n3);
+            threepf_t_exit          = column(sizeof(double), n3);
+            threepf_t_massless      = column(sizeof(double), n3);
+            threepf_flags           = column(sizeof(std::uint8_t), n3);
+
+            end = pos;
+          }
+
+
+        //! accumulate k-configuration tables and write them out as a binary image
+        class kconfig_image_builder
+          {
+
+            // INTERFACE
+
+          public:
+
+            //! add a twopf record; records should be added in ascending serial order
+            void add_twopf(const twopf_kconfig& config, bool store_bg, bool stored);
+
+            //! add a threepf record; records should be added in ascending serial order
+            void add_threepf(const threepf_kconfig& config, bool store_bg, bool k1, bool k2, bool k3);
+
+            //! write image to disk, recording the size and modification time of the companion SQLite database
+            void write(const boost::filesystem::path& path, const kconfig_database_stamp& sqlite_stamp) const;
+
+
+            // INTERNAL DATA
+
+          private:
+
+            std::vector<std::uint32_t> twopf_serial;
+            std::vector<double>        twopf_k_conventional;
+            std::vector<double>        twopf_k_comoving;
+            std::vector<double>        twopf_t_exit;
+            std::vector<double>        twopf_t_massless;
+            std::vector<std::uint8_t>  twopf_flags;
+
+            std::vector<std::uint32_t> threepf_serial;
+            std::vector<std::uint32_t> threepf_k1_serial;
+            std::vector<std::uint32_t> threepf_k2_serial;
+            std::vector<std::uint32_t> threepf_k3_serial;
+            std::vector<double>        threepf_kt_conventional;
+            std::vector<double>        threepf_kt_comoving;
+            std::vector<double>        threepf_alpha;
+            std::vector<double>        threepf_beta;
+            std::vector<double>        threepf_t_exit;
+            std::vector<double>        threepf_t_massless;
+            std::vector<std::uint8_t>  threepf_flags;
+
+          };
+
+
+        inline void kconfig_image_builder::add_twopf(const twopf_kconfig& config, bool store_bg, bool stored)
+          {
+            this->twopf_serial.push_back(config.serial);
+            this->twopf_k_conventional.push_back(config.k_conventional);
+            this->twopf_k_comoving.push_back(config.k_comoving);
+            this->twopf_t_exit.push_back(config.t_exit);
+            this->twopf_t_massless.push_back(config.t_massless);
+            this->twopf_flags.push_back(static_cast<std::uint8_t>((store_bg ? kconfig_image_flags::store_background : 0)
+                                                                  | (stored ? kconfig_image_flags::twopf_stored : 0)));
+          }
+
+
+        inline void kconfig_image_builder::add_threepf(const threepf_kconfig& config, bool store_bg, bool k1, bool k2, bool k3)
+          {
+            this->threepf_serial.push_back(config.serial);
+            this->threepf_k1_serial.push_back(config.k1_serial);
+            this->threepf_k2_serial.push_back(config.k2_serial);
+            this->threepf_k3_serial.push_back(config.k3_serial);
+            this->threepf_kt_conventional.push_back(config.kt_conventional);
+            this->threepf_kt_comoving.push_back(config.kt_comoving);
+            this->threepf_alpha.push_back(config.alpha);
+            this->threepf_beta.push_back(config.beta);
+            this->threepf_t_exit.push_back(config.t_exit);
+            this->threepf_t_massless.push_back(config.t_massless);
+            this->threepf_flags.push_back(static_cast<std::uint8_t>((store_bg ? kconfig_image_flags::store_background : 0)
+                                                                    | (k1 ? kconfig_image_flags::store_k1 : 0)
+                                                                    | (k2 ? kconfig_image_flags::store_k2 : 0)
+                                                                    | (k3 ? kconfig_image_flags::store_k3 : 0)));
+          }
+
+
+        inline void kconfig_image_builder::write(const boost::filesystem::path& path, const kconfig_database_stamp& sqlite_stamp) const
+          {
+            std::uint32_t n2 = static_cast<std::uint32_t>(this->twopf_serial.size());
+            std::uint32_t n3 = static_cast<std::uint32_t>(this->threepf_serial.size());
+            kconfig_image_layout layout(n2, n3);
+
+            // assemble the image in memory; it is written in a single operation
+            std::vector<char> image(layout.size(), 0);
+
+            kconfig_image_header header;
+            std::memset(&header, 0, sizeof(header));
+            std::memcpy(header.magic, CPPTRANSPORT_KCONFIG_IMAGE_MAGIC, sizeof(header.magic));
+            header.version       = CPPTRANSPORT_KCONFIG_IMAGE_VERSION;
+            header.twopf_count   = n2;
+            header.threepf_count = n3;
+            header.sqlite_size   = sqlite_stamp.size;
+            header.sqlite_mtime  = sqlite_stamp.mtime;
+            std::memcpy(image.data(), &header, sizeof(header));
+
+            auto copy = [&](std::size_t offset, const auto& column)
+              {
+                if(!column.empty()) std::memcpy(image.data() + offset, column.data(), column.size()*sizeof(column[0]));
+              };
+
+            copy(layout.twopf_serial, this->twopf_serial);
+            copy(layout.twopf_k_conventional, this->twopf_k_conventional);
+            copy(layout.twopf_k_comoving, this->twopf_k_comoving);
+            copy(layout.twopf_t_exit, this->twopf_t_exit);
+            copy(layout.twopf_t_massless, this->twopf_t_massless);
+            copy(layout.twopf_flags, this->twopf_flags);
+
+            copy(layout.threepf_serial, this->threepf_serial);
+            copy(layout.threepf_k1_serial, this->threepf_k1_serial);
+            copy(layout.threepf_k2_serial, this->threepf_k2_serial);
+            copy(layout.threepf_k3_serial, this->threepf_k3_serial);
+            copy(layout.threepf_kt_conventional, this->threepf_kt_conventional);
+            copy(layout.threepf_kt_comoving, this->threepf_kt_comoving);
+            copy(layout.threepf_alpha, this->threepf_alpha);
+            copy(layout.threepf_beta, this->threepf_beta);
+            copy(layout.threepf_t_exit, this->threepf_t_exit);
+            copy(layout.threepf_t_massless, this->threepf_t_massless);
+            copy(layout.threepf_flags, this->threepf_flags);
+
+            std::ofstream out(path.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+            out.write(image.data(), image.size());
+            out.close();
+
+            if(!out)
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_KCONFIG_IMAGE_WRITE_FAIL << " '" << path.string() << "'";
+                throw runtime_exception(exception_type::REPOSITORY_BACKEND_ERROR, msg.str());
+              }
+          }
+
+
+        //! read-only memory map of a binary k-configuration image.
+        //! The mapping is shared, so all processes on a node which load the same task
+        //! share a single copy through the page cache
+        class kconfig_database_image
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! map the image at the given path; check valid() before use
+            kconfig_database_image(const boost::filesystem::path& path);
+
+            //! disable copying
+            kconfig_database_image(const kconfig_database_image&) = delete;
+
+            //! destructor unmaps the image
+            ~kconfig_database_image();
+
+
+            // INTERFACE
+
+          public:
+
+            //! was the image mapped and its header recognized?
+            bool valid() const { return(this->base != nullptr); }
+
+            //! size of the companion SQLite database when the image was written
+            std::uint64_t get_sqlite_size() const { return(this->header()->sqlite_size); }
+
+            //! modification time of the companion SQLite database when the image was written
+            std::int64_t get_sqlite_mtime() const { return(this->header()->sqlite_mtime); }
+
+            //! number of twopf records
+            std::uint32_t twopf_size() const { return(this->header()->twopf_count); }
+
+            //! number of threepf records
+            std::uint32_t threepf_size() const { return(this->header()->threepf_count); }
+
+            //! get index of a twopf record from its serial number, or twopf_size() if not present;
+            //! constant time when serial numbers are dense
+            std::uint32_t twopf_index(unsigned int serial) const;
+
+            //! access a column by byte offset; offsets are obtained from get_layout()
+            template <typename Type>
+            const Type* column(std::size_t offset) const { return(reinterpret_cast<const Type*>(static_cast<const char*>(this->base) + offset)); }
+
+            //! get layout of the image
+            const kconfig_image_layout& get_layout() const { return(this->layout); }
+
+
+            // FACTORY
+
+          public:
+
+            //! locate and map the image accompanying an SQLite k-configuration database.
+            //! Returns nullptr if there is no image, for example because the database is held in memory,
+            //! or if the image does not match the current database
+            static std::unique_ptr<kconfig_database_image> open_companion(sqlite3* handle);
+
+
+            // INTERNAL API
+
+          protected:
+
+            //! get header
+            const kconfig_image_header* header() const { return(static_cast<const kconfig_image_header*>(this->base)); }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! base address of mapping, or nullptr if mapping failed
+            void* base;
+
+            //! size of mapping
+            std::size_t length;
+
+            //! column layout
+            kconfig_image_layout layout;
+
+          };
+
+
+        inline kconfig_database_image::kconfig_database_image(const boost::filesystem::path& path)
+          : base(nullptr),
+            length(0),
+            layout(0, 0)
+          {
+            int fd = ::open(path.c_str(), O_RDONLY);
+            if(fd < 0) return;
+
+            struct stat st;
+            if(::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(kconfig_image_header))
+              {
+                ::close(fd);
+                return;
+              }
+
+            void* addr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd);    // mapping remains valid after the descriptor is closed
+            if(addr == MAP_FAILED) return;
+
+            const kconfig_image_header* hdr = static_cast<const kconfig_image_header*>(addr);
+            kconfig_image_layout expected(hdr->twopf_count, hdr->threepf_count);
+
+            if(std::memcmp(hdr->magic, CPPTRANSPORT_KCONFIG_IMAGE_MAGIC, sizeof(hdr->magic)) != 0
+               || hdr->version != CPPTRANSPORT_KCONFIG_IMAGE_VERSION
+               || expected.size() != static_cast<std::size_t>(st.st_size))
+              {
+                ::munmap(addr, static_cast<std::size_t>(st.st_size));
+                return;
+              }
+
+            // columns are consumed in order, so advise the kernel to read ahead
+            ::madvise(addr, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+
+            this->base   = addr;
+            this->length = static_cast<std::size_t>(st.st_size);
+            this->layout = expected;
+          }
+
+
+        inline kconfig_database_image::~kconfig_database_image()
+          {
+            if(this->base != nullptr) ::munmap(this->base, this->length);
+          }
+
+
+        inline std::uint32_t kconfig_database_image::twopf_index(unsigned int serial) const
+          {
+            const std::uint32_t* serials = this->column<std::uint32_t>(this->layout.twopf_serial);
+            std::uint32_t n = this->twopf_size();
+
+            // serial numbers are usually dense, so try direct indexing first
+            if(serial < n && serials[serial] == serial) return(serial);
+
+            const std::uint32_t* t = std::lower_bound(serials, serials + n, serial);
+            return(t != serials + n && *t == serial ? static_cast<std::uint32_t>(t - serials) : n);
+          }
+
+
+        inline std::unique_ptr<kconfig_database_image> kconfig_database_image::open_companion(sqlite3* handle)
+          {
+            // in-memory and temporary databases have an empty filename
+            const char* filename = sqlite3_db_filename(handle, "main");
+            if(filename == nullptr || *filename == '\0') return(nullptr);
+
+            boost::filesystem::path db_path(filename);
+            boost::filesystem::path image_path(db_path.string() + CPPTRANSPORT_KCONFIG_IMAGE_EXTENSION);
+            if(!boost::filesystem::exists(image_path)) return(nullptr);
+
+            std::unique_ptr<kconfig_database_image> image = std::make_unique<kconfig_database_image>(image_path);
+
+            // the image and database are committed together; if the database has since been resized or rewritten,
+            // the image is stale. A database which has merely been copied also gets a new modification time;
+            // then the image is rejected unnecessarily, but the only cost is a fallback to reading from SQLite
+            kconfig_database_stamp stamp;
+            if(!image->valid() || !stamp_kconfig_database(db_path, stamp)) return(nullptr);
+            if(image->get_sqlite_size() != stamp.size || image->get_sqlite_mtime() != stamp.mtime) return(nullptr);
+
+            return(image);
+          }
+
+      }   // namespace configuration_database
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_KCONFIG_DATABASE_IMAGE_H
@@ -28,7 +28,8 @@
 #define CPPTRANSPORT_THREEPF_CONFIG_DATABASE_H
 
 
-#include <map>
+#include <vector>
+#include <algorithm>
 
 #include <assert.h>
 
@@ -40,6 +41,7 @@
 #include "transport-runtime/tasks/configuration-database/generic_record_iterator.h"
 #include "transport-runtime/tasks/configuration-database/generic_config_iterator.h"
 #include "transport-runtime/tasks/configuration-database/generic_value_iterator.h"
+#include "transport-runtime/tasks/configuration-database/kconfig_database_image.h"
 
 #include "transport-runtime/defaults.h"
 #include "transport-runtime/messages.h"
@@ -116,7 +118,7 @@ namespace transport
       };
 
 
-    threepf_kconfig_record::threepf_kconfig_record(threepf_kconfig& k, bool b, bool k1, bool k2, bool k3)
+    inline threepf_kconfig_record::threepf_kconfig_record(threepf_kconfig& k, bool b, bool k1, bool k2, bool k3)
       : record(k),
         store_background(b),
         store_twopf_k1(k1),
@@ -140,8 +142,10 @@ namespace transport
 
       private:
 
-        //! alias for database data structure
-        typedef std::map< unsigned int, threepf_kconfig_record > database_type;
+        //! alias for database data structure;
+        //! records are held contiguously in ascending serial order, which keeps large databases compact
+        //! and allows lookup by serial number in constant time when serial numbers are dense
+        typedef std::vector< std::pair< unsigned int, threepf_kconfig_record > > database_type;
 
 
         // RECORD VALUED ITERATOR
@@ -300,6 +304,23 @@ namespace transport
         //! Serialize this object
         void write(sqlite3* handle);
 
+        //! Add database to a binary image
+        void write(configuration_database::kconfig_image_builder& image) const;
+
+
+        // INTERNAL API
+
+      protected:
+
+        //! populate database from a binary image
+        void ingest(const configuration_database::kconfig_database_image& image);
+
+        //! update cached meta-information to include a new record
+        void update_cache(const threepf_kconfig& config);
+
+        //! find position of a record with a given serial number, or end() if not present
+        database_type::size_type find_index(unsigned int serial) const;
+
 
         // INTERNAL DATA
 
@@ -350,7 +371,7 @@ namespace transport
       };
 
 
-    threepf_kconfig_database::threepf_kconfig_database(double cn)
+    inline threepf_kconfig_database::threepf_kconfig_database(double cn)
       : comoving_normalization(cn),
         serial(0),
         ktmax_conventional(-std::numeric_limits<double>::max()),
@@ -367,7 +388,7 @@ namespace transport
       }
 
 
-    threepf_kconfig_database::threepf_kconfig_database(double cn, sqlite3* handle, twopf_kconfig_database& twopf_db)
+    inline threepf_kconfig_database::threepf_kconfig_database(double cn, sqlite3* handle, twopf_kconfig_database& twopf_db)
       : comoving_normalization(cn),
         serial(0),
         ktmax_conventional(-std::numeric_limits<double>::max()),
@@ -381,6 +402,15 @@ namespace transport
         store_background(false),
         modified(false)
       {
+        // if a binary image accompanies this database, ingest it directly rather than stepping through SQLite rows;
+        // the image carries everything needed, so no lookups into the twopf database are required
+        std::unique_ptr<configuration_database::kconfig_database_image> image = configuration_database::kconfig_database_image::open_companion(handle);
+        if(image)
+          {
+            this->ingest(*image);
+            return;
+          }
+
         std::ostringstream query_stmt;
 
         query_stmt
@@ -399,7 +429,7 @@ namespace transport
 	        << "threepf_kconfig.store_k1        AS store_k1, "
 	        << "threepf_kconfig.store_k2        AS store_k2, "
 	        << "threepf_kconfig.store_k3        AS store_k3 "
-	        << "FROM threepf_kconfig;";
+	        << "FROM threepf_kconfig ORDER BY serial;";
 
         sqlite3_stmt* stmt;
         sqlite3_operations::check_stmt(handle, sqlite3_prepare_v2(handle, query_stmt.str().c_str(), query_stmt.str().length()+1, &stmt, nullptr));
@@ -438,28 +468,15 @@ namespace transport
 		            config.k3_conventional = (*k3)->k_conventional;
 		            config.k3_comoving     = (*k3)->k_comoving;
 
-		            if(config.serial+1 > serial)                             this->serial             = config.serial+1;
-		            if(config.kt_conventional > this->ktmax_conventional)    this->ktmax_conventional = config.kt_conventional;
-		            if(config.kt_conventional < this->ktmin_conventional)    this->ktmin_conventional = config.kt_conventional;
-		            if(config.kt_comoving > this->ktmax_comoving)            this->ktmax_comoving     = config.kt_comoving;
-		            if(config.kt_comoving < this->ktmin_comoving)            this->ktmin_comoving     = config.kt_comoving;
-
-                double k_max_conventional = std::max(std::max(config.k1_conventional, config.k2_conventional), config.k3_conventional);
-                double k_min_conventional = std::min(std::min(config.k1_conventional, config.k2_conventional), config.k3_conventional);
-                double k_max_comoving     = std::max(std::max(config.k1_comoving, config.k2_comoving), config.k3_comoving);
-                double k_min_comoving     = std::min(std::min(config.k1_comoving, config.k2_comoving), config.k3_comoving);
-
-                if(k_max_conventional > this->kmax_2pf_conventional) this->kmax_2pf_conventional = k_max_conventional;
-                if(k_min_conventional < this->kmin_2pf_conventional) this->kmin_2pf_conventional = k_min_conventional;
-                if(k_max_comoving > this->kmax_2pf_comoving)         this->kmax_2pf_comoving     = k_max_comoving;
-                if(k_min_comoving < this->kmin_2pf_comoving)         this->kmin_2pf_comoving     = k_min_comoving;
+		            if(config.serial+1 > serial) this->serial = config.serial+1;
+                this->update_cache(config);
 
 		            bool store_bg = (sqlite3_column_int(stmt, 10) > 0);
 		            bool store_k1 = (sqlite3_column_int(stmt, 11) > 0);
 		            bool store_k2 = (sqlite3_column_int(stmt, 12) > 0);
 		            bool store_k3 = (sqlite3_column_int(stmt, 13) > 0);
 
-		            this->database.emplace(config.serial, threepf_kconfig_record(config, store_bg, store_k1, store_k2, store_k3));
+		            this->database.emplace_back(config.serial, threepf_kconfig_record(config, store_bg, store_k1, store_k2, store_k3));
 	            }
             else
 	            {
@@ -474,7 +491,7 @@ namespace transport
       }
 
 
-		void threepf_kconfig_database::clear()
+		inline void threepf_kconfig_database::clear()
 			{
 		    this->database.clear();
 
@@ -617,20 +634,7 @@ namespace transport
 
 				// otherwise, policy confirms that this configuration should be retained
 
-				if(config.kt_conventional > this->ktmax_conventional) this->ktmax_conventional = config.kt_conventional;
-				if(config.kt_conventional < this->ktmin_conventional) this->ktmin_conventional = config.kt_conventional;
-				if(config.kt_comoving > this->ktmax_comoving) this->ktmax_comoving = config.kt_comoving;
-				if(config.kt_comoving < this->ktmin_comoving) this->ktmin_comoving = config.kt_comoving;
-
-				double k_max_conventional = std::max(std::max(config.k1_conventional, config.k2_conventional), config.k3_conventional);
-				double k_min_conventional = std::min(std::min(config.k1_conventional, config.k2_conventional), config.k3_conventional);
-				double k_max_comoving     = std::max(std::max(config.k1_comoving, config.k2_comoving), config.k3_comoving);
-				double k_min_comoving     = std::min(std::min(config.k1_comoving, config.k2_comoving), config.k3_comoving);
-
-				if(k_max_conventional > this->kmax_2pf_conventional) this->kmax_2pf_conventional = k_max_conventional;
-				if(k_min_conventional < this->kmin_2pf_conventional) this->kmin_2pf_conventional = k_min_conventional;
-				if(k_max_comoving > this->kmax_2pf_comoving)         this->kmax_2pf_comoving     = k_max_comoving;
-				if(k_min_comoving < this->kmin_2pf_comoving)         this->kmin_2pf_comoving     = k_min_comoving;
+				this->update_cache(config);
 
         // determine whether constituent 2pf values need to be stored with this configuration
         bool k1_store = !k1_rec->is_stored();
@@ -642,15 +646,16 @@ namespace transport
         bool k3_store = !k3_rec->is_stored();
         if(k3_store) k3_rec->set_stored();
 
-        std::pair<database_type::iterator, bool> emplaced_value= this->database.emplace(config.serial, threepf_kconfig_record(config, this->store_background, k1_store, k2_store, k3_store));
+        // serial numbers are issued in ascending order, so appending keeps the database sorted
+        this->database.emplace_back(config.serial, threepf_kconfig_record(config, this->store_background, k1_store, k2_store, k3_store));
 				this->store_background = false;
 
-				this->modified = emplaced_value.second;
-        return threepf_kconfig_database::record_iterator(emplaced_value.first);
+				this->modified = true;
+        return threepf_kconfig_database::record_iterator(std::prev(this->database.end()));
       }
 
 
-    void threepf_kconfig_database::write(sqlite3* handle)
+    inline void threepf_kconfig_database::write(sqlite3* handle)
       {
         std::ostringstream create_stmt;
 
@@ -729,22 +734,131 @@ namespace transport
       }
 
 
-    threepf_kconfig_database::record_iterator threepf_kconfig_database::lookup(unsigned int serial)
+    inline threepf_kconfig_database::record_iterator threepf_kconfig_database::lookup(unsigned int serial)
 	    {
-        database_type::iterator t = this->database.find(serial);          // find has logarithmic complexity
-
-        return threepf_kconfig_database::record_iterator(t);
+        return threepf_kconfig_database::record_iterator(this->database.begin() + this->find_index(serial));
 	    }
 
 
-    threepf_kconfig_database::const_record_iterator threepf_kconfig_database::lookup(unsigned int serial) const
+    inline threepf_kconfig_database::const_record_iterator threepf_kconfig_database::lookup(unsigned int serial) const
 	    {
-        database_type::const_iterator t = this->database.find(serial);    // find has logarithmic complexity
-
-        return threepf_kconfig_database::const_record_iterator(t);
+        return threepf_kconfig_database::const_record_iterator(this->database.cbegin() + this->find_index(serial));
 	    }
 
 
+    inline threepf_kconfig_database::database_type::size_type threepf_kconfig_database::find_index(unsigned int serial) const
+      {
+        // serial numbers are usually dense, in which case the record is found by direct indexing
+        if(serial < this->database.size() && this->database[serial].first == serial) return(serial);
+
+        // otherwise fall back to binary search
+        database_type::const_iterator t = std::lower_bound(this->database.cbegin(), this->database.cend(), serial,
+                                                           [](const database_type::value_type& a, unsigned int b) -> bool { return(a.first < b); });
+
+        if(t == this->database.cend() || t->first != serial) return(this->database.size());
+        return(static_cast<database_type::size_type>(std::distance(this->database.cbegin(), t)));
+      }
+
+
+    inline void threepf_kconfig_database::update_cache(const threepf_kconfig& config)
+      {
+        if(config.kt_conventional > this->ktmax_conventional) this->ktmax_conventional = config.kt_conventional;
+        if(config.kt_conventional < this->ktmin_conventional) this->ktmin_conventional = config.kt_conventional;
+        if(config.kt_comoving > this->ktmax_comoving)         this->ktmax_comoving     = config.kt_comoving;
+        if(config.kt_comoving < this->ktmin_comoving)         this->ktmin_comoving     = config.kt_comoving;
+
+        double k_max_conventional = std::max(std::max(config.k1_conventional, config.k2_conventional), config.k3_conventional);
+        double k_min_conventional = std::min(std::min(config.k1_conventional, config.k2_conventional), config.k3_conventional);
+        double k_max_comoving     = std::max(std::max(config.k1_comoving, config.k2_comoving), config.k3_comoving);
+        double k_min_comoving     = std::min(std::min(config.k1_comoving, config.k2_comoving), config.k3_comoving);
+
+        if(k_max_conventional > this->kmax_2pf_conventional) this->kmax_2pf_conventional = k_max_conventional;
+        if(k_min_conventional < this->kmin_2pf_conventional) this->kmin_2pf_conventional = k_min_conventional;
+        if(k_max_comoving > this->kmax_2pf_comoving)         this->kmax_2pf_comoving     = k_max_comoving;
+        if(k_min_comoving < this->kmin_2pf_comoving)         this->kmin_2pf_comoving     = k_min_comoving;
+      }
+
+
+    inline void threepf_kconfig_database::ingest(const configuration_database::kconfig_database_image& image)
+      {
+        const configuration_database::kconfig_image_layout& layout = image.get_layout();
+
+        const double* k_conventional = image.column<double>(layout.twopf_k_conventional);
+        const double* k_comoving     = image.column<double>(layout.twopf_k_comoving);
+
+        const std::uint32_t* serials         = image.column<std::uint32_t>(layout.threepf_serial);
+        const std::uint32_t* k1_serials      = image.column<std::uint32_t>(layout.threepf_k1_serial);
+        const std::uint32_t* k2_serials      = image.column<std::uint32_t>(layout.threepf_k2_serial);
+        const std::uint32_t* k3_serials      = image.column<std::uint32_t>(layout.threepf_k3_serial);
+        const double*        kt_conventional = image.column<double>(layout.threepf_kt_conventional);
+        const double*        kt_comoving     = image.column<double>(layout.threepf_kt_comoving);
+        const double*        alpha           = image.column<double>(layout.threepf_alpha);
+        const double*        beta            = image.column<double>(layout.threepf_beta);
+        const double*        t_exit          = image.column<double>(layout.threepf_t_exit);
+        const double*        t_massless      = image.column<double>(layout.threepf_t_massless);
+        const std::uint8_t*  flags           = image.column<std::uint8_t>(layout.threepf_flags);
+
+        this->database.clear();
+        this->database.reserve(image.threepf_size());
+
+        for(std::uint32_t i = 0; i < image.threepf_size(); ++i)
+          {
+            threepf_kconfig config;
+
+            config.serial          = serials[i];
+            config.kt_conventional = kt_conventional[i];
+            config.kt_comoving     = kt_comoving[i];
+            config.alpha           = alpha[i];
+            config.beta            = beta[i];
+            config.t_exit          = t_exit[i];
+            config.t_massless      = t_massless[i];
+
+            config.k1_serial = k1_serials[i];
+            config.k2_serial = k2_serials[i];
+            config.k3_serial = k3_serials[i];
+
+            // wavenumbers are read from the twopf columns of the same image
+            std::uint32_t k1 = image.twopf_index(config.k1_serial);
+            std::uint32_t k2 = image.twopf_index(config.k2_serial);
+            std::uint32_t k3 = image.twopf_index(config.k3_serial);
+
+            if(k1 == image.twopf_size() || k2 == image.twopf_size() || k3 == image.twopf_size())
+              {
+                std::ostringstream msg;
+                msg << CPPTRANSPORT_THREEPF_DATABASE_IMAGE_MISS << " " << config.serial;
+                throw runtime_exception(exception_type::DATA_CONTAINER_ERROR, msg.str());
+              }
+
+            config.k1_conventional = k_conventional[k1];
+            config.k1_comoving     = k_comoving[k1];
+            config.k2_conventional = k_conventional[k2];
+            config.k2_comoving     = k_comoving[k2];
+            config.k3_conventional = k_conventional[k3];
+            config.k3_comoving     = k_comoving[k3];
+
+            if(config.serial+1 > this->serial) this->serial = config.serial+1;
+            this->update_cache(config);
+
+            this->database.emplace_back(config.serial,
+                                        threepf_kconfig_record(config,
+                                                               (flags[i] & configuration_database::kconfig_image_flags::store_background) != 0,
+                                                               (flags[i] & configuration_database::kconfig_image_flags::store_k1) != 0,
+                                                               (flags[i] & configuration_database::kconfig_image_flags::store_k2) != 0,
+                                                               (flags[i] & configuration_database::kconfig_image_flags::store_k3) != 0));
+          }
+      }
+
+
+    inline void threepf_kconfig_database::write(configuration_database::kconfig_image_builder& image) const
+      {
+        for(database_type::const_iterator t = this->database.begin(); t != this->database.end(); ++t)
+          {
+            image.add_threepf(*t->second, t->second.is_background_stored(),
+                              t->second.is_twopf_k1_stored(), t->second.is_twopf_k2_stored(), t->second.is_twopf_k3_stored());
+          }
+      }
+
+
   }   // namespace transport
 
 
@@ -95,7 +95,7 @@ namespace transport
 			};
 
 
-		time_config_record::time_config_record(time_config& t, bool s)
+		inline time_config_record::time_config_record(time_config& t, bool s)
 			: record(t),
 		    store(s)
 			{
@@ -261,18 +261,18 @@ namespace transport
 			};
 
 
-		time_config_database::time_config_database()
+		inline time_config_database::time_config_database()
 			{
 			}
 
 
-    void time_config_database::clear()
+    inline void time_config_database::clear()
 	    {
         this->database.clear();
 	    }
 
 
-		void time_config_database::add_record(double t, bool store, unsigned int serial)
+		inline void time_config_database::add_record(double t, bool store, unsigned int serial)
 			{
 				time_config config;
 
@@ -41,6 +41,7 @@
 #include "transport-runtime/tasks/configuration-database/generic_record_iterator.h"
 #include "transport-runtime/tasks/configuration-database/generic_config_iterator.h"
 #include "transport-runtime/tasks/configuration-database/generic_value_iterator.h"
+#include "transport-runtime/tasks/configuration-database/kconfig_database_image.h"
 
 #include "transport-runtime/defaults.h"
 #include "transport-runtime/messages.h"
@@ -114,7 +115,7 @@ namespace transport
       };
 
 
-    twopf_kconfig_record::twopf_kconfig_record(twopf_kconfig& k, bool s)
+    inline twopf_kconfig_record::twopf_kconfig_record(twopf_kconfig& k, bool s)
       : record(k),
         store_background(s),
         stored(false)
@@ -288,6 +289,9 @@ namespace transport
         //! rebuild caches after deleting records
         void rebuild_cache();
 
+        //! populate database from a binary image
+        void ingest(const configuration_database::kconfig_database_image& image);
+
 
         // INTERFACE -- LOOKUP META-INFORMATION
 
@@ -313,6 +317,9 @@ namespace transport
         //! Write database out to SQLite
         void write(sqlite3* handle);
 
+        //! Add database to a binary image
+        void write(configuration_database::kconfig_image_builder& image) const;
+
 
         // INTERNAL DATA
 
@@ -356,7 +363,7 @@ namespace transport
       };
 
 
-    twopf_kconfig_database::twopf_kconfig_database(double cn)
+    inline twopf_kconfig_database::twopf_kconfig_database(double cn)
       : comoving_normalization(cn),
         serial(0),
         kmax_conventional(-std::numeric_limits<double>::max()),
@@ -369,7 +376,7 @@ namespace transport
       }
 
 
-    twopf_kconfig_database::twopf_kconfig_database(double cn, sqlite3* handle)
+    inline twopf_kconfig_database::twopf_kconfig_database(double cn, sqlite3* handle)
       : comoving_normalization(cn),
         serial(0),
         kmax_conventional(-std::numeric_limits<double>::max()),
@@ -379,6 +386,14 @@ namespace transport
         store_background(false),
         modified(false)
       {
+        // if a binary image accompanies this database, ingest it directly rather than stepping through SQLite rows
+        std::unique_ptr<configuration_database::kconfig_database_image> image = configuration_database::kconfig_database_image::open_companion(handle);
+        if(image)
+          {
+            this->ingest(*image);
+            return;
+          }
+
         std::ostringstream query_stmt;
 
 		    query_stmt
@@ -439,7 +454,7 @@ namespace transport
       }
 
 
-    void twopf_kconfig_database::clear()
+    inline void twopf_kconfig_database::clear()
 	    {
         this->database.clear();
 
@@ -448,7 +463,7 @@ namespace transport
 	    }
 
 
-    twopf_kconfig_database::record_iterator twopf_kconfig_database::add_record(double k_conventional)
+    inline twopf_kconfig_database::record_iterator twopf_kconfig_database::add_record(double k_conventional)
       {
         // insert a record into the database
         twopf_kconfig config;
@@ -476,7 +491,7 @@ namespace transport
       }
 
 
-    twopf_kconfig_database::record_iterator twopf_kconfig_database::lookup(unsigned int serial)
+    inline twopf_kconfig_database::record_iterator twopf_kconfig_database::lookup(unsigned int serial)
       {
         database_type::iterator t = this->database.find(serial);		// find has logarithmic complexity
 
@@ -484,7 +499,7 @@ namespace transport
       }
 
 
-    twopf_kconfig_database::const_record_iterator twopf_kconfig_database::lookup(unsigned int serial) const
+    inline twopf_kconfig_database::const_record_iterator twopf_kconfig_database::lookup(unsigned int serial) const
 	    {
         database_type::const_iterator t = this->database.find(serial);		// find has logarithmic complexity
 
@@ -492,7 +507,7 @@ namespace transport
 	    }
 
 
-    twopf_kconfig_database::record_iterator twopf_kconfig_database::find(double k_conventional)
+    inline twopf_kconfig_database::record_iterator twopf_kconfig_database::find(double k_conventional)
       {
         index_type::const_iterator t = this->index_on_k.find(k_conventional);		// find has logarithmic complexity
 
@@ -502,7 +517,7 @@ namespace transport
       }
 
 
-		twopf_kconfig_database::const_record_iterator twopf_kconfig_database::find(double k_conventional) const
+		inline twopf_kconfig_database::const_record_iterator twopf_kconfig_database::find(double k_conventional) const
 			{
 				index_type::const_iterator t = this->index_on_k.find(k_conventional);		// find has logarithmic complexity
 
@@ -512,7 +527,7 @@ namespace transport
 			}
 
 
-    void twopf_kconfig_database::delete_record(unsigned int serial)
+    inline void twopf_kconfig_database::delete_record(unsigned int serial)
       {
         database_type::iterator t = this->database.find(serial);
         index_type::const_iterator u = this->index_on_k.find(t->second->k_conventional);
@@ -524,7 +539,7 @@ namespace transport
       }
 
 
-    void twopf_kconfig_database::rebuild_cache()
+    inline void twopf_kconfig_database::rebuild_cache()
       {
         // reset serial number
         this->serial = 0;
@@ -547,7 +562,52 @@ namespace transport
       }
 
 
-    void twopf_kconfig_database::write(sqlite3* handle)
+    inline void twopf_kconfig_database::ingest(const configuration_database::kconfig_database_image& image)
+      {
+        const configuration_database::kconfig_image_layout& layout = image.get_layout();
+
+        const std::uint32_t* serials      = image.column<std::uint32_t>(layout.twopf_serial);
+        const double*        conventional = image.column<double>(layout.twopf_k_conventional);
+        const double*        comoving     = image.column<double>(layout.twopf_k_comoving);
+        const double*        t_exit       = image.column<double>(layout.twopf_t_exit);
+        const double*        t_massless   = image.column<double>(layout.twopf_t_massless);
+        const std::uint8_t*  flags        = image.column<std::uint8_t>(layout.twopf_flags);
+
+        this->database.clear();
+        this->index_on_k.clear();
+
+        for(std::uint32_t i = 0; i < image.twopf_size(); ++i)
+          {
+            twopf_kconfig config;
+
+            config.serial         = serials[i];
+            config.k_conventional = conventional[i];
+            config.k_comoving     = comoving[i];
+            config.t_exit         = t_exit[i];
+            config.t_massless     = t_massless[i];
+
+            // records are stored in serial order, so each insertion is at the end
+            database_type::iterator t = this->database.emplace_hint(this->database.end(), config.serial,
+                                                                    twopf_kconfig_record(config, (flags[i] & configuration_database::kconfig_image_flags::store_background) != 0));
+            if(flags[i] & configuration_database::kconfig_image_flags::twopf_stored) t->second.set_stored();
+
+            this->index_on_k.emplace(config.k_conventional, t);
+          }
+
+        this->rebuild_cache();
+      }
+
+
+    inline void twopf_kconfig_database::write(configuration_database::kconfig_image_builder& image) const
+      {
+        for(database_type::const_iterator t = this->database.begin(); t != this->database.end(); ++t)
+          {
+            image.add_twopf(*t->second, t->second.is_background_stored(), t->second.is_stored());
+          }
+      }
+
+
+    inline void twopf_kconfig_database::write(sqlite3* handle)
       {
         std::ostringstream create_stmt;
 
@@ -30,6 +30,7 @@
 
 #include "transport-runtime/tasks/integration_detail/common.h"
 #include "transport-runtime/tasks/configuration-database/time_config_database.h"
+#include "transport-runtime/tasks/configuration-database/kconfig_database_image.h"
 #include "transport-runtime/models/advisory_classes.h"
 
 #include "transport-runtime/utilities/random_string.h"
@@ -181,6 +182,9 @@ namespace transport
 		    //! write k-configuration database to disk
 		    virtual void write_kconfig_database(sqlite3* handle) = 0;
 
+        //! add k-configuration database to a binary image
+        virtual void write_kconfig_database(configuration_database::kconfig_image_builder& image) const = 0;
+
 		    //! check whether databases have been modified
 		    virtual bool is_kconfig_database_modified() const = 0;
 
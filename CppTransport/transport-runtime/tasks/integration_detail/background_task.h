@@ -81,6 +81,9 @@ namespace transport
 		    //! Throw an exception if an attempt is made to write a background k-configuration database
 		    virtual void write_kconfig_database(sqlite3* handle) override { throw std::runtime_error(CPPTRANSPORT_KCONFIG_BACKGROUND_TASK); }
 
+        //! Throw an exception if an attempt is made to write a background k-configuration database
+        virtual void write_kconfig_database(configuration_database::kconfig_image_builder& image) const override { throw std::runtime_error(CPPTRANSPORT_KCONFIG_BACKGROUND_TASK); }
+
         //! Throw an exception if an attempt is made to write a background k-configuration database
 		    virtual bool is_kconfig_database_modified() const override { throw std::runtime_error(CPPTRANSPORT_KCONFIG_BACKGROUND_TASK); }
 
@@ -180,6 +180,9 @@ namespace transport
         //! Write k-configuration database to disk
         virtual void write_kconfig_database(sqlite3* handle) override;
 
+        //! Add k-configuration databases to a binary image
+        virtual void write_kconfig_database(configuration_database::kconfig_image_builder& image) const override;
+
 		    //! Check whether k-configuration databases have been modified
 		    virtual bool is_kconfig_database_modified() const override { return(this->threepf_db->is_modified() || this->twopf_db_task<number>::is_kconfig_database_modified()); }
 
@@ -253,6 +256,14 @@ namespace transport
 			}
 
 
+    template <typename number>
+    void threepf_task<number>::write_kconfig_database(configuration_database::kconfig_image_builder& image) const
+      {
+        this->twopf_db_task<number>::write_kconfig_database(image);
+        this->threepf_db->write(image);
+      }
+
+
     template <typename number>
     const time_config_database threepf_task<number>::get_time_config_database(const threepf_kconfig& config) const
       {
@@ -272,6 +272,9 @@ namespace transport
         //! Write k-configuration database to disk
         virtual void write_kconfig_database(sqlite3* handle) override;
 
+        //! Add k-configuration database to a binary image
+        virtual void write_kconfig_database(configuration_database::kconfig_image_builder& image) const override;
+
 		    //! Check whether twopf database has been modified
 		    virtual bool is_kconfig_database_modified() const override { return(this->twopf_db->is_modified()); }
 
@@ -531,6 +534,13 @@ namespace transport
 	    }
 
 
+    template <typename number>
+    void twopf_db_task<number>::write_kconfig_database(configuration_database::kconfig_image_builder& image) const
+      {
+        this->twopf_db->write(image);
+      }
+
+
     template <typename number>
     const time_config_database twopf_db_task<number>::get_time_config_database(const twopf_kconfig& config) const
       {
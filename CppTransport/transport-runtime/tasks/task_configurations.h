@@ -31,6 +31,7 @@
 #include <iostream>
 
 #include "transport-runtime/messages.h"
+#include "transport-runtime/utilities/hot_path_instrument.h"
 
 // forward-declare derived products if needed
 #include "transport-runtime/derived-products/derived_product_forward_declare.h"
@@ -262,6 +263,9 @@ namespace transport
 
         //! hostname of worker
         std::string hostname;
+
+        //! hot-path profile summary, if the integration was instrumented
+        hot_path::profile_summary profile;
 			};
 
 
@@ -279,7 +279,7 @@ namespace transport
 	    };
 
 
-		transaction_manager::transaction_manager(const boost::filesystem::path l, std::unique_ptr<transaction_handler> h)
+		inline transaction_manager::transaction_manager(const boost::filesystem::path l, std::unique_ptr<transaction_handler> h)
 			: handler(std::move(h)),
         lockfile(std::move(l)),
 			  committed(false),
@@ -321,7 +321,7 @@ namespace transport
 			}
 
 
-    transaction_manager::~transaction_manager()
+    inline transaction_manager::~transaction_manager()
 			{
 		    // rollback the transaction if it was not committed
 		    if(!this->committed && !this->dead)
@@ -344,7 +344,7 @@ namespace transport
 		// TRANSACTION MANAGEMENT
 
 
-		void transaction_manager::commit()
+		inline void transaction_manager::commit()
 			{
         // check lockfile is present; if not, we have somehow lost the exclusive lock
         // so rollback and throw an exception
@@ -390,7 +390,7 @@ namespace transport
 			}
 
 
-		void transaction_manager::rollback()
+		inline void transaction_manager::rollback()
 			{
         // First, unwind all journalled actions
 
@@ -431,7 +431,7 @@ namespace transport
 		// JOURNALLING
 
 
-		void transaction_manager::journal_deposit(const boost::filesystem::path& journal, const boost::filesystem::path& target)
+		inline void transaction_manager::journal_deposit(const boost::filesystem::path& journal, const boost::filesystem::path& target)
 			{
 				if(this->committed) throw runtime_exception(exception_type::TRANSACTION_ERROR, CPPTRANSPORT_TRANSACTION_COMMITTED);
 				if(this->dead)      throw runtime_exception(exception_type::TRANSACTION_ERROR, CPPTRANSPORT_TRANSACTION_DEAD);
@@ -440,7 +440,7 @@ namespace transport
 			}
 
 
-    void transaction_manager::journal_move(const boost::filesystem::path& source, const boost::filesystem::path& target)
+    inline void transaction_manager::journal_move(const boost::filesystem::path& source, const boost::filesystem::path& target)
       {
         if(this->committed) throw runtime_exception(exception_type::TRANSACTION_ERROR, CPPTRANSPORT_TRANSACTION_COMMITTED);
         if(this->dead)      throw runtime_exception(exception_type::TRANSACTION_ERROR, CPPTRANSPORT_TRANSACTION_DEAD);
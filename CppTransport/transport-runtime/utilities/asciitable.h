@@ -280,7 +280,7 @@ namespace transport
       // IMPLEMENTATION -- CLASS asciitable
 
 
-    void asciitable::write(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
+    inline void asciitable::write(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
                            const std::string tag, asciitable_format format)
       {
         // determine which layout engine to use
@@ -307,7 +307,7 @@ namespace transport
       }
 
 
-    void asciitable::write_justified(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
+    inline void asciitable::write_justified(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
                                      const std::string tag)
       {
         assert(columns.size() == table.size());
@@ -394,7 +394,7 @@ namespace transport
       }
 
 
-    void asciitable::write_csv(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
+    inline void asciitable::write_csv(std::vector<column_descriptor>& columns, const std::vector< std::vector<std::string> >& table,
                                const std::string tag, const std::string separator)
       {
         assert(columns.size() == table.size());
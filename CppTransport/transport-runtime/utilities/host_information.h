@@ -212,7 +212,7 @@ namespace transport
 	    };
 
 
-		cpu_vendor_id::cpu_vendor_id()
+		inline cpu_vendor_id::cpu_vendor_id()
 			{
 				constexpr unsigned int level = 0;
 				unsigned int eax = 0;
@@ -223,7 +223,7 @@ namespace transport
 			}
     
     
-    cpu_brand_string::cpu_brand_string()
+    inline cpu_brand_string::cpu_brand_string()
       {
         // check whether brand string is supported
         constexpr unsigned int getCode = 0x80000000;
@@ -269,7 +269,7 @@ namespace transport
       }
 
 
-		host_information::host_information()
+		inline host_information::host_information()
 			{
 		    // get MPI to report the local host name
 		    char p_name[MPI_MAX_PROCESSOR_NAME];
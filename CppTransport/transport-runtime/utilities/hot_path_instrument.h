@@ -0,0 +1,559 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_HOT_PATH_INSTRUMENT_H
+#define CPPTRANSPORT_HOT_PATH_INSTRUMENT_H
+
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+
+#include "transport-runtime/defaults.h"
+#include "transport-runtime/utilities/formatter.h"
+
+#include "boost/timer/timer.hpp"
+
+
+// use the CPU timestamp counter where one is available, unless asked not to;
+// otherwise fall back to std::chrono::steady_clock
+#if !defined(CPPTRANSPORT_NO_TSC) && (defined(__x86_64__) || defined(__i386__))
+  #define CPPTRANSPORT_HOT_PATH_TSC
+  #include <x86intrin.h>
+#endif
+
+
+namespace transport
+  {
+
+    namespace hot_path
+      {
+
+        // Hot-path instrumentation is designed to be cheap enough to leave enabled for production runs.
+        // Rather than timing every RHS evaluation with a boost::timer::cpu_timer (which costs several system calls
+        // per phase, and distorts the very thing being measured), we read a cycle counter for one evaluation in every
+        // sample period, and accumulate the results in log-linear histograms.
+        // Each integration_profile belongs to a single k-configuration, and is only ever touched by the thread
+        // performing that integration, so the hot path needs no synchronization.
+        // Profiles are merged into a shared profile_accumulator only once an integration is complete
+
+
+        //! raw clock reading
+        typedef std::uint64_t tick_type;
+
+
+        //! read the hot-path clock
+        inline tick_type read_clock()
+          {
+#ifdef CPPTRANSPORT_HOT_PATH_TSC
+            return static_cast<tick_type>(__rdtsc());
+#else
+            return static_cast<tick_type>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+          }
+
+
+        //! conversion factor from clock ticks to nanoseconds; the timestamp counter is calibrated
+        //! against steady_clock the first time this function is called
+        inline double ns_per_tick()
+          {
+#ifdef CPPTRANSPORT_HOT_PATH_TSC
+            static const double factor = []() -> double
+              {
+                const auto wall_start = std::chrono::steady_clock::now();
+                const tick_type tick_start = read_clock();
+
+                auto wall_now = wall_start;
+                while(std::chrono::duration_cast<std::chrono::microseconds>(wall_now - wall_start).count() < CPPTRANSPORT_DEFAULT_INSTRUMENT_CALIBRATION)
+                  {
+                    wall_now = std::chrono::steady_clock::now();
+                  }
+
+                const tick_type tick_end = read_clock();
+                const double ns = std::chrono::duration<double, std::nano>(wall_now - wall_start).count();
+
+                return tick_end > tick_start ? ns / static_cast<double>(tick_end - tick_start) : 1.0;
+              }();
+
+            return factor;
+#else
+            return 1.0;
+#endif
+          }
+
+
+        //! log-linear histogram: each power of 2 is divided into a fixed number of linearly-spaced sub-buckets,
+        //! so the relative resolution is the same at every scale and recording a value costs only a frexp()
+        //! and an increment
+        class log_linear_histogram
+          {
+
+          public:
+
+            //! number of linear sub-buckets per octave
+            constexpr static unsigned int sub_buckets = 8;
+
+            //! smallest resolved exponent; smaller values are accumulated in the lowest bucket
+            constexpr static int min_exponent = -48;
+
+            //! largest resolved exponent; larger values are accumulated in the highest bucket
+            constexpr static int max_exponent = 48;
+
+            //! total number of buckets
+            constexpr static unsigned int num_buckets = (max_exponent - min_exponent) * sub_buckets;
+
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor produces an empty histogram
+            log_linear_histogram()
+              : count(0),
+                sum(0.0),
+                min(std::numeric_limits<double>::max()),
+                max(0.0)
+              {
+                this->counts.fill(0);
+              }
+
+            //! destructor is default
+            ~log_linear_histogram() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! record a value
+            void record(double v)
+              {
+                ++this->counts[bucket(v)];
+                ++this->count;
+                this->sum += v;
+                if(v < this->min) this->min = v;
+                if(v > this->max) this->max = v;
+              }
+
+            //! merge another histogram into this one
+            void merge(const log_linear_histogram& h)
+              {
+                for(unsigned int i = 0; i < num_buckets; ++i) this->counts[i] += h.counts[i];
+                this->count += h.count;
+                this->sum += h.sum;
+                if(h.min < this->min) this->min = h.min;
+                if(h.max > this->max) this->max = h.max;
+              }
+
+            //! get number of recorded values
+            std::uint64_t get_count() const { return this->count; }
+
+            //! get smallest recorded value
+            double get_min() const { return this->count > 0 ? this->min : 0.0; }
+
+            //! get largest recorded value
+            double get_max() const { return this->max; }
+
+            //! get mean of recorded values
+            double mean() const { return this->count > 0 ? this->sum / static_cast<double>(this->count) : 0.0; }
+
+            //! estimate a quantile 0 <= q <= 1; the result is the midpoint of the bucket containing the quantile,
+            //! clamped to the range of recorded values
+            double quantile(double q) const
+              {
+                if(this->count == 0) return 0.0;
+
+                const double target = q * static_cast<double>(this->count);
+
+                std::uint64_t cumulative = 0;
+                for(unsigned int i = 0; i < num_buckets; ++i)
+                  {
+                    cumulative += this->counts[i];
+                    if(this->counts[i] > 0 && static_cast<double>(cumulative) >= target)
+                      {
+                        double v = 0.5 * (lower_edge(i) + lower_edge(i+1));
+                        if(v < this->min) v = this->min;
+                        if(v > this->max) v = this->max;
+                        return v;
+                      }
+                  }
+
+                return this->max;
+              }
+
+
+            // INTERNAL API
+
+          protected:
+
+            //! compute bucket for a value
+            static unsigned int bucket(double v)
+              {
+                if(!(v > 0.0)) return 0;
+
+                // v = m * 2^e with 0.5 <= m < 1, so v lies in the octave [2^(e-1), 2^e)
+                int e;
+                const double m = std::frexp(v, &e);
+
+                const int octave = e - 1 - min_exponent;
+                if(octave < 0) return 0;
+                if(octave >= max_exponent - min_exponent) return num_buckets - 1;
+
+                unsigned int sub = static_cast<unsigned int>((m - 0.5) * 2.0 * sub_buckets);
+                if(sub >= sub_buckets) sub = sub_buckets - 1;
+
+                return static_cast<unsigned int>(octave) * sub_buckets + sub;
+              }
+
+            //! compute lower edge of a bucket
+            static double lower_edge(unsigned int b)
+              {
+                const unsigned int octave = b / sub_buckets;
+                const unsigned int sub = b % sub_buckets;
+
+                return std::ldexp(1.0 + static_cast<double>(sub) / static_cast<double>(sub_buckets),
+                                  static_cast<int>(octave) + min_exponent);
+              }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! bucket counts
+            std::array<std::uint64_t, num_buckets> counts;
+
+            //! total number of recorded values
+            std::uint64_t count;
+
+            //! sum of recorded values
+            double sum;
+
+            //! smallest recorded value
+            double min;
+
+            //! largest recorded value
+            double max;
+
+          };
+
+
+        //! summary of the hot-path profile for a single k-configuration, in the form
+        //! stored in the per-configuration statistics table
+        class profile_summary
+          {
+
+          public:
+
+            //! is this summary populated? false if the integration was not instrumented
+            bool available = false;
+
+            //! number of RHS evaluations
+            std::uint64_t evaluations = 0;
+
+            //! mean time spent in setup per sampled RHS evaluation, in nanoseconds
+            double setup = 0.0;
+
+            //! mean time spent computing u-tensors per sampled RHS evaluation, in nanoseconds
+            double u_tensor = 0.0;
+
+            //! mean time spent evaluating transport equations per sampled RHS evaluation, in nanoseconds
+            double transport = 0.0;
+
+            //! median RHS evaluation time, in nanoseconds
+            double rhs_median = 0.0;
+
+            //! 99th percentile RHS evaluation time, in nanoseconds
+            double rhs_p99 = 0.0;
+
+            //! median integration advance per RHS evaluation, in e-folds; multiply by the number of stages
+            //! per step to estimate the typical step size
+            double step_median = 0.0;
+
+            //! median observer latency, in nanoseconds
+            double observer_median = 0.0;
+
+            //! 99th percentile observer latency, in nanoseconds
+            double observer_p99 = 0.0;
+
+          };
+
+
+        //! hot-path profile for the integration of a single k-configuration
+        class integration_profile
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor; the sample period is rounded down to a power of 2
+            integration_profile(unsigned int period = CPPTRANSPORT_DEFAULT_INSTRUMENT_SAMPLE_PERIOD)
+              : sample_mask(0),
+                evaluations(0),
+                have_observation(false),
+                last_observation_time(0.0),
+                last_observation_evaluations(0)
+              {
+                while(period > 1)
+                  {
+                    this->sample_mask = (this->sample_mask << 1) | 1;
+                    period >>= 1;
+                  }
+              }
+
+            //! destructor is default
+            ~integration_profile() = default;
+
+
+            // RHS EVALUATIONS
+
+          public:
+
+            //! count an RHS evaluation; returns true if this evaluation should be timed
+            bool sample_rhs() { return (++this->evaluations & this->sample_mask) == 0; }
+
+            //! record phase timings for a sampled RHS evaluation
+            void record_rhs(tick_type setup_start, tick_type u_tensor_start, tick_type transport_start, tick_type end)
+              {
+                this->setup.record(static_cast<double>(u_tensor_start - setup_start));
+                this->u_tensor.record(static_cast<double>(transport_start - u_tensor_start));
+                this->transport.record(static_cast<double>(end - transport_start));
+                this->rhs.record(static_cast<double>(end - setup_start));
+              }
+
+
+            // OBSERVATIONS
+
+          public:
+
+            //! begin timing an observation
+            tick_type begin_observation() const { return read_clock(); }
+
+            //! end timing an observation at integration time t; also records the mean integration advance
+            //! per RHS evaluation since the previous observation
+            void end_observation(tick_type start, double t)
+              {
+                this->observer.record(static_cast<double>(read_clock() - start));
+
+                if(this->have_observation && t > this->last_observation_time && this->evaluations > this->last_observation_evaluations)
+                  {
+                    this->step.record((t - this->last_observation_time) / static_cast<double>(this->evaluations - this->last_observation_evaluations));
+                  }
+
+                this->have_observation = true;
+                this->last_observation_time = t;
+                this->last_observation_evaluations = this->evaluations;
+              }
+
+
+            // SUMMARY
+
+          public:
+
+            //! summarize, converting clock ticks to nanoseconds
+            profile_summary summarize() const
+              {
+                const double f = ns_per_tick();
+
+                profile_summary s;
+                s.available       = true;
+                s.evaluations     = this->evaluations;
+                s.setup           = f * this->setup.mean();
+                s.u_tensor        = f * this->u_tensor.mean();
+                s.transport       = f * this->transport.mean();
+                s.rhs_median      = f * this->rhs.quantile(0.5);
+                s.rhs_p99         = f * this->rhs.quantile(0.99);
+                s.step_median     = this->step.quantile(0.5);
+                s.observer_median = f * this->observer.quantile(0.5);
+                s.observer_p99    = f * this->observer.quantile(0.99);
+
+                return s;
+              }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! mask applied to the evaluation counter to decide whether an evaluation is sampled
+            std::uint64_t sample_mask;
+
+            //! number of RHS evaluations
+            std::uint64_t evaluations;
+
+
+            // HISTOGRAMS -- times are held in clock ticks
+
+            //! setup phase
+            log_linear_histogram setup;
+
+            //! u-tensor phase
+            log_linear_histogram u_tensor;
+
+            //! transport equation phase
+            log_linear_histogram transport;
+
+            //! total RHS evaluation
+            log_linear_histogram rhs;
+
+            //! integration advance per RHS evaluation
+            log_linear_histogram step;
+
+            //! observer latency
+            log_linear_histogram observer;
+
+
+            // OBSERVATION TRACKING
+
+            //! has an observation been made?
+            bool have_observation;
+
+            //! integration time at last observation
+            double last_observation_time;
+
+            //! evaluation count at last observation
+            std::uint64_t last_observation_evaluations;
+
+
+            friend class profile_accumulator;
+
+          };
+
+
+        //! accumulate profiles from many k-configurations, possibly from many threads
+        class profile_accumulator
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor
+            profile_accumulator()
+              : configurations(0),
+                evaluations(0)
+              {
+              }
+
+            //! destructor is default
+            ~profile_accumulator() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! merge a completed profile
+            void merge(const integration_profile& p)
+              {
+                std::lock_guard<std::mutex> lock(this->mtx);
+
+                ++this->configurations;
+                this->evaluations += p.evaluations;
+
+                this->setup.merge(p.setup);
+                this->u_tensor.merge(p.u_tensor);
+                this->transport.merge(p.transport);
+                this->rhs.merge(p.rhs);
+                this->step.merge(p.step);
+                this->observer.merge(p.observer);
+              }
+
+            //! get number of merged configurations
+            unsigned int get_configurations() const { return this->configurations; }
+
+            //! write report
+            void write(std::ostream& out, const std::string& label) const
+              {
+                std::lock_guard<std::mutex> lock(this->mtx);
+
+                const double f = ns_per_tick();
+
+                auto ns = [&](double v) -> std::string { return format_time(static_cast<boost::timer::nanosecond_type>(f*v)); };
+
+                auto line = [&](const std::string& name, const log_linear_histogram& h) -> void
+                  {
+                    out << "  -- " << name << ": "
+                        << "mean " << ns(h.mean()) << ", "
+                        << "median " << ns(h.quantile(0.5)) << ", "
+                        << "99% " << ns(h.quantile(0.99)) << ", "
+                        << "max " << ns(h.get_max()) << '\n';
+                  };
+
+                out << '\n' << label << " INSTRUMENTATION REPORT" << '\n';
+                out << "* " << this->configurations << " configurations, " << this->evaluations << " RHS evaluations ("
+                    << this->rhs.get_count() << " sampled)" << '\n';
+                out << "* PER SAMPLED INVOKATION" << '\n';
+                line("setup", this->setup);
+                line("U tensors", this->u_tensor);
+                line("transport equations", this->transport);
+                line("total", this->rhs);
+                out << "* PER OBSERVATION" << '\n';
+                line("observer", this->observer);
+                out << "* INTEGRATION ADVANCE PER RHS EVALUATION" << '\n';
+                out << "  -- median " << this->step.quantile(0.5) << ", "
+                    << "min " << this->step.get_min() << ", "
+                    << "max " << this->step.get_max() << " e-folds" << '\n';
+              }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! mutex protecting merges
+            mutable std::mutex mtx;
+
+            //! number of merged configurations
+            unsigned int configurations;
+
+            //! total number of RHS evaluations
+            std::uint64_t evaluations;
+
+
+            // HISTOGRAMS
+
+            log_linear_histogram setup;
+            log_linear_histogram u_tensor;
+            log_linear_histogram transport;
+            log_linear_histogram rhs;
+            log_linear_histogram step;
+            log_linear_histogram observer;
+
+          };
+
+      }   // namespace hot_path
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_HOT_PATH_INSTRUMENT_H
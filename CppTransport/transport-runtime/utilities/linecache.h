@@ -32,6 +32,8 @@
 #include <sstream>
 #include <string>
 #include <list>
+#include <memory>
+#include <utility>
 #include <stdexcept>
 
 #include "transport-runtime/messages.h"
@@ -57,6 +59,18 @@ namespace transport
         // template function, which must be specialized later, used to obtain the number of elements in a container
         template <typename Container> unsigned int elementsof_container(const Container& c);
 
+				//! 'line_puller' fetches the data for a cache line on a miss. Its 'siblings' argument allows a tag to
+				//! return further lines which were obtained by the same database operation, so that they can be
+				//! entered into the cache together. The default pulls a single line; tag families which support
+				//! bulk pulls can specialize it later
+				template <typename DataContainer, typename DataTag, typename QueryObject>
+				struct line_puller
+					{
+						typedef std::list< std::pair< std::unique_ptr<DataTag>, DataContainer > > sibling_list;
+
+						static void pull(DataTag& tag, QueryObject& query, DataContainer& data, sibling_list& siblings) { tag.pull(query, data); }
+					};
+
 				// forward declare constituent classes
 				template <typename DataContainer, typename DataTag, typename QueryObject, unsigned int HashSize>
 				class table;
@@ -650,7 +664,8 @@ namespace transport
 						if((t = std::find(this->cache[hash].begin(), this->cache[hash].end(), tag)) == this->cache[hash].end())     // data item doesn't already exist
 							{
 								DataContainer data;
-						    tag.pull(*this->query, data);
+						    typename line_puller<DataContainer, DataTag, QueryObject>::sibling_list siblings;
+						    line_puller<DataContainer, DataTag, QueryObject>::pull(tag, *this->query, data, siblings);
 
 								this->cache[hash].push_front( data_item(data, tag, &(this->cache[hash])
 #ifdef CPPTRANSPORT_LINECACHE_DEBUG
@@ -664,6 +679,27 @@ namespace transport
 								// default -- until we explicitly unlock it below
 								this->parent_cache->advise_size_increase((*t).get_size());
 
+								// enter any sibling lines which arrived with this one; each is locked only until its
+								// size has been accounted for, so later siblings may evict earlier ones if space is short
+								for(typename line_puller<DataContainer, DataTag, QueryObject>::sibling_list::iterator u = siblings.begin(); u != siblings.end(); ++u)
+									{
+								    DataTag& sibling_tag = *(u->first);
+								    unsigned int sibling_hash = sibling_tag.hash();
+								    assert(sibling_hash < HashSize);
+
+								    if(std::find(this->cache[sibling_hash].begin(), this->cache[sibling_hash].end(), sibling_tag) == this->cache[sibling_hash].end())
+									    {
+								        this->cache[sibling_hash].push_front( data_item(u->second, sibling_tag, &(this->cache[sibling_hash])
+#ifdef CPPTRANSPORT_LINECACHE_DEBUG
+									        , this->table_name
+#endif
+								        ) );
+								        typename std::list<data_item>::iterator v = this->cache[sibling_hash].begin();
+								        this->parent_cache->advise_size_increase((*v).get_size());
+								        (*v).unlock();
+									    }
+									}
+
 #ifdef CPPTRANSPORT_LINECACHE_DEBUG
 								std::ostringstream msg;
 								msg << "@@ Cache table '" << this->table_name << "': loaded cache line '" << tag.name() << "' of size " << format_memory((*t).get_size()) << ". Cache size now " << format_memory(this->parent_cache->get_size()) << " (capacity " << format_memory(this->parent_cache->get_capacity()) << ")";
@@ -31,7 +31,7 @@
 #define CPPTRANSPORT_MATCH_H
 
 
-bool check_match(std::string s, std::string e, bool exact=false)
+inline bool check_match(std::string s, std::string e, bool exact=false)
   {
     // check for regular expression syntax
     if(!e.empty() && e.front() == '{' && e.back() == '}')
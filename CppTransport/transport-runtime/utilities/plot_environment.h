@@ -75,7 +75,7 @@ namespace transport
       };
 
 
-    void plot_environment::write_environment(std::ofstream& outf)
+    inline void plot_environment::write_environment(std::ofstream& outf)
       {
         if(!env.has_python()) return;
         if(!env.has_matplotlib()) return;
@@ -0,0 +1,642 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+
+#ifndef CPPTRANSPORT_TAYLOR_JET_H
+#define CPPTRANSPORT_TAYLOR_JET_H
+
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <algorithm>
+#include <utility>
+
+
+namespace transport
+  {
+
+    //! forward-mode automatic differentiation.
+    //! Code generated by the translator in --autodiff mode calls elementary functions through this namespace,
+    //! so the same expression can be evaluated with ordinary numbers or with taylor_jet objects
+    namespace ad
+      {
+
+        namespace taylor_jet_impl
+          {
+
+            //! packed index of the symmetric pair (i,j) with i <= j
+            constexpr unsigned int pair(unsigned int i, unsigned int j)
+              {
+                return (j*(j+1))/2 + i;
+              }
+
+
+            //! packed index of the symmetric triple (i,j,k) with i <= j <= k
+            constexpr unsigned int triple(unsigned int i, unsigned int j, unsigned int k)
+              {
+                return (k*(k+1)*(k+2))/6 + (j*(j+1))/2 + i;
+              }
+
+
+            //! compute the polygamma functions psi_0(x), psi_1(x), psi_2(x), needed to differentiate
+            //! tgamma and lgamma.
+            //! Uses the recurrence psi_n(x) = psi_n(x+1) - (-1)^n n!/x^(n+1) to shift x into the region where
+            //! the asymptotic series is accurate
+            template <typename number>
+            void polygamma(number x, number& psi0, number& psi1, number& psi2)
+              {
+                psi0 = psi1 = psi2 = number(0);
+
+                while(x < number(10))
+                  {
+                    const number r = number(1)/x;
+                    psi0 -= r;
+                    psi1 += r*r;
+                    psi2 -= 2*r*r*r;
+                    x += number(1);
+                  }
+
+                const number r = number(1)/x;
+                const number r2 = r*r;
+
+                psi0 += std::log(x) - r/2 - r2*(number(1)/12 - r2*(number(1)/120 - r2*(number(1)/252 - r2*(number(1)/240 - r2/132))));
+                psi1 += r + r2/2 + r*r2*(number(1)/6 - r2*(number(1)/30 - r2*(number(1)/42 - r2*(number(1)/30 - r2*5/66))));
+                psi2 -= r2 + r*r2 + r2*r2*(number(1)/2 - r2*(number(1)/6 - r2*(number(1)/6 - r2*(number(3)/10 - r2*5/6))));
+              }
+
+          }   // namespace taylor_jet_impl
+
+
+        //! truncated multivariate Taylor series in N variables, carrying the value of an expression together with
+        //! all its partial derivatives up to order Order (at most 3).
+        //! Mixed partial derivatives are symmetric, so only the components with ordered indices are stored
+        template <typename number, unsigned int N, unsigned int Order>
+        class taylor_jet
+          {
+
+            static_assert(Order >= 1 && Order <= 3, "taylor_jet supports derivatives of order 1, 2 or 3");
+
+          public:
+
+            using value_type = number;
+
+            //! number of stored second derivatives
+            static constexpr unsigned int pairs = Order >= 2 ? (N*(N+1))/2 : 0;
+
+            //! number of stored third derivatives
+            static constexpr unsigned int triples = Order >= 3 ? (N*(N+1)*(N+2))/6 : 0;
+
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! construct a constant; derivatives are all zero
+            taylor_jet(number v = number(0))
+              : val(v)
+              {
+                d1.fill(number(0));
+                d2.fill(number(0));
+                d3.fill(number(0));
+              }
+
+            //! destructor is default
+            ~taylor_jet() = default;
+
+
+            //! construct the i-th independent variable, with value v
+            static taylor_jet variable(number v, unsigned int i)
+              {
+                taylor_jet r(v);
+                r.d1[i] = number(1);
+                return r;
+              }
+
+
+            // ACCESSORS
+
+          public:
+
+            //! value
+            number value() const { return this->val; }
+
+            //! first derivative
+            number derivative(unsigned int i) const { return this->d1[i]; }
+
+            //! second derivative; zero if not carried
+            number derivative(unsigned int i, unsigned int j) const
+              {
+                if(Order < 2) return number(0);
+
+                if(i > j) std::swap(i, j);
+                return this->d2[taylor_jet_impl::pair(i, j)];
+              }
+
+            //! third derivative; zero if not carried
+            number derivative(unsigned int i, unsigned int j, unsigned int k) const
+              {
+                if(Order < 3) return number(0);
+
+                if(i > j) std::swap(i, j);
+                if(j > k) std::swap(j, k);
+                if(i > j) std::swap(i, j);
+                return this->d3[taylor_jet_impl::triple(i, j, k)];
+              }
+
+
+            // COMPOSITION
+
+          public:
+
+            //! compose with a function f of one variable, given f and its first three derivatives
+            //! evaluated at the current value
+            taylor_jet compose(number f0, number f1, number f2, number f3) const
+              {
+                using taylor_jet_impl::pair;
+                using taylor_jet_impl::triple;
+
+                taylor_jet r(f0);
+
+                for(unsigned int i = 0; i < N; ++i)
+                  {
+                    r.d1[i] = f1*this->d1[i];
+                  }
+
+                if(Order >= 2)
+                  {
+                    for(unsigned int j = 0; j < N; ++j)
+                      {
+                        for(unsigned int i = 0; i <= j; ++i)
+                          {
+                            r.d2[pair(i,j)] = f2*this->d1[i]*this->d1[j] + f1*this->d2[pair(i,j)];
+                          }
+                      }
+                  }
+
+                if(Order >= 3)
+                  {
+                    for(unsigned int k = 0; k < N; ++k)
+                      {
+                        for(unsigned int j = 0; j <= k; ++j)
+                          {
+                            for(unsigned int i = 0; i <= j; ++i)
+                              {
+                                r.d3[triple(i,j,k)] = f3*this->d1[i]*this->d1[j]*this->d1[k]
+                                                      + f2*(this->d2[pair(i,j)]*this->d1[k]
+                                                            + this->d2[pair(i,k)]*this->d1[j]
+                                                            + this->d2[pair(j,k)]*this->d1[i])
+                                                      + f1*this->d3[triple(i,j,k)];
+                              }
+                          }
+                      }
+                  }
+
+                return r;
+              }
+
+
+            //! reciprocal 1/x
+            taylor_jet reciprocal() const
+              {
+                const number r = number(1)/this->val;
+                return this->compose(r, -r*r, 2*r*r*r, -6*r*r*r*r);
+              }
+
+
+            // ARITHMETIC
+
+          public:
+
+            taylor_jet operator-() const
+              {
+                taylor_jet r(*this);
+                r.scale(number(-1));
+                return r;
+              }
+
+            taylor_jet& operator+=(const taylor_jet& b)
+              {
+                this->val += b.val;
+                for(unsigned int i = 0; i < N; ++i)       this->d1[i] += b.d1[i];
+                for(unsigned int i = 0; i < pairs; ++i)   this->d2[i] += b.d2[i];
+                for(unsigned int i = 0; i < triples; ++i) this->d3[i] += b.d3[i];
+                return *this;
+              }
+
+            taylor_jet& operator-=(const taylor_jet& b)
+              {
+                this->val -= b.val;
+                for(unsigned int i = 0; i < N; ++i)       this->d1[i] -= b.d1[i];
+                for(unsigned int i = 0; i < pairs; ++i)   this->d2[i] -= b.d2[i];
+                for(unsigned int i = 0; i < triples; ++i) this->d3[i] -= b.d3[i];
+                return *this;
+              }
+
+            taylor_jet& operator*=(const taylor_jet& b) { *this = multiply(*this, b); return *this; }
+            taylor_jet& operator/=(const taylor_jet& b) { *this = multiply(*this, b.reciprocal()); return *this; }
+
+            taylor_jet& operator+=(number b) { this->val += b; return *this; }
+            taylor_jet& operator-=(number b) { this->val -= b; return *this; }
+            taylor_jet& operator*=(number b) { this->scale(b); return *this; }
+            taylor_jet& operator/=(number b) { this->scale(number(1)/b); return *this; }
+
+            friend taylor_jet operator+(taylor_jet a, const taylor_jet& b) { a += b; return a; }
+            friend taylor_jet operator-(taylor_jet a, const taylor_jet& b) { a -= b; return a; }
+            friend taylor_jet operator*(const taylor_jet& a, const taylor_jet& b) { return multiply(a, b); }
+            friend taylor_jet operator/(const taylor_jet& a, const taylor_jet& b) { return multiply(a, b.reciprocal()); }
+
+            friend taylor_jet operator+(taylor_jet a, number b) { a += b; return a; }
+            friend taylor_jet operator-(taylor_jet a, number b) { a -= b; return a; }
+            friend taylor_jet operator*(taylor_jet a, number b) { a.scale(b); return a; }
+            friend taylor_jet operator/(taylor_jet a, number b) { a.scale(number(1)/b); return a; }
+
+            friend taylor_jet operator+(number a, taylor_jet b) { b += a; return b; }
+            friend taylor_jet operator-(number a, taylor_jet b) { b.scale(number(-1)); b += a; return b; }
+            friend taylor_jet operator*(number a, taylor_jet b) { b.scale(a); return b; }
+            friend taylor_jet operator/(number a, const taylor_jet& b) { taylor_jet r = b.reciprocal(); r.scale(a); return r; }
+
+
+            // INTERNAL API
+
+          private:
+
+            //! multiply every component by a constant
+            void scale(number c)
+              {
+                this->val *= c;
+                for(unsigned int i = 0; i < N; ++i)       this->d1[i] *= c;
+                for(unsigned int i = 0; i < pairs; ++i)   this->d2[i] *= c;
+                for(unsigned int i = 0; i < triples; ++i) this->d3[i] *= c;
+              }
+
+            //! Leibniz rule for the product a*b
+            static taylor_jet multiply(const taylor_jet& a, const taylor_jet& b)
+              {
+                using taylor_jet_impl::pair;
+                using taylor_jet_impl::triple;
+
+                taylor_jet r(a.val*b.val);
+
+                for(unsigned int i = 0; i < N; ++i)
+                  {
+                    r.d1[i] = a.d1[i]*b.val + a.val*b.d1[i];
+                  }
+
+                if(Order >= 2)
+                  {
+                    for(unsigned int j = 0; j < N; ++j)
+                      {
+                        for(unsigned int i = 0; i <= j; ++i)
+                          {
+                            const unsigned int ij = pair(i,j);
+                            r.d2[ij] = a.d2[ij]*b.val + a.d1[i]*b.d1[j] + a.d1[j]*b.d1[i] + a.val*b.d2[ij];
+                          }
+                      }
+                  }
+
+                if(Order >= 3)
+                  {
+                    for(unsigned int k = 0; k < N; ++k)
+                      {
+                        for(unsigned int j = 0; j <= k; ++j)
+                          {
+                            for(unsigned int i = 0; i <= j; ++i)
+                              {
+                                const unsigned int ij = pair(i,j);
+                                const unsigned int ik = pair(i,k);
+                                const unsigned int jk = pair(j,k);
+                                const unsigned int ijk = triple(i,j,k);
+
+                                r.d3[ijk] = a.d3[ijk]*b.val + a.val*b.d3[ijk]
+                                            + a.d2[ij]*b.d1[k] + a.d2[ik]*b.d1[j] + a.d2[jk]*b.d1[i]
+                                            + a.d1[i]*b.d2[jk] + a.d1[j]*b.d2[ik] + a.d1[k]*b.d2[ij];
+                              }
+                          }
+                      }
+                  }
+
+                return r;
+              }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! value
+            number val;
+
+            //! first derivatives
+            std::array<number, N> d1;
+
+            //! second derivatives, packed with i <= j
+            std::array<number, pairs> d2;
+
+            //! third derivatives, packed with i <= j <= k
+            std::array<number, triples> d3;
+
+          };
+
+
+        // ELEMENTARY FUNCTIONS
+        // ordinary numbers are passed through to the standard library
+
+        using std::abs;
+        using std::sqrt;
+        using std::sin;
+        using std::cos;
+        using std::tan;
+        using std::asin;
+        using std::acos;
+        using std::atan;
+        using std::atan2;
+        using std::sinh;
+        using std::cosh;
+        using std::tanh;
+        using std::asinh;
+        using std::acosh;
+        using std::atanh;
+        using std::exp;
+        using std::log;
+        using std::pow;
+        using std::tgamma;
+        using std::lgamma;
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> abs(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number s = x < number(0) ? number(-1) : number(1);
+            return u.compose(std::abs(x), s, number(0), number(0));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> sqrt(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number s = std::sqrt(x);
+            const number r = number(1)/x;
+            return u.compose(s, s*r/2, -s*r*r/4, 3*s*r*r*r/8);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> sin(const taylor_jet<number, N, Order>& u)
+          {
+            const number s = std::sin(u.value());
+            const number c = std::cos(u.value());
+            return u.compose(s, c, -s, -c);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> cos(const taylor_jet<number, N, Order>& u)
+          {
+            const number s = std::sin(u.value());
+            const number c = std::cos(u.value());
+            return u.compose(c, -s, -c, s);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> tan(const taylor_jet<number, N, Order>& u)
+          {
+            const number t = std::tan(u.value());
+            const number sec2 = 1 + t*t;
+            return u.compose(t, sec2, 2*t*sec2, 2*sec2*(1 + 3*t*t));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> asin(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number q = 1/std::sqrt(1 - x*x);
+            const number q3 = q*q*q;
+            return u.compose(std::asin(x), q, x*q3, q3*(1 + 3*x*x*q*q));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> acos(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number q = 1/std::sqrt(1 - x*x);
+            const number q3 = q*q*q;
+            return u.compose(std::acos(x), -q, -x*q3, -q3*(1 + 3*x*x*q*q));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> atan(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number p = 1/(1 + x*x);
+            return u.compose(std::atan(x), p, -2*x*p*p, -2*p*p + 8*x*x*p*p*p);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> atan2(const taylor_jet<number, N, Order>& y, const taylor_jet<number, N, Order>& x)
+          {
+            // away from the branch cut atan2(y,x) differs from atan(y/x) or -atan(x/y) by a constant,
+            // so take the derivatives from whichever ratio is better conditioned
+            auto r = std::abs(x.value()) >= std::abs(y.value()) ? atan(y/x) : -atan(x/y);
+            return r + (std::atan2(y.value(), x.value()) - r.value());
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> atan2(const taylor_jet<number, N, Order>& y, typename taylor_jet<number, N, Order>::value_type x)
+          {
+            return atan2(y, taylor_jet<number, N, Order>(x));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> atan2(typename taylor_jet<number, N, Order>::value_type y, const taylor_jet<number, N, Order>& x)
+          {
+            return atan2(taylor_jet<number, N, Order>(y), x);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> sinh(const taylor_jet<number, N, Order>& u)
+          {
+            const number s = std::sinh(u.value());
+            const number c = std::cosh(u.value());
+            return u.compose(s, c, s, c);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> cosh(const taylor_jet<number, N, Order>& u)
+          {
+            const number s = std::sinh(u.value());
+            const number c = std::cosh(u.value());
+            return u.compose(c, s, c, s);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> tanh(const taylor_jet<number, N, Order>& u)
+          {
+            const number t = std::tanh(u.value());
+            const number sech2 = 1 - t*t;
+            return u.compose(t, sech2, -2*t*sech2, sech2*(6*t*t - 2));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> asinh(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number q = 1/std::sqrt(1 + x*x);
+            const number q3 = q*q*q;
+            return u.compose(std::asinh(x), q, -x*q3, q3*(3*x*x*q*q - 1));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> acosh(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number q = 1/std::sqrt(x*x - 1);
+            const number q3 = q*q*q;
+            return u.compose(std::acosh(x), q, -x*q3, q3*(3*x*x*q*q - 1));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> atanh(const taylor_jet<number, N, Order>& u)
+          {
+            const number x = u.value();
+            const number p = 1/(1 - x*x);
+            return u.compose(std::atanh(x), p, 2*x*p*p, 2*p*p + 8*x*x*p*p*p);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> exp(const taylor_jet<number, N, Order>& u)
+          {
+            const number e = std::exp(u.value());
+            return u.compose(e, e, e, e);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> log(const taylor_jet<number, N, Order>& u)
+          {
+            const number r = 1/u.value();
+            return u.compose(std::log(u.value()), r, -r*r, 2*r*r*r);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> pow(const taylor_jet<number, N, Order>& u, typename taylor_jet<number, N, Order>::value_type c)
+          {
+            // coefficients c(c-1)...(c-n+1) vanish for small integer exponents; skip these terms
+            // to avoid evaluating 0*inf when the base is zero
+            const number x = u.value();
+            const number c1 = c;
+            const number c2 = c1*(c - 1);
+            const number c3 = c2*(c - 2);
+
+            const number f1 = c1 != number(0) ? c1*std::pow(x, c - 1) : number(0);
+            const number f2 = c2 != number(0) ? c2*std::pow(x, c - 2) : number(0);
+            const number f3 = c3 != number(0) ? c3*std::pow(x, c - 3) : number(0);
+
+            return u.compose(std::pow(x, c), f1, f2, f3);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> pow(const taylor_jet<number, N, Order>& u, const taylor_jet<number, N, Order>& v)
+          {
+            return exp(v*log(u));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> pow(typename taylor_jet<number, N, Order>::value_type a, const taylor_jet<number, N, Order>& v)
+          {
+            return exp(v*std::log(a));
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> lgamma(const taylor_jet<number, N, Order>& u)
+          {
+            number psi0, psi1, psi2;
+            taylor_jet_impl::polygamma(u.value(), psi0, psi1, psi2);
+            return u.compose(std::lgamma(u.value()), psi0, psi1, psi2);
+          }
+
+
+        template <typename number, unsigned int N, unsigned int Order>
+        taylor_jet<number, N, Order> tgamma(const taylor_jet<number, N, Order>& u)
+          {
+            number psi0, psi1, psi2;
+            taylor_jet_impl::polygamma(u.value(), psi0, psi1, psi2);
+
+            const number g = std::tgamma(u.value());
+            return u.compose(g, g*psi0, g*(psi0*psi0 + psi1), g*(psi0*psi0*psi0 + 3*psi0*psi1 + psi2));
+          }
+
+
+        // CROSS-CHECKS
+
+
+        //! largest discrepancy between the components of a and b, relative to the largest component of the
+        //! reference b; if b vanishes identically the discrepancy is absolute
+        template <typename number, std::size_t S>
+        number relative_discrepancy(const std::array<number, S>& a, const std::array<number, S>& b)
+          {
+            number scale(0);
+            number diff(0);
+
+            for(std::size_t i = 0; i < S; ++i)
+              {
+                const number d = std::abs(a[i] - b[i]);
+
+                // a NaN or infinity must not be masked by the comparisons below
+                if(!std::isfinite(d)) return d;
+
+                scale = std::max(scale, static_cast<number>(std::abs(b[i])));
+                diff = std::max(diff, d);
+              }
+
+            return scale > number(0) ? diff/scale : diff;
+          }
+
+      }   // namespace ad
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_TAYLOR_JET_H
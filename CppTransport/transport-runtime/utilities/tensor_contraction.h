@@ -0,0 +1,428 @@
+//
+// Created by David Seery on 19/10/2026.
+// --@@
+// Copyright (c) 2026 University of Sussex. All rights reserved.
+//
+// This file is part of the CppTransport platform.
+//
+// CppTransport is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// CppTransport is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with CppTransport.  If not, see <http://www.gnu.org/licenses/>.
+//
+// @license: GPL-2
+// @contributor: David Seery <D.Seery@sussex.ac.uk>
+// --@@
+//
+
+#ifndef CPPTRANSPORT_TENSOR_CONTRACTION_H
+#define CPPTRANSPORT_TENSOR_CONTRACTION_H
+
+
+#include <vector>
+#include <algorithm>
+#include <assert.h>
+
+#include "transport-runtime/defaults.h"
+
+
+// ask the compiler to vectorize an inner loop over time samples, asserting that the operands do not alias
+#if defined(__INTEL_COMPILER)
+  #define CPPTRANSPORT_VECTORIZE_LOOP _Pragma("ivdep")
+#elif defined(__clang__)
+  #define CPPTRANSPORT_VECTORIZE_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+  #define CPPTRANSPORT_VECTORIZE_LOOP _Pragma("GCC ivdep")
+#else
+  #define CPPTRANSPORT_VECTORIZE_LOOP
+#endif
+
+
+namespace transport
+  {
+
+    namespace contraction
+      {
+
+        //! read-only view onto a component-major block: each row holds one tensor component,
+        //! and each column holds one sample (typically a time sample).
+        //! Rows are contiguous, so loops over samples stream through memory
+        template <typename number>
+        class component_view
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! construct from raw storage
+            component_view(const number* d, unsigned int r, unsigned int c, unsigned int s)
+              : data(d),
+                N_rows(r),
+                N_columns(c),
+                stride(s)
+              {
+              }
+
+            //! construct from a flat vector holding r contiguous rows; a vector holding one value per
+            //! component is a valid single-column view
+            component_view(const std::vector<number>& v, unsigned int r)
+              : data(v.data()),
+                N_rows(r),
+                N_columns(r > 0 ? static_cast<unsigned int>(v.size()) / r : 0),
+                stride(N_columns)
+              {
+                assert(static_cast<size_t>(N_rows)*N_columns == v.size());
+              }
+
+            //! destructor is default
+            ~component_view() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! get number of rows (components)
+            unsigned int rows() const { return this->N_rows; }
+
+            //! get number of columns (samples)
+            unsigned int columns() const { return this->N_columns; }
+
+            //! get pointer to start of a row
+            const number* row(unsigned int r) const { return this->data + static_cast<size_t>(r)*this->stride; }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! pointer to first element
+            const number* data;
+
+            //! number of rows
+            unsigned int N_rows;
+
+            //! number of columns
+            unsigned int N_columns;
+
+            //! distance between the starts of successive rows
+            unsigned int stride;
+
+          };
+
+
+        //! owning component-major block
+        template <typename number>
+        class component_block
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor
+            component_block(unsigned int r=0, unsigned int c=0)
+              : N_rows(r),
+                N_columns(c),
+                data(static_cast<size_t>(r)*c)
+              {
+              }
+
+            //! destructor is default
+            ~component_block() = default;
+
+
+            // INTERFACE
+
+          public:
+
+            //! get number of rows (components)
+            unsigned int rows() const { return this->N_rows; }
+
+            //! get number of columns (samples)
+            unsigned int columns() const { return this->N_columns; }
+
+            //! resize; contents are unspecified afterwards
+            void resize(unsigned int r, unsigned int c)
+              {
+                this->N_rows = r;
+                this->N_columns = c;
+                this->data.resize(static_cast<size_t>(r)*c);
+              }
+
+            //! get pointer to start of a row
+            number* row(unsigned int r) { return this->data.data() + static_cast<size_t>(r)*this->N_columns; }
+
+            //! get pointer to start of a row (const version)
+            const number* row(unsigned int r) const { return this->data.data() + static_cast<size_t>(r)*this->N_columns; }
+
+            //! copy a line of samples into a row
+            void assign_row(unsigned int r, const std::vector<number>& line)
+              {
+                assert(line.size() == this->N_columns);
+                std::copy(line.begin(), line.end(), this->row(r));
+              }
+
+            //! fill from sample-major storage, ie. a vector indexed by sample whose elements are vectors of r components;
+            //! this is the layout in which the model's gauge transformation methods return their data
+            void assign_transposed(const std::vector< std::vector<number> >& samples, unsigned int r)
+              {
+                const unsigned int c = static_cast<unsigned int>(samples.size());
+                this->resize(r, c);
+
+                for(unsigned int j = 0; j < c; ++j)
+                  {
+                    assert(samples[j].size() == r);
+                    for(unsigned int i = 0; i < r; ++i)
+                      {
+                        this->data[static_cast<size_t>(i)*c + j] = samples[j][i];
+                      }
+                  }
+              }
+
+            //! convert to a read-only view
+            operator component_view<number>() const
+              {
+                return component_view<number>(this->data.data(), this->N_rows, this->N_columns, this->N_columns);
+              }
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! number of rows
+            unsigned int N_rows;
+
+            //! number of columns
+            unsigned int N_columns;
+
+            //! storage, row-major
+            std::vector<number> data;
+
+          };
+
+
+        //! contraction_engine evaluates the index contractions needed to build zeta correlation functions
+        //! and fNL inner products from component-major blocks.
+        //! Each contraction is evaluated for all samples at once: the sample axis is processed in tiles
+        //! so that the working set for one tile stays in cache while the component loops run over it,
+        //! and the innermost loop is always a unit-stride loop over samples which the compiler can vectorize
+        template <typename number>
+        class contraction_engine
+          {
+
+            // CONSTRUCTOR, DESTRUCTOR
+
+          public:
+
+            //! constructor
+            contraction_engine(unsigned int t=CPPTRANSPORT_DEFAULT_CONTRACTION_TILE)
+              : tile(std::max(t, 1u)),
+                scratch(tile)
+              {
+              }
+
+            //! destructor is default
+            ~contraction_engine() = default;
+
+
+            // CONTRACTIONS
+
+          public:
+
+            //! contract the trailing index of a rank-2 tensor T with a vector W,
+            //! out_a = sum_b T_ab W_b, where the rows of T are indexed by a*W.rows() + b
+            void contract_trailing(const component_view<number>& T, const component_view<number>& W, component_block<number>& out);
+
+            //! full contraction of a vector A with a vector W, accumulated into out:
+            //! out += s * sum_a A_a W_a
+            void contract_vector(const component_view<number>& A, const component_view<number>& W, number s, number* out);
+
+            //! full contraction of a rank-2 tensor X with two vectors, accumulated into out:
+            //! out += s * sum_ab X_ab U_a V_b, where the rows of X are indexed by a*V.rows() + b
+            void contract_bilinear(const component_view<number>& X, const component_view<number>& U, const component_view<number>& V,
+                                   number s, number* out);
+
+            //! weighted sum of products over rows, accumulated into out:
+            //! out += sum_r w_r A_r B_r
+            void contract_weighted(const component_view<number>& A, const component_view<number>& B, const std::vector<number>& w,
+                                   number* out);
+
+
+            // INTERNAL DATA
+
+          private:
+
+            //! number of samples per tile
+            unsigned int tile;
+
+            //! scratch space for one tile
+            std::vector<number> scratch;
+
+          };
+
+
+        namespace contraction_impl
+          {
+
+            //! acc += x*y, elementwise
+            template <typename number>
+            inline void multiply_accumulate(number* acc, const number* x, const number* y, unsigned int n)
+              {
+                CPPTRANSPORT_VECTORIZE_LOOP
+                for(unsigned int j = 0; j < n; ++j)
+                  {
+                    acc[j] += x[j]*y[j];
+                  }
+              }
+
+
+            //! acc += s*x*y, elementwise
+            template <typename number>
+            inline void scaled_multiply_accumulate(number* acc, number s, const number* x, const number* y, unsigned int n)
+              {
+                CPPTRANSPORT_VECTORIZE_LOOP
+                for(unsigned int j = 0; j < n; ++j)
+                  {
+                    acc[j] += s*x[j]*y[j];
+                  }
+              }
+
+
+            //! acc = x*y, elementwise
+            template <typename number>
+            inline void multiply(number* acc, const number* x, const number* y, unsigned int n)
+              {
+                CPPTRANSPORT_VECTORIZE_LOOP
+                for(unsigned int j = 0; j < n; ++j)
+                  {
+                    acc[j] = x[j]*y[j];
+                  }
+              }
+
+          }   // namespace contraction_impl
+
+
+        template <typename number>
+        void contraction_engine<number>::contract_trailing(const component_view<number>& T, const component_view<number>& W,
+                                                           component_block<number>& out)
+          {
+            const unsigned int inner = W.rows();
+            const unsigned int outer = inner > 0 ? T.rows() / inner : 0;
+            const unsigned int samples = T.columns();
+
+            assert(T.rows() == outer*inner);
+            assert(W.columns() == samples);
+
+            out.resize(outer, samples);
+
+            for(unsigned int j0 = 0; j0 < samples; j0 += this->tile)
+              {
+                const unsigned int n = std::min(this->tile, samples - j0);
+
+                for(unsigned int a = 0; a < outer; ++a)
+                  {
+                    number* acc = out.row(a) + j0;
+
+                    if(inner == 0) { std::fill(acc, acc+n, number(0)); continue; }
+
+                    contraction_impl::multiply(acc, T.row(a*inner) + j0, W.row(0) + j0, n);
+                    for(unsigned int b = 1; b < inner; ++b)
+                      {
+                        contraction_impl::multiply_accumulate(acc, T.row(a*inner + b) + j0, W.row(b) + j0, n);
+                      }
+                  }
+              }
+          }
+
+
+        template <typename number>
+        void contraction_engine<number>::contract_vector(const component_view<number>& A, const component_view<number>& W,
+                                                         number s, number* out)
+          {
+            const unsigned int samples = A.columns();
+
+            assert(A.rows() == W.rows());
+            assert(W.columns() == samples);
+
+            for(unsigned int j0 = 0; j0 < samples; j0 += this->tile)
+              {
+                const unsigned int n = std::min(this->tile, samples - j0);
+
+                for(unsigned int a = 0; a < A.rows(); ++a)
+                  {
+                    contraction_impl::scaled_multiply_accumulate(out + j0, s, A.row(a) + j0, W.row(a) + j0, n);
+                  }
+              }
+          }
+
+
+        template <typename number>
+        void contraction_engine<number>::contract_bilinear(const component_view<number>& X, const component_view<number>& U,
+                                                           const component_view<number>& V, number s, number* out)
+          {
+            const unsigned int inner = V.rows();
+            const unsigned int samples = X.columns();
+
+            assert(X.rows() == U.rows()*inner);
+            assert(U.columns() == samples);
+            assert(V.columns() == samples);
+
+            number* tmp = this->scratch.data();
+
+            for(unsigned int j0 = 0; j0 < samples; j0 += this->tile)
+              {
+                const unsigned int n = std::min(this->tile, samples - j0);
+
+                for(unsigned int a = 0; a < U.rows(); ++a)
+                  {
+                    // contract trailing index into the scratch tile, which stays resident in L1
+                    std::fill(tmp, tmp+n, number(0));
+                    for(unsigned int b = 0; b < inner; ++b)
+                      {
+                        contraction_impl::multiply_accumulate(tmp, X.row(a*inner + b) + j0, V.row(b) + j0, n);
+                      }
+
+                    contraction_impl::scaled_multiply_accumulate(out + j0, s, tmp, U.row(a) + j0, n);
+                  }
+              }
+          }
+
+
+        template <typename number>
+        void contraction_engine<number>::contract_weighted(const component_view<number>& A, const component_view<number>& B,
+                                                           const std::vector<number>& w, number* out)
+          {
+            const unsigned int samples = A.columns();
+
+            assert(A.rows() == B.rows());
+            assert(A.rows() <= w.size());
+            assert(B.columns() == samples);
+
+            for(unsigned int j0 = 0; j0 < samples; j0 += this->tile)
+              {
+                const unsigned int n = std::min(this->tile, samples - j0);
+
+                for(unsigned int r = 0; r < A.rows(); ++r)
+                  {
+                    contraction_impl::scaled_multiply_accumulate(out + j0, w[r], A.row(r) + j0, B.row(r) + j0, n);
+                  }
+              }
+          }
+
+      }   // namespace contraction
+
+  }   // namespace transport
+
+
+#endif //CPPTRANSPORT_TENSOR_CONTRACTION_H
@@ -36,8 +36,8 @@ namespace transport
     constexpr auto         CPPTRANSPORT_VERSION             = "2018.1";
     constexpr auto         CPPTRANSPORT_COPYRIGHT           = "(c) University of Sussex 2016-2018";
     
-    constexpr auto         CPPTRANSPORT_RUNTIME_API         = "runtime version 2018.1";
-    constexpr unsigned int CPPTRANSPORT_RUNTIME_API_VERSION = 201801;
+    constexpr auto         CPPTRANSPORT_RUNTIME_API         = "runtime version 2019.1";
+    constexpr unsigned int CPPTRANSPORT_RUNTIME_API_VERSION = 201901;
     
   }   // namespace transport
 